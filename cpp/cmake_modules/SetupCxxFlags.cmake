@@ -20,6 +20,18 @@
 include(CheckCXXCompilerFlag)
 # x86/amd64 compiler flags
 check_cxx_compiler_flag("-msse4.2" CXX_SUPPORTS_SSE4_2)
+if(MSVC)
+  set(ARROW_AVX2_FLAG "/arch:AVX2")
+  set(ARROW_AVX512_FLAG "/arch:AVX512")
+  # Carry-less multiplication intrinsics need no special flag
+  set(ARROW_CLMUL_FLAG "")
+else()
+  set(ARROW_AVX2_FLAG "-mavx2")
+  set(ARROW_AVX512_FLAG "-mavx512f -mavx512cd -mavx512vl -mavx512dq -mavx512bw")
+  set(ARROW_CLMUL_FLAG "-mpclmul")
+endif()
+check_cxx_compiler_flag(${ARROW_AVX2_FLAG} CXX_SUPPORTS_AVX2)
+check_cxx_compiler_flag(${ARROW_AVX512_FLAG} CXX_SUPPORTS_AVX512)
 # power compiler flags
 check_cxx_compiler_flag("-maltivec" CXX_SUPPORTS_ALTIVEC)
 # Arm64 compiler flags
@@ -270,6 +282,17 @@ if(CXX_SUPPORTS_SSE4_2 AND ARROW_SSE42)
   set(CXX_COMMON_FLAGS "${CXX_COMMON_FLAGS} -msse4.2")
 endif()
 
+# Kernels for these instruction sets are built in separate translation units,
+# with the flags above, and selected at runtime (see arrow/util/dispatch.h)
+if(CXX_SUPPORTS_AVX2 AND ARROW_RUNTIME_SIMD_LEVEL MATCHES "^(AVX2|AVX512|MAX)$")
+  set(ARROW_HAVE_RUNTIME_AVX2 ON)
+  add_definitions(-DARROW_HAVE_RUNTIME_AVX2)
+endif()
+if(CXX_SUPPORTS_AVX512 AND ARROW_RUNTIME_SIMD_LEVEL MATCHES "^(AVX512|MAX)$")
+  set(ARROW_HAVE_RUNTIME_AVX512 ON)
+  add_definitions(-DARROW_HAVE_RUNTIME_AVX512)
+endif()
+
 if(CXX_SUPPORTS_ALTIVEC AND ARROW_ALTIVEC)
   set(CXX_COMMON_FLAGS "${CXX_COMMON_FLAGS} -maltivec")
 endif()
@@ -66,6 +66,7 @@ class DictionaryMemoTable::DictionaryMemoTableImpl {
   struct ArrayValuesInserter {
     DictionaryMemoTableImpl* impl_;
     const Array& values_;
+    int32_t* out_memo_indices_;
 
     template <typename T>
     Status Visit(const T& type) {
@@ -86,9 +87,12 @@ class DictionaryMemoTable::DictionaryMemoTableImpl {
       if (array.null_count() > 0) {
         return Status::Invalid("Cannot insert dictionary values containing nulls");
       }
+      int32_t memo_index;
       for (int64_t i = 0; i < array.length(); ++i) {
-        int32_t unused_memo_index;
-        RETURN_NOT_OK(impl_->GetOrInsert(array.GetView(i), &unused_memo_index));
+        RETURN_NOT_OK(impl_->GetOrInsert(array.GetView(i), &memo_index));
+        if (out_memo_indices_ != NULLPTR) {
+          out_memo_indices_[i] = memo_index;
+        }
       }
       return Status::OK();
     }
@@ -124,12 +128,12 @@ class DictionaryMemoTable::DictionaryMemoTableImpl {
     ARROW_CHECK_OK(VisitTypeInline(*type_, &visitor));
   }
 
-  Status InsertValues(const Array& array) {
+  Status InsertValues(const Array& array, int32_t* out_memo_indices) {
     if (!array.type()->Equals(*type_)) {
       return Status::Invalid("Array value type does not match memo type: ",
                              array.type()->ToString());
     }
-    ArrayValuesInserter visitor{this, array};
+    ArrayValuesInserter visitor{this, array, out_memo_indices};
     return VisitTypeInline(*array.type(), &visitor);
   }
 
@@ -159,7 +163,7 @@ DictionaryMemoTable::DictionaryMemoTable(MemoryPool* pool,
 DictionaryMemoTable::DictionaryMemoTable(MemoryPool* pool,
                                          const std::shared_ptr<Array>& dictionary)
     : impl_(new DictionaryMemoTableImpl(pool, dictionary->type())) {
-  ARROW_CHECK_OK(impl_->InsertValues(*dictionary));
+  ARROW_CHECK_OK(impl_->InsertValues(*dictionary, NULLPTR));
 }
 
 DictionaryMemoTable::~DictionaryMemoTable() = default;
@@ -190,7 +194,11 @@ Status DictionaryMemoTable::GetArrayData(int64_t start_offset,
 }
 
 Status DictionaryMemoTable::InsertValues(const Array& array) {
-  return impl_->InsertValues(array);
+  return impl_->InsertValues(array, NULLPTR);
+}
+
+Status DictionaryMemoTable::InsertValues(const Array& array, int32_t* out_memo_indices) {
+  return impl_->InsertValues(array, out_memo_indices);
 }
 
 int32_t DictionaryMemoTable::size() const { return impl_->size(); }
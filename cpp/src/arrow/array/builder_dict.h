@@ -77,6 +77,10 @@ class ARROW_EXPORT DictionaryMemoTable {
   /// \brief Insert new memo values
   Status InsertValues(const Array& values);
 
+  /// \brief Insert new memo values, and write the memo index of each value to
+  /// out_memo_indices, of values.length() entries
+  Status InsertValues(const Array& values, int32_t* out_memo_indices);
+
   int32_t size() const;
 
  private:
@@ -199,6 +203,16 @@ class DictionaryBuilderBase : public ArrayBuilder {
     return memo_table_->InsertValues(values);
   }
 
+  /// \brief Insert values into the dictionary's memo like InsertMemoValues,
+  /// and write the memo index of each value. Can be used to transpose the
+  /// indices of another dictionary holding these values to this builder's
+  /// \param[in] values dictionary values to add to memo. Type must match
+  /// builder type
+  /// \param[out] out_memo_indices the memo index of each of the values
+  Status InsertMemoValues(const Array& values, int32_t* out_memo_indices) {
+    return memo_table_->InsertValues(values, out_memo_indices);
+  }
+
   /// \brief Append a whole dense array to the builder
   template <typename T1 = T>
   enable_if_t<!is_fixed_size_binary_type<T1>::value, Status> AppendArray(
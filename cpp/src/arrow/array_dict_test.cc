@@ -429,6 +429,23 @@ TEST(TestStringDictionaryBuilder, AppendIndices) {
   TestStringDictionaryAppendIndices<StringDictionary32Builder, Int32Type, int32_t>();
 }
 
+TEST(TestStringDictionaryBuilder, InsertMemoValuesWithIndices) {
+  StringDictionary32Builder builder;
+  ASSERT_OK(builder.InsertMemoValues(*ArrayFromJSON(utf8(), R"(["c", "a"])")));
+
+  std::vector<int32_t> memo_indices(3);
+  ASSERT_OK(builder.InsertMemoValues(*ArrayFromJSON(utf8(), R"(["a", "d", "c"])"),
+                                     memo_indices.data()));
+  ASSERT_EQ(memo_indices, std::vector<int32_t>({1, 2, 0}));
+  ASSERT_EQ(builder.dictionary_length(), 3);
+
+  ASSERT_RAISES(Invalid, builder.InsertMemoValues(*ArrayFromJSON(binary(), R"(["e"])"),
+                                                  memo_indices.data()));
+  ASSERT_RAISES(Invalid,
+                builder.InsertMemoValues(*ArrayFromJSON(utf8(), R"(["e", null])"),
+                                         memo_indices.data()));
+}
+
 TEST(TestStringDictionaryBuilder, ArrayInit) {
   auto dict_array = ArrayFromJSON(utf8(), R"(["test", "test2"])");
   auto int_array = ArrayFromJSON(int8(), "[0, 1, 0]");
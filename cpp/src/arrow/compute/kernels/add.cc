@@ -16,8 +16,9 @@
 // under the License.
 
 #include "arrow/compute/kernels/add.h"
-#include "arrow/builder.h"
 #include "arrow/compute/context.h"
+#include "arrow/compute/kernels/add_internal.h"
+#include "arrow/compute/kernels/util_internal.h"
 #include "arrow/type_traits.h"
 
 namespace arrow {
@@ -27,20 +28,22 @@ template <typename ArrowType>
 class AddKernelImpl : public AddKernel {
  private:
   using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+  using CType = typename ArrowType::c_type;
   std::shared_ptr<DataType> result_type_;
 
   Status Add(FunctionContext* ctx, const std::shared_ptr<ArrayType>& lhs,
              const std::shared_ptr<ArrayType>& rhs, std::shared_ptr<Array>* result) {
-    NumericBuilder<ArrowType> builder;
-    RETURN_NOT_OK(builder.Reserve(lhs->length()));
-    for (int i = 0; i < lhs->length(); i++) {
-      if (lhs->IsNull(i) || rhs->IsNull(i)) {
-        builder.UnsafeAppendNull();
-      } else {
-        builder.UnsafeAppend(lhs->Value(i) + rhs->Value(i));
-      }
-    }
-    return builder.Finish(result);
+    const int64_t length = lhs->length();
+    std::shared_ptr<Buffer> values;
+    RETURN_NOT_OK(ctx->Allocate(length * sizeof(CType), &values));
+    auto out = ArrayData::Make(result_type_, length, {nullptr, values});
+    RETURN_NOT_OK(detail::AssignNullIntersection(ctx, *lhs->data(), *rhs->data(),
+                                                 out.get()));
+    // Slots under nulls are added as well, which keeps the loop branch-free
+    AddValues(lhs->raw_values(), rhs->raw_values(), length,
+              reinterpret_cast<CType*>(values->mutable_data()));
+    *result = MakeArray(out);
+    return Status::OK();
   }
 
  public:
@@ -0,0 +1,49 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Addition loop compiled with AVX2 code generation, see add_internal.h
+
+#include <cstdint>
+
+#include "arrow/compute/kernels/add_internal.h"
+
+namespace arrow {
+namespace compute {
+
+template <typename CType>
+void AddAvx2(const CType* left, const CType* right, int64_t length, CType* out) {
+  AddLoop<internal::DispatchLevel::AVX2>(left, right, length, out);
+}
+
+#define INSTANTIATE_ADD(CType)                                               \
+  template void AddAvx2<CType>(const CType*, const CType*, int64_t, CType*);
+
+INSTANTIATE_ADD(int8_t)
+INSTANTIATE_ADD(int16_t)
+INSTANTIATE_ADD(int32_t)
+INSTANTIATE_ADD(int64_t)
+INSTANTIATE_ADD(uint8_t)
+INSTANTIATE_ADD(uint16_t)
+INSTANTIATE_ADD(uint32_t)
+INSTANTIATE_ADD(uint64_t)
+INSTANTIATE_ADD(float)
+INSTANTIATE_ADD(double)
+
+#undef INSTANTIATE_ADD
+
+}  // namespace compute
+}  // namespace arrow
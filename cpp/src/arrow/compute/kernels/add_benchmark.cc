@@ -0,0 +1,82 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "benchmark/benchmark.h"
+
+#include <limits>
+#include <vector>
+
+#include "arrow/compute/benchmark_util.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/add.h"
+#include "arrow/compute/test_util.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+
+namespace arrow {
+namespace compute {
+
+constexpr auto kSeed = 0x94378165;
+
+static void AddArrayArrayKernel(benchmark::State& state) {
+  const int64_t memory_size = state.range(0);
+  const int64_t array_size = memory_size / sizeof(int32_t);
+  const double null_percent = static_cast<double>(state.range(1)) / 100.0;
+  auto rand = random::RandomArrayGenerator(kSeed);
+  // Spanning the whole range, so that about half of the additions wrap around
+  auto lhs = rand.Int32(array_size, std::numeric_limits<int32_t>::min(),
+                        std::numeric_limits<int32_t>::max(), null_percent);
+  auto rhs = rand.Int32(array_size, std::numeric_limits<int32_t>::min(),
+                        std::numeric_limits<int32_t>::max(), null_percent);
+
+  FunctionContext ctx;
+  for (auto _ : state) {
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(Add(&ctx, *lhs, *rhs, &out));
+    benchmark::DoNotOptimize(out);
+  }
+
+  state.counters["size"] = static_cast<double>(memory_size);
+  state.counters["null_percent"] = static_cast<double>(state.range(1));
+  state.SetBytesProcessed(state.iterations() * array_size * sizeof(int32_t) * 2);
+}
+
+static void AddArrayArrayKernelDouble(benchmark::State& state) {
+  const int64_t memory_size = state.range(0);
+  const int64_t array_size = memory_size / sizeof(double);
+  const double null_percent = static_cast<double>(state.range(1)) / 100.0;
+  auto rand = random::RandomArrayGenerator(kSeed);
+  auto lhs = rand.Float64(array_size, -100, 100, null_percent);
+  auto rhs = rand.Float64(array_size, -100, 100, null_percent);
+
+  FunctionContext ctx;
+  for (auto _ : state) {
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(Add(&ctx, *lhs, *rhs, &out));
+    benchmark::DoNotOptimize(out);
+  }
+
+  state.counters["size"] = static_cast<double>(memory_size);
+  state.counters["null_percent"] = static_cast<double>(state.range(1));
+  state.SetBytesProcessed(state.iterations() * array_size * sizeof(double) * 2);
+}
+
+BENCHMARK(AddArrayArrayKernel)->Apply(RegressionSetArgs);
+BENCHMARK(AddArrayArrayKernelDouble)->Apply(RegressionSetArgs);
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,93 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "arrow/util/dispatch.h"
+
+namespace arrow {
+namespace compute {
+
+// ----------------------------------------------------------------------
+// Element-wise addition of primitive values, with an implementation for each
+// DispatchLevel
+
+template <internal::DispatchLevel Level, typename CType, typename Enable = void>
+struct AddPrimitive {
+  static CType Call(CType left, CType right) { return left + right; }
+};
+
+// Integers wrap around on overflow, which is well-defined for unsigned types
+template <internal::DispatchLevel Level, typename CType>
+struct AddPrimitive<Level, CType,
+                    typename std::enable_if<std::is_integral<CType>::value>::type> {
+  using UnsignedType = typename std::make_unsigned<CType>::type;
+
+  static CType Call(CType left, CType right) {
+    return static_cast<CType>(static_cast<UnsignedType>(left) +
+                              static_cast<UnsignedType>(right));
+  }
+};
+
+/// Write left[i] + right[i] to out[i], regardless of nulls
+template <internal::DispatchLevel Level, typename CType>
+void AddLoop(const CType* left, const CType* right, int64_t length, CType* out) {
+  for (int64_t i = 0; i < length; ++i) {
+    out[i] = AddPrimitive<Level, CType>::Call(left[i], right[i]);
+  }
+}
+
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+template <typename CType>
+void AddAvx2(const CType* left, const CType* right, int64_t length, CType* out);
+#endif
+
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+template <typename CType>
+void AddAvx512(const CType* left, const CType* right, int64_t length, CType* out);
+#endif
+
+template <typename CType>
+struct AddDynamic {
+  using FunctionType = decltype(&AddLoop<internal::DispatchLevel::NONE, CType>);
+
+  static std::vector<std::pair<internal::DispatchLevel, FunctionType>> implementations() {
+    return {
+      {internal::DispatchLevel::NONE, AddLoop<internal::DispatchLevel::NONE, CType>}
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+      , {internal::DispatchLevel::AVX2, AddAvx2<CType>}
+#endif
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+      , {internal::DispatchLevel::AVX512, AddAvx512<CType>}
+#endif
+    };
+  }
+};
+
+template <typename CType>
+void AddValues(const CType* left, const CType* right, int64_t length, CType* out) {
+  static internal::DynamicDispatch<AddDynamic<CType>> dispatch;
+  dispatch.func(left, right, length, out);
+}
+
+}  // namespace compute
+}  // namespace arrow
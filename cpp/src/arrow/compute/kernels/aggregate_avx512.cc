@@ -0,0 +1,72 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Sum and min/max loops compiled with AVX512 code generation, see
+// sum_internal.h and minmax_internal.h
+
+#include <cstdint>
+
+#include "arrow/compute/kernels/minmax_internal.h"
+#include "arrow/compute/kernels/sum_internal.h"
+
+namespace arrow {
+namespace compute {
+
+template <typename CType, typename SumCType>
+SumCType SumDenseAvx512(const CType* values, int64_t length) {
+  return SumDenseLoop<internal::DispatchLevel::AVX512, CType, SumCType>(values, length);
+}
+
+template <typename CType>
+void MinMaxDenseAvx512(const CType* values, int64_t length, CType* min, CType* max) {
+  MinMaxDenseLoop<internal::DispatchLevel::AVX512, CType>(values, length, min, max);
+}
+
+#define INSTANTIATE_SUM(CType, SumCType)                                    \
+  template SumCType SumDenseAvx512<CType, SumCType>(const CType*, int64_t);
+
+INSTANTIATE_SUM(int8_t, int64_t)
+INSTANTIATE_SUM(int16_t, int64_t)
+INSTANTIATE_SUM(int32_t, int64_t)
+INSTANTIATE_SUM(int64_t, int64_t)
+INSTANTIATE_SUM(uint8_t, uint64_t)
+INSTANTIATE_SUM(uint16_t, uint64_t)
+INSTANTIATE_SUM(uint32_t, uint64_t)
+INSTANTIATE_SUM(uint64_t, uint64_t)
+INSTANTIATE_SUM(float, double)
+INSTANTIATE_SUM(double, double)
+
+#undef INSTANTIATE_SUM
+
+#define INSTANTIATE_MINMAX(CType)                                                \
+  template void MinMaxDenseAvx512<CType>(const CType*, int64_t, CType*, CType*);
+
+INSTANTIATE_MINMAX(int8_t)
+INSTANTIATE_MINMAX(int16_t)
+INSTANTIATE_MINMAX(int32_t)
+INSTANTIATE_MINMAX(int64_t)
+INSTANTIATE_MINMAX(uint8_t)
+INSTANTIATE_MINMAX(uint16_t)
+INSTANTIATE_MINMAX(uint32_t)
+INSTANTIATE_MINMAX(uint64_t)
+INSTANTIATE_MINMAX(float)
+INSTANTIATE_MINMAX(double)
+
+#undef INSTANTIATE_MINMAX
+
+}  // namespace compute
+}  // namespace arrow
@@ -23,6 +23,7 @@
 #include "arrow/compute/benchmark_util.h"
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/minmax.h"
 #include "arrow/compute/kernels/sum.h"
 #include "arrow/memory_pool.h"
 #include "arrow/testing/gtest_util.h"
@@ -326,7 +327,48 @@ static void SumKernel(benchmark::State& state) {
   state.SetBytesProcessed(state.iterations() * array_size * sizeof(int64_t));
 }
 
+static void SumKernelDouble(benchmark::State& state) {
+  const int64_t array_size = state.range(0) / sizeof(double);
+  const double null_percent = static_cast<double>(state.range(1)) / 100.0;
+  auto rand = random::RandomArrayGenerator(1923);
+  auto array = std::static_pointer_cast<NumericArray<DoubleType>>(
+      rand.Float64(array_size, -100, 100, null_percent));
+
+  FunctionContext ctx;
+  for (auto _ : state) {
+    Datum out;
+    ABORT_NOT_OK(Sum(&ctx, Datum(array), &out));
+    benchmark::DoNotOptimize(out);
+  }
+
+  state.counters["size"] = static_cast<double>(state.range(0));
+  state.counters["null_percent"] = static_cast<double>(state.range(1));
+  state.SetBytesProcessed(state.iterations() * array_size * sizeof(double));
+}
+
+static void MinMaxKernel(benchmark::State& state) {
+  const int64_t array_size = state.range(0) / sizeof(int64_t);
+  const double null_percent = static_cast<double>(state.range(1)) / 100.0;
+  auto rand = random::RandomArrayGenerator(1923);
+  auto array = std::static_pointer_cast<NumericArray<Int64Type>>(
+      rand.Int64(array_size, -100, 100, null_percent));
+
+  FunctionContext ctx;
+  MinMaxOptions options;
+  for (auto _ : state) {
+    Datum out;
+    ABORT_NOT_OK(MinMax(&ctx, options, Datum(array), &out));
+    benchmark::DoNotOptimize(out);
+  }
+
+  state.counters["size"] = static_cast<double>(state.range(0));
+  state.counters["null_percent"] = static_cast<double>(state.range(1));
+  state.SetBytesProcessed(state.iterations() * array_size * sizeof(int64_t));
+}
+
 BENCHMARK(SumKernel)->Apply(RegressionSetArgs);
+BENCHMARK(SumKernelDouble)->Apply(RegressionSetArgs);
+BENCHMARK(MinMaxKernel)->Apply(RegressionSetArgs);
 
 }  // namespace compute
 }  // namespace arrow
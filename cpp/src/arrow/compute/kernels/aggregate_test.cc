@@ -16,9 +16,12 @@
 // under the License.
 
 #include <algorithm>
+#include <limits>
 #include <memory>
+#include <string>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -27,12 +30,14 @@
 #include "arrow/compute/kernels/count.h"
 #include "arrow/compute/kernels/mean.h"
 #include "arrow/compute/kernels/minmax.h"
+#include "arrow/compute/kernels/minmax_internal.h"
 #include "arrow/compute/kernels/sum.h"
 #include "arrow/compute/kernels/sum_internal.h"
 #include "arrow/compute/test_util.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/cpu_info.h"
 
 #include "arrow/testing/gtest_common.h"
 #include "arrow/testing/gtest_util.h"
@@ -199,6 +204,31 @@ TYPED_TEST(TestRandomNumericSumKernel, RandomSliceArraySum) {
   }
 }
 
+// The lanes of the dense loop do not depend on the instruction set, so every
+// dispatch level must give the same floating point result.
+TEST(TestSumDense, DispatchLevels) {
+  std::vector<double> values;
+  random_real(1000, 0x3c2b1a, -1e6, 1e6, &values);
+  const auto cpu_info = internal::CpuInfo::GetInstance();
+  for (int64_t length : {0, 1, 15, 16, 17, 100, 1000}) {
+    SCOPED_TRACE("length = " + std::to_string(length));
+    const double expected = SumDenseLoop<internal::DispatchLevel::NONE, double, double>(
+        values.data(), length);
+    ASSERT_EQ(expected, (SumDense<double, double>(values.data(), length)));
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+    if (cpu_info->IsSupported(internal::CpuInfo::AVX2)) {
+      ASSERT_EQ(expected, (SumDenseAvx2<double, double>(values.data(), length)));
+    }
+#endif
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+    if (cpu_info->IsSupported(internal::CpuInfo::AVX512)) {
+      ASSERT_EQ(expected, (SumDenseAvx512<double, double>(values.data(), length)));
+    }
+#endif
+    ARROW_UNUSED(cpu_info);
+  }
+}
+
 ///
 /// Mean
 ///
@@ -397,5 +427,35 @@ TYPED_TEST(TestFloatingMinMaxKernel, Floats) {
   this->AssertMinMaxIs("[5, -Inf, 2, 3, 4]", -INFINITY, 5, options);
 }
 
+TEST(TestMinMaxDense, DispatchLevels) {
+  std::vector<int32_t> values;
+  randint(1000, -1000000, 1000000, &values);
+  const auto cpu_info = internal::CpuInfo::GetInstance();
+  for (int64_t length : {1, 15, 16, 17, 100, 1000}) {
+    SCOPED_TRACE("length = " + std::to_string(length));
+    const auto minmax = std::minmax_element(values.begin(), values.begin() + length);
+    auto check = [&](void (*func)(const int32_t*, int64_t, int32_t*, int32_t*)) {
+      int32_t min = std::numeric_limits<int32_t>::max();
+      int32_t max = std::numeric_limits<int32_t>::min();
+      func(values.data(), length, &min, &max);
+      ASSERT_EQ(*minmax.first, min);
+      ASSERT_EQ(*minmax.second, max);
+    };
+    check(MinMaxDenseLoop<internal::DispatchLevel::NONE, int32_t>);
+    check(MinMaxDense<int32_t>);
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+    if (cpu_info->IsSupported(internal::CpuInfo::AVX2)) {
+      check(MinMaxDenseAvx2<int32_t>);
+    }
+#endif
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+    if (cpu_info->IsSupported(internal::CpuInfo::AVX512)) {
+      check(MinMaxDenseAvx512<int32_t>);
+    }
+#endif
+    ARROW_UNUSED(cpu_info);
+  }
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -16,6 +16,7 @@
 // under the License.
 
 #include "arrow/compute/kernels/compare.h"
+#include "arrow/compute/kernels/compare_internal.h"
 
 #include <utility>
 
@@ -180,6 +181,37 @@ Status Compare(L&& get_left, R&& get_right, ArrayData* out) {
   return Status::OK();
 }
 
+// Primitive values are compared by a vectorized loop
+
+template <CompareOperator Op, typename Left, typename Right>
+Status CompareValues(const Left& left, const Right& right, ArrayData* out) {
+  return Compare<Op>(MakeRange(left), MakeRange(right), out);
+}
+
+template <CompareOperator Op, typename T>
+Status CompareValues(const NumericArray<T>& left, const NumericArray<T>& right,
+                     ArrayData* out) {
+  CompareArrayArray<Op>(left.raw_values(), right.raw_values(), out->length,
+                        out->buffers[1]->mutable_data());
+  return Status::OK();
+}
+
+template <CompareOperator Op, typename T>
+Status CompareValues(const NumericArray<T>& left,
+                     const internal::PrimitiveScalar<T>& right, ArrayData* out) {
+  CompareArrayScalar<Op>(left.raw_values(), right.value, out->length,
+                         out->buffers[1]->mutable_data());
+  return Status::OK();
+}
+
+template <CompareOperator Op, typename T>
+Status CompareValues(const NumericArray<T>& left, const TemporalScalar<T>& right,
+                     ArrayData* out) {
+  CompareArrayScalar<Op>(left.raw_values(), right.value, out->length,
+                         out->buffers[1]->mutable_data());
+  return Status::OK();
+}
+
 template <typename ArrowType, CompareOperator Op>
 class CompareKernel final : public BinaryKernel {
  public:
@@ -198,12 +230,12 @@ class CompareKernel final : public BinaryKernel {
 
     if (left_array && right_array) {
       RETURN_NOT_OK(AssignNulls(ctx, *left_array, *right_array, out.get()));
-      return Compare<Op>(MakeRange(*left_array), MakeRange(*right_array), out.get());
+      return CompareValues<Op>(*left_array, *right_array, out.get());
     }
 
     if (left_array && right_scalar) {
       RETURN_NOT_OK(AssignNulls(ctx, *left_array, *right_scalar, out.get()));
-      return Compare<Op>(MakeRange(*left_array), MakeRange(*right_scalar), out.get());
+      return CompareValues<Op>(*left_array, *right_scalar, out.get());
     }
 
     return Status::Invalid("Invalid datum signature for CompareBinaryKernel::Call");
@@ -0,0 +1,71 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Comparison loops compiled with AVX2 code generation, see
+// compare_internal.h
+
+#include <cstdint>
+
+#include "arrow/compute/kernels/compare_internal.h"
+
+namespace arrow {
+namespace compute {
+
+template <CompareOperator Op, typename CType>
+void CompareArrayArrayAvx2(const CType* left, const CType* right, int64_t length,
+                           uint8_t* out_bitmap) {
+  CompareArrayArrayLoop<internal::DispatchLevel::AVX2, Op>(left, right, length,
+                                                           out_bitmap);
+}
+
+template <CompareOperator Op, typename CType>
+void CompareArrayScalarAvx2(const CType* left, CType right, int64_t length,
+                            uint8_t* out_bitmap) {
+  CompareArrayScalarLoop<internal::DispatchLevel::AVX2, Op>(left, right, length,
+                                                            out_bitmap);
+}
+
+#define INSTANTIATE_COMPARE_OP(Op, CType)                           \
+  template void CompareArrayArrayAvx2<CompareOperator::Op, CType>(  \
+      const CType*, const CType*, int64_t, uint8_t*);               \
+  template void CompareArrayScalarAvx2<CompareOperator::Op, CType>( \
+      const CType*, CType, int64_t, uint8_t*);
+
+#define INSTANTIATE_COMPARE(CType)             \
+  INSTANTIATE_COMPARE_OP(EQUAL, CType)         \
+  INSTANTIATE_COMPARE_OP(NOT_EQUAL, CType)     \
+  INSTANTIATE_COMPARE_OP(GREATER, CType)       \
+  INSTANTIATE_COMPARE_OP(GREATER_EQUAL, CType) \
+  INSTANTIATE_COMPARE_OP(LESS, CType)          \
+  INSTANTIATE_COMPARE_OP(LESS_EQUAL, CType)
+
+INSTANTIATE_COMPARE(int8_t)
+INSTANTIATE_COMPARE(int16_t)
+INSTANTIATE_COMPARE(int32_t)
+INSTANTIATE_COMPARE(int64_t)
+INSTANTIATE_COMPARE(uint8_t)
+INSTANTIATE_COMPARE(uint16_t)
+INSTANTIATE_COMPARE(uint32_t)
+INSTANTIATE_COMPARE(uint64_t)
+INSTANTIATE_COMPARE(float)
+INSTANTIATE_COMPARE(double)
+
+#undef INSTANTIATE_COMPARE
+#undef INSTANTIATE_COMPARE_OP
+
+}  // namespace compute
+}  // namespace arrow
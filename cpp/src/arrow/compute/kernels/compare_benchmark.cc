@@ -77,8 +77,31 @@ static void CompareArrayArrayKernel(benchmark::State& state) {
   state.SetBytesProcessed(state.iterations() * array_size * sizeof(int64_t) * 2);
 }
 
+static void CompareArrayScalarKernelDouble(benchmark::State& state) {
+  const int64_t memory_size = state.range(0);
+  const int64_t array_size = memory_size / sizeof(double);
+  const double null_percent = static_cast<double>(state.range(1)) / 100.0;
+  auto rand = random::RandomArrayGenerator(kSeed);
+  auto array = std::static_pointer_cast<NumericArray<DoubleType>>(
+      rand.Float64(array_size, -100, 100, null_percent));
+
+  CompareOptions less{LESS};
+
+  FunctionContext ctx;
+  for (auto _ : state) {
+    Datum out;
+    ABORT_NOT_OK(Compare(&ctx, Datum(array), Datum(0.0), less, &out));
+    benchmark::DoNotOptimize(out);
+  }
+
+  state.counters["size"] = static_cast<double>(memory_size);
+  state.counters["null_percent"] = static_cast<double>(state.range(1));
+  state.SetBytesProcessed(state.iterations() * array_size * sizeof(double));
+}
+
 BENCHMARK(CompareArrayScalarKernel)->Apply(RegressionSetArgs);
 BENCHMARK(CompareArrayArrayKernel)->Apply(RegressionSetArgs);
+BENCHMARK(CompareArrayScalarKernelDouble)->Apply(RegressionSetArgs);
 
 }  // namespace compute
 }  // namespace arrow
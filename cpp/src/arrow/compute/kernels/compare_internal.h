@@ -0,0 +1,216 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+#include "arrow/compute/kernels/compare.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/dispatch.h"
+
+namespace arrow {
+namespace compute {
+
+// ----------------------------------------------------------------------
+// Comparison of primitive values into a bitmap, with an implementation for
+// each DispatchLevel
+
+template <internal::DispatchLevel Level, CompareOperator Op>
+struct ComparePrimitive;
+
+template <internal::DispatchLevel Level>
+struct ComparePrimitive<Level, CompareOperator::EQUAL> {
+  template <typename T>
+  static bool Call(T left, T right) {
+    return left == right;
+  }
+};
+
+template <internal::DispatchLevel Level>
+struct ComparePrimitive<Level, CompareOperator::NOT_EQUAL> {
+  template <typename T>
+  static bool Call(T left, T right) {
+    return left != right;
+  }
+};
+
+template <internal::DispatchLevel Level>
+struct ComparePrimitive<Level, CompareOperator::GREATER> {
+  template <typename T>
+  static bool Call(T left, T right) {
+    return left > right;
+  }
+};
+
+template <internal::DispatchLevel Level>
+struct ComparePrimitive<Level, CompareOperator::GREATER_EQUAL> {
+  template <typename T>
+  static bool Call(T left, T right) {
+    return left >= right;
+  }
+};
+
+template <internal::DispatchLevel Level>
+struct ComparePrimitive<Level, CompareOperator::LESS> {
+  template <typename T>
+  static bool Call(T left, T right) {
+    return left < right;
+  }
+};
+
+template <internal::DispatchLevel Level>
+struct ComparePrimitive<Level, CompareOperator::LESS_EQUAL> {
+  template <typename T>
+  static bool Call(T left, T right) {
+    return left <= right;
+  }
+};
+
+/// Pack bytes holding 0 or 1 into bits, 8 bytes at a time
+template <internal::DispatchLevel Level>
+void PackBytesToBits(const uint8_t* bytes, int64_t num_bytes, uint8_t* out_bitmap) {
+  for (int64_t i = 0; i < num_bytes / 8; ++i) {
+    uint64_t word;
+    std::memcpy(&word, bytes + i * 8, sizeof(word));
+    // Gather the lowest bit of each byte into the top byte
+    word = BitUtil::FromLittleEndian(word) * 0x0102040810204080ULL;
+    out_bitmap[i] = static_cast<uint8_t>(word >> 56);
+  }
+}
+
+/// Write compare(i) for i in [0, length) to a bitmap starting at bit 0.  The
+/// comparisons are made by blocks into bytes, which the compiler can
+/// vectorize, then packed into bits.
+template <internal::DispatchLevel Level, typename Compare>
+void GenerateBitsByBlocks(int64_t length, uint8_t* out_bitmap, Compare&& compare) {
+  constexpr int64_t kBlockSize = 64;
+  uint8_t block[kBlockSize];
+
+  const int64_t num_blocks = length / kBlockSize;
+  for (int64_t b = 0; b < num_blocks; ++b) {
+    const int64_t offset = b * kBlockSize;
+    for (int64_t j = 0; j < kBlockSize; ++j) {
+      block[j] = compare(offset + j);
+    }
+    PackBytesToBits<Level>(block, kBlockSize, out_bitmap + offset / 8);
+  }
+
+  const int64_t offset = num_blocks * kBlockSize;
+  const int64_t remaining = length - offset;
+  if (remaining > 0) {
+    std::memset(block, 0, kBlockSize);
+    for (int64_t j = 0; j < remaining; ++j) {
+      block[j] = compare(offset + j);
+    }
+    uint8_t packed[kBlockSize / 8];
+    PackBytesToBits<Level>(block, kBlockSize, packed);
+    std::memcpy(out_bitmap + offset / 8, packed, BitUtil::BytesForBits(remaining));
+  }
+}
+
+template <internal::DispatchLevel Level, CompareOperator Op, typename CType>
+void CompareArrayArrayLoop(const CType* left, const CType* right, int64_t length,
+                           uint8_t* out_bitmap) {
+  GenerateBitsByBlocks<Level>(length, out_bitmap, [&](int64_t i) -> uint8_t {
+    return ComparePrimitive<Level, Op>::Call(left[i], right[i]);
+  });
+}
+
+template <internal::DispatchLevel Level, CompareOperator Op, typename CType>
+void CompareArrayScalarLoop(const CType* left, CType right, int64_t length,
+                            uint8_t* out_bitmap) {
+  GenerateBitsByBlocks<Level>(length, out_bitmap, [&](int64_t i) -> uint8_t {
+    return ComparePrimitive<Level, Op>::Call(left[i], right);
+  });
+}
+
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+template <CompareOperator Op, typename CType>
+void CompareArrayArrayAvx2(const CType* left, const CType* right, int64_t length,
+                           uint8_t* out_bitmap);
+template <CompareOperator Op, typename CType>
+void CompareArrayScalarAvx2(const CType* left, CType right, int64_t length,
+                            uint8_t* out_bitmap);
+#endif
+
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+template <CompareOperator Op, typename CType>
+void CompareArrayArrayAvx512(const CType* left, const CType* right, int64_t length,
+                             uint8_t* out_bitmap);
+template <CompareOperator Op, typename CType>
+void CompareArrayScalarAvx512(const CType* left, CType right, int64_t length,
+                              uint8_t* out_bitmap);
+#endif
+
+template <CompareOperator Op, typename CType>
+struct CompareArrayArrayDynamic {
+  using FunctionType =
+      decltype(&CompareArrayArrayLoop<internal::DispatchLevel::NONE, Op, CType>);
+
+  static std::vector<std::pair<internal::DispatchLevel, FunctionType>> implementations() {
+    return {
+      {internal::DispatchLevel::NONE,
+       CompareArrayArrayLoop<internal::DispatchLevel::NONE, Op, CType>}
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+      , {internal::DispatchLevel::AVX2, CompareArrayArrayAvx2<Op, CType>}
+#endif
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+      , {internal::DispatchLevel::AVX512, CompareArrayArrayAvx512<Op, CType>}
+#endif
+    };
+  }
+};
+
+template <CompareOperator Op, typename CType>
+struct CompareArrayScalarDynamic {
+  using FunctionType =
+      decltype(&CompareArrayScalarLoop<internal::DispatchLevel::NONE, Op, CType>);
+
+  static std::vector<std::pair<internal::DispatchLevel, FunctionType>> implementations() {
+    return {
+      {internal::DispatchLevel::NONE,
+       CompareArrayScalarLoop<internal::DispatchLevel::NONE, Op, CType>}
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+      , {internal::DispatchLevel::AVX2, CompareArrayScalarAvx2<Op, CType>}
+#endif
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+      , {internal::DispatchLevel::AVX512, CompareArrayScalarAvx512<Op, CType>}
+#endif
+    };
+  }
+};
+
+template <CompareOperator Op, typename CType>
+void CompareArrayArray(const CType* left, const CType* right, int64_t length,
+                       uint8_t* out_bitmap) {
+  static internal::DynamicDispatch<CompareArrayArrayDynamic<Op, CType>> dispatch;
+  dispatch.func(left, right, length, out_bitmap);
+}
+
+template <CompareOperator Op, typename CType>
+void CompareArrayScalar(const CType* left, CType right, int64_t length,
+                        uint8_t* out_bitmap) {
+  static internal::DynamicDispatch<CompareArrayScalarDynamic<Op, CType>> dispatch;
+  dispatch.func(left, right, length, out_bitmap);
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -27,10 +27,12 @@
 #include "arrow/array.h"
 #include "arrow/compute/kernel.h"
 #include "arrow/compute/kernels/compare.h"
+#include "arrow/compute/kernels/compare_internal.h"
 #include "arrow/compute/test_util.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/cpu_info.h"
 
 #include "arrow/testing/gtest_common.h"
 #include "arrow/testing/gtest_util.h"
@@ -423,6 +425,53 @@ TYPED_TEST(TestNumericCompareKernel, RandomCompareArrayArray) {
   }
 }
 
+TEST(TestCompareDispatch, DispatchLevels) {
+  using internal::DispatchLevel;
+  std::vector<int64_t> left, right;
+  randint(300, 0, 3, &left);
+  randint(300, 0, 3, &right);
+  std::vector<uint8_t> expected(BitUtil::BytesForBits(300));
+  std::vector<uint8_t> out(expected.size());
+
+  auto check = [&](void (*func)(const int64_t*, const int64_t*, int64_t, uint8_t*)) {
+    for (int64_t length : {0, 1, 7, 63, 64, 65, 130, 300}) {
+      std::fill(out.begin(), out.end(), 0xff);
+      func(left.data(), right.data(), length, out.data());
+      for (int64_t i = 0; i < length; ++i) {
+        ASSERT_EQ(left[i] < right[i], BitUtil::GetBit(out.data(), i)) << "at " << i;
+      }
+    }
+  };
+  check(CompareArrayArrayLoop<DispatchLevel::NONE, LESS, int64_t>);
+  check(CompareArrayArray<LESS, int64_t>);
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+  if (internal::CpuInfo::GetInstance()->IsSupported(internal::CpuInfo::AVX2)) {
+    check(CompareArrayArrayAvx2<LESS, int64_t>);
+  }
+#endif
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+  if (internal::CpuInfo::GetInstance()->IsSupported(internal::CpuInfo::AVX512)) {
+    check(CompareArrayArrayAvx512<LESS, int64_t>);
+  }
+#endif
+}
+
+TYPED_TEST(TestNumericCompareKernel, SlicedCompareArrayScalar) {
+  using ScalarType = typename TypeTraits<TypeParam>::ScalarType;
+  using CType = typename TypeTraits<TypeParam>::CType;
+
+  auto rand = random::RandomArrayGenerator(0x2b7f1a0);
+  auto array = rand.Numeric<TypeParam>(200, 0, 100, 0.1);
+  auto fifty = Datum(std::make_shared<ScalarType>(CType(50)));
+  for (int64_t offset : {1, 7, 63}) {
+    for (int64_t length : {1, 9, 65, 130}) {
+      auto slice = Datum(array->Slice(offset, length));
+      ValidateCompare<TypeParam>(&this->ctx_, CompareOptions(GREATER), slice, fifty);
+      ValidateCompare<TypeParam>(&this->ctx_, CompareOptions(LESS), slice, slice);
+    }
+  }
+}
+
 class TestStringCompareKernel : public ComputeFixture, public TestBase {};
 
 TEST_F(TestStringCompareKernel, SimpleCompareArrayScalar) {
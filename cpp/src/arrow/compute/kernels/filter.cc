@@ -17,6 +17,7 @@
 
 #include "arrow/compute/kernels/filter.h"
 
+#include <algorithm>
 #include <limits>
 #include <memory>
 #include <utility>
@@ -27,6 +28,7 @@
 #include "arrow/compute/kernels/take_internal.h"
 #include "arrow/record_batch.h"
 #include "arrow/result.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
 
@@ -67,13 +69,30 @@ class FilterIndexSequence {
   int64_t index_ = 0, out_length_ = -1;
 };
 
-// TODO(bkietz) this can be optimized
+// Null filter slots emit a null, so the output size is the number of nulls
+// plus the number of valid true slots.  The latter is counted by chunks of
+// the intersection of the validity and value bitmaps, to use word-wise
+// operations instead of testing each bit.
 static int64_t OutputSize(const BooleanArray& filter) {
-  int64_t size = 0;
-  for (auto i = 0; i < filter.length(); ++i) {
-    if (filter.IsNull(i) || filter.Value(i)) {
-      ++size;
-    }
+  const uint8_t* values = filter.values()->data();
+  const int64_t offset = filter.offset();
+  const int64_t length = filter.length();
+  const int64_t null_count = filter.null_count();
+  if (null_count == 0) {
+    return internal::CountSetBits(values, offset, length);
+  }
+  if (null_count == length) {
+    return length;
+  }
+
+  constexpr int64_t kChunkBits = 4096;
+  uint8_t chunk[kChunkBits / 8 + 1];
+  const uint8_t* validity = filter.null_bitmap_data();
+  int64_t size = null_count;
+  for (int64_t i = 0; i < length; i += kChunkBits) {
+    const int64_t chunk_length = std::min(kChunkBits, length - i);
+    internal::BitmapAnd(validity, offset + i, values, offset + i, chunk_length, 0, chunk);
+    size += internal::CountSetBits(chunk, 0, chunk_length);
   }
   return size;
 }
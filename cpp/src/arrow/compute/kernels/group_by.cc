@@ -0,0 +1,968 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/group_by.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/buffer_builder.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/sum_internal.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/hashing.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/string_view.h"
+#include "arrow/util/thread_pool.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+
+namespace {
+
+// ----------------------------------------------------------------------
+// Row-wise key encoding
+//
+// Each row of the key columns is encoded into a contiguous byte string which
+// is then hashed and compared by a BinaryMemoTable. For every key column the
+// encoding consists of a null marker byte followed by the value bytes (zeroed
+// when null): the fixed-width value, or a uint32 length and the binary data.
+
+constexpr uint8_t kValidByte = 0;
+constexpr uint8_t kNullByte = 1;
+
+class KeyEncoder {
+ public:
+  virtual ~KeyEncoder() = default;
+
+  // Add the encoded length of each row of data to lengths.
+  virtual void AddLength(const ArrayData& data, int64_t* lengths) = 0;
+
+  // Encode each row of data at encoded_bytes[i] and advance the pointers.
+  virtual void Encode(const ArrayData& data, uint8_t** encoded_bytes) = 0;
+
+  // Decode length values from encoded_bytes[i] and advance the pointers.
+  virtual Status Decode(const uint8_t** encoded_bytes, int64_t length, MemoryPool* pool,
+                        std::shared_ptr<ArrayData>* out) = 0;
+
+ protected:
+  static bool IsValid(const ArrayData& data, int64_t i) {
+    return data.buffers[0] == nullptr ||
+           BitUtil::GetBit(data.buffers[0]->data(), data.offset + i);
+  }
+
+  // Consume the null marker byte of each row and build the validity bitmap.
+  static Status DecodeNulls(const uint8_t** encoded_bytes, int64_t length,
+                            MemoryPool* pool, std::shared_ptr<Buffer>* null_bitmap,
+                            int64_t* null_count) {
+    *null_count = 0;
+    for (int64_t i = 0; i < length; ++i) {
+      *null_count += encoded_bytes[i][0] == kNullByte;
+    }
+    if (*null_count > 0) {
+      RETURN_NOT_OK(AllocateBitmap(pool, length, null_bitmap));
+      uint8_t* bitmap = (*null_bitmap)->mutable_data();
+      for (int64_t i = 0; i < length; ++i) {
+        BitUtil::SetBitTo(bitmap, i, encoded_bytes[i][0] == kValidByte);
+      }
+    } else {
+      *null_bitmap = nullptr;
+    }
+    for (int64_t i = 0; i < length; ++i) {
+      encoded_bytes[i] += 1;
+    }
+    return Status::OK();
+  }
+};
+
+class BooleanKeyEncoder : public KeyEncoder {
+ public:
+  void AddLength(const ArrayData& data, int64_t* lengths) override {
+    for (int64_t i = 0; i < data.length; ++i) {
+      lengths[i] += 2;
+    }
+  }
+
+  void Encode(const ArrayData& data, uint8_t** encoded_bytes) override {
+    const uint8_t* values = data.buffers[1]->data();
+    for (int64_t i = 0; i < data.length; ++i) {
+      uint8_t*& encoded_ptr = encoded_bytes[i];
+      if (IsValid(data, i)) {
+        encoded_ptr[0] = kValidByte;
+        encoded_ptr[1] = BitUtil::GetBit(values, data.offset + i) ? 1 : 0;
+      } else {
+        encoded_ptr[0] = kNullByte;
+        encoded_ptr[1] = 0;
+      }
+      encoded_ptr += 2;
+    }
+  }
+
+  Status Decode(const uint8_t** encoded_bytes, int64_t length, MemoryPool* pool,
+                std::shared_ptr<ArrayData>* out) override {
+    std::shared_ptr<Buffer> null_bitmap, values;
+    int64_t null_count;
+    RETURN_NOT_OK(DecodeNulls(encoded_bytes, length, pool, &null_bitmap, &null_count));
+    RETURN_NOT_OK(AllocateBitmap(pool, length, &values));
+    uint8_t* raw_values = values->mutable_data();
+    for (int64_t i = 0; i < length; ++i) {
+      BitUtil::SetBitTo(raw_values, i, encoded_bytes[i][0] != 0);
+      encoded_bytes[i] += 1;
+    }
+    *out = ArrayData::Make(boolean(), length, {null_bitmap, values}, null_count);
+    return Status::OK();
+  }
+};
+
+class FixedWidthKeyEncoder : public KeyEncoder {
+ public:
+  explicit FixedWidthKeyEncoder(const std::shared_ptr<DataType>& type)
+      : type_(type),
+        byte_width_(checked_cast<const FixedWidthType&>(*type).bit_width() / 8) {}
+
+  void AddLength(const ArrayData& data, int64_t* lengths) override {
+    for (int64_t i = 0; i < data.length; ++i) {
+      lengths[i] += 1 + byte_width_;
+    }
+  }
+
+  void Encode(const ArrayData& data, uint8_t** encoded_bytes) override {
+    const uint8_t* values = data.buffers[1]->data() + data.offset * byte_width_;
+    for (int64_t i = 0; i < data.length; ++i) {
+      uint8_t*& encoded_ptr = encoded_bytes[i];
+      if (IsValid(data, i)) {
+        *encoded_ptr++ = kValidByte;
+        std::memcpy(encoded_ptr, values + i * byte_width_, byte_width_);
+      } else {
+        *encoded_ptr++ = kNullByte;
+        std::memset(encoded_ptr, 0, byte_width_);
+      }
+      encoded_ptr += byte_width_;
+    }
+  }
+
+  Status Decode(const uint8_t** encoded_bytes, int64_t length, MemoryPool* pool,
+                std::shared_ptr<ArrayData>* out) override {
+    std::shared_ptr<Buffer> null_bitmap, values;
+    int64_t null_count;
+    RETURN_NOT_OK(DecodeNulls(encoded_bytes, length, pool, &null_bitmap, &null_count));
+    RETURN_NOT_OK(AllocateBuffer(pool, length * byte_width_, &values));
+    uint8_t* raw_values = values->mutable_data();
+    for (int64_t i = 0; i < length; ++i) {
+      std::memcpy(raw_values + i * byte_width_, encoded_bytes[i], byte_width_);
+      encoded_bytes[i] += byte_width_;
+    }
+    *out = ArrayData::Make(type_, length, {null_bitmap, values}, null_count);
+    return Status::OK();
+  }
+
+ private:
+  std::shared_ptr<DataType> type_;
+  int byte_width_;
+};
+
+template <typename Type>
+class VarLengthKeyEncoder : public KeyEncoder {
+  using ArrayType = typename TypeTraits<Type>::ArrayType;
+  using Offset = typename Type::offset_type;
+
+ public:
+  explicit VarLengthKeyEncoder(const std::shared_ptr<DataType>& type) : type_(type) {}
+
+  void AddLength(const ArrayData& data, int64_t* lengths) override {
+    const Offset* offsets = data.GetValues<Offset>(1);
+    for (int64_t i = 0; i < data.length; ++i) {
+      lengths[i] += 1 + sizeof(uint32_t);
+      if (IsValid(data, i)) {
+        lengths[i] += offsets[i + 1] - offsets[i];
+      }
+    }
+  }
+
+  void Encode(const ArrayData& data, uint8_t** encoded_bytes) override {
+    const Offset* offsets = data.GetValues<Offset>(1);
+    const uint8_t* value_data = data.buffers[2] ? data.buffers[2]->data() : nullptr;
+    for (int64_t i = 0; i < data.length; ++i) {
+      uint8_t*& encoded_ptr = encoded_bytes[i];
+      uint32_t value_length = 0;
+      if (IsValid(data, i)) {
+        *encoded_ptr++ = kValidByte;
+        value_length = static_cast<uint32_t>(offsets[i + 1] - offsets[i]);
+      } else {
+        *encoded_ptr++ = kNullByte;
+      }
+      std::memcpy(encoded_ptr, &value_length, sizeof(uint32_t));
+      encoded_ptr += sizeof(uint32_t);
+      if (value_length > 0) {
+        std::memcpy(encoded_ptr, value_data + offsets[i], value_length);
+        encoded_ptr += value_length;
+      }
+    }
+  }
+
+  Status Decode(const uint8_t** encoded_bytes, int64_t length, MemoryPool* pool,
+                std::shared_ptr<ArrayData>* out) override {
+    std::shared_ptr<Buffer> null_bitmap, offsets, values;
+    int64_t null_count;
+    RETURN_NOT_OK(DecodeNulls(encoded_bytes, length, pool, &null_bitmap, &null_count));
+
+    RETURN_NOT_OK(AllocateBuffer(pool, (length + 1) * sizeof(Offset), &offsets));
+    auto raw_offsets = reinterpret_cast<Offset*>(offsets->mutable_data());
+    int64_t total_length = 0;
+    for (int64_t i = 0; i < length; ++i) {
+      uint32_t value_length;
+      std::memcpy(&value_length, encoded_bytes[i], sizeof(uint32_t));
+      raw_offsets[i] = static_cast<Offset>(total_length);
+      total_length += value_length;
+    }
+    if (total_length > std::numeric_limits<Offset>::max()) {
+      return Status::CapacityError("Key data too large for ", *type_);
+    }
+    raw_offsets[length] = static_cast<Offset>(total_length);
+
+    RETURN_NOT_OK(AllocateBuffer(pool, total_length, &values));
+    uint8_t* raw_values = values->mutable_data();
+    for (int64_t i = 0; i < length; ++i) {
+      const auto value_length = raw_offsets[i + 1] - raw_offsets[i];
+      encoded_bytes[i] += sizeof(uint32_t);
+      std::memcpy(raw_values + raw_offsets[i], encoded_bytes[i], value_length);
+      encoded_bytes[i] += value_length;
+    }
+    *out = ArrayData::Make(type_, length, {null_bitmap, offsets, values}, null_count);
+    return Status::OK();
+  }
+
+ private:
+  std::shared_ptr<DataType> type_;
+};
+
+Status MakeKeyEncoder(const std::shared_ptr<DataType>& type,
+                      std::unique_ptr<KeyEncoder>* out) {
+  switch (type->id()) {
+    case Type::BOOL:
+      out->reset(new BooleanKeyEncoder());
+      return Status::OK();
+    case Type::BINARY:
+      out->reset(new VarLengthKeyEncoder<BinaryType>(type));
+      return Status::OK();
+    case Type::STRING:
+      out->reset(new VarLengthKeyEncoder<StringType>(type));
+      return Status::OK();
+    case Type::LARGE_BINARY:
+      out->reset(new VarLengthKeyEncoder<LargeBinaryType>(type));
+      return Status::OK();
+    case Type::LARGE_STRING:
+      out->reset(new VarLengthKeyEncoder<LargeStringType>(type));
+      return Status::OK();
+    default:
+      break;
+  }
+  if ((is_primitive(type->id()) && type->id() != Type::NA) ||
+      type->id() == Type::FIXED_SIZE_BINARY || type->id() == Type::DECIMAL) {
+    out->reset(new FixedWidthKeyEncoder(type));
+    return Status::OK();
+  }
+  return Status::NotImplemented("Grouping by keys of type ", *type);
+}
+
+// ----------------------------------------------------------------------
+// Grouper implementation
+
+class GrouperImpl : public Grouper {
+ public:
+  GrouperImpl(FunctionContext* ctx, std::vector<std::shared_ptr<DataType>> key_types,
+              std::vector<std::unique_ptr<KeyEncoder>> encoders)
+      : ctx_(ctx),
+        key_types_(std::move(key_types)),
+        encoders_(std::move(encoders)),
+        map_(ctx->memory_pool()) {}
+
+  Status Consume(const std::vector<std::shared_ptr<Array>>& keys,
+                 std::shared_ptr<Array>* group_ids) override {
+    std::vector<uint8_t> key_bytes;
+    std::vector<int64_t> offsets;
+    RETURN_NOT_OK(EncodeRows(keys, &key_bytes, &offsets));
+
+    const int64_t num_rows = static_cast<int64_t>(offsets.size()) - 1;
+    std::shared_ptr<Buffer> ids;
+    RETURN_NOT_OK(AllocateBuffer(ctx_->memory_pool(), num_rows * sizeof(uint32_t), &ids));
+    auto raw_ids = reinterpret_cast<uint32_t*>(ids->mutable_data());
+
+    for (int64_t i = 0; i < num_rows; ++i) {
+      int32_t group_id;
+      RETURN_NOT_OK(map_.GetOrInsert(key_bytes.data() + offsets[i],
+                                     static_cast<int32_t>(offsets[i + 1] - offsets[i]),
+                                     &group_id));
+      raw_ids[i] = static_cast<uint32_t>(group_id);
+    }
+    *group_ids = std::make_shared<UInt32Array>(num_rows, ids);
+    return Status::OK();
+  }
+
+  Status Lookup(const std::vector<std::shared_ptr<Array>>& keys,
+                std::shared_ptr<Array>* group_ids) const override {
+    std::vector<uint8_t> key_bytes;
+    std::vector<int64_t> offsets;
+    RETURN_NOT_OK(EncodeRows(keys, &key_bytes, &offsets));
+
+    const int64_t num_rows = static_cast<int64_t>(offsets.size()) - 1;
+    std::shared_ptr<Buffer> ids, null_bitmap;
+    RETURN_NOT_OK(AllocateBuffer(ctx_->memory_pool(), num_rows * sizeof(uint32_t), &ids));
+    RETURN_NOT_OK(AllocateBitmap(ctx_->memory_pool(), num_rows, &null_bitmap));
+    auto raw_ids = reinterpret_cast<uint32_t*>(ids->mutable_data());
+    uint8_t* raw_null_bitmap = null_bitmap->mutable_data();
+
+    int64_t null_count = 0;
+    for (int64_t i = 0; i < num_rows; ++i) {
+      const int32_t group_id =
+          map_.Get(key_bytes.data() + offsets[i],
+                   static_cast<int32_t>(offsets[i + 1] - offsets[i]));
+      if (group_id == internal::kKeyNotFound) {
+        raw_ids[i] = 0;
+        BitUtil::ClearBit(raw_null_bitmap, i);
+        ++null_count;
+      } else {
+        raw_ids[i] = static_cast<uint32_t>(group_id);
+        BitUtil::SetBit(raw_null_bitmap, i);
+      }
+    }
+    if (null_count == 0) {
+      null_bitmap = nullptr;
+    }
+    *group_ids = std::make_shared<UInt32Array>(num_rows, ids, null_bitmap, null_count);
+    return Status::OK();
+  }
+
+  uint32_t num_groups() const override { return static_cast<uint32_t>(map_.size()); }
+
+  Status GetUniques(std::vector<std::shared_ptr<Array>>* out) const override {
+    const int64_t length = num_groups();
+    std::vector<const uint8_t*> encoded_bytes;
+    encoded_bytes.reserve(length);
+    map_.VisitValues(0, [&](const util::string_view& key) {
+      encoded_bytes.push_back(reinterpret_cast<const uint8_t*>(key.data()));
+    });
+
+    out->resize(encoders_.size());
+    for (size_t i = 0; i < encoders_.size(); ++i) {
+      std::shared_ptr<ArrayData> data;
+      RETURN_NOT_OK(encoders_[i]->Decode(encoded_bytes.data(), length,
+                                         ctx_->memory_pool(), &data));
+      (*out)[i] = MakeArray(data);
+    }
+    return Status::OK();
+  }
+
+ private:
+  // Encode all rows of keys into key_bytes, row i spanning
+  // [offsets[i], offsets[i + 1]).
+  Status EncodeRows(const std::vector<std::shared_ptr<Array>>& keys,
+                    std::vector<uint8_t>* key_bytes,
+                    std::vector<int64_t>* offsets) const {
+    if (keys.size() != encoders_.size()) {
+      return Status::Invalid("Expected ", encoders_.size(), " key columns, got ",
+                             keys.size());
+    }
+    // Grouper::Make rejects empty key types
+    const int64_t num_rows = keys[0]->length();
+    for (size_t i = 0; i < keys.size(); ++i) {
+      if (!keys[i]->type()->Equals(*key_types_[i])) {
+        return Status::TypeError("Expected key column ", i, " of type ", *key_types_[i],
+                                 ", got ", *keys[i]->type());
+      }
+      if (keys[i]->length() != num_rows) {
+        return Status::Invalid("Key columns must all have the same length");
+      }
+    }
+
+    offsets->assign(num_rows + 1, 0);
+    int64_t* lengths = offsets->data() + 1;
+    for (size_t i = 0; i < keys.size(); ++i) {
+      encoders_[i]->AddLength(*keys[i]->data(), lengths);
+    }
+    for (int64_t i = 0; i < num_rows; ++i) {
+      lengths[i] += lengths[i - 1];
+      if (ARROW_PREDICT_FALSE(lengths[i] - lengths[i - 1] >
+                              std::numeric_limits<int32_t>::max())) {
+        return Status::CapacityError("Encoded key too large");
+      }
+    }
+
+    key_bytes->resize(offsets->back());
+    std::vector<uint8_t*> encoded_bytes(num_rows);
+    for (int64_t i = 0; i < num_rows; ++i) {
+      encoded_bytes[i] = key_bytes->data() + (*offsets)[i];
+    }
+    for (size_t i = 0; i < keys.size(); ++i) {
+      encoders_[i]->Encode(*keys[i]->data(), encoded_bytes.data());
+    }
+    return Status::OK();
+  }
+
+  FunctionContext* ctx_;
+  std::vector<std::shared_ptr<DataType>> key_types_;
+  std::vector<std::unique_ptr<KeyEncoder>> encoders_;
+  internal::BinaryMemoTable map_;
+};
+
+// ----------------------------------------------------------------------
+// Grouped aggregate functions
+
+// Grow a per-group state buffer to num_groups entries, initializing new
+// entries with value.
+template <typename T>
+Status ResizeStates(TypedBufferBuilder<T>* states, int64_t num_groups, T value) {
+  const int64_t added = num_groups - states->length();
+  if (added > 0) {
+    return states->Append(added, value);
+  }
+  return Status::OK();
+}
+
+// Build a validity bitmap with bit i set if counts[i] > 0.
+Status CountsToNullBitmap(MemoryPool* pool, const int64_t* counts, int64_t length,
+                          std::shared_ptr<Buffer>* null_bitmap, int64_t* null_count) {
+  *null_count = std::count(counts, counts + length, 0);
+  if (*null_count == 0) {
+    *null_bitmap = nullptr;
+    return Status::OK();
+  }
+  RETURN_NOT_OK(AllocateBitmap(pool, length, null_bitmap));
+  uint8_t* bitmap = (*null_bitmap)->mutable_data();
+  for (int64_t i = 0; i < length; ++i) {
+    BitUtil::SetBitTo(bitmap, i, counts[i] > 0);
+  }
+  return Status::OK();
+}
+
+// Invoke visit(i) for each non-null slot i of input.
+template <typename Visitor>
+void VisitValid(const Array& input, Visitor&& visit) {
+  if (input.null_count() == 0) {
+    for (int64_t i = 0; i < input.length(); ++i) {
+      visit(i);
+    }
+  } else {
+    internal::BitmapReader reader(input.null_bitmap_data(), input.offset(),
+                                  input.length());
+    for (int64_t i = 0; i < input.length(); ++i) {
+      if (reader.IsSet()) {
+        visit(i);
+      }
+      reader.Next();
+    }
+  }
+}
+
+class GroupedCountImpl : public HashAggregateFunction {
+ public:
+  explicit GroupedCountImpl(FunctionContext* ctx)
+      : ctx_(ctx), counts_(ctx->memory_pool()) {}
+
+  Status Resize(int64_t num_groups) override {
+    return ResizeStates<int64_t>(&counts_, num_groups, 0);
+  }
+
+  Status Consume(const Array& input, const uint32_t* group_ids) override {
+    int64_t* counts = counts_.mutable_data();
+    VisitValid(input, [&](int64_t i) { ++counts[group_ids[i]]; });
+    return Status::OK();
+  }
+
+  Status Merge(const HashAggregateFunction& other,
+               const uint32_t* group_id_mapping) override {
+    const auto& other_counts = checked_cast<const GroupedCountImpl&>(other).counts_;
+    int64_t* counts = counts_.mutable_data();
+    for (int64_t i = 0; i < other_counts.length(); ++i) {
+      counts[group_id_mapping[i]] += other_counts.data()[i];
+    }
+    return Status::OK();
+  }
+
+  Status Finalize(std::shared_ptr<Array>* out) override {
+    const int64_t length = counts_.length();
+    std::shared_ptr<Buffer> data;
+    RETURN_NOT_OK(AllocateBuffer(ctx_->memory_pool(), length * sizeof(int64_t), &data));
+    std::memcpy(data->mutable_data(), counts_.data(), length * sizeof(int64_t));
+    *out = std::make_shared<Int64Array>(length, data);
+    return Status::OK();
+  }
+
+  std::shared_ptr<DataType> out_type() const override { return int64(); }
+
+ private:
+  FunctionContext* ctx_;
+  TypedBufferBuilder<int64_t> counts_;
+};
+
+// Shared implementation of SUM and MEAN, which only differ in Finalize.
+template <typename ArrowType, bool kMean>
+class GroupedSumImpl : public HashAggregateFunction {
+  using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+  using SumType = typename FindAccumulatorType<ArrowType>::Type;
+  using SumCType = typename SumType::c_type;
+  using OutType = typename std::conditional<kMean, DoubleType, SumType>::type;
+
+ public:
+  explicit GroupedSumImpl(FunctionContext* ctx)
+      : ctx_(ctx), sums_(ctx->memory_pool()), counts_(ctx->memory_pool()) {}
+
+  Status Resize(int64_t num_groups) override {
+    RETURN_NOT_OK(ResizeStates<SumCType>(&sums_, num_groups, 0));
+    return ResizeStates<int64_t>(&counts_, num_groups, 0);
+  }
+
+  Status Consume(const Array& input, const uint32_t* group_ids) override {
+    const auto values = checked_cast<const ArrayType&>(input).raw_values();
+    SumCType* sums = sums_.mutable_data();
+    int64_t* counts = counts_.mutable_data();
+    VisitValid(input, [&](int64_t i) {
+      sums[group_ids[i]] += values[i];
+      ++counts[group_ids[i]];
+    });
+    return Status::OK();
+  }
+
+  Status Merge(const HashAggregateFunction& other,
+               const uint32_t* group_id_mapping) override {
+    const auto& other_impl = checked_cast<const GroupedSumImpl&>(other);
+    SumCType* sums = sums_.mutable_data();
+    int64_t* counts = counts_.mutable_data();
+    for (int64_t i = 0; i < other_impl.counts_.length(); ++i) {
+      sums[group_id_mapping[i]] += other_impl.sums_.data()[i];
+      counts[group_id_mapping[i]] += other_impl.counts_.data()[i];
+    }
+    return Status::OK();
+  }
+
+  Status Finalize(std::shared_ptr<Array>* out) override {
+    using OutCType = typename OutType::c_type;
+    const int64_t length = counts_.length();
+    std::shared_ptr<Buffer> null_bitmap, data;
+    int64_t null_count;
+    RETURN_NOT_OK(CountsToNullBitmap(ctx_->memory_pool(), counts_.data(), length,
+                                     &null_bitmap, &null_count));
+    RETURN_NOT_OK(AllocateBuffer(ctx_->memory_pool(), length * sizeof(OutCType), &data));
+    auto raw_data = reinterpret_cast<OutCType*>(data->mutable_data());
+    for (int64_t i = 0; i < length; ++i) {
+      if (kMean) {
+        const int64_t count = counts_.data()[i];
+        raw_data[i] = static_cast<OutCType>(static_cast<double>(sums_.data()[i]) /
+                                            static_cast<double>(count > 0 ? count : 1));
+      } else {
+        raw_data[i] = static_cast<OutCType>(sums_.data()[i]);
+      }
+    }
+    *out = MakeArray(
+        ArrayData::Make(out_type(), length, {null_bitmap, data}, null_count));
+    return Status::OK();
+  }
+
+  std::shared_ptr<DataType> out_type() const override {
+    return TypeTraits<OutType>::type_singleton();
+  }
+
+ private:
+  FunctionContext* ctx_;
+  TypedBufferBuilder<SumCType> sums_;
+  TypedBufferBuilder<int64_t> counts_;
+};
+
+// Min/max of a single value, with the same NaN handling as MinMax().
+template <typename CType, bool kMin, typename Enable = void>
+struct MinMaxOp {
+  static CType initial() {
+    return kMin ? std::numeric_limits<CType>::max() : std::numeric_limits<CType>::min();
+  }
+  static CType Call(CType state, CType value) {
+    return kMin ? std::min(state, value) : std::max(state, value);
+  }
+};
+
+template <typename CType, bool kMin>
+struct MinMaxOp<CType, kMin, enable_if_t<std::is_floating_point<CType>::value>> {
+  static CType initial() {
+    return kMin ? std::numeric_limits<CType>::infinity()
+                : -std::numeric_limits<CType>::infinity();
+  }
+  static CType Call(CType state, CType value) {
+    return kMin ? std::fmin(state, value) : std::fmax(state, value);
+  }
+};
+
+template <typename ArrowType, bool kMin>
+class GroupedMinMaxImpl : public HashAggregateFunction {
+  using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+  using CType = typename ArrowType::c_type;
+  using Op = MinMaxOp<CType, kMin>;
+
+ public:
+  explicit GroupedMinMaxImpl(FunctionContext* ctx)
+      : ctx_(ctx), states_(ctx->memory_pool()), counts_(ctx->memory_pool()) {}
+
+  Status Resize(int64_t num_groups) override {
+    RETURN_NOT_OK(ResizeStates<CType>(&states_, num_groups, Op::initial()));
+    return ResizeStates<int64_t>(&counts_, num_groups, 0);
+  }
+
+  Status Consume(const Array& input, const uint32_t* group_ids) override {
+    const auto values = checked_cast<const ArrayType&>(input).raw_values();
+    CType* states = states_.mutable_data();
+    int64_t* counts = counts_.mutable_data();
+    VisitValid(input, [&](int64_t i) {
+      states[group_ids[i]] = Op::Call(states[group_ids[i]], values[i]);
+      ++counts[group_ids[i]];
+    });
+    return Status::OK();
+  }
+
+  Status Merge(const HashAggregateFunction& other,
+               const uint32_t* group_id_mapping) override {
+    const auto& other_impl = checked_cast<const GroupedMinMaxImpl&>(other);
+    CType* states = states_.mutable_data();
+    int64_t* counts = counts_.mutable_data();
+    for (int64_t i = 0; i < other_impl.counts_.length(); ++i) {
+      const uint32_t group_id = group_id_mapping[i];
+      states[group_id] = Op::Call(states[group_id], other_impl.states_.data()[i]);
+      counts[group_id] += other_impl.counts_.data()[i];
+    }
+    return Status::OK();
+  }
+
+  Status Finalize(std::shared_ptr<Array>* out) override {
+    const int64_t length = counts_.length();
+    std::shared_ptr<Buffer> null_bitmap, data;
+    int64_t null_count;
+    RETURN_NOT_OK(CountsToNullBitmap(ctx_->memory_pool(), counts_.data(), length,
+                                     &null_bitmap, &null_count));
+    RETURN_NOT_OK(AllocateBuffer(ctx_->memory_pool(), length * sizeof(CType), &data));
+    std::memcpy(data->mutable_data(), states_.data(), length * sizeof(CType));
+    *out = MakeArray(
+        ArrayData::Make(out_type(), length, {null_bitmap, data}, null_count));
+    return Status::OK();
+  }
+
+  std::shared_ptr<DataType> out_type() const override {
+    return TypeTraits<ArrowType>::type_singleton();
+  }
+
+ private:
+  FunctionContext* ctx_;
+  TypedBufferBuilder<CType> states_;
+  TypedBufferBuilder<int64_t> counts_;
+};
+
+template <template <typename> class Impl>
+Status MakeNumericHashAggregate(FunctionContext* ctx, const DataType& type,
+                                std::unique_ptr<HashAggregateFunction>* out) {
+#define NUMERIC_HASH_AGG_FN_CASE(T)  \
+  case T::type_id:                   \
+    out->reset(new Impl<T>(ctx));    \
+    return Status::OK();
+
+  switch (type.id()) {
+    NUMERIC_HASH_AGG_FN_CASE(UInt8Type);
+    NUMERIC_HASH_AGG_FN_CASE(Int8Type);
+    NUMERIC_HASH_AGG_FN_CASE(UInt16Type);
+    NUMERIC_HASH_AGG_FN_CASE(Int16Type);
+    NUMERIC_HASH_AGG_FN_CASE(UInt32Type);
+    NUMERIC_HASH_AGG_FN_CASE(Int32Type);
+    NUMERIC_HASH_AGG_FN_CASE(UInt64Type);
+    NUMERIC_HASH_AGG_FN_CASE(Int64Type);
+    NUMERIC_HASH_AGG_FN_CASE(FloatType);
+    NUMERIC_HASH_AGG_FN_CASE(DoubleType);
+    default:
+      return Status::NotImplemented("Grouped aggregation of type ", type);
+  }
+
+#undef NUMERIC_HASH_AGG_FN_CASE
+}
+
+template <typename T>
+using GroupedSum = GroupedSumImpl<T, false>;
+template <typename T>
+using GroupedMean = GroupedSumImpl<T, true>;
+template <typename T>
+using GroupedMin = GroupedMinMaxImpl<T, true>;
+template <typename T>
+using GroupedMax = GroupedMinMaxImpl<T, false>;
+
+const char* AggregateKindName(AggregateSpec::Kind kind) {
+  switch (kind) {
+    case AggregateSpec::COUNT:
+      return "count";
+    case AggregateSpec::SUM:
+      return "sum";
+    case AggregateSpec::MEAN:
+      return "mean";
+    case AggregateSpec::MIN:
+      return "min";
+    case AggregateSpec::MAX:
+      return "max";
+  }
+  return "unknown";
+}
+
+}  // namespace
+
+Status Grouper::Make(FunctionContext* ctx,
+                     const std::vector<std::shared_ptr<DataType>>& key_types,
+                     std::unique_ptr<Grouper>* out) {
+  if (key_types.empty()) {
+    return Status::Invalid("Grouping needs at least one key column");
+  }
+  std::vector<std::unique_ptr<KeyEncoder>> encoders(key_types.size());
+  for (size_t i = 0; i < key_types.size(); ++i) {
+    RETURN_NOT_OK(MakeKeyEncoder(key_types[i], &encoders[i]));
+  }
+  out->reset(new GrouperImpl(ctx, key_types, std::move(encoders)));
+  return Status::OK();
+}
+
+Status MakeHashAggregateFunction(FunctionContext* ctx, AggregateSpec::Kind kind,
+                                 const DataType& type,
+                                 std::unique_ptr<HashAggregateFunction>* out) {
+  switch (kind) {
+    case AggregateSpec::COUNT:
+      out->reset(new GroupedCountImpl(ctx));
+      return Status::OK();
+    case AggregateSpec::SUM:
+      return MakeNumericHashAggregate<GroupedSum>(ctx, type, out);
+    case AggregateSpec::MEAN:
+      return MakeNumericHashAggregate<GroupedMean>(ctx, type, out);
+    case AggregateSpec::MIN:
+      return MakeNumericHashAggregate<GroupedMin>(ctx, type, out);
+    case AggregateSpec::MAX:
+      return MakeNumericHashAggregate<GroupedMax>(ctx, type, out);
+  }
+  return Status::Invalid("Unknown aggregate kind");
+}
+
+// ----------------------------------------------------------------------
+// GroupByAggregator implementation
+
+class GroupByAggregator::Impl {
+ public:
+  Status Init(FunctionContext* ctx, const std::shared_ptr<Schema>& schema,
+              const GroupByOptions& options) {
+    ctx_ = ctx;
+    schema_ = schema;
+    options_ = std::make_shared<GroupByOptions>(options);
+
+    std::vector<std::shared_ptr<Field>> out_fields;
+    std::vector<std::shared_ptr<DataType>> key_types;
+    for (const auto& key : options.keys) {
+      int index;
+      RETURN_NOT_OK(FindField(key, &index));
+      key_indices_.push_back(index);
+      key_types.push_back(schema->field(index)->type());
+      out_fields.push_back(schema->field(index));
+    }
+    RETURN_NOT_OK(Grouper::Make(ctx, key_types, &grouper_));
+
+    for (const auto& aggregate : options.aggregates) {
+      int index;
+      RETURN_NOT_OK(FindField(aggregate.target, &index));
+      target_indices_.push_back(index);
+
+      std::unique_ptr<HashAggregateFunction> function;
+      RETURN_NOT_OK(MakeHashAggregateFunction(
+          ctx, aggregate.kind, *schema->field(index)->type(), &function));
+      out_fields.push_back(
+          field(aggregate.target + "_" + AggregateKindName(aggregate.kind),
+                function->out_type()));
+      aggregates_.push_back(std::move(function));
+    }
+    out_schema_ = arrow::schema(std::move(out_fields));
+    return Status::OK();
+  }
+
+  Status Consume(const RecordBatch& batch) {
+    if (!batch.schema()->Equals(*schema_, /*check_metadata=*/false)) {
+      return Status::Invalid("Batch schema does not match the aggregator's schema");
+    }
+    std::vector<std::shared_ptr<Array>> keys;
+    for (int index : key_indices_) {
+      keys.push_back(batch.column(index));
+    }
+    std::shared_ptr<Array> group_ids;
+    RETURN_NOT_OK(grouper_->Consume(keys, &group_ids));
+    const auto raw_group_ids =
+        checked_cast<const UInt32Array&>(*group_ids).raw_values();
+
+    for (size_t i = 0; i < aggregates_.size(); ++i) {
+      RETURN_NOT_OK(aggregates_[i]->Resize(grouper_->num_groups()));
+      RETURN_NOT_OK(
+          aggregates_[i]->Consume(*batch.column(target_indices_[i]), raw_group_ids));
+    }
+    return Status::OK();
+  }
+
+  Status Merge(const Impl& other) {
+    if (other.aggregates_.size() != aggregates_.size() ||
+        !other.out_schema_->Equals(*out_schema_, /*check_metadata=*/false)) {
+      return Status::Invalid("Cannot merge aggregators with different options");
+    }
+    // Insert the other's keys in this grouper, which maps the other's group
+    // ids to ours.
+    std::vector<std::shared_ptr<Array>> other_keys;
+    RETURN_NOT_OK(other.grouper_->GetUniques(&other_keys));
+    std::shared_ptr<Array> group_id_mapping;
+    RETURN_NOT_OK(grouper_->Consume(other_keys, &group_id_mapping));
+    const auto raw_mapping =
+        checked_cast<const UInt32Array&>(*group_id_mapping).raw_values();
+
+    for (size_t i = 0; i < aggregates_.size(); ++i) {
+      RETURN_NOT_OK(aggregates_[i]->Resize(grouper_->num_groups()));
+      RETURN_NOT_OK(aggregates_[i]->Merge(*other.aggregates_[i], raw_mapping));
+    }
+    return Status::OK();
+  }
+
+  Status Finish(std::shared_ptr<RecordBatch>* out) {
+    std::vector<std::shared_ptr<Array>> columns;
+    RETURN_NOT_OK(grouper_->GetUniques(&columns));
+    for (const auto& aggregate : aggregates_) {
+      std::shared_ptr<Array> column;
+      RETURN_NOT_OK(aggregate->Resize(grouper_->num_groups()));
+      RETURN_NOT_OK(aggregate->Finalize(&column));
+      columns.push_back(std::move(column));
+    }
+    *out = RecordBatch::Make(out_schema_, grouper_->num_groups(), std::move(columns));
+    return Status::OK();
+  }
+
+  FunctionContext* ctx_;
+  std::shared_ptr<Schema> schema_;
+  std::shared_ptr<GroupByOptions> options_;
+  std::shared_ptr<Schema> out_schema_;
+
+ private:
+  Status FindField(const std::string& name, int* index) const {
+    *index = schema_->GetFieldIndex(name);
+    if (*index == -1) {
+      return Status::Invalid("No field named '", name, "' in schema ", *schema_);
+    }
+    return Status::OK();
+  }
+
+  std::vector<int> key_indices_;
+  std::vector<int> target_indices_;
+  std::unique_ptr<Grouper> grouper_;
+  std::vector<std::unique_ptr<HashAggregateFunction>> aggregates_;
+};
+
+GroupByAggregator::GroupByAggregator() : impl_(new Impl()) {}
+
+GroupByAggregator::~GroupByAggregator() {}
+
+Status GroupByAggregator::Make(FunctionContext* ctx,
+                               const std::shared_ptr<Schema>& schema,
+                               const GroupByOptions& options,
+                               std::unique_ptr<GroupByAggregator>* out) {
+  std::unique_ptr<GroupByAggregator> aggregator(new GroupByAggregator());
+  RETURN_NOT_OK(aggregator->impl_->Init(ctx, schema, options));
+  *out = std::move(aggregator);
+  return Status::OK();
+}
+
+Status GroupByAggregator::Consume(const RecordBatch& batch) {
+  return impl_->Consume(batch);
+}
+
+Status GroupByAggregator::Merge(const GroupByAggregator& other) {
+  return impl_->Merge(*other.impl_);
+}
+
+Status GroupByAggregator::Finish(std::shared_ptr<RecordBatch>* out) {
+  return impl_->Finish(out);
+}
+
+std::shared_ptr<Schema> GroupByAggregator::out_schema() const {
+  return impl_->out_schema_;
+}
+
+Status GroupBy(FunctionContext* ctx, RecordBatchReader* reader,
+               const GroupByOptions& options, std::shared_ptr<Table>* out) {
+  std::unique_ptr<GroupByAggregator> aggregator;
+  RETURN_NOT_OK(GroupByAggregator::Make(ctx, reader->schema(), options, &aggregator));
+
+  std::shared_ptr<RecordBatch> batch;
+  while (true) {
+    RETURN_NOT_OK(reader->ReadNext(&batch));
+    if (batch == nullptr) {
+      break;
+    }
+    RETURN_NOT_OK(aggregator->Consume(*batch));
+  }
+
+  RETURN_NOT_OK(aggregator->Finish(&batch));
+  return Table::FromRecordBatches(aggregator->out_schema(), {batch}, out);
+}
+
+Status GroupBy(FunctionContext* ctx, const Table& table, const GroupByOptions& options,
+               std::shared_ptr<Table>* out) {
+  TableBatchReader reader(table);
+  if (!options.use_threads) {
+    return GroupBy(ctx, &reader, options, out);
+  }
+
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  RETURN_NOT_OK(reader.ReadAll(&batches));
+
+  // Each task consumes a strided subset of the batches into its own
+  // aggregator; the partial states are then merged into the first one.
+  const int num_tasks = std::max(
+      1, std::min(GetCpuThreadPoolCapacity(), static_cast<int>(batches.size())));
+  std::vector<std::unique_ptr<GroupByAggregator>> aggregators(num_tasks);
+  for (auto& aggregator : aggregators) {
+    RETURN_NOT_OK(GroupByAggregator::Make(ctx, table.schema(), options, &aggregator));
+  }
+  RETURN_NOT_OK(internal::ParallelFor(num_tasks, [&](int task) {
+    for (size_t i = task; i < batches.size(); i += num_tasks) {
+      RETURN_NOT_OK(aggregators[task]->Consume(*batches[i]));
+    }
+    return Status::OK();
+  }));
+  for (int task = 1; task < num_tasks; ++task) {
+    RETURN_NOT_OK(aggregators[0]->Merge(*aggregators[task]));
+  }
+
+  std::shared_ptr<RecordBatch> batch;
+  RETURN_NOT_OK(aggregators[0]->Finish(&batch));
+  return Table::FromRecordBatches(aggregators[0]->out_schema(), {batch}, out);
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,255 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/status.h"
+#include "arrow/type_fwd.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Array;
+class DataType;
+class RecordBatch;
+class RecordBatchReader;
+class Schema;
+class Table;
+
+namespace compute {
+
+class FunctionContext;
+
+/// \brief Map the rows of one or more key columns to dense group ids
+///
+/// Each distinct key (the tuple of values of all key columns in a row) is
+/// assigned the next unused group id on its first occurrence. Null is treated
+/// as a regular key value, i.e. all rows with a null in the same key column
+/// (and equal values elsewhere) fall into the same group.
+///
+/// Keys are hashed through a BinaryMemoTable over a row-wise encoding of the
+/// key columns, so any mix of supported types can be combined. Floating point
+/// keys are compared bitwise.
+class ARROW_EXPORT Grouper {
+ public:
+  virtual ~Grouper() = default;
+
+  /// \brief Assign a group id to each row of the given key columns
+  ///
+  /// Keys not seen before are inserted. The output is a UInt32Array without
+  /// nulls, with the same length as the key columns.
+  virtual Status Consume(const std::vector<std::shared_ptr<Array>>& keys,
+                         std::shared_ptr<Array>* group_ids) = 0;
+
+  /// \brief Look up the group id of each row of the given key columns
+  ///
+  /// Keys are not inserted. The output is a UInt32Array with the same length
+  /// as the key columns, null where the key was not found.
+  virtual Status Lookup(const std::vector<std::shared_ptr<Array>>& keys,
+                        std::shared_ptr<Array>* group_ids) const = 0;
+
+  /// \brief The number of groups seen so far
+  virtual uint32_t num_groups() const = 0;
+
+  /// \brief Materialize the distinct keys, one array per key column, ordered
+  /// by group id
+  virtual Status GetUniques(std::vector<std::shared_ptr<Array>>* out) const = 0;
+
+  /// \brief Make a Grouper for the given key types
+  ///
+  /// \param[in] ctx the FunctionContext
+  /// \param[in] key_types the types of the key columns, at least one
+  /// \param[out] out created Grouper
+  static Status Make(FunctionContext* ctx,
+                     const std::vector<std::shared_ptr<DataType>>& key_types,
+                     std::unique_ptr<Grouper>* out);
+};
+
+/// \class AggregateSpec
+///
+/// Describes one aggregation computed per group: the aggregate kind and the
+/// name of the column it is applied to.
+struct ARROW_EXPORT AggregateSpec {
+  enum Kind {
+    // Count the non-null values.
+    COUNT = 0,
+    // Sum the non-null values, see Sum().
+    SUM,
+    // Mean of the non-null values, see Mean().
+    MEAN,
+    // Smallest non-null value.
+    MIN,
+    // Largest non-null value.
+    MAX,
+  };
+
+  AggregateSpec(Kind kind, std::string target)
+      : kind(kind), target(std::move(target)) {}
+
+  Kind kind;
+  std::string target;
+};
+
+/// \class GroupByOptions
+///
+/// The user controls the GroupBy kernel with this class: the key columns, the
+/// aggregations computed per group, and whether the input may be consumed on
+/// several threads.
+struct ARROW_EXPORT GroupByOptions {
+  GroupByOptions(std::vector<std::string> keys, std::vector<AggregateSpec> aggregates)
+      : keys(std::move(keys)), aggregates(std::move(aggregates)) {}
+
+  // The key columns, at least one
+  std::vector<std::string> keys;
+  std::vector<AggregateSpec> aggregates;
+  // Consume the input in parallel on the CPU thread pool and merge the
+  // per-thread partial states (Table input only).
+  bool use_threads = true;
+};
+
+/// HashAggregateFunction is the grouped counterpart of AggregateFunction.
+///
+/// It follows the same Consume/Merge/Finalize contract, except that the state
+/// is kept per group: Consume folds each value into the state of the group
+/// given by a parallel array of group ids, Merge folds the states of another
+/// instance into this one given a mapping of the other's group ids to this
+/// instance's, and Finalize produces one value per group.
+///
+/// Unlike AggregateFunction, the per-group states are owned by the instance.
+class ARROW_EXPORT HashAggregateFunction {
+ public:
+  virtual ~HashAggregateFunction() = default;
+
+  /// \brief Grow the number of groups tracked. Groups are never removed.
+  virtual Status Resize(int64_t num_groups) = 0;
+
+  /// \brief Consume an array into the states of the groups in group_ids
+  ///
+  /// group_ids must have the same length as input and refer to groups below
+  /// the size given to Resize().
+  virtual Status Consume(const Array& input, const uint32_t* group_ids) = 0;
+
+  /// \brief Merge the states of other into this instance's states.
+  ///
+  /// Group i of other is merged into group group_id_mapping[i] of this instance.
+  virtual Status Merge(const HashAggregateFunction& other,
+                       const uint32_t* group_id_mapping) = 0;
+
+  /// \brief Convert the states into an array with one value per group
+  virtual Status Finalize(std::shared_ptr<Array>* out) = 0;
+
+  virtual std::shared_ptr<DataType> out_type() const = 0;
+};
+
+/// \brief Return a HashAggregateFunction
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] kind the kind of aggregation
+/// \param[in] type required to specialize the function
+/// \param[out] out created function
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status MakeHashAggregateFunction(FunctionContext* ctx, AggregateSpec::Kind kind,
+                                 const DataType& type,
+                                 std::unique_ptr<HashAggregateFunction>* out);
+
+/// \brief Incremental grouped aggregation over a stream of record batches
+///
+/// Batches are consumed one at a time; independent instances (e.g. one per
+/// thread) can be combined with Merge(). The result has one row per group,
+/// with the key columns followed by one column per aggregation, named
+/// "<target>_<kind>" (e.g. "price_sum").
+class ARROW_EXPORT GroupByAggregator {
+ public:
+  ~GroupByAggregator();
+
+  /// \brief Make an aggregator for batches with the given schema
+  ///
+  /// \param[in] ctx the FunctionContext
+  /// \param[in] schema schema of the batches to consume
+  /// \param[in] options keys and aggregations, see GroupByOptions
+  /// \param[out] out created aggregator
+  static Status Make(FunctionContext* ctx, const std::shared_ptr<Schema>& schema,
+                     const GroupByOptions& options,
+                     std::unique_ptr<GroupByAggregator>* out);
+
+  /// \brief Fold a batch into the per-group states
+  Status Consume(const RecordBatch& batch);
+
+  /// \brief Fold the groups and states of another aggregator (made with the
+  /// same schema and options) into this one
+  Status Merge(const GroupByAggregator& other);
+
+  /// \brief Produce the aggregated result, one row per group
+  Status Finish(std::shared_ptr<RecordBatch>* out);
+
+  /// \brief The schema of the aggregated result
+  std::shared_ptr<Schema> out_schema() const;
+
+ private:
+  GroupByAggregator();
+
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+/// \brief Compute grouped aggregations over a stream of record batches
+///
+/// For example given a table with columns k = ["a", "b", "a", null] and
+/// v = [1, 2, 3, 4], grouping by "k" with {SUM, "v"} yields
+/// k = ["a", "b", null] and v_sum = [4, 2, 4].
+///
+/// Groups are output in order of first appearance.
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] reader the record batches to consume
+/// \param[in] options keys and aggregations, see GroupByOptions
+/// \param[out] out resulting table
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status GroupBy(FunctionContext* ctx, RecordBatchReader* reader,
+               const GroupByOptions& options, std::shared_ptr<Table>* out);
+
+/// \brief Compute grouped aggregations over a table
+///
+/// If options.use_threads is set, the chunks of the table are consumed in
+/// parallel and the partial states merged, in which case the order of the
+/// output groups is unspecified.
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] table the table to consume
+/// \param[in] options keys and aggregations, see GroupByOptions
+/// \param[out] out resulting table
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status GroupBy(FunctionContext* ctx, const Table& table, const GroupByOptions& options,
+               std::shared_ptr<Table>* out);
+
+}  // namespace compute
+}  // namespace arrow
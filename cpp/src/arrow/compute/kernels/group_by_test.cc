@@ -0,0 +1,252 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/group_by.h"
+#include "arrow/compute/kernels/sort_to_indices.h"
+#include "arrow/compute/kernels/take.h"
+#include "arrow/compute/test_util.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+
+namespace arrow {
+namespace compute {
+
+class TestGrouper : public ComputeFixture, public TestBase {
+ protected:
+  void AssertConsume(const std::vector<std::shared_ptr<Array>>& keys,
+                     const std::string& expected_ids) {
+    std::shared_ptr<Array> ids;
+    ASSERT_OK(grouper_->Consume(keys, &ids));
+    ASSERT_OK(ids->ValidateFull());
+    AssertArraysEqual(*ArrayFromJSON(uint32(), expected_ids), *ids);
+  }
+
+  std::unique_ptr<Grouper> grouper_;
+};
+
+TEST_F(TestGrouper, SingleKey) {
+  ASSERT_OK(Grouper::Make(&this->ctx_, {int32()}, &grouper_));
+  AssertConsume({ArrayFromJSON(int32(), "[3, 1, 3, null, 1, null]")},
+                "[0, 1, 0, 2, 1, 2]");
+  AssertConsume({ArrayFromJSON(int32(), "[7, 3, null]")}, "[3, 0, 2]");
+  ASSERT_EQ(grouper_->num_groups(), 4);
+
+  std::vector<std::shared_ptr<Array>> uniques;
+  ASSERT_OK(grouper_->GetUniques(&uniques));
+  ASSERT_EQ(uniques.size(), 1);
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[3, 1, null, 7]"), *uniques[0]);
+}
+
+TEST_F(TestGrouper, MultipleKeys) {
+  ASSERT_OK(Grouper::Make(&this->ctx_, {utf8(), boolean(), float64()}, &grouper_));
+  AssertConsume({ArrayFromJSON(utf8(), R"(["a", "b", "a", "a", null, "b"])"),
+                 ArrayFromJSON(boolean(), "[true, true, true, false, null, true]"),
+                 ArrayFromJSON(float64(), "[1.5, 1.5, 1.5, 1.5, null, 2.5]")},
+                "[0, 1, 0, 2, 3, 4]");
+
+  std::vector<std::shared_ptr<Array>> uniques;
+  ASSERT_OK(grouper_->GetUniques(&uniques));
+  ASSERT_EQ(uniques.size(), 3);
+  AssertArraysEqual(*ArrayFromJSON(utf8(), R"(["a", "b", "a", null, "b"])"),
+                    *uniques[0]);
+  AssertArraysEqual(*ArrayFromJSON(boolean(), "[true, true, false, null, true]"),
+                    *uniques[1]);
+  AssertArraysEqual(*ArrayFromJSON(float64(), "[1.5, 1.5, 1.5, null, 2.5]"),
+                    *uniques[2]);
+}
+
+TEST_F(TestGrouper, Lookup) {
+  ASSERT_OK(Grouper::Make(&this->ctx_, {utf8()}, &grouper_));
+  AssertConsume({ArrayFromJSON(utf8(), R"(["x", "y"])")}, "[0, 1]");
+
+  std::shared_ptr<Array> ids;
+  ASSERT_OK(grouper_->Lookup({ArrayFromJSON(utf8(), R"(["y", "z", "x", null])")}, &ids));
+  ASSERT_OK(ids->ValidateFull());
+  AssertArraysEqual(*ArrayFromJSON(uint32(), "[1, null, 0, null]"), *ids);
+  ASSERT_EQ(grouper_->num_groups(), 2);
+}
+
+TEST_F(TestGrouper, Errors) {
+  ASSERT_RAISES(NotImplemented, Grouper::Make(&this->ctx_, {list(int32())}, &grouper_));
+  ASSERT_RAISES(Invalid, Grouper::Make(&this->ctx_, {}, &grouper_));
+
+  ASSERT_OK(Grouper::Make(&this->ctx_, {int32()}, &grouper_));
+  std::shared_ptr<Array> ids;
+  ASSERT_RAISES(TypeError, grouper_->Consume({ArrayFromJSON(int64(), "[1]")}, &ids));
+  ASSERT_RAISES(Invalid, grouper_->Consume({}, &ids));
+}
+
+class TestGroupBy : public ComputeFixture, public TestBase {
+ protected:
+  void SetUp() override {
+    schema_ = arrow::schema({field("key", utf8()), field("i", int32()),
+                             field("f", float64())});
+    table_ = TableFromJSON(schema_, {R"([
+      {"key": "a", "i": 1, "f": 1.5},
+      {"key": "b", "i": 2, "f": null},
+      {"key": "a", "i": null, "f": 2.5}
+    ])",
+                                     R"([
+      {"key": null, "i": 4, "f": 0.5},
+      {"key": "b", "i": 5, "f": -1.0},
+      {"key": "a", "i": 6, "f": 3.0}
+    ])"});
+  }
+
+  // Sort the groups of a (single chunk) result by key for comparison
+  std::shared_ptr<Table> SortByKey(const std::shared_ptr<Table>& table) {
+    std::shared_ptr<Table> combined, sorted;
+    ARROW_EXPECT_OK(table->CombineChunks(default_memory_pool(), &combined));
+    std::shared_ptr<Array> indices;
+    ARROW_EXPECT_OK(
+        SortToIndices(&this->ctx_, *combined->column(0)->chunk(0), &indices));
+    ARROW_EXPECT_OK(Take(&this->ctx_, *combined, *indices, TakeOptions(), &sorted));
+    return sorted;
+  }
+
+  std::shared_ptr<Schema> schema_;
+  std::shared_ptr<Table> table_;
+};
+
+TEST_F(TestGroupBy, Aggregates) {
+  GroupByOptions options({"key"}, {{AggregateSpec::COUNT, "f"},
+                                   {AggregateSpec::SUM, "i"},
+                                   {AggregateSpec::MEAN, "i"},
+                                   {AggregateSpec::MIN, "f"},
+                                   {AggregateSpec::MAX, "i"}});
+  auto expected_schema = arrow::schema(
+      {field("key", utf8()), field("f_count", int64()), field("i_sum", int64()),
+       field("i_mean", float64()), field("f_min", float64()), field("i_max", int32())});
+  auto expected = TableFromJSON(expected_schema, {R"([
+    {"key": "a", "f_count": 3, "i_sum": 7, "i_mean": 3.5, "f_min": 1.5, "i_max": 6},
+    {"key": "b", "f_count": 1, "i_sum": 7, "i_mean": 3.5, "f_min": -1.0, "i_max": 5},
+    {"key": null, "f_count": 1, "i_sum": 4, "i_mean": 4.0, "f_min": 0.5, "i_max": 4}
+  ])"});
+
+  for (bool use_threads : {false, true}) {
+    options.use_threads = use_threads;
+    std::shared_ptr<Table> actual;
+    ASSERT_OK(GroupBy(&this->ctx_, *table_, options, &actual));
+    ASSERT_OK(actual->ValidateFull());
+    if (use_threads) {
+      actual = SortByKey(actual);
+      auto sorted_expected = SortByKey(expected);
+      AssertTablesEqual(*sorted_expected, *actual);
+    } else {
+      AssertTablesEqual(*expected, *actual);
+    }
+  }
+}
+
+TEST_F(TestGroupBy, MultipleKeys) {
+  GroupByOptions options({"key", "i"}, {{AggregateSpec::SUM, "f"}});
+  options.use_threads = false;
+
+  auto table = TableFromJSON(schema_, {R"([
+    {"key": "a", "i": 1, "f": 1.0},
+    {"key": "a", "i": 2, "f": 2.0},
+    {"key": "a", "i": 1, "f": 3.0},
+    {"key": null, "i": null, "f": 4.0},
+    {"key": null, "i": null, "f": 5.0}
+  ])"});
+  auto expected = TableFromJSON(
+      arrow::schema(
+          {field("key", utf8()), field("i", int32()), field("f_sum", float64())}),
+      {R"([
+    {"key": "a", "i": 1, "f_sum": 4.0},
+    {"key": "a", "i": 2, "f_sum": 2.0},
+    {"key": null, "i": null, "f_sum": 9.0}
+  ])"});
+
+  std::shared_ptr<Table> actual;
+  ASSERT_OK(GroupBy(&this->ctx_, *table, options, &actual));
+  AssertTablesEqual(*expected, *actual);
+}
+
+TEST_F(TestGroupBy, Merge) {
+  GroupByOptions options({"key"}, {{AggregateSpec::SUM, "i"}, {AggregateSpec::MIN, "f"}});
+  std::unique_ptr<GroupByAggregator> left, right;
+  ASSERT_OK(GroupByAggregator::Make(&this->ctx_, schema_, options, &left));
+  ASSERT_OK(GroupByAggregator::Make(&this->ctx_, schema_, options, &right));
+
+  ASSERT_OK(left->Consume(*RecordBatchFromJSON(schema_, R"([
+    {"key": "a", "i": 1, "f": 1.5},
+    {"key": "b", "i": 2, "f": null}
+  ])")));
+  ASSERT_OK(right->Consume(*RecordBatchFromJSON(schema_, R"([
+    {"key": "c", "i": 3, "f": 0.5},
+    {"key": "b", "i": 4, "f": 2.0},
+    {"key": "a", "i": null, "f": 1.0}
+  ])")));
+  ASSERT_OK(left->Merge(*right));
+
+  std::shared_ptr<RecordBatch> actual;
+  ASSERT_OK(left->Finish(&actual));
+  ASSERT_OK(actual->ValidateFull());
+  AssertBatchesEqual(*RecordBatchFromJSON(left->out_schema(), R"([
+    {"key": "a", "i_sum": 1, "f_min": 1.0},
+    {"key": "b", "i_sum": 6, "f_min": 2.0},
+    {"key": "c", "i_sum": 3, "f_min": 0.5}
+  ])"),
+                     *actual);
+}
+
+TEST_F(TestGroupBy, EmptyGroupsAreNull) {
+  GroupByOptions options({"key"}, {{AggregateSpec::SUM, "i"},
+                                   {AggregateSpec::MEAN, "f"},
+                                   {AggregateSpec::MAX, "f"}});
+  options.use_threads = false;
+  auto table = TableFromJSON(schema_, {R"([{"key": "a", "i": null, "f": null}])"});
+
+  std::shared_ptr<Table> actual;
+  ASSERT_OK(GroupBy(&this->ctx_, *table, options, &actual));
+  auto expected = TableFromJSON(
+      arrow::schema({field("key", utf8()), field("i_sum", int64()),
+                     field("f_mean", float64()), field("f_max", float64())}),
+      {R"([{"key": "a", "i_sum": null, "f_mean": null, "f_max": null}])"});
+  AssertTablesEqual(*expected, *actual);
+}
+
+TEST_F(TestGroupBy, Errors) {
+  std::shared_ptr<Table> actual;
+  ASSERT_RAISES(Invalid, GroupBy(&this->ctx_, *table_,
+                                 GroupByOptions({"missing"}, {}), &actual));
+  // Without keys there would be no group to aggregate the rows into
+  ASSERT_RAISES(Invalid, GroupBy(&this->ctx_, *table_,
+                                 GroupByOptions({}, {{AggregateSpec::SUM, "i"}}),
+                                 &actual));
+  std::unique_ptr<GroupByAggregator> aggregator;
+  ASSERT_RAISES(Invalid,
+                GroupByAggregator::Make(&this->ctx_, table_->schema(),
+                                        GroupByOptions({}, {{AggregateSpec::SUM, "i"}}),
+                                        &aggregator));
+  ASSERT_RAISES(NotImplemented,
+                GroupBy(&this->ctx_, *table_,
+                        GroupByOptions({"i"}, {{AggregateSpec::SUM, "key"}}), &actual));
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,341 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/hash_join.h"
+
+#include <algorithm>
+#include <deque>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/buffer_builder.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/group_by.h"
+#include "arrow/compute/kernels/take.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/task_group.h"
+#include "arrow/util/thread_pool.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+using internal::TaskGroup;
+
+namespace compute {
+
+namespace {
+
+Status FindKeyFields(const Schema& schema, const std::vector<std::string>& names,
+                     std::vector<int>* indices) {
+  for (const auto& name : names) {
+    const int index = schema.GetFieldIndex(name);
+    if (index == -1) {
+      return Status::Invalid("No field named '", name, "' in schema ", schema);
+    }
+    indices->push_back(index);
+  }
+  return Status::OK();
+}
+
+// Get the single chunk of a combined column (an empty column has no chunks).
+Status GetCombinedChunk(MemoryPool* pool, const ChunkedArray& column,
+                        std::shared_ptr<Array>* out) {
+  if (column.num_chunks() == 0) {
+    return MakeArrayOfNull(pool, column.type(), 0, out);
+  }
+  DCHECK_EQ(column.num_chunks(), 1);
+  *out = column.chunk(0);
+  return Status::OK();
+}
+
+}  // namespace
+
+class HashJoiner::Impl {
+ public:
+  Status Init(FunctionContext* ctx, const std::shared_ptr<Schema>& left_schema,
+              const std::shared_ptr<Table>& right, const HashJoinOptions& options) {
+    ctx_ = ctx;
+    join_type_ = options.join_type;
+
+    std::vector<int> right_key_indices;
+    RETURN_NOT_OK(FindKeyFields(*left_schema, options.left_keys, &left_key_indices_));
+    RETURN_NOT_OK(
+        FindKeyFields(*right->schema(), options.right_keys, &right_key_indices));
+    if (left_key_indices_.size() != right_key_indices.size()) {
+      return Status::Invalid("Join needs as many left keys as right keys");
+    }
+    if (left_key_indices_.empty()) {
+      return Status::Invalid("Join needs at least one key");
+    }
+
+    std::vector<std::shared_ptr<DataType>> key_types;
+    for (size_t i = 0; i < left_key_indices_.size(); ++i) {
+      const auto& left_type = left_schema->field(left_key_indices_[i])->type();
+      const auto& right_type = right->schema()->field(right_key_indices[i])->type();
+      if (!left_type->Equals(*right_type)) {
+        return Status::TypeError("Join key types differ: ", *left_type, " and ",
+                                 *right_type);
+      }
+      key_types.push_back(left_type);
+    }
+    RETURN_NOT_OK(Grouper::Make(ctx, key_types, &grouper_));
+
+    // Gather the build side into one chunk per column, so that the payload
+    // can be taken from without concatenating on every probe.
+    std::shared_ptr<Table> combined;
+    RETURN_NOT_OK(right->CombineChunks(ctx->memory_pool(), &combined));
+    std::vector<std::shared_ptr<Array>> right_keys;
+    for (int index : right_key_indices) {
+      std::shared_ptr<Array> key;
+      RETURN_NOT_OK(GetCombinedChunk(ctx->memory_pool(), *combined->column(index), &key));
+      right_keys.push_back(std::move(key));
+    }
+
+    std::vector<std::shared_ptr<Field>> out_fields = left_schema->fields();
+    if (join_type_ == HashJoinOptions::INNER ||
+        join_type_ == HashJoinOptions::LEFT_OUTER) {
+      for (int i = 0; i < combined->num_columns(); ++i) {
+        if (std::find(right_key_indices.begin(), right_key_indices.end(), i) !=
+            right_key_indices.end()) {
+          continue;
+        }
+        std::shared_ptr<Array> payload;
+        RETURN_NOT_OK(
+            GetCombinedChunk(ctx->memory_pool(), *combined->column(i), &payload));
+        right_payload_.push_back(std::move(payload));
+        auto out_field = right->schema()->field(i);
+        if (join_type_ == HashJoinOptions::LEFT_OUTER) {
+          // Left rows without a match get nulls on the right
+          out_field = out_field->WithNullable(true);
+        }
+        if (!left_schema->GetAllFieldIndices(out_field->name()).empty()) {
+          return Status::Invalid("Join output would have duplicate column name '",
+                                 out_field->name(), "'");
+        }
+        out_fields.push_back(std::move(out_field));
+      }
+    }
+    out_schema_ = schema(std::move(out_fields));
+
+    return Build(right_keys);
+  }
+
+  Status Probe(const RecordBatch& left, std::shared_ptr<RecordBatch>* out) const {
+    std::vector<std::shared_ptr<Array>> keys;
+    for (int index : left_key_indices_) {
+      keys.push_back(left.column(index));
+    }
+    std::shared_ptr<Array> group_ids;
+    RETURN_NOT_OK(grouper_->Lookup(keys, &group_ids));
+    const auto& group_ids_array = checked_cast<const UInt32Array&>(*group_ids);
+
+    MemoryPool* pool = ctx_->memory_pool();
+    TypedBufferBuilder<uint32_t> left_indices(pool);
+    TypedBufferBuilder<int64_t> right_indices(pool);
+    TypedBufferBuilder<bool> right_validity(pool);
+    RETURN_NOT_OK(left_indices.Reserve(left.num_rows()));
+
+    for (int64_t i = 0; i < left.num_rows(); ++i) {
+      int64_t begin = 0, end = 0;
+      if (group_ids_array.IsValid(i)) {
+        const uint32_t group_id = group_ids_array.Value(i);
+        begin = bucket_offsets_[group_id];
+        end = bucket_offsets_[group_id + 1];
+      }
+      const auto row = static_cast<uint32_t>(i);
+      switch (join_type_) {
+        case HashJoinOptions::INNER:
+        case HashJoinOptions::LEFT_OUTER:
+          if (begin < end) {
+            RETURN_NOT_OK(left_indices.Append(end - begin, row));
+            RETURN_NOT_OK(right_indices.Append(bucket_rows_.data() + begin, end - begin));
+            RETURN_NOT_OK(right_validity.Append(end - begin, true));
+          } else if (join_type_ == HashJoinOptions::LEFT_OUTER) {
+            RETURN_NOT_OK(left_indices.Append(row));
+            RETURN_NOT_OK(right_indices.Append(0));
+            RETURN_NOT_OK(right_validity.Append(false));
+          }
+          break;
+        case HashJoinOptions::LEFT_SEMI:
+          if (begin < end) {
+            left_indices.UnsafeAppend(row);
+          }
+          break;
+        case HashJoinOptions::LEFT_ANTI:
+          if (begin == end) {
+            left_indices.UnsafeAppend(row);
+          }
+          break;
+      }
+    }
+
+    const int64_t num_rows = left_indices.length();
+    std::shared_ptr<Buffer> left_indices_buffer;
+    RETURN_NOT_OK(left_indices.Finish(&left_indices_buffer));
+    UInt32Array left_indices_array(num_rows, left_indices_buffer);
+
+    std::vector<std::shared_ptr<Array>> columns(out_schema_->num_fields());
+    for (int i = 0; i < left.num_columns(); ++i) {
+      RETURN_NOT_OK(Take(ctx_, *left.column(i), left_indices_array, TakeOptions(),
+                         &columns[i]));
+    }
+
+    if (!right_payload_.empty()) {
+      const int64_t null_count = right_validity.false_count();
+      std::shared_ptr<Buffer> right_indices_buffer, right_validity_buffer;
+      RETURN_NOT_OK(right_indices.Finish(&right_indices_buffer));
+      RETURN_NOT_OK(right_validity.Finish(&right_validity_buffer));
+      Int64Array right_indices_array(num_rows, right_indices_buffer,
+                                     null_count > 0 ? right_validity_buffer : nullptr,
+                                     null_count);
+      for (size_t i = 0; i < right_payload_.size(); ++i) {
+        RETURN_NOT_OK(Take(ctx_, *right_payload_[i], right_indices_array, TakeOptions(),
+                           &columns[left.num_columns() + i]));
+      }
+    }
+
+    *out = RecordBatch::Make(out_schema_, num_rows, std::move(columns));
+    return Status::OK();
+  }
+
+  FunctionContext* ctx_;
+  std::shared_ptr<Schema> out_schema_;
+
+ private:
+  // Bucket the right rows by group id: the rows with group id g are
+  // bucket_rows_[bucket_offsets_[g]:bucket_offsets_[g + 1]], in table order.
+  // Rows with a null key are left out since they never match.
+  Status Build(const std::vector<std::shared_ptr<Array>>& right_keys) {
+    std::shared_ptr<Array> group_ids;
+    RETURN_NOT_OK(grouper_->Consume(right_keys, &group_ids));
+    const uint32_t* raw_group_ids =
+        checked_cast<const UInt32Array&>(*group_ids).raw_values();
+    const int64_t num_rows = group_ids->length();
+
+    std::vector<bool> has_null_key(num_rows, false);
+    for (const auto& key : right_keys) {
+      if (key->null_count() == 0) continue;
+      for (int64_t i = 0; i < num_rows; ++i) {
+        if (key->IsNull(i)) {
+          has_null_key[i] = true;
+        }
+      }
+    }
+
+    bucket_offsets_.assign(grouper_->num_groups() + 1, 0);
+    for (int64_t i = 0; i < num_rows; ++i) {
+      if (!has_null_key[i]) {
+        ++bucket_offsets_[raw_group_ids[i] + 1];
+      }
+    }
+    for (size_t g = 1; g < bucket_offsets_.size(); ++g) {
+      bucket_offsets_[g] += bucket_offsets_[g - 1];
+    }
+
+    std::vector<int64_t> positions(bucket_offsets_.begin(), bucket_offsets_.end() - 1);
+    bucket_rows_.resize(bucket_offsets_.back());
+    for (int64_t i = 0; i < num_rows; ++i) {
+      if (!has_null_key[i]) {
+        bucket_rows_[positions[raw_group_ids[i]]++] = i;
+      }
+    }
+    return Status::OK();
+  }
+
+  HashJoinOptions::JoinType join_type_;
+  std::vector<int> left_key_indices_;
+  std::vector<std::shared_ptr<Array>> right_payload_;
+  std::unique_ptr<Grouper> grouper_;
+  std::vector<int64_t> bucket_offsets_;
+  std::vector<int64_t> bucket_rows_;
+};
+
+HashJoiner::HashJoiner() : impl_(new Impl()) {}
+
+HashJoiner::~HashJoiner() {}
+
+Status HashJoiner::Make(FunctionContext* ctx, const std::shared_ptr<Schema>& left_schema,
+                        const std::shared_ptr<Table>& right,
+                        const HashJoinOptions& options,
+                        std::unique_ptr<HashJoiner>* out) {
+  std::unique_ptr<HashJoiner> joiner(new HashJoiner());
+  RETURN_NOT_OK(joiner->impl_->Init(ctx, left_schema, right, options));
+  *out = std::move(joiner);
+  return Status::OK();
+}
+
+Status HashJoiner::Probe(const RecordBatch& left,
+                         std::shared_ptr<RecordBatch>* out) const {
+  return impl_->Probe(left, out);
+}
+
+std::shared_ptr<Schema> HashJoiner::out_schema() const { return impl_->out_schema_; }
+
+Status HashJoin(FunctionContext* ctx, RecordBatchReader* left,
+                const std::shared_ptr<Table>& right, const HashJoinOptions& options,
+                std::shared_ptr<Table>* out) {
+  std::unique_ptr<HashJoiner> joiner;
+  RETURN_NOT_OK(HashJoiner::Make(ctx, left->schema(), right, options, &joiner));
+
+  auto task_group = options.use_threads
+                        ? TaskGroup::MakeThreaded(internal::GetCpuThreadPool())
+                        : TaskGroup::MakeSerial();
+
+  // A deque keeps references to its elements valid while growing, so tasks
+  // can write their result in place as more batches are read.
+  std::deque<std::shared_ptr<RecordBatch>> results;
+  while (task_group->ok()) {
+    std::shared_ptr<RecordBatch> batch;
+    Status st = left->ReadNext(&batch);
+    if (!st.ok()) {
+      // Wait for running tasks, which refer to `results`
+      ARROW_UNUSED(task_group->Finish());
+      return st;
+    }
+    if (batch == nullptr) {
+      break;
+    }
+    results.emplace_back();
+    std::shared_ptr<RecordBatch>* result = &results.back();
+    const HashJoiner* joiner_ptr = joiner.get();
+    task_group->Append(
+        [joiner_ptr, batch, result] { return joiner_ptr->Probe(*batch, result); });
+  }
+  RETURN_NOT_OK(task_group->Finish());
+
+  std::vector<std::shared_ptr<RecordBatch>> batches(results.begin(), results.end());
+  return Table::FromRecordBatches(joiner->out_schema(), batches, out);
+}
+
+Status HashJoin(FunctionContext* ctx, const Table& left,
+                const std::shared_ptr<Table>& right, const HashJoinOptions& options,
+                std::shared_ptr<Table>* out) {
+  TableBatchReader reader(left);
+  return HashJoin(ctx, &reader, right, options, out);
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,149 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class RecordBatch;
+class RecordBatchReader;
+class Schema;
+class Table;
+
+namespace compute {
+
+class FunctionContext;
+
+/// \class HashJoinOptions
+///
+/// The user controls the HashJoin kernel with this class. The left input is
+/// the probe side (typically a large fact table, possibly streamed), the right
+/// input is the build side (typically a smaller dimension table) which is
+/// loaded into a hash table.
+///
+/// Keys are compared by value; a null key never matches anything.
+struct ARROW_EXPORT HashJoinOptions {
+  enum JoinType {
+    // Emit a row for each pair of matching left and right rows.
+    INNER = 0,
+    // Like INNER, plus left rows without a match, with nulls on the right.
+    LEFT_OUTER,
+    // Emit each left row that has at least one match, once.
+    LEFT_SEMI,
+    // Emit each left row that has no match.
+    LEFT_ANTI,
+  };
+
+  HashJoinOptions(JoinType join_type, std::vector<std::string> left_keys,
+                  std::vector<std::string> right_keys)
+      : join_type(join_type),
+        left_keys(std::move(left_keys)),
+        right_keys(std::move(right_keys)) {}
+
+  JoinType join_type;
+  std::vector<std::string> left_keys;
+  std::vector<std::string> right_keys;
+  // Probe the left batches in parallel on the CPU thread pool.
+  bool use_threads = true;
+};
+
+/// \brief Build/probe hash join of record batches against a table
+///
+/// The right table is hashed once on construction; Probe() can then be
+/// called concurrently from several threads. Output rows are gathered with
+/// Take() on both sides, so payload columns are never copied row by row.
+///
+/// For INNER and LEFT_OUTER joins the output has all left columns followed
+/// by the right columns other than the right keys; these must not have the
+/// same name as a left column. LEFT_OUTER makes the right columns nullable.
+/// For LEFT_SEMI and LEFT_ANTI joins the output has the left schema.
+class ARROW_EXPORT HashJoiner {
+ public:
+  ~HashJoiner();
+
+  /// \brief Build the hash table from the right (build side) table
+  ///
+  /// \param[in] ctx the FunctionContext
+  /// \param[in] left_schema the schema of the batches to probe with
+  /// \param[in] right the build side table
+  /// \param[in] options join type and keys, see HashJoinOptions
+  /// \param[out] out created joiner
+  static Status Make(FunctionContext* ctx, const std::shared_ptr<Schema>& left_schema,
+                     const std::shared_ptr<Table>& right, const HashJoinOptions& options,
+                     std::unique_ptr<HashJoiner>* out);
+
+  /// \brief Join a batch of left (probe side) rows against the right table
+  ///
+  /// Output rows follow the order of the left rows; the matches of a left row
+  /// follow the order of the right table. This method is thread-safe.
+  Status Probe(const RecordBatch& left, std::shared_ptr<RecordBatch>* out) const;
+
+  /// \brief The schema of the joined batches
+  std::shared_ptr<Schema> out_schema() const;
+
+ private:
+  HashJoiner();
+
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+/// \brief Join a stream of record batches against a table
+///
+/// The right table is loaded into a hash table keyed on options.right_keys,
+/// then each left batch is probed with its options.left_keys columns. With
+/// options.use_threads, batches are probed in parallel on the CPU thread
+/// pool; the output batches keep the order of the input batches.
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] left the probe side batches
+/// \param[in] right the build side table
+/// \param[in] options join type and keys, see HashJoinOptions
+/// \param[out] out resulting table
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status HashJoin(FunctionContext* ctx, RecordBatchReader* left,
+                const std::shared_ptr<Table>& right, const HashJoinOptions& options,
+                std::shared_ptr<Table>* out);
+
+/// \brief Join two tables
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] left the probe side table
+/// \param[in] right the build side table
+/// \param[in] options join type and keys, see HashJoinOptions
+/// \param[out] out resulting table
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status HashJoin(FunctionContext* ctx, const Table& left,
+                const std::shared_ptr<Table>& right, const HashJoinOptions& options,
+                std::shared_ptr<Table>* out);
+
+}  // namespace compute
+}  // namespace arrow
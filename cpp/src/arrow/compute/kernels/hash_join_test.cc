@@ -0,0 +1,201 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/hash_join.h"
+#include "arrow/compute/test_util.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+
+namespace arrow {
+namespace compute {
+
+class TestHashJoin : public ComputeFixture, public TestBase {
+ protected:
+  void SetUp() override {
+    left_schema_ = schema({field("k", int32()), field("s", utf8()), field("v", int64())});
+    right_schema_ =
+        schema({field("rk", int32()), field("rs", utf8()), field("name", utf8())});
+    left_ = TableFromJSON(left_schema_, {R"([
+      {"k": 1, "s": "x", "v": 10},
+      {"k": 2, "s": "x", "v": 20}
+    ])",
+                                         R"([
+      {"k": 3, "s": "y", "v": 30},
+      {"k": 2, "s": "y", "v": 40},
+      {"k": 9, "s": "x", "v": 50},
+      {"k": null, "s": "x", "v": 60}
+    ])"});
+    right_ = TableFromJSON(right_schema_, {R"([
+      {"rk": 2, "rs": "x", "name": "two"},
+      {"rk": 3, "rs": "y", "name": "three"}
+    ])",
+                                           R"([
+      {"rk": 2, "rs": "y", "name": "deux"},
+      {"rk": null, "rs": "x", "name": "nothing"},
+      {"rk": 2, "rs": "x", "name": "zwei"}
+    ])"});
+  }
+
+  void AssertJoin(const HashJoinOptions& options,
+                  const std::shared_ptr<Schema>& expected_schema,
+                  const std::string& expected_json) {
+    auto expected = TableFromJSON(expected_schema, {expected_json});
+    for (bool use_threads : {false, true}) {
+      HashJoinOptions local_options = options;
+      local_options.use_threads = use_threads;
+      std::shared_ptr<Table> actual, combined;
+      ASSERT_OK(HashJoin(&this->ctx_, *left_, right_, local_options, &actual));
+      ASSERT_OK(actual->ValidateFull());
+      ASSERT_OK(actual->CombineChunks(default_memory_pool(), &combined));
+      AssertTablesEqual(*expected, *combined);
+    }
+  }
+
+  std::shared_ptr<Schema> left_schema_, right_schema_;
+  std::shared_ptr<Table> left_, right_;
+};
+
+TEST_F(TestHashJoin, Inner) {
+  auto out_schema = schema({field("k", int32()), field("s", utf8()), field("v", int64()),
+                            field("rs", utf8()), field("name", utf8())});
+  AssertJoin(HashJoinOptions(HashJoinOptions::INNER, {"k"}, {"rk"}), out_schema, R"([
+    {"k": 2, "s": "x", "v": 20, "rs": "x", "name": "two"},
+    {"k": 2, "s": "x", "v": 20, "rs": "y", "name": "deux"},
+    {"k": 2, "s": "x", "v": 20, "rs": "x", "name": "zwei"},
+    {"k": 3, "s": "y", "v": 30, "rs": "y", "name": "three"},
+    {"k": 2, "s": "y", "v": 40, "rs": "x", "name": "two"},
+    {"k": 2, "s": "y", "v": 40, "rs": "y", "name": "deux"},
+    {"k": 2, "s": "y", "v": 40, "rs": "x", "name": "zwei"}
+  ])");
+}
+
+TEST_F(TestHashJoin, LeftOuter) {
+  auto out_schema = schema({field("k", int32()), field("s", utf8()), field("v", int64()),
+                            field("rs", utf8()), field("name", utf8())});
+  AssertJoin(HashJoinOptions(HashJoinOptions::LEFT_OUTER, {"k"}, {"rk"}), out_schema, R"([
+    {"k": 1, "s": "x", "v": 10, "rs": null, "name": null},
+    {"k": 2, "s": "x", "v": 20, "rs": "x", "name": "two"},
+    {"k": 2, "s": "x", "v": 20, "rs": "y", "name": "deux"},
+    {"k": 2, "s": "x", "v": 20, "rs": "x", "name": "zwei"},
+    {"k": 3, "s": "y", "v": 30, "rs": "y", "name": "three"},
+    {"k": 2, "s": "y", "v": 40, "rs": "x", "name": "two"},
+    {"k": 2, "s": "y", "v": 40, "rs": "y", "name": "deux"},
+    {"k": 2, "s": "y", "v": 40, "rs": "x", "name": "zwei"},
+    {"k": 9, "s": "x", "v": 50, "rs": null, "name": null},
+    {"k": null, "s": "x", "v": 60, "rs": null, "name": null}
+  ])");
+}
+
+TEST_F(TestHashJoin, LeftOuterNonNullable) {
+  auto right_schema = schema({field("rk", int32()), field("name", utf8(), false)});
+  auto right = TableFromJSON(right_schema, {R"([{"rk": 2, "name": "two"}])"});
+  std::shared_ptr<Table> actual;
+  ASSERT_OK(HashJoin(&this->ctx_, *left_, right,
+                     HashJoinOptions(HashJoinOptions::LEFT_OUTER, {"k"}, {"rk"}),
+                     &actual));
+  ASSERT_OK(actual->ValidateFull());
+  ASSERT_TRUE(actual->schema()->GetFieldByName("name")->nullable());
+  ASSERT_EQ(actual->GetColumnByName("name")->null_count(), 4);
+
+  // INNER joins keep the right nullability
+  ASSERT_OK(HashJoin(&this->ctx_, *left_, right,
+                     HashJoinOptions(HashJoinOptions::INNER, {"k"}, {"rk"}), &actual));
+  ASSERT_FALSE(actual->schema()->GetFieldByName("name")->nullable());
+}
+
+TEST_F(TestHashJoin, DuplicateColumnNames) {
+  auto right_schema = schema({field("rk", int32()), field("v", int64())});
+  auto right = TableFromJSON(right_schema, {R"([{"rk": 2, "v": 1}])"});
+  std::shared_ptr<Table> actual;
+  for (auto join_type : {HashJoinOptions::INNER, HashJoinOptions::LEFT_OUTER}) {
+    ASSERT_RAISES(Invalid, HashJoin(&this->ctx_, *left_, right,
+                                    HashJoinOptions(join_type, {"k"}, {"rk"}), &actual));
+  }
+  // Only the left columns are output by semi joins, and right keys are dropped
+  ASSERT_OK(HashJoin(&this->ctx_, *left_, right,
+                     HashJoinOptions(HashJoinOptions::LEFT_SEMI, {"k"}, {"rk"}),
+                     &actual));
+  auto keyed_right = TableFromJSON(schema({field("k", int32())}), {R"([{"k": 2}])"});
+  ASSERT_OK(HashJoin(&this->ctx_, *left_, keyed_right,
+                     HashJoinOptions(HashJoinOptions::INNER, {"k"}, {"k"}), &actual));
+}
+
+TEST_F(TestHashJoin, MultipleKeys) {
+  auto out_schema = schema({field("k", int32()), field("s", utf8()), field("v", int64()),
+                            field("name", utf8())});
+  AssertJoin(HashJoinOptions(HashJoinOptions::INNER, {"k", "s"}, {"rk", "rs"}),
+             out_schema, R"([
+    {"k": 2, "s": "x", "v": 20, "name": "two"},
+    {"k": 2, "s": "x", "v": 20, "name": "zwei"},
+    {"k": 3, "s": "y", "v": 30, "name": "three"},
+    {"k": 2, "s": "y", "v": 40, "name": "deux"}
+  ])");
+}
+
+TEST_F(TestHashJoin, SemiAndAnti) {
+  AssertJoin(HashJoinOptions(HashJoinOptions::LEFT_SEMI, {"k"}, {"rk"}), left_schema_,
+             R"([
+    {"k": 2, "s": "x", "v": 20},
+    {"k": 3, "s": "y", "v": 30},
+    {"k": 2, "s": "y", "v": 40}
+  ])");
+  AssertJoin(HashJoinOptions(HashJoinOptions::LEFT_ANTI, {"k"}, {"rk"}), left_schema_,
+             R"([
+    {"k": 1, "s": "x", "v": 10},
+    {"k": 9, "s": "x", "v": 50},
+    {"k": null, "s": "x", "v": 60}
+  ])");
+}
+
+TEST_F(TestHashJoin, EmptyBuildSide) {
+  auto empty_right = TableFromJSON(right_schema_, {"[]"});
+  std::shared_ptr<Table> actual;
+  ASSERT_OK(HashJoin(&this->ctx_, *left_, empty_right,
+                     HashJoinOptions(HashJoinOptions::INNER, {"k"}, {"rk"}), &actual));
+  ASSERT_EQ(actual->num_rows(), 0);
+  ASSERT_OK(HashJoin(&this->ctx_, *left_, empty_right,
+                     HashJoinOptions(HashJoinOptions::LEFT_ANTI, {"k"}, {"rk"}),
+                     &actual));
+  ASSERT_EQ(actual->num_rows(), left_->num_rows());
+}
+
+TEST_F(TestHashJoin, Errors) {
+  std::shared_ptr<Table> actual;
+  ASSERT_RAISES(Invalid,
+                HashJoin(&this->ctx_, *left_, right_,
+                         HashJoinOptions(HashJoinOptions::INNER, {"k"}, {"missing"}),
+                         &actual));
+  ASSERT_RAISES(Invalid, HashJoin(&this->ctx_, *left_, right_,
+                                  HashJoinOptions(HashJoinOptions::INNER, {"k"}, {}),
+                                  &actual));
+  ASSERT_RAISES(TypeError,
+                HashJoin(&this->ctx_, *left_, right_,
+                         HashJoinOptions(HashJoinOptions::INNER, {"v"}, {"rk"}),
+                         &actual));
+}
+
+}  // namespace compute
+}  // namespace arrow
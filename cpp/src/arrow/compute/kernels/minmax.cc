@@ -21,6 +21,7 @@
 
 #include "arrow/compute/kernels/aggregate.h"
 #include "arrow/compute/kernels/minmax.h"
+#include "arrow/compute/kernels/minmax_internal.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/checked_cast.h"
 
@@ -84,11 +85,17 @@ class MinMaxAggregateFunction final
   Status Consume(const Array& array, StateType* state) const override {
     StateType local;
 
-    internal::BitmapReader reader(array.null_bitmap_data(), array.offset(),
-                                  array.length());
     const auto values =
         checked_cast<const typename TypeTraits<ArrowType>::ArrayType&>(array)
             .raw_values();
+    if (array.null_count() == 0) {
+      MinMaxDense(values, array.length(), &local.min, &local.max);
+      *state = local;
+      return Status::OK();
+    }
+
+    internal::BitmapReader reader(array.null_bitmap_data(), array.offset(),
+                                  array.length());
     for (int64_t i = 0; i < array.length(); i++) {
       if (reader.IsSet()) {
         local.MergeOne(values[i]);
@@ -0,0 +1,103 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "arrow/util/dispatch.h"
+
+namespace arrow {
+namespace compute {
+
+// ----------------------------------------------------------------------
+// Min and max of values without nulls, with an implementation for each
+// DispatchLevel
+
+/// Update *min and *max with the given values.  The values are reduced in
+/// independent lanes, which lets the compiler vectorize the loop.  NaNs are
+/// ignored, as with std::fmin and std::fmax, since they compare false; *min
+/// and *max must not be NaN.
+template <internal::DispatchLevel Level, typename CType>
+void MinMaxDenseLoop(const CType* values, int64_t length, CType* min, CType* max) {
+  constexpr int64_t kLanes = 16;
+  CType mins[kLanes];
+  CType maxs[kLanes];
+  for (int64_t j = 0; j < kLanes; ++j) {
+    mins[j] = *min;
+    maxs[j] = *max;
+  }
+
+  const int64_t num_blocks = length / kLanes;
+  for (int64_t block = 0; block < num_blocks; ++block) {
+    const CType* block_values = values + block * kLanes;
+    for (int64_t j = 0; j < kLanes; ++j) {
+      const CType value = block_values[j];
+      mins[j] = value < mins[j] ? value : mins[j];
+      maxs[j] = value > maxs[j] ? value : maxs[j];
+    }
+  }
+  for (int64_t i = num_blocks * kLanes; i < length; ++i) {
+    const CType value = values[i];
+    mins[0] = value < mins[0] ? value : mins[0];
+    maxs[0] = value > maxs[0] ? value : maxs[0];
+  }
+
+  for (int64_t j = 0; j < kLanes; ++j) {
+    *min = mins[j] < *min ? mins[j] : *min;
+    *max = maxs[j] > *max ? maxs[j] : *max;
+  }
+}
+
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+template <typename CType>
+void MinMaxDenseAvx2(const CType* values, int64_t length, CType* min, CType* max);
+#endif
+
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+template <typename CType>
+void MinMaxDenseAvx512(const CType* values, int64_t length, CType* min, CType* max);
+#endif
+
+template <typename CType>
+struct MinMaxDenseDynamic {
+  using FunctionType = decltype(&MinMaxDenseLoop<internal::DispatchLevel::NONE, CType>);
+
+  static std::vector<std::pair<internal::DispatchLevel, FunctionType>> implementations() {
+    return {
+      {internal::DispatchLevel::NONE,
+       MinMaxDenseLoop<internal::DispatchLevel::NONE, CType>}
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+      , {internal::DispatchLevel::AVX2, MinMaxDenseAvx2<CType>}
+#endif
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+      , {internal::DispatchLevel::AVX512, MinMaxDenseAvx512<CType>}
+#endif
+    };
+  }
+};
+
+template <typename CType>
+void MinMaxDense(const CType* values, int64_t length, CType* min, CType* max) {
+  static internal::DynamicDispatch<MinMaxDenseDynamic<CType>> dispatch;
+  dispatch.func(values, length, min, max);
+}
+
+}  // namespace compute
+}  // namespace arrow
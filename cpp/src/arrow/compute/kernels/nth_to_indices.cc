@@ -0,0 +1,288 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/nth_to_indices.h"
+
+#include <algorithm>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/compute/context.h"
+#include "arrow/table.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/checked_cast.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+
+namespace {
+
+template <typename ArrowType>
+struct SelectionTypes {
+  using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+  // The value type returned by GetView(), e.g. int32_t or util::string_view
+  using ViewType = decltype(std::declval<ArrayType>().GetView(0));
+};
+
+// Partition the non-null rows to the front, then select the n-th of them
+template <typename IsNull, typename Less>
+void PartitionIndices(uint64_t* indices_begin, uint64_t* indices_end, int64_t n,
+                      bool has_nulls, IsNull&& is_null, Less&& less) {
+  uint64_t* nulls_begin = indices_end;
+  if (has_nulls) {
+    nulls_begin = std::partition(indices_begin, indices_end,
+                                 [&is_null](uint64_t row) { return !is_null(row); });
+  }
+  if (indices_begin + n < nulls_begin) {
+    std::nth_element(indices_begin, indices_begin + n, nulls_begin, less);
+  }
+}
+
+template <typename ArrowType>
+Status NthToIndicesImpl(FunctionContext* ctx, const ChunkedArray& values, int64_t n,
+                        std::shared_ptr<Array>* offsets) {
+  using ArrayType = typename SelectionTypes<ArrowType>::ArrayType;
+  using ViewType = typename SelectionTypes<ArrowType>::ViewType;
+
+  const int64_t length = values.length();
+  if (n < 0 || n >= length) {
+    return Status::IndexError("NthToIndices index ", n, " out of bounds for length ",
+                              length);
+  }
+  std::shared_ptr<Buffer> indices_buf;
+  RETURN_NOT_OK(
+      AllocateBuffer(ctx->memory_pool(), length * sizeof(uint64_t), &indices_buf));
+  auto indices_begin = reinterpret_cast<uint64_t*>(indices_buf->mutable_data());
+  auto indices_end = indices_begin + length;
+  std::iota(indices_begin, indices_end, 0);
+  const bool has_nulls = values.null_count() > 0;
+
+  if (values.num_chunks() == 1) {
+    const auto& array = checked_cast<const ArrayType&>(*values.chunk(0));
+    PartitionIndices(
+        indices_begin, indices_end, n, has_nulls,
+        [&array](uint64_t row) { return array.IsNull(row); },
+        [&array](uint64_t left, uint64_t right) {
+          return array.GetView(left) < array.GetView(right);
+        });
+  } else {
+    // Selection needs random access to the values, gather views of them
+    // rather than concatenating the chunks
+    std::vector<ViewType> views;
+    std::vector<bool> is_null;
+    views.reserve(length);
+    if (has_nulls) {
+      is_null.reserve(length);
+    }
+    for (const auto& chunk : values.chunks()) {
+      const auto& array = checked_cast<const ArrayType&>(*chunk);
+      for (int64_t i = 0; i < array.length(); ++i) {
+        views.push_back(array.GetView(i));
+        if (has_nulls) {
+          is_null.push_back(array.IsNull(i));
+        }
+      }
+    }
+    PartitionIndices(
+        indices_begin, indices_end, n, has_nulls,
+        [&is_null](uint64_t row) { return is_null[row]; },
+        [&views](uint64_t left, uint64_t right) { return views[left] < views[right]; });
+  }
+
+  *offsets = std::make_shared<UInt64Array>(length, indices_buf);
+  return Status::OK();
+}
+
+// Keep the best k values seen so far in a heap whose top is the worst of
+// them. Rows are visited in increasing index order, so a new value only
+// replaces the top if it is strictly better: among equal values, the
+// earliest rows are selected.
+template <typename ArrowType, bool kLargest>
+class TopKSelector {
+  using ArrayType = typename SelectionTypes<ArrowType>::ArrayType;
+  using ViewType = typename SelectionTypes<ArrowType>::ViewType;
+
+  struct Entry {
+    ViewType value;
+    uint64_t index;
+  };
+
+  static bool IsBetter(const ViewType& left, const ViewType& right) {
+    return kLargest ? right < left : left < right;
+  }
+
+  // Strict weak order, better entries first
+  static bool EntryIsBetter(const Entry& left, const Entry& right) {
+    if (IsBetter(left.value, right.value)) {
+      return true;
+    }
+    return !IsBetter(right.value, left.value) && left.index < right.index;
+  }
+
+ public:
+  explicit TopKSelector(int64_t k) : k_(k) { heap_.reserve(k); }
+
+  void Consume(const ArrayType& array, uint64_t offset) {
+    if (k_ == 0) {
+      return;
+    }
+    const bool has_nulls = array.null_count() > 0;
+    for (int64_t i = 0; i < array.length(); ++i) {
+      if (has_nulls && array.IsNull(i)) {
+        continue;
+      }
+      const ViewType value = array.GetView(i);
+      if (static_cast<int64_t>(heap_.size()) < k_) {
+        heap_.push_back({value, offset + i});
+        std::push_heap(heap_.begin(), heap_.end(), EntryIsBetter);
+      } else if (IsBetter(value, heap_.front().value)) {
+        std::pop_heap(heap_.begin(), heap_.end(), EntryIsBetter);
+        heap_.back() = {value, offset + i};
+        std::push_heap(heap_.begin(), heap_.end(), EntryIsBetter);
+      }
+    }
+  }
+
+  /// Write the selected indices, best first, and return their number
+  int64_t Finish(uint64_t* out) {
+    std::sort_heap(heap_.begin(), heap_.end(), EntryIsBetter);
+    for (const auto& entry : heap_) {
+      *out++ = entry.index;
+    }
+    return static_cast<int64_t>(heap_.size());
+  }
+
+ private:
+  const int64_t k_;
+  std::vector<Entry> heap_;
+};
+
+template <typename ArrowType, bool kLargest>
+Status TopKToIndicesImpl(FunctionContext* ctx, const ChunkedArray& values, int64_t k,
+                         std::shared_ptr<Array>* offsets) {
+  using ArrayType = typename SelectionTypes<ArrowType>::ArrayType;
+
+  std::shared_ptr<Buffer> indices_buf;
+  RETURN_NOT_OK(AllocateBuffer(ctx->memory_pool(), k * sizeof(uint64_t), &indices_buf));
+  auto indices = reinterpret_cast<uint64_t*>(indices_buf->mutable_data());
+
+  TopKSelector<ArrowType, kLargest> selector(k);
+  uint64_t offset = 0;
+  for (const auto& chunk : values.chunks()) {
+    selector.Consume(checked_cast<const ArrayType&>(*chunk), offset);
+    offset += chunk->length();
+  }
+  int64_t num_selected = selector.Finish(indices);
+
+  // Not enough non-null values, fill up with the first nulls
+  offset = 0;
+  for (const auto& chunk : values.chunks()) {
+    for (int64_t i = 0; i < chunk->length() && num_selected < k; ++i) {
+      if (chunk->IsNull(i)) {
+        indices[num_selected++] = offset + i;
+      }
+    }
+    offset += chunk->length();
+  }
+
+  *offsets = std::make_shared<UInt64Array>(k, indices_buf);
+  return Status::OK();
+}
+
+template <typename ArrowType>
+Status TopKToIndicesImpl(FunctionContext* ctx, const ChunkedArray& values,
+                         const TopKOptions& options, std::shared_ptr<Array>* offsets) {
+  if (options.k < 0) {
+    return Status::Invalid("TopKToIndices expects a non-negative k, got ", options.k);
+  }
+  const int64_t k = std::min(options.k, values.length());
+  if (options.order == TopKOptions::LARGEST) {
+    return TopKToIndicesImpl<ArrowType, true>(ctx, values, k, offsets);
+  }
+  return TopKToIndicesImpl<ArrowType, false>(ctx, values, k, offsets);
+}
+
+}  // namespace
+
+#define SELECTION_TYPE_CASES(FUNC, ...)   \
+  case Type::UINT8:                       \
+    return FUNC<UInt8Type>(__VA_ARGS__);  \
+  case Type::INT8:                        \
+    return FUNC<Int8Type>(__VA_ARGS__);   \
+  case Type::UINT16:                      \
+    return FUNC<UInt16Type>(__VA_ARGS__); \
+  case Type::INT16:                       \
+    return FUNC<Int16Type>(__VA_ARGS__);  \
+  case Type::UINT32:                      \
+    return FUNC<UInt32Type>(__VA_ARGS__); \
+  case Type::INT32:                       \
+    return FUNC<Int32Type>(__VA_ARGS__);  \
+  case Type::UINT64:                      \
+    return FUNC<UInt64Type>(__VA_ARGS__); \
+  case Type::INT64:                       \
+    return FUNC<Int64Type>(__VA_ARGS__);  \
+  case Type::FLOAT:                       \
+    return FUNC<FloatType>(__VA_ARGS__);  \
+  case Type::DOUBLE:                      \
+    return FUNC<DoubleType>(__VA_ARGS__); \
+  case Type::BINARY:                      \
+    return FUNC<BinaryType>(__VA_ARGS__); \
+  case Type::STRING:                      \
+    return FUNC<StringType>(__VA_ARGS__);
+
+Status NthToIndices(FunctionContext* ctx, const ChunkedArray& values, int64_t n,
+                    std::shared_ptr<Array>* offsets) {
+  switch (values.type()->id()) {
+    SELECTION_TYPE_CASES(NthToIndicesImpl, ctx, values, n, offsets)
+    default:
+      break;
+  }
+  return Status::NotImplemented("NthToIndices of ", *values.type(), " arrays");
+}
+
+Status NthToIndices(FunctionContext* ctx, const Array& values, int64_t n,
+                    std::shared_ptr<Array>* offsets) {
+  return NthToIndices(ctx, ChunkedArray(ArrayVector{MakeArray(values.data())}), n,
+                      offsets);
+}
+
+Status TopKToIndices(FunctionContext* ctx, const ChunkedArray& values,
+                     const TopKOptions& options, std::shared_ptr<Array>* offsets) {
+  switch (values.type()->id()) {
+    SELECTION_TYPE_CASES(TopKToIndicesImpl, ctx, values, options, offsets)
+    default:
+      break;
+  }
+  return Status::NotImplemented("TopKToIndices of ", *values.type(), " arrays");
+}
+
+Status TopKToIndices(FunctionContext* ctx, const Array& values,
+                     const TopKOptions& options, std::shared_ptr<Array>* offsets) {
+  return TopKToIndices(ctx, ChunkedArray(ArrayVector{MakeArray(values.data())}), options,
+                       offsets);
+}
+
+#undef SELECTION_TYPE_CASES
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,136 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Array;
+class ChunkedArray;
+
+namespace compute {
+
+class FunctionContext;
+
+/// \brief Returns the indices that partition an array around its n-th value.
+///
+/// Perform an indirect partial sort of the array with introselect, in linear
+/// time on average. The output array contains all indices of the input, the
+/// index at position n being the one that would be there if the array were
+/// sorted with SortToIndices(); the indices before it point to values not
+/// greater than it and the indices after it to values not less than it, in
+/// unspecified order. Nulls are partitioned to the end of the output.
+///
+/// For example given values = [5, null, 1, 4, 3] and n = 2, the output could
+/// be [2, 4, 3, 0, 1].
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] values array to partition
+/// \param[in] n the position of the pivot in the output, must be less than
+///            the length of the array
+/// \param[out] offsets indices that would partition the array
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status NthToIndices(FunctionContext* ctx, const Array& values, int64_t n,
+                    std::shared_ptr<Array>* offsets);
+
+/// \brief Returns the indices that partition a chunked array around its n-th
+/// value.
+///
+/// Same as for an array, the output indices being row indices into the
+/// chunked array as a whole.
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] values chunked array to partition
+/// \param[in] n the position of the pivot in the output, must be less than
+///            the length of the chunked array
+/// \param[out] offsets indices that would partition the chunked array
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status NthToIndices(FunctionContext* ctx, const ChunkedArray& values, int64_t n,
+                    std::shared_ptr<Array>* offsets);
+
+/// \class TopKOptions
+///
+/// The user controls the TopKToIndices kernel with this class: the number of
+/// indices to select, and whether to select the smallest or the largest
+/// values.
+struct ARROW_EXPORT TopKOptions {
+  enum Order {
+    // Select the k smallest values, in ascending order.
+    SMALLEST = 0,
+    // Select the k largest values, in descending order.
+    LARGEST,
+  };
+
+  explicit TopKOptions(int64_t k, Order order = LARGEST) : k(k), order(order) {}
+
+  int64_t k;
+  Order order;
+};
+
+/// \brief Returns the indices of the k smallest or largest values of an array.
+///
+/// The values are scanned once while keeping the best k values seen so far
+/// in a heap, in O(n log k) time and O(k) memory. The output has
+/// min(k, length) indices, sorted by value; values that compare equal keep
+/// their relative order, and nulls come last. It is therefore the same as the
+/// first k indices of a stable sort, without sorting the other values.
+///
+/// For example given values = [5, null, 1, 4, 5] and k = 3, the output is
+/// [0, 4, 3] for LARGEST and [2, 3, 0] for SMALLEST.
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] values array to select from
+/// \param[in] options the number of indices and the order, see TopKOptions
+/// \param[out] offsets indices of the selected values
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status TopKToIndices(FunctionContext* ctx, const Array& values,
+                     const TopKOptions& options, std::shared_ptr<Array>* offsets);
+
+/// \brief Returns the indices of the k smallest or largest values of a chunked
+/// array.
+///
+/// Same as for an array, the output indices being row indices into the
+/// chunked array as a whole. The chunks are scanned in place.
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] values chunked array to select from
+/// \param[in] options the number of indices and the order, see TopKOptions
+/// \param[out] offsets indices of the selected values
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status TopKToIndices(FunctionContext* ctx, const ChunkedArray& values,
+                     const TopKOptions& options, std::shared_ptr<Array>* offsets);
+
+}  // namespace compute
+}  // namespace arrow
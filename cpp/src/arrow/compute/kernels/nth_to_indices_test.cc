@@ -0,0 +1,175 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array/concatenate.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/nth_to_indices.h"
+#include "arrow/compute/kernels/sort_to_indices.h"
+#include "arrow/compute/test_util.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/util/checked_cast.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+
+class TestNthToIndices : public ComputeFixture, public TestBase {
+ protected:
+  // Check the output against the position of each index in a full sort
+  void AssertNthToIndices(const std::shared_ptr<ChunkedArray>& values, int64_t n) {
+    std::shared_ptr<Array> concatenated, sorted, actual;
+    ASSERT_OK(Concatenate(values->chunks(), default_memory_pool(), &concatenated));
+    ASSERT_OK(SortToIndices(&this->ctx_, *concatenated, &sorted));
+    if (values->num_chunks() == 1) {
+      ASSERT_OK(NthToIndices(&this->ctx_, *values->chunk(0), n, &actual));
+    } else {
+      ASSERT_OK(NthToIndices(&this->ctx_, *values, n, &actual));
+    }
+    ASSERT_OK(actual->ValidateFull());
+    ASSERT_EQ(actual->length(), values->length());
+
+    // Rank of each row in the sorted order, equal values sharing a rank
+    std::vector<int64_t> ranks(values->length());
+    const auto& sorted_indices = checked_cast<const UInt64Array&>(*sorted);
+    int64_t rank = 0;
+    for (int64_t i = 0; i < sorted_indices.length(); ++i) {
+      const uint64_t row = sorted_indices.Value(i);
+      if (i > 0 && !concatenated->RangeEquals(row, row + 1, sorted_indices.Value(i - 1),
+                                              concatenated)) {
+        rank = i;
+      }
+      ranks[row] = rank;
+    }
+    const auto& indices = checked_cast<const UInt64Array&>(*actual);
+    const int64_t pivot_rank = ranks[sorted_indices.Value(n)];
+    ASSERT_EQ(ranks[indices.Value(n)], pivot_rank);
+    for (int64_t i = 0; i < indices.length(); ++i) {
+      if (i < n) {
+        ASSERT_LE(ranks[indices.Value(i)], pivot_rank);
+      } else {
+        ASSERT_GE(ranks[indices.Value(i)], pivot_rank);
+      }
+    }
+  }
+};
+
+TEST_F(TestNthToIndices, Basics) {
+  auto values = ChunkedArrayFromJSON(int32(), {"[5, null, 1, 4, 3]"});
+  for (int64_t n = 0; n < values->length(); ++n) {
+    AssertNthToIndices(values, n);
+  }
+  auto chunked = ChunkedArrayFromJSON(utf8(), {R"(["d", null])", "[]", R"(["a", "d"])",
+                                               R"(["c", null, "b"])"});
+  for (int64_t n = 0; n < chunked->length(); ++n) {
+    AssertNthToIndices(chunked, n);
+  }
+}
+
+TEST_F(TestNthToIndices, RandomValues) {
+  auto rand = random::RandomArrayGenerator(0x5487658);
+  auto values = std::make_shared<ChunkedArray>(ArrayVector{
+      rand.Int64(500, -50, 50, 0.1), rand.Int64(0, -50, 50, 0.1),
+      rand.Int64(700, -50, 50, 0.1)});
+  for (int64_t n : {0, 1, 600, 1000, 1199}) {
+    AssertNthToIndices(values, n);
+    AssertNthToIndices(std::make_shared<ChunkedArray>(ArrayVector{values->chunk(2)}),
+                       n % 700);
+  }
+}
+
+TEST_F(TestNthToIndices, Errors) {
+  std::shared_ptr<Array> actual;
+  auto values = ArrayFromJSON(int32(), "[1, 2]");
+  ASSERT_RAISES(IndexError, NthToIndices(&this->ctx_, *values, 2, &actual));
+  ASSERT_RAISES(IndexError, NthToIndices(&this->ctx_, *values, -1, &actual));
+  ASSERT_RAISES(NotImplemented,
+                NthToIndices(&this->ctx_, *ArrayFromJSON(boolean(), "[true]"), 0,
+                             &actual));
+}
+
+class TestTopKToIndices : public ComputeFixture, public TestBase {
+ protected:
+  void AssertTopKToIndices(const std::shared_ptr<ChunkedArray>& values,
+                           const TopKOptions& options, const std::string& expected) {
+    std::shared_ptr<Array> actual;
+    ASSERT_OK(TopKToIndices(&this->ctx_, *values, options, &actual));
+    ASSERT_OK(actual->ValidateFull());
+    AssertArraysEqual(*ArrayFromJSON(uint64(), expected), *actual);
+    if (values->num_chunks() == 1) {
+      ASSERT_OK(TopKToIndices(&this->ctx_, *values->chunk(0), options, &actual));
+      AssertArraysEqual(*ArrayFromJSON(uint64(), expected), *actual);
+    }
+  }
+};
+
+TEST_F(TestTopKToIndices, Basics) {
+  auto values = ChunkedArrayFromJSON(int32(), {"[5, null, 1, 4, 5]"});
+  AssertTopKToIndices(values, TopKOptions(3), "[0, 4, 3]");
+  AssertTopKToIndices(values, TopKOptions(3, TopKOptions::SMALLEST), "[2, 3, 0]");
+  AssertTopKToIndices(values, TopKOptions(0), "[]");
+  AssertTopKToIndices(values, TopKOptions(10), "[0, 4, 3, 2, 1]");
+  AssertTopKToIndices(ChunkedArrayFromJSON(float64(), {"[null, null]"}), TopKOptions(1),
+                      "[0]");
+}
+
+TEST_F(TestTopKToIndices, Chunked) {
+  auto values = ChunkedArrayFromJSON(utf8(), {R"(["d", null])", "[]", R"(["a", "d"])",
+                                              R"(["c", null, "b"])"});
+  AssertTopKToIndices(values, TopKOptions(2), "[0, 3]");
+  AssertTopKToIndices(values, TopKOptions(3, TopKOptions::SMALLEST), "[2, 6, 4]");
+  AssertTopKToIndices(values, TopKOptions(7, TopKOptions::SMALLEST),
+                      "[2, 6, 4, 0, 3, 1, 5]");
+}
+
+TEST_F(TestTopKToIndices, RandomValues) {
+  // The k smallest values are the first k of a stable sort
+  auto rand = random::RandomArrayGenerator(0x5487659);
+  ArrayVector chunks = {rand.Float64(1000, -100, 100, 0.1), rand.Float64(1, 0, 1, 0),
+                        rand.Float64(3000, -100, 100, 0.5)};
+  auto values = std::make_shared<ChunkedArray>(chunks);
+  std::shared_ptr<Array> concatenated, sorted, actual;
+  ASSERT_OK(Concatenate(chunks, default_memory_pool(), &concatenated));
+  ASSERT_OK(SortToIndices(&this->ctx_, *concatenated, &sorted));
+  for (int64_t k : {1, 10, 100, 2500, 4001}) {
+    ASSERT_OK(TopKToIndices(&this->ctx_, *values, TopKOptions(k, TopKOptions::SMALLEST),
+                            &actual));
+    AssertArraysEqual(*sorted->Slice(0, k), *actual);
+  }
+}
+
+TEST_F(TestTopKToIndices, Errors) {
+  std::shared_ptr<Array> actual;
+  ASSERT_RAISES(Invalid, TopKToIndices(&this->ctx_, *ArrayFromJSON(int32(), "[1]"),
+                                       TopKOptions(-1), &actual));
+  ASSERT_RAISES(NotImplemented,
+                TopKToIndices(&this->ctx_, *ArrayFromJSON(boolean(), "[true]"),
+                              TopKOptions(1), &actual));
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -18,14 +18,24 @@
 #include "arrow/compute/kernels/sort_to_indices.h"
 
 #include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
 #include <numeric>
+#include <type_traits>
 #include <vector>
 
 #include "arrow/builder.h"
 #include "arrow/compute/context.h"
 #include "arrow/compute/expression.h"
 #include "arrow/compute/logical_type.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/string_view.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 
@@ -255,5 +265,587 @@ Status SortToIndices(FunctionContext* ctx, const Array& values,
   return Status::OK();
 }
 
+namespace {
+
+using internal::checked_cast;
+
+// ----------------------------------------------------------------------
+// Sorting of chunked arrays
+//
+// Each chunk is sorted on its own with SortToIndicesKernel, which stably
+// partitions the nulls to the end. The sorted non-null runs are then merged
+// with a heap over the chunks, ties being broken by chunk index so that the
+// merge is stable. To merge in parallel, the values are split into ranges at
+// pivots sampled from the runs; the rows of every run that fall in the same
+// range are merged independently of the other ranges. The null rows come
+// last, in chunk order.
+
+// Don't split the merge into ranges smaller than this
+constexpr int64_t kMinMergeRangeLength = 4096;
+
+// Sample this many values per chunk and per range to pick the pivots
+constexpr int64_t kSamplesPerRange = 8;
+
+// Writes merged rows either as global indices or as (chunk, offset) pairs
+struct SortedIndexWriter {
+  void Write(int64_t position, uint32_t chunk, uint64_t offset) const {
+    if (global_indices != NULLPTR) {
+      global_indices[position] = chunk_starts[chunk] + offset;
+    } else {
+      chunk_indices[position] = chunk;
+      chunk_offsets[position] = offset;
+    }
+  }
+
+  uint64_t* global_indices;
+  const uint64_t* chunk_starts;
+  uint32_t* chunk_indices;
+  uint64_t* chunk_offsets;
+};
+
+template <typename ArrowType>
+class ChunkedArrayMerger {
+  using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+  using ViewType = decltype(std::declval<ArrayType>().GetView(0));
+
+ public:
+  ChunkedArrayMerger(const ChunkedArray& values,
+                     const std::vector<std::shared_ptr<Array>>& sorted_chunks) {
+    for (int i = 0; i < values.num_chunks(); ++i) {
+      const auto& chunk = checked_cast<const ArrayType&>(*values.chunk(i));
+      chunks_.push_back(&chunk);
+      runs_.push_back(checked_cast<const UInt64Array&>(*sorted_chunks[i]).raw_values());
+      run_lengths_.push_back(chunk.length() - chunk.null_count());
+      non_null_length_ += run_lengths_.back();
+    }
+  }
+
+  int64_t non_null_length() const { return non_null_length_; }
+
+  Status Merge(bool use_threads, const SortedIndexWriter& writer) const {
+    const int num_chunks = static_cast<int>(chunks_.size());
+    int num_ranges = 1;
+    if (use_threads) {
+      num_ranges = static_cast<int>(std::min<int64_t>(
+          GetCpuThreadPoolCapacity(), non_null_length_ / kMinMergeRangeLength));
+      num_ranges = std::max(num_ranges, 1);
+    }
+
+    // range_bounds[i * (num_ranges + 1) + j] is the start of range j within
+    // the run of chunk i
+    std::vector<int64_t> range_bounds(num_chunks * (num_ranges + 1));
+    std::vector<ViewType> pivots = PickPivots(num_ranges);
+    for (int i = 0; i < num_chunks; ++i) {
+      int64_t* bounds = range_bounds.data() + i * (num_ranges + 1);
+      const ArrayType& chunk = *chunks_[i];
+      for (int j = 1; j < num_ranges; ++j) {
+        bounds[j] = std::lower_bound(runs_[i], runs_[i] + run_lengths_[i], pivots[j - 1],
+                                     [&chunk](uint64_t row, const ViewType& pivot) {
+                                       return chunk.GetView(row) < pivot;
+                                     }) -
+                    runs_[i];
+      }
+      bounds[num_ranges] = run_lengths_[i];
+    }
+
+    auto merge_range = [&](int j) {
+      std::vector<int64_t> begins(num_chunks), ends(num_chunks);
+      int64_t position = 0;
+      for (int i = 0; i < num_chunks; ++i) {
+        const int64_t* bounds = range_bounds.data() + i * (num_ranges + 1);
+        begins[i] = bounds[j];
+        ends[i] = bounds[j + 1];
+        position += bounds[j];
+      }
+      MergeRange(std::move(begins), ends, position, writer);
+      return Status::OK();
+    };
+    if (num_ranges > 1) {
+      RETURN_NOT_OK(internal::ParallelFor(num_ranges, merge_range));
+    } else {
+      RETURN_NOT_OK(merge_range(0));
+    }
+
+    // Null rows are appended in chunk order
+    int64_t position = non_null_length_;
+    for (int i = 0; i < num_chunks; ++i) {
+      for (int64_t k = run_lengths_[i]; k < chunks_[i]->length(); ++k) {
+        writer.Write(position++, static_cast<uint32_t>(i), runs_[i][k]);
+      }
+    }
+    return Status::OK();
+  }
+
+ private:
+  ViewType Value(int chunk, int64_t run_position) const {
+    return chunks_[chunk]->GetView(runs_[chunk][run_position]);
+  }
+
+  // Pick num_ranges - 1 pivots splitting the values into ranges of about
+  // the same number of rows
+  std::vector<ViewType> PickPivots(int num_ranges) const {
+    std::vector<ViewType> pivots;
+    if (num_ranges < 2) {
+      return pivots;
+    }
+    std::vector<ViewType> samples;
+    const int64_t samples_per_chunk = num_ranges * kSamplesPerRange;
+    for (size_t i = 0; i < chunks_.size(); ++i) {
+      // Weigh each chunk by its length
+      const int64_t num_samples = std::min(
+          run_lengths_[i], samples_per_chunk * run_lengths_[i] / non_null_length_ + 1);
+      for (int64_t k = 0; k < num_samples && run_lengths_[i] > 0; ++k) {
+        samples.push_back(Value(static_cast<int>(i), k * run_lengths_[i] / num_samples));
+      }
+    }
+    std::sort(samples.begin(), samples.end());
+    for (int j = 1; j < num_ranges; ++j) {
+      pivots.push_back(samples[j * samples.size() / num_ranges]);
+    }
+    return pivots;
+  }
+
+  void MergeRange(std::vector<int64_t> cursors, const std::vector<int64_t>& ends,
+                  int64_t position, const SortedIndexWriter& writer) const {
+    // A min-heap of the chunks with rows left to merge, by current value
+    auto greater = [&](int left, int right) {
+      const ViewType left_value = Value(left, cursors[left]);
+      const ViewType right_value = Value(right, cursors[right]);
+      if (right_value < left_value) {
+        return true;
+      }
+      return !(left_value < right_value) && left > right;
+    };
+    std::vector<int> heap;
+    for (size_t i = 0; i < cursors.size(); ++i) {
+      if (cursors[i] < ends[i]) {
+        heap.push_back(static_cast<int>(i));
+      }
+    }
+    std::make_heap(heap.begin(), heap.end(), greater);
+    while (!heap.empty()) {
+      std::pop_heap(heap.begin(), heap.end(), greater);
+      const int chunk = heap.back();
+      writer.Write(position++, static_cast<uint32_t>(chunk),
+                   runs_[chunk][cursors[chunk]]);
+      if (++cursors[chunk] < ends[chunk]) {
+        std::push_heap(heap.begin(), heap.end(), greater);
+      } else {
+        heap.pop_back();
+      }
+    }
+  }
+
+  std::vector<const ArrayType*> chunks_;
+  std::vector<const uint64_t*> runs_;
+  std::vector<int64_t> run_lengths_;
+  int64_t non_null_length_ = 0;
+};
+
+template <typename ArrowType>
+Status SortChunkedArrayToIndices(FunctionContext* ctx, const ChunkedArray& values,
+                                 const ChunkedSortOptions& options,
+                                 std::shared_ptr<Array>* offsets) {
+  const int num_chunks = values.num_chunks();
+  std::vector<std::shared_ptr<Array>> sorted_chunks(num_chunks);
+  auto sort_chunk = [&](int i) {
+    return SortToIndices(ctx, *values.chunk(i), &sorted_chunks[i]);
+  };
+  if (options.use_threads && num_chunks > 1) {
+    RETURN_NOT_OK(internal::ParallelFor(num_chunks, sort_chunk));
+  } else {
+    for (int i = 0; i < num_chunks; ++i) {
+      RETURN_NOT_OK(sort_chunk(i));
+    }
+  }
+
+  const int64_t length = values.length();
+  std::vector<uint64_t> chunk_starts;
+  uint64_t chunk_start = 0;
+  for (const auto& chunk : values.chunks()) {
+    chunk_starts.push_back(chunk_start);
+    chunk_start += chunk->length();
+  }
+
+  SortedIndexWriter writer = {NULLPTR, chunk_starts.data(), NULLPTR, NULLPTR};
+  std::shared_ptr<Buffer> indices_buf, chunk_indices_buf;
+  RETURN_NOT_OK(
+      AllocateBuffer(ctx->memory_pool(), length * sizeof(uint64_t), &indices_buf));
+  if (options.output_type == ChunkedSortOptions::GLOBAL_INDICES) {
+    writer.global_indices = reinterpret_cast<uint64_t*>(indices_buf->mutable_data());
+  } else {
+    RETURN_NOT_OK(AllocateBuffer(ctx->memory_pool(), length * sizeof(uint32_t),
+                                 &chunk_indices_buf));
+    writer.chunk_indices = reinterpret_cast<uint32_t*>(chunk_indices_buf->mutable_data());
+    writer.chunk_offsets = reinterpret_cast<uint64_t*>(indices_buf->mutable_data());
+  }
+
+  ChunkedArrayMerger<ArrowType> merger(values, sorted_chunks);
+  RETURN_NOT_OK(merger.Merge(options.use_threads, writer));
+  // Release the per-chunk indices before building the output
+  sorted_chunks.clear();
+
+  if (options.output_type == ChunkedSortOptions::GLOBAL_INDICES) {
+    *offsets = std::make_shared<UInt64Array>(length, indices_buf);
+    return Status::OK();
+  }
+  std::shared_ptr<StructArray> pairs;
+  ARROW_ASSIGN_OR_RAISE(
+      pairs, StructArray::Make({std::make_shared<UInt32Array>(length, chunk_indices_buf),
+                                std::make_shared<UInt64Array>(length, indices_buf)},
+                               std::vector<std::string>{"chunk", "offset"}));
+  *offsets = pairs;
+  return Status::OK();
+}
+
+// ----------------------------------------------------------------------
+// Multi-key sorting of record batches and tables
+//
+// Rows are sorted one key at a time, from the least to the most significant
+// key, with a stable sort each time (LSD order). For each key the null rows
+// are first stably partitioned to the requested end, then the non-null rows
+// are sorted by value. Key columns are read chunk by chunk into a flat
+// per-row representation, so chunked columns are never concatenated.
+
+// Map a value to an unsigned integer of the same width whose unsigned order
+// is the order of the values, so that it can be radix sorted byte by byte.
+template <typename CType, typename Enable = void>
+struct RadixKey {};
+
+template <typename CType>
+struct RadixKey<CType, typename std::enable_if<std::is_integral<CType>::value &&
+                                               std::is_unsigned<CType>::value &&
+                                               !std::is_same<CType, bool>::value>::type> {
+  using type = CType;
+  static type Encode(CType value) { return value; }
+};
+
+template <typename CType>
+struct RadixKey<CType, typename std::enable_if<std::is_integral<CType>::value &&
+                                               std::is_signed<CType>::value>::type> {
+  using type = typename std::make_unsigned<CType>::type;
+  // Flip the sign bit
+  static type Encode(CType value) {
+    return static_cast<type>(static_cast<type>(value) ^
+                             (type(1) << (sizeof(type) * 8 - 1)));
+  }
+};
+
+template <>
+struct RadixKey<bool> {
+  using type = uint8_t;
+  static type Encode(bool value) { return value ? 1 : 0; }
+};
+
+template <typename CType, typename UInt>
+struct FloatingPointRadixKey {
+  using type = UInt;
+  // Flip all bits of negative values and only the sign bit of positive
+  // values; NaNs are mapped to the largest key.
+  static type Encode(CType value) {
+    if (std::isnan(value)) {
+      return std::numeric_limits<type>::max();
+    }
+    type bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    const type sign_bit = type(1) << (sizeof(type) * 8 - 1);
+    return (bits & sign_bit) ? static_cast<type>(~bits) : (bits | sign_bit);
+  }
+};
+
+template <>
+struct RadixKey<float> : public FloatingPointRadixKey<float, uint32_t> {};
+
+template <>
+struct RadixKey<double> : public FloatingPointRadixKey<double, uint64_t> {};
+
+class SortColumn {
+ public:
+  explicit SortColumn(const ChunkedArray& column) : null_count_(column.null_count()) {
+    if (null_count_ > 0) {
+      is_null_.reserve(column.length());
+      for (const auto& chunk : column.chunks()) {
+        for (int64_t i = 0; i < chunk->length(); ++i) {
+          is_null_.push_back(chunk->IsNull(i));
+        }
+      }
+    }
+  }
+
+  virtual ~SortColumn() = default;
+
+  int64_t null_count() const { return null_count_; }
+
+  bool IsNull(uint64_t row) const { return null_count_ > 0 && is_null_[row]; }
+
+  /// Stably sort the given row indices by this column's values. The rows
+  /// must all be non-null.
+  virtual void Sort(uint64_t* indices_begin, uint64_t* indices_end,
+                    bool descending) const = 0;
+
+ protected:
+  int64_t null_count_;
+  std::vector<bool> is_null_;
+};
+
+// LSD radix sort on the order-preserving unsigned encoding of the values,
+// one byte per pass. Passes where all keys share the same byte are skipped,
+// so e.g. small integers stored in a wide type only cost one or two passes.
+template <typename ArrowType>
+class RadixSortColumn : public SortColumn {
+  using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+  using CType = typename ArrowType::c_type;
+  using Key = typename RadixKey<CType>::type;
+
+  // Below this many rows a comparison sort is cheaper than the histograms
+  static constexpr int64_t kMinRadixSortLength = 256;
+
+ public:
+  explicit RadixSortColumn(const ChunkedArray& column) : SortColumn(column) {
+    keys_.reserve(column.length());
+    for (const auto& chunk : column.chunks()) {
+      const auto& array = checked_cast<const ArrayType&>(*chunk);
+      for (int64_t i = 0; i < array.length(); ++i) {
+        keys_.push_back(RadixKey<CType>::Encode(array.Value(i)));
+      }
+    }
+  }
+
+  void Sort(uint64_t* indices_begin, uint64_t* indices_end,
+            bool descending) const override {
+    const int64_t length = indices_end - indices_begin;
+    if (length < 2) {
+      return;
+    }
+    // Reversing the order of the keys keeps the sort stable, unlike
+    // reversing its output
+    const Key flip = descending ? std::numeric_limits<Key>::max() : 0;
+
+    if (length < kMinRadixSortLength) {
+      std::stable_sort(indices_begin, indices_end, [&](uint64_t left, uint64_t right) {
+        return (keys_[left] ^ flip) < (keys_[right] ^ flip);
+      });
+      return;
+    }
+
+    std::vector<Key> keys(length), keys_scratch(length);
+    std::vector<uint64_t> indices_scratch(length);
+    for (int64_t i = 0; i < length; ++i) {
+      keys[i] = keys_[indices_begin[i]] ^ flip;
+    }
+
+    Key* keys_in = keys.data();
+    Key* keys_out = keys_scratch.data();
+    uint64_t* indices_in = indices_begin;
+    uint64_t* indices_out = indices_scratch.data();
+    for (size_t shift = 0; shift < sizeof(Key) * 8; shift += 8) {
+      int64_t offsets[256] = {0};
+      for (int64_t i = 0; i < length; ++i) {
+        ++offsets[(keys_in[i] >> shift) & 0xFF];
+      }
+      if (offsets[(keys_in[0] >> shift) & 0xFF] == length) {
+        continue;
+      }
+      int64_t sum = 0;
+      for (auto& offset : offsets) {
+        const int64_t count = offset;
+        offset = sum;
+        sum += count;
+      }
+      for (int64_t i = 0; i < length; ++i) {
+        const int64_t pos = offsets[(keys_in[i] >> shift) & 0xFF]++;
+        keys_out[pos] = keys_in[i];
+        indices_out[pos] = indices_in[i];
+      }
+      std::swap(keys_in, keys_out);
+      std::swap(indices_in, indices_out);
+    }
+    if (indices_in != indices_begin) {
+      std::copy(indices_in, indices_in + length, indices_begin);
+    }
+  }
+
+ private:
+  std::vector<Key> keys_;
+};
+
+template <typename ArrowType>
+constexpr int64_t RadixSortColumn<ArrowType>::kMinRadixSortLength;
+
+// Comparison sort on views of the values, for binary-like types
+template <typename ArrowType>
+class CompareSortColumn : public SortColumn {
+  using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+
+ public:
+  explicit CompareSortColumn(const ChunkedArray& column) : SortColumn(column) {
+    views_.reserve(column.length());
+    for (const auto& chunk : column.chunks()) {
+      const auto& array = checked_cast<const ArrayType&>(*chunk);
+      for (int64_t i = 0; i < array.length(); ++i) {
+        views_.push_back(array.GetView(i));
+      }
+    }
+  }
+
+  void Sort(uint64_t* indices_begin, uint64_t* indices_end,
+            bool descending) const override {
+    if (descending) {
+      std::stable_sort(indices_begin, indices_end, [this](uint64_t left, uint64_t right) {
+        return views_[right] < views_[left];
+      });
+    } else {
+      std::stable_sort(indices_begin, indices_end, [this](uint64_t left, uint64_t right) {
+        return views_[left] < views_[right];
+      });
+    }
+  }
+
+ private:
+  std::vector<util::string_view> views_;
+};
+
+Status MakeSortColumn(const ChunkedArray& column, std::unique_ptr<SortColumn>* out) {
+  switch (column.type()->id()) {
+#define RADIX_SORT_CASE(TYPE_CLASS)                      \
+  case TYPE_CLASS::type_id:                              \
+    out->reset(new RadixSortColumn<TYPE_CLASS>(column)); \
+    return Status::OK();
+
+    RADIX_SORT_CASE(BooleanType)
+    RADIX_SORT_CASE(UInt8Type)
+    RADIX_SORT_CASE(Int8Type)
+    RADIX_SORT_CASE(UInt16Type)
+    RADIX_SORT_CASE(Int16Type)
+    RADIX_SORT_CASE(UInt32Type)
+    RADIX_SORT_CASE(Int32Type)
+    RADIX_SORT_CASE(UInt64Type)
+    RADIX_SORT_CASE(Int64Type)
+    RADIX_SORT_CASE(FloatType)
+    RADIX_SORT_CASE(DoubleType)
+    RADIX_SORT_CASE(Date32Type)
+    RADIX_SORT_CASE(Date64Type)
+    RADIX_SORT_CASE(Time32Type)
+    RADIX_SORT_CASE(Time64Type)
+    RADIX_SORT_CASE(TimestampType)
+    RADIX_SORT_CASE(DurationType)
+
+#undef RADIX_SORT_CASE
+
+#define COMPARE_SORT_CASE(TYPE_CLASS)                      \
+  case TYPE_CLASS::type_id:                                \
+    out->reset(new CompareSortColumn<TYPE_CLASS>(column)); \
+    return Status::OK();
+
+    COMPARE_SORT_CASE(BinaryType)
+    COMPARE_SORT_CASE(StringType)
+    COMPARE_SORT_CASE(LargeBinaryType)
+    COMPARE_SORT_CASE(LargeStringType)
+    COMPARE_SORT_CASE(FixedSizeBinaryType)
+
+#undef COMPARE_SORT_CASE
+
+    default:
+      break;
+  }
+  return Status::NotImplemented("Sorting of ", *column.type(), " columns");
+}
+
+Status MultipleKeySortToIndices(FunctionContext* ctx, const Schema& schema,
+                                int64_t length,
+                                const std::vector<std::shared_ptr<ChunkedArray>>& columns,
+                                const SortOptions& options,
+                                std::shared_ptr<Array>* offsets) {
+  if (options.sort_keys.empty()) {
+    return Status::Invalid("Must specify at least one sort key");
+  }
+  std::vector<std::unique_ptr<SortColumn>> sort_columns;
+  for (const auto& sort_key : options.sort_keys) {
+    const int index = schema.GetFieldIndex(sort_key.name);
+    if (index == -1) {
+      return Status::Invalid("Sort key column '", sort_key.name, "' not found in ",
+                             schema.ToString());
+    }
+    std::unique_ptr<SortColumn> sort_column;
+    RETURN_NOT_OK(MakeSortColumn(*columns[index], &sort_column));
+    sort_columns.push_back(std::move(sort_column));
+  }
+
+  std::shared_ptr<Buffer> indices_buf;
+  RETURN_NOT_OK(
+      AllocateBuffer(ctx->memory_pool(), length * sizeof(uint64_t), &indices_buf));
+  auto indices_begin = reinterpret_cast<uint64_t*>(indices_buf->mutable_data());
+  auto indices_end = indices_begin + length;
+  std::iota(indices_begin, indices_end, 0);
+
+  for (size_t i = sort_columns.size(); i-- > 0;) {
+    const SortColumn& sort_column = *sort_columns[i];
+    uint64_t* values_begin = indices_begin;
+    uint64_t* values_end = indices_end;
+    if (sort_column.null_count() > 0) {
+      if (options.null_placement == SortOptions::NULLS_AT_START) {
+        values_begin = std::stable_partition(
+            indices_begin, indices_end,
+            [&sort_column](uint64_t row) { return sort_column.IsNull(row); });
+      } else {
+        values_end = std::stable_partition(
+            indices_begin, indices_end,
+            [&sort_column](uint64_t row) { return !sort_column.IsNull(row); });
+      }
+    }
+    sort_column.Sort(values_begin, values_end,
+                     options.sort_keys[i].order == SortKey::DESCENDING);
+  }
+
+  *offsets = std::make_shared<UInt64Array>(length, indices_buf);
+  return Status::OK();
+}
+
+}  // namespace
+
+Status SortToIndices(FunctionContext* ctx, const ChunkedArray& values,
+                     const ChunkedSortOptions& options, std::shared_ptr<Array>* offsets) {
+  switch (values.type()->id()) {
+#define CHUNKED_SORT_CASE(TYPE_CLASS)                                            \
+  case TYPE_CLASS::type_id:                                                      \
+    return SortChunkedArrayToIndices<TYPE_CLASS>(ctx, values, options, offsets);
+
+    CHUNKED_SORT_CASE(UInt8Type)
+    CHUNKED_SORT_CASE(Int8Type)
+    CHUNKED_SORT_CASE(UInt16Type)
+    CHUNKED_SORT_CASE(Int16Type)
+    CHUNKED_SORT_CASE(UInt32Type)
+    CHUNKED_SORT_CASE(Int32Type)
+    CHUNKED_SORT_CASE(UInt64Type)
+    CHUNKED_SORT_CASE(Int64Type)
+    CHUNKED_SORT_CASE(FloatType)
+    CHUNKED_SORT_CASE(DoubleType)
+    CHUNKED_SORT_CASE(BinaryType)
+    CHUNKED_SORT_CASE(StringType)
+
+#undef CHUNKED_SORT_CASE
+
+    default:
+      break;
+  }
+  return Status::NotImplemented("Sorting of ", *values.type(), " arrays");
+}
+
+Status SortToIndices(FunctionContext* ctx, const RecordBatch& batch,
+                     const SortOptions& options, std::shared_ptr<Array>* offsets) {
+  std::vector<std::shared_ptr<ChunkedArray>> columns;
+  for (int i = 0; i < batch.num_columns(); ++i) {
+    columns.push_back(std::make_shared<ChunkedArray>(ArrayVector{batch.column(i)}));
+  }
+  return MultipleKeySortToIndices(ctx, *batch.schema(), batch.num_rows(), columns,
+                                  options, offsets);
+}
+
+Status SortToIndices(FunctionContext* ctx, const Table& table, const SortOptions& options,
+                     std::shared_ptr<Array>* offsets) {
+  return MultipleKeySortToIndices(ctx, *table.schema(), table.num_rows(),
+                                  table.columns(), options, offsets);
+}
+
 }  // namespace compute
 }  // namespace arrow
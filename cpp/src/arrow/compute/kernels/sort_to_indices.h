@@ -18,6 +18,9 @@
 #pragma once
 
 #include <memory>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include "arrow/compute/kernel.h"
 #include "arrow/status.h"
@@ -26,6 +29,9 @@
 namespace arrow {
 
 class Array;
+class ChunkedArray;
+class RecordBatch;
+class Table;
 
 namespace compute {
 
@@ -47,5 +53,127 @@ ARROW_EXPORT
 Status SortToIndices(FunctionContext* ctx, const Array& values,
                      std::shared_ptr<Array>* offsets);
 
+/// \class ChunkedSortOptions
+///
+/// The user controls sorting of chunked arrays with this class.
+struct ARROW_EXPORT ChunkedSortOptions {
+  enum OutputType {
+    // A UInt64Array of row indices into the chunked array as a whole.
+    GLOBAL_INDICES = 0,
+    // A StructArray with a UInt32 "chunk" field and a UInt64 "offset" field,
+    // the row being at the given offset within the given chunk.
+    CHUNK_INDICES,
+  };
+
+  explicit ChunkedSortOptions(OutputType output_type = GLOBAL_INDICES)
+      : output_type(output_type) {}
+
+  OutputType output_type;
+  // Sort the chunks and merge the sorted runs in parallel on the CPU thread
+  // pool.
+  bool use_threads = true;
+};
+
+/// \brief Returns the indices that would sort a chunked array.
+///
+/// The output is the same as sorting the concatenation of the chunks (see
+/// above), but the chunks are never concatenated: each chunk is sorted on
+/// its own, then the sorted chunks are merged into the output indices. With
+/// options.use_threads both steps run in parallel, the merge being split
+/// into independent ranges of values.
+///
+/// For example given chunks [[null, 1, 3.3], [null, 2, 5.3]], the output
+/// will be [1, 4, 2, 5, 0, 3], or with CHUNK_INDICES the pairs (0, 1), (1, 1),
+/// (0, 2), (1, 2), (0, 0), (1, 0).
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] values chunked array to sort
+/// \param[in] options output type and threading, see ChunkedSortOptions
+/// \param[out] offsets indices that would sort the chunked array
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status SortToIndices(FunctionContext* ctx, const ChunkedArray& values,
+                     const ChunkedSortOptions& options, std::shared_ptr<Array>* offsets);
+
+/// \class SortKey
+///
+/// One column to sort by, and the direction to sort it in.
+struct ARROW_EXPORT SortKey {
+  enum Order {
+    ASCENDING = 0,
+    DESCENDING,
+  };
+
+  explicit SortKey(std::string name, Order order = ASCENDING)
+      : name(std::move(name)), order(order) {}
+
+  std::string name;
+  Order order;
+};
+
+/// \class SortOptions
+///
+/// The user controls sorting of record batches and tables with this class:
+/// the sort keys, from most to least significant, and where null values are
+/// placed relative to non-null values (regardless of the key's order).
+struct ARROW_EXPORT SortOptions {
+  enum NullPlacement {
+    // Nulls sort after all non-null values.
+    NULLS_AT_END = 0,
+    // Nulls sort before all non-null values.
+    NULLS_AT_START,
+  };
+
+  explicit SortOptions(std::vector<SortKey> sort_keys = {},
+                       NullPlacement null_placement = NULLS_AT_END)
+      : sort_keys(std::move(sort_keys)), null_placement(null_placement) {}
+
+  std::vector<SortKey> sort_keys;
+  NullPlacement null_placement;
+};
+
+/// \brief Returns the indices that would sort a record batch by several keys
+///
+/// The sort is stable: rows comparing equal on all keys keep their relative
+/// order. Rows are sorted one key at a time, from the least to the most
+/// significant; keys of integer, floating point, boolean and temporal types
+/// are sorted with an LSD radix sort, binary-like keys with a comparison sort.
+/// NaN compares greater than all other floating point values, so it sorts
+/// last with ASCENDING order and first with DESCENDING order (unlike nulls,
+/// whose placement does not depend on the order).
+///
+/// For example given a = [1, 2, 1, null] and b = [5, 6, 7, 8], sorting with
+/// keys {"a", ASCENDING} and {"b", DESCENDING} gives [2, 0, 1, 3].
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] batch record batch to sort
+/// \param[in] options sort keys and null placement, see SortOptions
+/// \param[out] offsets indices that would sort the batch
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status SortToIndices(FunctionContext* ctx, const RecordBatch& batch,
+                     const SortOptions& options, std::shared_ptr<Array>* offsets);
+
+/// \brief Returns the indices that would sort a table by several keys
+///
+/// Same as for a record batch. The output indices are global row indices,
+/// suitable for Take(); chunked key columns are sorted as is, without
+/// concatenating their chunks.
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] table table to sort
+/// \param[in] options sort keys and null placement, see SortOptions
+/// \param[out] offsets indices that would sort the table
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status SortToIndices(FunctionContext* ctx, const Table& table, const SortOptions& options,
+                     std::shared_ptr<Array>* offsets);
+
 }  // namespace compute
 }  // namespace arrow
@@ -15,12 +15,17 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <limits>
+
 #include "benchmark/benchmark.h"
 
+#include "arrow/compute/kernels/nth_to_indices.h"
 #include "arrow/compute/kernels/sort_to_indices.h"
 
 #include "arrow/compute/benchmark_util.h"
 #include "arrow/compute/test_util.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
 
@@ -60,6 +65,87 @@ static void SortToIndicesInt8(benchmark::State& state) {
   SortToIndicesBenchmark(state, values);
 }
 
+static void SortToIndicesRecordBatchInt64Keys(benchmark::State& state) {
+  RegressionArgs args(state);
+
+  const int64_t array_size = args.size / (2 * sizeof(int64_t));
+  auto rand = random::RandomArrayGenerator(kSeed);
+
+  // A low cardinality leading key, so that the second key decides many rows
+  auto batch = RecordBatch::Make(
+      schema({field("a", int64()), field("b", int64())}), array_size,
+      {rand.Int64(array_size, -100, 100, args.null_proportion),
+       rand.Int64(array_size, std::numeric_limits<int64_t>::min(),
+                  std::numeric_limits<int64_t>::max(), args.null_proportion)});
+  SortOptions options({SortKey("a"), SortKey("b", SortKey::DESCENDING)});
+
+  FunctionContext ctx;
+  for (auto _ : state) {
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(SortToIndices(&ctx, *batch, options, &out));
+    benchmark::DoNotOptimize(out);
+  }
+}
+
+static void SortToIndicesChunkedInt64(benchmark::State& state) {
+  RegressionArgs args(state);
+
+  const int64_t array_size = args.size / sizeof(int64_t);
+  const int64_t num_chunks = 16;
+  auto rand = random::RandomArrayGenerator(kSeed);
+
+  ArrayVector chunks;
+  for (int64_t i = 0; i < num_chunks; ++i) {
+    chunks.push_back(rand.Int64(array_size / num_chunks,
+                                std::numeric_limits<int64_t>::min(),
+                                std::numeric_limits<int64_t>::max(),
+                                args.null_proportion));
+  }
+  ChunkedArray values(chunks);
+
+  FunctionContext ctx;
+  for (auto _ : state) {
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(SortToIndices(&ctx, values, ChunkedSortOptions(), &out));
+    benchmark::DoNotOptimize(out);
+  }
+}
+
+// Select the 100 largest values, to compare with a full sort
+static void TopKToIndicesInt64(benchmark::State& state) {
+  RegressionArgs args(state);
+
+  const int64_t array_size = args.size / sizeof(int64_t);
+  auto rand = random::RandomArrayGenerator(kSeed);
+
+  auto values = rand.Int64(array_size, std::numeric_limits<int64_t>::min(),
+                           std::numeric_limits<int64_t>::max(), args.null_proportion);
+
+  FunctionContext ctx;
+  for (auto _ : state) {
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(TopKToIndices(&ctx, *values, TopKOptions(100), &out));
+    benchmark::DoNotOptimize(out);
+  }
+}
+
+static void NthToIndicesInt64(benchmark::State& state) {
+  RegressionArgs args(state);
+
+  const int64_t array_size = args.size / sizeof(int64_t);
+  auto rand = random::RandomArrayGenerator(kSeed);
+
+  auto values = rand.Int64(array_size, std::numeric_limits<int64_t>::min(),
+                           std::numeric_limits<int64_t>::max(), args.null_proportion);
+
+  FunctionContext ctx;
+  for (auto _ : state) {
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(NthToIndices(&ctx, *values, array_size / 2, &out));
+    benchmark::DoNotOptimize(out);
+  }
+}
+
 BENCHMARK(SortToIndicesInt64)
     ->Apply(RegressionSetArgs)
     ->Args({1 << 20, 1})
@@ -76,5 +162,35 @@ BENCHMARK(SortToIndicesInt8)
     ->Args({1 << 23, 99})
     ->MinTime(1.0)
     ->Unit(benchmark::TimeUnit::kNanosecond);
+
+BENCHMARK(TopKToIndicesInt64)
+    ->Apply(RegressionSetArgs)
+    ->Args({1 << 20, 1})
+    ->Args({1 << 23, 1})
+    ->Args({1 << 23, 50})
+    ->MinTime(1.0)
+    ->Unit(benchmark::TimeUnit::kNanosecond);
+
+BENCHMARK(NthToIndicesInt64)
+    ->Apply(RegressionSetArgs)
+    ->Args({1 << 20, 1})
+    ->Args({1 << 23, 1})
+    ->MinTime(1.0)
+    ->Unit(benchmark::TimeUnit::kNanosecond);
+
+BENCHMARK(SortToIndicesChunkedInt64)
+    ->Apply(RegressionSetArgs)
+    ->Args({1 << 20, 1})
+    ->Args({1 << 23, 1})
+    ->MinTime(1.0)
+    ->Unit(benchmark::TimeUnit::kNanosecond);
+
+BENCHMARK(SortToIndicesRecordBatchInt64Keys)
+    ->Apply(RegressionSetArgs)
+    ->Args({1 << 20, 1})
+    ->Args({1 << 23, 1})
+    ->Args({1 << 23, 50})
+    ->MinTime(1.0)
+    ->Unit(benchmark::TimeUnit::kNanosecond);
 }  // namespace compute
 }  // namespace arrow
@@ -15,21 +15,29 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
 #include <limits>
 #include <memory>
 #include <string>
 #include <vector>
 
+#include "arrow/array/concatenate.h"
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernels/sort_to_indices.h"
 #include "arrow/compute/test_util.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
 #include "arrow/testing/gtest_common.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
 #include "arrow/testing/util.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/checked_cast.h"
 
 namespace arrow {
+
+using internal::checked_cast;
+
 namespace compute {
 
 template <typename ArrowType>
@@ -209,5 +217,275 @@ TYPED_TEST(TestSortToIndicesKernelRandom, SortRandomValues) {
   }
 }
 
+class TestSortToIndicesChunked : public ComputeFixture, public TestBase {
+ protected:
+  void AssertSortToIndices(const std::shared_ptr<ChunkedArray>& values,
+                           const std::string& expected) {
+    for (bool use_threads : {false, true}) {
+      ChunkedSortOptions options;
+      options.use_threads = use_threads;
+      std::shared_ptr<Array> actual;
+      ASSERT_OK(SortToIndices(&this->ctx_, *values, options, &actual));
+      ASSERT_OK(actual->ValidateFull());
+      AssertArraysEqual(*ArrayFromJSON(uint64(), expected), *actual);
+    }
+  }
+};
+
+TEST_F(TestSortToIndicesChunked, GlobalIndices) {
+  AssertSortToIndices(
+      ChunkedArrayFromJSON(float64(), {"[null, 1, 3.3]", "[null, 2, 5.3]"}),
+      "[1, 4, 2, 5, 0, 3]");
+  AssertSortToIndices(ChunkedArrayFromJSON(int16(), {"[]", "[3, 1]", "[]", "[1, 0]"}),
+                      "[3, 1, 2, 0]");
+  AssertSortToIndices(ChunkedArrayFromJSON(utf8(), {R"(["b", "a"])", R"(["a", null])"}),
+                      "[1, 2, 0, 3]");
+  AssertSortToIndices(ChunkedArrayFromJSON(int32(), {"[]"}), "[]");
+}
+
+TEST_F(TestSortToIndicesChunked, ChunkIndices) {
+  auto values = ChunkedArrayFromJSON(int64(), {"[5, 1, 3, null]", "[2, 1]"});
+  std::shared_ptr<Array> actual;
+  ASSERT_OK(SortToIndices(&this->ctx_, *values,
+                          ChunkedSortOptions(ChunkedSortOptions::CHUNK_INDICES),
+                          &actual));
+  ASSERT_OK(actual->ValidateFull());
+  auto expected_type = struct_({field("chunk", uint32()), field("offset", uint64())});
+  AssertArraysEqual(*ArrayFromJSON(expected_type, R"([
+    {"chunk": 0, "offset": 1},
+    {"chunk": 1, "offset": 1},
+    {"chunk": 1, "offset": 0},
+    {"chunk": 0, "offset": 2},
+    {"chunk": 0, "offset": 0},
+    {"chunk": 0, "offset": 3}
+  ])"),
+                    *actual);
+}
+
+TEST_F(TestSortToIndicesChunked, Errors) {
+  std::shared_ptr<Array> actual;
+  ASSERT_RAISES(NotImplemented,
+                SortToIndices(&this->ctx_, *ChunkedArrayFromJSON(boolean(), {"[true]"}),
+                              ChunkedSortOptions(), &actual));
+}
+
+TEST_F(TestSortToIndicesChunked, RandomValues) {
+  // Large enough for the merge to be split into several ranges
+  auto rand = random::RandomArrayGenerator(0x5487657);
+  for (auto type_id : {Type::INT32, Type::DOUBLE, Type::STRING}) {
+    ArrayVector chunks;
+    for (int64_t length : {10000, 0, 25000, 3}) {
+      switch (type_id) {
+        case Type::INT32:
+          chunks.push_back(rand.Int32(length, -1000, 1000, 0.1));
+          break;
+        case Type::DOUBLE:
+          chunks.push_back(rand.Float64(length, -1e6, 1e6, 0.1));
+          break;
+        default:
+          chunks.push_back(rand.String(length, 0, 4, 0.1));
+          break;
+      }
+    }
+    auto values = std::make_shared<ChunkedArray>(chunks);
+    std::shared_ptr<Array> concatenated, expected, actual;
+    ASSERT_OK(Concatenate(chunks, default_memory_pool(), &concatenated));
+    ASSERT_OK(SortToIndices(&this->ctx_, *concatenated, &expected));
+    for (bool use_threads : {false, true}) {
+      ChunkedSortOptions options;
+      options.use_threads = use_threads;
+      ASSERT_OK(SortToIndices(&this->ctx_, *values, options, &actual));
+      AssertArraysEqual(*expected, *actual);
+    }
+  }
+}
+
+class TestSortToIndicesTable : public ComputeFixture, public TestBase {
+ protected:
+  void AssertSortToIndices(const std::shared_ptr<Schema>& schema,
+                           const std::vector<std::string>& json,
+                           const SortOptions& options, const std::string& expected) {
+    auto table = TableFromJSON(schema, json);
+    std::shared_ptr<Array> actual;
+    ASSERT_OK(SortToIndices(&this->ctx_, *table, options, &actual));
+    ASSERT_OK(actual->ValidateFull());
+    AssertArraysEqual(*ArrayFromJSON(uint64(), expected), *actual);
+
+    // A record batch sorts the same as the equivalent single chunk table
+    std::shared_ptr<Table> combined;
+    ASSERT_OK(table->CombineChunks(default_memory_pool(), &combined));
+    TableBatchReader reader(*combined);
+    std::shared_ptr<RecordBatch> batch;
+    ASSERT_OK(reader.ReadNext(&batch));
+    if (batch != nullptr) {
+      ASSERT_OK(SortToIndices(&this->ctx_, *batch, options, &actual));
+      AssertArraysEqual(*ArrayFromJSON(uint64(), expected), *actual);
+    }
+  }
+};
+
+TEST_F(TestSortToIndicesTable, MultipleKeys) {
+  auto schema = arrow::schema({field("a", int32()), field("b", utf8())});
+  std::vector<std::string> json = {R"([
+    {"a": 3, "b": "x"},
+    {"a": 1, "b": "y"},
+    {"a": 3, "b": null}
+  ])",
+                                   R"([
+    {"a": null, "b": "x"},
+    {"a": 1, "b": "x"},
+    {"a": 3, "b": "z"},
+    {"a": 1, "b": "y"}
+  ])"};
+
+  AssertSortToIndices(schema, json, SortOptions({SortKey("a"), SortKey("b")}),
+                      "[4, 1, 6, 0, 5, 2, 3]");
+  AssertSortToIndices(schema, json,
+                      SortOptions({SortKey("a", SortKey::DESCENDING), SortKey("b")}),
+                      "[0, 5, 2, 4, 1, 6, 3]");
+  AssertSortToIndices(schema, json,
+                      SortOptions({SortKey("b", SortKey::DESCENDING),
+                                   SortKey("a", SortKey::DESCENDING)}),
+                      "[5, 1, 6, 0, 4, 3, 2]");
+  AssertSortToIndices(
+      schema, json,
+      SortOptions({SortKey("a"), SortKey("b")}, SortOptions::NULLS_AT_START),
+      "[3, 4, 1, 6, 2, 0, 5]");
+  AssertSortToIndices(schema, {"[]"}, SortOptions({SortKey("a")}), "[]");
+}
+
+TEST_F(TestSortToIndicesTable, FloatingPoint) {
+  auto schema = arrow::schema({field("f", float64())});
+  std::vector<std::string> json = {"[[1.5], [NaN], [-0.5], [null]]",
+                                   "[[-Inf], [Inf], [0.0], [-2.5]]"};
+  AssertSortToIndices(schema, json, SortOptions({SortKey("f")}),
+                      "[4, 7, 2, 6, 0, 5, 1, 3]");
+  // NaN is the largest value, so it leads in descending order
+  AssertSortToIndices(schema, json, SortOptions({SortKey("f", SortKey::DESCENDING)}),
+                      "[1, 5, 0, 6, 2, 7, 4, 3]");
+}
+
+TEST_F(TestSortToIndicesTable, TemporalAndBoolean) {
+  auto schema = arrow::schema({field("t", timestamp(TimeUnit::SECOND)),
+                               field("d", date32()), field("b", boolean())});
+  std::vector<std::string> json = {R"([
+    {"t": 100, "d": -3, "b": true},
+    {"t": -100, "d": 5, "b": false},
+    {"t": 100, "d": 1, "b": false}
+  ])",
+                                   R"([
+    {"t": 0, "d": -3, "b": null},
+    {"t": 100, "d": 1, "b": true}
+  ])"};
+  AssertSortToIndices(schema, json, SortOptions({SortKey("t"), SortKey("d")}),
+                      "[1, 3, 0, 2, 4]");
+  AssertSortToIndices(schema, json,
+                      SortOptions({SortKey("b", SortKey::DESCENDING),
+                                   SortKey("t", SortKey::DESCENDING)}),
+                      "[0, 4, 2, 1, 3]");
+}
+
+TEST_F(TestSortToIndicesTable, Errors) {
+  auto table = TableFromJSON(schema({field("a", int32()), field("l", list(int32()))}),
+                             {R"([{"a": 1, "l": [1]}])"});
+  std::shared_ptr<Array> offsets;
+  ASSERT_RAISES(Invalid, SortToIndices(&this->ctx_, *table, SortOptions(), &offsets));
+  ASSERT_RAISES(Invalid, SortToIndices(&this->ctx_, *table,
+                                       SortOptions({SortKey("missing")}), &offsets));
+  ASSERT_RAISES(NotImplemented, SortToIndices(&this->ctx_, *table,
+                                              SortOptions({SortKey("l")}), &offsets));
+}
+
+// Compare rows of a table by several keys, with nulls at the end
+class RowComparator {
+ public:
+  RowComparator(const Table& table, const std::vector<SortKey>& sort_keys) {
+    for (const auto& sort_key : sort_keys) {
+      std::shared_ptr<Array> column;
+      ARROW_EXPECT_OK(Concatenate(table.GetColumnByName(sort_key.name)->chunks(),
+                                  default_memory_pool(), &column));
+      columns_.push_back(column);
+      descending_.push_back(sort_key.order == SortKey::DESCENDING);
+    }
+  }
+
+  // Returns -1, 0 or 1
+  template <typename ArrayType>
+  int CompareValues(const Array& array, uint64_t lhs, uint64_t rhs) {
+    const auto& values = checked_cast<const ArrayType&>(array);
+    if (values.GetView(lhs) == values.GetView(rhs)) return 0;
+    return values.GetView(lhs) < values.GetView(rhs) ? -1 : 1;
+  }
+
+  int Compare(uint64_t lhs, uint64_t rhs) {
+    for (size_t i = 0; i < columns_.size(); ++i) {
+      const Array& column = *columns_[i];
+      if (column.IsNull(lhs) || column.IsNull(rhs)) {
+        if (column.IsNull(lhs) && column.IsNull(rhs)) continue;
+        return column.IsNull(lhs) ? 1 : -1;
+      }
+      int result = 0;
+      switch (column.type_id()) {
+        case Type::INT8:
+          result = CompareValues<Int8Array>(column, lhs, rhs);
+          break;
+        case Type::INT64:
+          result = CompareValues<Int64Array>(column, lhs, rhs);
+          break;
+        case Type::DOUBLE:
+          result = CompareValues<DoubleArray>(column, lhs, rhs);
+          break;
+        case Type::STRING:
+          result = CompareValues<StringArray>(column, lhs, rhs);
+          break;
+        default:
+          ADD_FAILURE() << "Unexpected type " << *column.type();
+      }
+      if (result != 0) {
+        return descending_[i] ? -result : result;
+      }
+    }
+    return 0;
+  }
+
+ private:
+  std::vector<std::shared_ptr<Array>> columns_;
+  std::vector<bool> descending_;
+};
+
+TEST_F(TestSortToIndicesTable, RandomValues) {
+  auto rand = random::RandomArrayGenerator(0x5487656);
+  auto schema = arrow::schema({field("i8", int8()), field("i64", int64()),
+                               field("f64", float64()), field("s", utf8())});
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  for (int64_t length : {0, 700, 1300}) {
+    batches.push_back(RecordBatch::Make(
+        schema, length,
+        {rand.Int8(length, -10, 10, 0.1), rand.Int64(length, -1000000, 1000000, 0.1),
+         rand.Float64(length, -1e6, 1e6, 0.1), rand.String(length, 0, 2, 0.1)}));
+  }
+  std::shared_ptr<Table> table;
+  ASSERT_OK(Table::FromRecordBatches(batches, &table));
+
+  for (const auto& sort_keys : std::vector<std::vector<SortKey>>{
+           {SortKey("i64")},
+           {SortKey("i8"), SortKey("f64", SortKey::DESCENDING)},
+           {SortKey("s", SortKey::DESCENDING), SortKey("i8"), SortKey("i64")}}) {
+    std::shared_ptr<Array> offsets;
+    ASSERT_OK(SortToIndices(&this->ctx_, *table, SortOptions(sort_keys), &offsets));
+    ASSERT_EQ(offsets->length(), table->num_rows());
+    const auto& indices = checked_cast<const UInt64Array&>(*offsets);
+    RowComparator comparator(*table, sort_keys);
+    for (int64_t i = 1; i < indices.length(); ++i) {
+      const int result = comparator.Compare(indices.Value(i - 1), indices.Value(i));
+      ASSERT_LE(result, 0);
+      if (result == 0) {
+        // Stable sort
+        ASSERT_LT(indices.Value(i - 1), indices.Value(i));
+      }
+    }
+  }
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -19,6 +19,8 @@
 
 #include <memory>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 #include "arrow/compute/kernel.h"
 #include "arrow/compute/kernels/aggregate.h"
@@ -26,6 +28,7 @@
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/bit_util.h"
+#include "arrow/util/dispatch.h"
 #include "arrow/util/logging.h"
 
 namespace arrow {
@@ -54,6 +57,74 @@ struct FindAccumulatorType<I, enable_if_floating_point<I>> {
   using Type = DoubleType;
 };
 
+// ----------------------------------------------------------------------
+// Sum of values without nulls, with an implementation for each DispatchLevel
+
+/// The values are summed in independent lanes, which lets the compiler
+/// vectorize the loop even for floating point values (whose additions it
+/// may not reorder).  The lanes do not depend on the instruction set, so
+/// all levels give the same result.
+template <internal::DispatchLevel Level, typename CType, typename SumCType>
+SumCType SumDenseLoop(const CType* values, int64_t length) {
+  constexpr int64_t kLanes = 16;
+  SumCType lanes[kLanes] = {};
+
+  const int64_t num_blocks = length / kLanes;
+  for (int64_t block = 0; block < num_blocks; ++block) {
+    const CType* block_values = values + block * kLanes;
+    for (int64_t j = 0; j < kLanes; ++j) {
+      lanes[j] += block_values[j];
+    }
+  }
+  for (int64_t i = num_blocks * kLanes; i < length; ++i) {
+    lanes[i % kLanes] += values[i];
+  }
+
+  SumCType sum = 0;
+  for (int64_t j = 0; j < kLanes; ++j) {
+    sum += lanes[j];
+  }
+  return sum;
+}
+
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+template <typename CType, typename SumCType>
+SumCType SumDenseAvx2(const CType* values, int64_t length);
+#endif
+
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+template <typename CType, typename SumCType>
+SumCType SumDenseAvx512(const CType* values, int64_t length);
+#endif
+
+template <typename CType, typename SumCType>
+struct SumDenseDynamic {
+  using FunctionType =
+      decltype(&SumDenseLoop<internal::DispatchLevel::NONE, CType, SumCType>);
+
+  static std::vector<std::pair<internal::DispatchLevel, FunctionType>> implementations() {
+    return {
+      {internal::DispatchLevel::NONE,
+       SumDenseLoop<internal::DispatchLevel::NONE, CType, SumCType>}
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+      , {internal::DispatchLevel::AVX2, SumDenseAvx2<CType, SumCType>}
+#endif
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+      , {internal::DispatchLevel::AVX512, SumDenseAvx512<CType, SumCType>}
+#endif
+    };
+  }
+};
+
+template <typename CType, typename SumCType>
+SumCType SumDense(const CType* values, int64_t length) {
+  static internal::DynamicDispatch<SumDenseDynamic<CType, SumCType>> dispatch;
+  return dispatch.func(values, length);
+}
+
+// ----------------------------------------------------------------------
+// Sum aggregate
+
 template <typename ArrowType, typename StateType>
 class SumAggregateFunction final : public AggregateFunctionStaticState<StateType> {
   using CType = typename TypeTraits<ArrowType>::CType;
@@ -99,12 +170,8 @@ class SumAggregateFunction final : public AggregateFunctionStaticState<StateType
   StateType ConsumeDense(const ArrayType& array) const {
     StateType local;
 
-    const auto values = array.raw_values();
     const int64_t length = array.length();
-    for (int64_t i = 0; i < length; i++) {
-      local.sum += values[i];
-    }
-
+    local.sum = SumDense<CType, decltype(local.sum)>(array.raw_values(), length);
     local.count = length;
 
     return local;
@@ -21,6 +21,7 @@
 #include <memory>
 #include <utility>
 
+#include "arrow/csv/lexing_internal.h"
 #include "arrow/status.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/make_unique.h"
@@ -45,7 +46,10 @@ class Lexer {
     AT_QUOTED_ESCAPE
   };
 
-  explicit Lexer(const ParseOptions& options) : options_(options) {
+  // If given, `finder` must span the data passed to ReadLine(), and is used
+  // to skip over runs of ordinary characters
+  explicit Lexer(const ParseOptions& options, SpecialCharFinder* finder = NULLPTR)
+      : options_(options), finder_(finder) {
     DCHECK_EQ(quoting, options_.quoting);
     DCHECK_EQ(escaping, options_.escaping);
   }
@@ -88,6 +92,9 @@ class Lexer {
 
   InField:
     // Inside a non-quoted part of a field
+    if (finder_ != NULLPTR) {
+      data = finder_->Next(data);
+    }
     if (ARROW_PREDICT_FALSE(data == data_end)) {
       state_ = IN_FIELD;
       goto AbortLine;
@@ -113,6 +120,10 @@ class Lexer {
     if (ARROW_PREDICT_FALSE(c == options_.delimiter)) {
       goto FieldEnd;
     }
+    if (quoting && finder_ != NULLPTR && ARROW_PREDICT_FALSE(c == options_.quote_char)) {
+      // Not at the start of a field, this is an ordinary character
+      finder_->StopMaskingQuoted(data - 1);
+    }
     goto InField;
 
   AtEscape:
@@ -122,6 +133,9 @@ class Lexer {
 
   InQuotedField:
     // Inside a quoted part of a field
+    if (finder_ != NULLPTR) {
+      data = finder_->Next(data);
+    }
     if (ARROW_PREDICT_FALSE(data == data_end)) {
       state_ = IN_QUOTED_FIELD;
       goto AbortLine;
@@ -180,6 +194,7 @@ class Lexer {
 
  protected:
   const ParseOptions& options_;
+  SpecialCharFinder* finder_;
   State state_ = FIELD_START;
 };
 
@@ -210,11 +225,14 @@ class LexingBoundaryFinder : public BoundaryFinder {
   }
 
   Status FindLast(util::string_view block, int64_t* out_pos) override {
-    Lexer<quoting, escaping> lexer(options_);
-
     const char* data = block.data();
     const char* const data_end = block.data() + block.size();
 
+    // The block starts at the beginning of a line, so its special characters
+    // can be classified upfront
+    SpecialCharFinder finder(options_, data, data_end);
+    Lexer<quoting, escaping> lexer(options_, &finder);
+
     while (data < data_end) {
       const char* line_end = lexer.ReadLine(data, data_end);
       if (line_end == nullptr) {
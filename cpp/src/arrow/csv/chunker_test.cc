@@ -261,5 +261,24 @@ TEST_P(BaseChunkerTest, EscapingNewline) {
   }
 }
 
+TEST_P(BaseChunkerTest, LongFields) {
+  // Fields spanning several 64-byte words of special character bitmaps
+  const std::string a(100, 'a');
+  const std::string b(70, 'b');
+  MakeChunker();
+  {
+    auto csv = MakeCSVData({a + "," + b + "\n", "\"" + b + "\"," + a + "\n"});
+    auto lengths = {172, 174};
+    AssertChunking(*chunker_, csv, lengths);
+  }
+  if (options_.newlines_in_values) {
+    // Quoted newlines and stray quotes
+    auto csv = MakeCSVData({"\"" + a + "\n" + b + "\"\n", a + "\"" + b + "\n",
+                            "\"" + b + "\r\n" + a + "\",x\n"});
+    auto lengths = {174, 172, 177};
+    AssertChunking(*chunker_, csv, lengths);
+  }
+}
+
 }  // namespace csv
 }  // namespace arrow
@@ -0,0 +1,160 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/csv/lexing_internal.h"
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+#include "arrow/util/cpu_info.h"
+
+namespace arrow {
+namespace csv {
+
+using ::arrow::internal::CpuInfo;
+using ::arrow::internal::DispatchLevel;
+
+namespace {
+
+struct ClassifySpecialCharsDynamic {
+  using FunctionType = decltype(&ClassifySpecialChars<DispatchLevel::NONE>);
+
+  static std::vector<std::pair<DispatchLevel, FunctionType>> implementations() {
+    std::vector<std::pair<DispatchLevel, FunctionType>> impls = {
+        {DispatchLevel::NONE, ClassifySpecialChars<DispatchLevel::NONE>}};
+    // The vectorized implementations compute the quote parity with a carry-less
+    // multiplication
+    if (CpuInfo::GetInstance()->IsSupported(CpuInfo::CLMUL)) {
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+      impls.emplace_back(DispatchLevel::AVX2, ClassifySpecialCharsAvx2);
+#endif
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+      impls.emplace_back(DispatchLevel::AVX512, ClassifySpecialCharsAvx512);
+#endif
+    }
+    return impls;
+  }
+};
+
+// Number of 64-byte words classified at once
+constexpr int64_t kWindowWords = 64;
+
+// Number of 64-byte words sampled by HasLongRuns()
+constexpr int64_t kSampleWords = 16;
+
+// Below this mean number of bytes per special character, the parser's
+// byte-by-byte scan is faster than looking up the next special character
+constexpr int64_t kMinMeanRunLength = 12;
+
+void ClassifyDispatched(const SpecialChars& chars, bool mask_quoted, const uint8_t* data,
+                        int64_t num_words, uint64_t* out_bits, uint64_t* in_quotes) {
+  static ::arrow::internal::DynamicDispatch<ClassifySpecialCharsDynamic> dispatch;
+  dispatch.func(chars, mask_quoted, data, num_words, out_bits, in_quotes);
+}
+
+SpecialChars MakeSpecialChars(const ParseOptions& options) {
+  return {static_cast<uint8_t>(options.delimiter),
+          static_cast<uint8_t>(options.quote_char),
+          static_cast<uint8_t>(options.escape_char), options.quoting, options.escaping};
+}
+
+}  // namespace
+
+SpecialCharFinder::SpecialCharFinder(const ParseOptions& options, const char* data,
+                                     const char* data_end)
+    : chars_(MakeSpecialChars(options)),
+      // Escaped quotes would break the quote parity
+      mask_quoted_(options.quoting && !options.escaping),
+      data_(data),
+      data_end_(data_end),
+      num_words_((data_end - data + 63) / 64),
+      bits_(num_words_),
+      word_start_(data) {}
+
+bool SpecialCharFinder::HasLongRuns(const ParseOptions& options, const char* data,
+                                    const char* data_end) {
+  const int64_t num_words = std::min(kSampleWords, (data_end - data) / 64);
+  if (num_words == 0) {
+    return false;
+  }
+  uint64_t bits[kSampleWords];
+  uint64_t in_quotes = 0;
+  ClassifyDispatched(MakeSpecialChars(options), /*mask_quoted=*/false,
+                     reinterpret_cast<const uint8_t*>(data), num_words, bits,
+                     &in_quotes);
+  const int64_t num_special = ::arrow::internal::CountSetBits(
+      reinterpret_cast<const uint8_t*>(bits), 0, num_words * 64);
+  return num_special * kMinMeanRunLength <= num_words * 64;
+}
+
+const char* SpecialCharFinder::NextSlow(const char* pos) {
+  int64_t word_index = (pos - data_) / 64;
+  uint64_t mask = ~static_cast<uint64_t>(0) << ((pos - data_) % 64);
+  while (word_index < num_words_) {
+    if (word_index >= num_computed_words_) {
+      ComputeWords(word_index);
+    }
+    if ((bits_[word_index] & mask) != 0) {
+      word_start_ = data_ + word_index * 64;
+      word_ = bits_[word_index];
+      return word_start_ + BitUtil::CountTrailingZeros(word_ & mask);
+    }
+    ++word_index;
+    mask = ~static_cast<uint64_t>(0);
+  }
+  return data_end_;
+}
+
+void SpecialCharFinder::ComputeWords(int64_t word_index) {
+  // Words are computed contiguously, so as to carry the quote parity
+  const int64_t start = num_computed_words_;
+  const int64_t end =
+      std::min(num_words_, std::max(word_index + 1, start + kWindowWords));
+
+  const auto data = reinterpret_cast<const uint8_t*>(data_);
+  const int64_t full_words = std::min(end, (data_end_ - data_) / 64);
+  if (full_words > start) {
+    ClassifyDispatched(chars_, mask_quoted_, data + start * 64, full_words - start,
+                       bits_.data() + start, &in_quotes_);
+  }
+  if (end > full_words && end > start) {
+    // Last, partial word: classify a zero-padded copy
+    const int64_t tail_size = (data_end_ - data_) - full_words * 64;
+    uint8_t padded[64] = {};
+    std::memcpy(padded, data + full_words * 64, tail_size);
+    ClassifyDispatched(chars_, mask_quoted_, padded, 1, bits_.data() + full_words,
+                       &in_quotes_);
+    // The padding is never special, even if e.g. the delimiter is a NUL byte
+    bits_[full_words] &= (static_cast<uint64_t>(1) << tail_size) - 1;
+  }
+  num_computed_words_ = end;
+}
+
+void SpecialCharFinder::StopMaskingQuoted(const char* pos) {
+  if (mask_quoted_) {
+    mask_quoted_ = false;
+    // Recompute from the word containing `pos`
+    num_computed_words_ = std::min(num_computed_words_, (pos - data_) / 64);
+    word_start_ = data_;
+    word_ = 0;
+  }
+}
+
+}  // namespace csv
+}  // namespace arrow
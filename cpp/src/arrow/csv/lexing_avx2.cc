@@ -0,0 +1,76 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <immintrin.h>
+
+#include "arrow/csv/lexing_internal.h"
+
+namespace arrow {
+namespace csv {
+
+using ::arrow::internal::DispatchLevel;
+
+void ClassifySpecialCharsAvx2(const SpecialChars& chars, bool mask_quoted,
+                              const uint8_t* data, int64_t num_words,
+                              uint64_t* out_bits, uint64_t* in_quotes) {
+  const __m256i delimiter = _mm256_set1_epi8(static_cast<char>(chars.delimiter));
+  const __m256i quote_char = _mm256_set1_epi8(static_cast<char>(chars.quote_char));
+  const __m256i escape_char = _mm256_set1_epi8(static_cast<char>(chars.escape_char));
+  const __m256i cr = _mm256_set1_epi8('\r');
+  const __m256i lf = _mm256_set1_epi8('\n');
+  const __m128i all_ones = _mm_set1_epi8(-1);
+
+  auto to_bits = [](__m256i lo_matches, __m256i hi_matches) -> uint64_t {
+    const auto lo_bits = static_cast<uint32_t>(_mm256_movemask_epi8(lo_matches));
+    const auto hi_bits = static_cast<uint32_t>(_mm256_movemask_epi8(hi_matches));
+    return static_cast<uint64_t>(lo_bits) | (static_cast<uint64_t>(hi_bits) << 32);
+  };
+
+  for (int64_t w = 0; w < num_words; ++w, data += 64) {
+    const __m256i lo = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+    const __m256i hi = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + 32));
+    __m256i lo_special = _mm256_or_si256(
+        _mm256_cmpeq_epi8(lo, delimiter),
+        _mm256_or_si256(_mm256_cmpeq_epi8(lo, cr), _mm256_cmpeq_epi8(lo, lf)));
+    __m256i hi_special = _mm256_or_si256(
+        _mm256_cmpeq_epi8(hi, delimiter),
+        _mm256_or_si256(_mm256_cmpeq_epi8(hi, cr), _mm256_cmpeq_epi8(hi, lf)));
+    if (chars.escaping) {
+      lo_special = _mm256_or_si256(lo_special, _mm256_cmpeq_epi8(lo, escape_char));
+      hi_special = _mm256_or_si256(hi_special, _mm256_cmpeq_epi8(hi, escape_char));
+    }
+    const uint64_t special = to_bits(lo_special, hi_special);
+    const uint64_t quotes =
+        chars.quoting ? to_bits(_mm256_cmpeq_epi8(lo, quote_char),
+                                _mm256_cmpeq_epi8(hi, quote_char))
+                      : 0;
+
+    if (mask_quoted) {
+      // Prefix XOR as a carry-less multiplication by all ones
+      const uint64_t quote_parity = static_cast<uint64_t>(_mm_cvtsi128_si64(
+          _mm_clmulepi64_si128(_mm_set_epi64x(0, static_cast<int64_t>(quotes)),
+                               all_ones, 0)));
+      out_bits[w] = MaskQuoted<DispatchLevel::AVX2>(special, quotes, quote_parity,
+                                                    in_quotes);
+    } else {
+      out_bits[w] = special | quotes;
+    }
+  }
+}
+
+}  // namespace csv
+}  // namespace arrow
@@ -0,0 +1,60 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <immintrin.h>
+
+#include "arrow/csv/lexing_internal.h"
+
+namespace arrow {
+namespace csv {
+
+using ::arrow::internal::DispatchLevel;
+
+void ClassifySpecialCharsAvx512(const SpecialChars& chars, bool mask_quoted,
+                                const uint8_t* data, int64_t num_words,
+                                uint64_t* out_bits, uint64_t* in_quotes) {
+  const __m512i delimiter = _mm512_set1_epi8(static_cast<char>(chars.delimiter));
+  const __m512i quote_char = _mm512_set1_epi8(static_cast<char>(chars.quote_char));
+  const __m512i escape_char = _mm512_set1_epi8(static_cast<char>(chars.escape_char));
+  const __m512i cr = _mm512_set1_epi8('\r');
+  const __m512i lf = _mm512_set1_epi8('\n');
+  const __m128i all_ones = _mm_set1_epi8(-1);
+
+  for (int64_t w = 0; w < num_words; ++w, data += 64) {
+    const __m512i v = _mm512_loadu_si512(data);
+    uint64_t special = _mm512_cmpeq_epi8_mask(v, delimiter) |
+                       _mm512_cmpeq_epi8_mask(v, cr) | _mm512_cmpeq_epi8_mask(v, lf);
+    if (chars.escaping) {
+      special |= _mm512_cmpeq_epi8_mask(v, escape_char);
+    }
+    const uint64_t quotes = chars.quoting ? _mm512_cmpeq_epi8_mask(v, quote_char) : 0;
+
+    if (mask_quoted) {
+      // Prefix XOR as a carry-less multiplication by all ones
+      const uint64_t quote_parity = static_cast<uint64_t>(_mm_cvtsi128_si64(
+          _mm_clmulepi64_si128(_mm_set_epi64x(0, static_cast<int64_t>(quotes)),
+                               all_ones, 0)));
+      out_bits[w] = MaskQuoted<DispatchLevel::AVX512>(special, quotes, quote_parity,
+                                                      in_quotes);
+    } else {
+      out_bits[w] = special | quotes;
+    }
+  }
+}
+
+}  // namespace csv
+}  // namespace arrow
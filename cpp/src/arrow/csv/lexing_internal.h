@@ -0,0 +1,191 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "arrow/csv/options.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/dispatch.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/sse_util.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace csv {
+
+// Vectorized lexing of CSV data, in the manner of simdjson's "structural
+// indexes": the input is classified 64 bytes at a time into a bitmap of
+// "special" characters (delimiters, line separators, quotes and escapes),
+// which lets the parsing state machines skip over runs of ordinary bytes.
+//
+// Without escaping, the quote parity of each byte is computed as a prefix XOR
+// (a carry-less multiplication by all ones) of the quote bits, and the
+// delimiters and line separators inside quoted regions are left out.  This is
+// only exact as long as quotes open and close fields; see
+// SpecialCharFinder::StopMaskingQuoted().
+
+struct SpecialChars {
+  uint8_t delimiter;
+  uint8_t quote_char;
+  uint8_t escape_char;
+  bool quoting;
+  bool escaping;
+};
+
+/// Inclusive prefix XOR of the bits of `word`: bit i of the result is the
+/// parity of bits [0, i]
+template <::arrow::internal::DispatchLevel Level>
+inline uint64_t PrefixXor(uint64_t word) {
+  word ^= word << 1;
+  word ^= word << 2;
+  word ^= word << 4;
+  word ^= word << 8;
+  word ^= word << 16;
+  word ^= word << 32;
+  return word;
+}
+
+/// Leave out the delimiters and line separators inside quoted regions
+///
+/// `*in_quotes` is all ones if the word starts inside quotes, zero otherwise.
+/// It is updated for the next word.
+template <::arrow::internal::DispatchLevel Level>
+inline uint64_t MaskQuoted(uint64_t special, uint64_t quotes, uint64_t quote_parity,
+                           uint64_t* in_quotes) {
+  const uint64_t quoted = quote_parity ^ *in_quotes;
+  *in_quotes = static_cast<uint64_t>(static_cast<int64_t>(quoted) >> 63);
+  // Quote characters themselves are always kept
+  return (special & ~quoted) | quotes;
+}
+
+/// Classify `num_words` * 64 bytes of `data` into `out_bits`, one bit per byte,
+/// set for special characters.  If `mask_quoted` is true, the delimiters and
+/// line separators inside quoted regions are left out (see MaskQuoted).
+template <::arrow::internal::DispatchLevel Level>
+void ClassifySpecialChars(const SpecialChars& chars, bool mask_quoted,
+                          const uint8_t* data, int64_t num_words, uint64_t* out_bits,
+                          uint64_t* in_quotes) {
+  for (int64_t w = 0; w < num_words; ++w, data += 64) {
+    uint64_t special = 0;
+    uint64_t quotes = 0;
+#if defined(ARROW_HAVE_SSE2)
+    const __m128i delimiter = _mm_set1_epi8(static_cast<char>(chars.delimiter));
+    const __m128i quote_char = _mm_set1_epi8(static_cast<char>(chars.quote_char));
+    const __m128i escape_char = _mm_set1_epi8(static_cast<char>(chars.escape_char));
+    const __m128i cr = _mm_set1_epi8('\r');
+    const __m128i lf = _mm_set1_epi8('\n');
+    for (int i = 0; i < 4; ++i) {
+      const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i * 16));
+      __m128i matches = _mm_or_si128(
+          _mm_cmpeq_epi8(v, delimiter),
+          _mm_or_si128(_mm_cmpeq_epi8(v, cr), _mm_cmpeq_epi8(v, lf)));
+      if (chars.escaping) {
+        matches = _mm_or_si128(matches, _mm_cmpeq_epi8(v, escape_char));
+      }
+      special |= static_cast<uint64_t>(
+                     static_cast<uint16_t>(_mm_movemask_epi8(matches)))
+                 << (i * 16);
+      if (chars.quoting) {
+        quotes |= static_cast<uint64_t>(static_cast<uint16_t>(
+                      _mm_movemask_epi8(_mm_cmpeq_epi8(v, quote_char))))
+                  << (i * 16);
+      }
+    }
+#else
+    for (int i = 0; i < 64; ++i) {
+      const uint8_t c = data[i];
+      const bool is_special = c == chars.delimiter || c == '\r' || c == '\n' ||
+                              (chars.escaping && c == chars.escape_char);
+      special |= static_cast<uint64_t>(is_special) << i;
+      quotes |= static_cast<uint64_t>(chars.quoting && c == chars.quote_char) << i;
+    }
+#endif
+    out_bits[w] = mask_quoted ? MaskQuoted<Level>(special, quotes,
+                                                  PrefixXor<Level>(quotes), in_quotes)
+                              : special | quotes;
+  }
+}
+
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+void ClassifySpecialCharsAvx2(const SpecialChars& chars, bool mask_quoted,
+                              const uint8_t* data, int64_t num_words,
+                              uint64_t* out_bits, uint64_t* in_quotes);
+#endif
+
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+void ClassifySpecialCharsAvx512(const SpecialChars& chars, bool mask_quoted,
+                                const uint8_t* data, int64_t num_words,
+                                uint64_t* out_bits, uint64_t* in_quotes);
+#endif
+
+/// \brief Find the special characters of a CSV buffer
+///
+/// The buffer must start at the beginning of a line, and is classified lazily
+/// as it is scanned, by windows of a few kilobytes.
+class ARROW_EXPORT SpecialCharFinder {
+ public:
+  SpecialCharFinder(const ParseOptions& options, const char* data, const char* data_end);
+
+  /// \brief Whether the ordinary characters at the start of a buffer come in
+  /// runs long enough for skipping to the next special character to beat a
+  /// byte-by-byte scan
+  static bool HasLongRuns(const ParseOptions& options, const char* data,
+                          const char* data_end);
+
+  /// Return the first special character at or after `pos`, or the end of the
+  /// buffer.  `pos` must not be before the position of a previous call.
+  const char* Next(const char* pos) {
+    // Fast path: the special character is in the current word.  This is kept
+    // short, as the parser's position depends on it.
+    const auto offset = static_cast<uint64_t>(pos - word_start_);
+    if (ARROW_PREDICT_TRUE(offset < 64)) {
+      const uint64_t word = word_ & (~static_cast<uint64_t>(0) << offset);
+      if (ARROW_PREDICT_TRUE(word != 0)) {
+        return word_start_ + BitUtil::CountTrailingZeros(word);
+      }
+    }
+    return NextSlow(pos);
+  }
+
+  /// \brief Stop leaving out quoted delimiters and line separators from `pos` on
+  ///
+  /// This must be called when a quote character is found that neither opens
+  /// nor closes a quoted field, as it breaks the quote parity.
+  void StopMaskingQuoted(const char* pos);
+
+ protected:
+  const char* NextSlow(const char* pos);
+  void ComputeWords(int64_t word_index);
+
+  SpecialChars chars_;
+  bool mask_quoted_;
+  uint64_t in_quotes_ = 0;
+  const char* data_;
+  const char* data_end_;
+  int64_t num_words_;
+  int64_t num_computed_words_ = 0;
+  std::vector<uint64_t> bits_;
+  // The word last returned from, and where it starts
+  const char* word_start_;
+  uint64_t word_ = 0;
+};
+
+}  // namespace csv
+}  // namespace arrow
@@ -114,6 +114,9 @@ struct ARROW_EXPORT ReadOptions {
   /// Block size we request from the IO layer; also determines the size of
   /// chunks when use_threads is true
   int32_t block_size = 1 << 20;  // 1 MB
+  /// Number of blocks StreamingReader reads to infer column types, which are
+  /// then frozen for the rest of the file
+  int32_t streaming_inference_blocks = 1;
 
   /// Number of header rows to skip (not including the row of column names, if any)
   int32_t skip_rows = 0;
@@ -129,6 +132,41 @@ struct ARROW_EXPORT ReadOptions {
   static ReadOptions Defaults();
 };
 
+struct ARROW_EXPORT WriteOptions {
+  // Writer options
+
+  /// Whether to write a header row with the column names
+  bool include_header = true;
+  /// Maximum number of rows formatted at once; also determines the size of
+  /// the writes to the output stream
+  int32_t batch_size = 1 << 13;
+  /// Whether to use the global CPU thread pool to format columns in parallel
+  bool use_threads = true;
+
+  // Formatting options.  They have the same meaning as in ParseOptions, so that
+  // a file written with some options reads back with the same ParseOptions
+  // (and `newlines_in_values` if some values contain CR or LF characters).
+
+  /// Field delimiter
+  char delimiter = ',';
+  /// Whether to quote values containing special characters, and empty strings.
+  /// Null values are never quoted, so a one-column null is an empty line,
+  /// which reads back only if ParseOptions::ignore_empty_lines is false.
+  bool quoting = true;
+  /// Quoting character (if `quoting` is true)
+  char quote_char = '"';
+  /// Whether a quote inside a value is double-quoted (if `quoting` is true)
+  bool double_quote = true;
+  /// Whether to escape special characters (in quoted values, only the quote
+  /// character if `double_quote` is false, and the escape character)
+  bool escaping = false;
+  /// Escaping character (if `escaping` is true)
+  char escape_char = kDefaultEscapeChar;
+
+  /// Create write options with default values
+  static WriteOptions Defaults();
+};
+
 }  // namespace csv
 }  // namespace arrow
 
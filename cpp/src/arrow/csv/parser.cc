@@ -19,9 +19,12 @@
 
 #include <algorithm>
 #include <cstdio>
+#include <cstring>
 #include <limits>
+#include <memory>
 #include <utility>
 
+#include "arrow/csv/lexing_internal.h"
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
 #include "arrow/util/logging.h"
@@ -96,6 +99,12 @@ class BlockParser::PresizedParsedWriter {
     parsed_[parsed_size_++] = static_cast<uint8_t>(c);
   }
 
+  void PushFieldChars(const char* data, int64_t size) {
+    DCHECK_LE(parsed_size_ + size, parsed_capacity_);
+    std::memcpy(parsed_ + parsed_size_, data, size);
+    parsed_size_ += size;
+  }
+
   // Rollback the state that was saved in BeginLine()
   void RollbackLine() { parsed_size_ = saved_parsed_size_; }
 
@@ -215,7 +224,8 @@ class BlockParser::PresizedValuesWriter {
 
 template <typename SpecializedOptions, typename ValuesWriter, typename ParsedWriter>
 Status BlockParser::ParseLine(ValuesWriter* values_writer, ParsedWriter* parsed_writer,
-                              const char* data, const char* data_end, bool is_final,
+                              SpecialCharFinder* finder, const char* data,
+                              const char* data_end, bool is_final,
                               const char** out_data) {
   int32_t num_cols = 0;
   char c;
@@ -259,6 +269,12 @@ FieldStart:
 
 InField:
   // Inside a non-quoted part of a field
+  if (finder != NULLPTR) {
+    // Copy ordinary characters up to the next special one
+    const char* special = finder->Next(data);
+    parsed_writer->PushFieldChars(data, special - data);
+    data = special;
+  }
   if (ARROW_PREDICT_FALSE(data == data_end)) {
     goto AbortLine;
   }
@@ -286,11 +302,22 @@ InField:
       goto LineEnd;
     }
   }
+  if (SpecializedOptions::quoting && finder != NULLPTR &&
+      ARROW_PREDICT_FALSE(c == options_.quote_char)) {
+    // Not at the start of a field, this is an ordinary character
+    finder->StopMaskingQuoted(data - 1);
+  }
   parsed_writer->PushFieldChar(c);
   goto InField;
 
 InQuotedField:
   // Inside a quoted part of a field
+  if (finder != NULLPTR) {
+    // Copy ordinary characters up to the next special one
+    const char* special = finder->Next(data);
+    parsed_writer->PushFieldChars(data, special - data);
+    data = special;
+  }
   if (ARROW_PREDICT_FALSE(data == data_end)) {
     goto AbortLine;
   }
@@ -378,15 +405,15 @@ EmptyLine:
 
 template <typename SpecializedOptions, typename ValuesWriter, typename ParsedWriter>
 Status BlockParser::ParseChunk(ValuesWriter* values_writer, ParsedWriter* parsed_writer,
-                               const char* data, const char* data_end, bool is_final,
-                               int32_t rows_in_chunk, const char** out_data,
-                               bool* finished_parsing) {
+                               SpecialCharFinder* finder, const char* data,
+                               const char* data_end, bool is_final, int32_t rows_in_chunk,
+                               const char** out_data, bool* finished_parsing) {
   int32_t num_rows_deadline = num_rows_ + rows_in_chunk;
 
   while (data < data_end && num_rows_ < num_rows_deadline) {
     const char* line_end = data;
-    RETURN_NOT_OK(ParseLine<SpecializedOptions>(values_writer, parsed_writer, data,
-                                                data_end, is_final, &line_end));
+    RETURN_NOT_OK(ParseLine<SpecializedOptions>(values_writer, parsed_writer, finder,
+                                                data, data_end, is_final, &line_end));
     if (line_end == data) {
       // Cannot parse any further
       *finished_parsing = true;
@@ -430,6 +457,12 @@ Status BlockParser::DoParseSpecialized(const std::vector<util::string_view>& vie
     const char* data = view.data();
     const char* data_end = view.data() + view.length();
     bool finished_parsing = false;
+    // Skipping to the next special character only pays off with long fields,
+    // short ones are scanned byte by byte
+    std::unique_ptr<SpecialCharFinder> finder;
+    if (SpecialCharFinder::HasLongRuns(options_, data, data_end)) {
+      finder.reset(new SpecialCharFinder(options_, data, data_end));
+    }
 
     if (num_cols_ == -1) {
       // Can't presize values when the number of columns is not known, first parse
@@ -438,9 +471,9 @@ Status BlockParser::DoParseSpecialized(const std::vector<util::string_view>& vie
       ResizableValuesWriter values_writer(pool_);
       values_writer.Start(parsed_writer);
 
-      RETURN_NOT_OK(ParseChunk<SpecializedOptions>(&values_writer, &parsed_writer, data,
-                                                   data_end, is_final, rows_in_chunk,
-                                                   &data, &finished_parsing));
+      RETURN_NOT_OK(ParseChunk<SpecializedOptions>(
+          &values_writer, &parsed_writer, finder.get(), data, data_end, is_final,
+          rows_in_chunk, &data, &finished_parsing));
       if (num_cols_ == -1) {
         return ParseError("Empty CSV file or block: cannot infer number of columns");
       }
@@ -463,9 +496,9 @@ Status BlockParser::DoParseSpecialized(const std::vector<util::string_view>& vie
       PresizedValuesWriter values_writer(pool_, rows_in_chunk, num_cols_);
       values_writer.Start(parsed_writer);
 
-      RETURN_NOT_OK(ParseChunk<SpecializedOptions>(&values_writer, &parsed_writer, data,
-                                                   data_end, is_final, rows_in_chunk,
-                                                   &data, &finished_parsing));
+      RETURN_NOT_OK(ParseChunk<SpecializedOptions>(
+          &values_writer, &parsed_writer, finder.get(), data, data_end, is_final,
+          rows_in_chunk, &data, &finished_parsing));
     }
     DCHECK_GE(data, view.data());
     DCHECK_LE(data, data_end);
@@ -35,6 +35,8 @@ class MemoryPool;
 
 namespace csv {
 
+class SpecialCharFinder;
+
 constexpr int32_t kMaxParserNumRows = 100000;
 
 /// Skip at most num_rows from the given input.  The input pointer is updated
@@ -139,14 +141,16 @@ class ARROW_EXPORT BlockParser {
 
   template <typename SpecializedOptions, typename ValuesWriter, typename ParsedWriter>
   Status ParseChunk(ValuesWriter* values_writer, ParsedWriter* parsed_writer,
-                    const char* data, const char* data_end, bool is_final,
-                    int32_t rows_in_chunk, const char** out_data, bool* finished_parsing);
+                    SpecialCharFinder* finder, const char* data, const char* data_end,
+                    bool is_final, int32_t rows_in_chunk, const char** out_data,
+                    bool* finished_parsing);
 
-  // Parse a single line from the data pointer
+  // Parse a single line from the data pointer.  If not null, `finder` spans the
+  // data and is used to skip over runs of ordinary characters.
   template <typename SpecializedOptions, typename ValuesWriter, typename ParsedWriter>
   Status ParseLine(ValuesWriter* values_writer, ParsedWriter* parsed_writer,
-                   const char* data, const char* data_end, bool is_final,
-                   const char** out_data);
+                   SpecialCharFinder* finder, const char* data, const char* data_end,
+                   bool is_final, const char** out_data);
 
   MemoryPool* pool_;
   const ParseOptions options_;
@@ -34,6 +34,10 @@ namespace csv {
 // >> For a static/global string constant, use a C style string instead
 const char* one_row = "abc,\"d,f\",12.34,\n";
 const char* one_row_escaped = "abc,d\\,f,12.34,\n";
+const char* one_row_unquoted = "abc,d f,12.34,\n";
+const char* one_row_long =
+    "abc,\"The quick brown fox, jumps over the lazy dog\",12.34,"
+    "Lorem ipsum dolor sit amet consectetur adipiscing elit\n";
 
 const auto num_rows = static_cast<int32_t>((1024 * 64) / strlen(one_row));
 
@@ -139,11 +143,34 @@ static void ParseCSVEscapedBlock(benchmark::State& state) {  // NOLINT non-const
   BenchmarkCSVParsing(state, csv, num_rows, options);
 }
 
+static void ParseCSVUnquotedBlock(
+    benchmark::State& state) {  // NOLINT non-const reference
+  auto csv = BuildCSVData(one_row_unquoted, num_rows);
+  auto options = ParseOptions::Defaults();
+  options.quoting = false;
+  options.escaping = false;
+
+  BenchmarkCSVParsing(state, csv, num_rows, options);
+}
+
+static void ParseCSVLongFieldsBlock(
+    benchmark::State& state) {  // NOLINT non-const reference
+  const auto long_num_rows = static_cast<int32_t>((1024 * 64) / strlen(one_row_long));
+  auto csv = BuildCSVData(one_row_long, long_num_rows);
+  auto options = ParseOptions::Defaults();
+  options.quoting = true;
+  options.escaping = false;
+
+  BenchmarkCSVParsing(state, csv, long_num_rows, options);
+}
+
 BENCHMARK(ChunkCSVQuotedBlock);
 BENCHMARK(ChunkCSVEscapedBlock);
 BENCHMARK(ChunkCSVNoNewlinesBlock);
 BENCHMARK(ParseCSVQuotedBlock);
 BENCHMARK(ParseCSVEscapedBlock);
+BENCHMARK(ParseCSVUnquotedBlock);
+BENCHMARK(ParseCSVLongFieldsBlock);
 
 }  // namespace csv
 }  // namespace arrow
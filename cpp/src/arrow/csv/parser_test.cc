@@ -15,6 +15,7 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
 #include <cstdint>
 #include <string>
 #include <utility>
@@ -623,5 +624,98 @@ TEST(BlockParser, QuotedEscape) {
   }
 }
 
+TEST(BlockParser, LongFields) {
+  // Fields spanning several 64-byte words of special character bitmaps
+  const std::string a(100, 'a');
+  const std::string b(70, 'b');
+  const std::string c(130, 'c');
+  {
+    BlockParser parser(ParseOptions::Defaults());
+    auto csv = MakeCSVData({a + "," + b + "\n", c + ",\"" + b + "\"\n"});
+    AssertParseOk(parser, csv);
+    AssertColumnsEq(parser, {{a, c}, {b, b}}, {{false, false}, {false, true}});
+  }
+  {
+    // Quoted delimiters and newlines
+    const std::string quoted = b + ",\n" + a + "\r\n\"\"" + c;
+    BlockParser parser(ParseOptions::Defaults());
+    auto csv = MakeCSVData(
+        {a + ",\"" + b + ",\n" + a + "\r\n\"\"\"\"" + c + "\"\n", "\"\"," + b + "\n"});
+    AssertParseOk(parser, csv);
+    AssertColumnsEq(parser, {{a, ""}, {quoted, b}}, {{false, true}, {true, false}});
+  }
+  {
+    // Several views
+    BlockParser parser(ParseOptions::Defaults());
+    const std::string first = a + "," + c + "\n";
+    const std::string second = "\"" + b + "\"," + a + "\n";
+    AssertParseOk(parser, {util::string_view(first), util::string_view(second)});
+    AssertColumnsEq(parser, {{a, b}, {c, a}});
+  }
+}
+
+TEST(BlockParser, LongFieldsStrayQuotes) {
+  // A quote in the middle of an unquoted field doesn't open a quoted region
+  const std::string a(100, 'a');
+  const std::string b(70, 'b');
+  {
+    BlockParser parser(ParseOptions::Defaults());
+    auto csv = MakeCSVData({a + "\"" + b + ",\"" + b + "," + a + "\"\n",
+                            b + ",\"" + a + "\n" + b + "\"\n"});
+    AssertParseOk(parser, csv);
+    AssertColumnsEq(parser, {{a + "\"" + b, b}, {b + "," + a, a + "\n" + b}},
+                    {{false, false}, {true, true}});
+  }
+  {
+    // Without double quoting, a quote after a quoted region is a stray quote
+    auto options = ParseOptions::Defaults();
+    options.double_quote = false;
+    BlockParser parser(options);
+    auto csv =
+        MakeCSVData({"\"" + a + "\"\"," + b + "\n", b + ",\"" + a + "," + b + "\"\n"});
+    AssertParseOk(parser, csv);
+    AssertColumnsEq(parser, {{a + "\"", b}, {b, a + "," + b}});
+  }
+  {
+    // With escaping
+    auto options = ParseOptions::Defaults();
+    options.escaping = true;
+    BlockParser parser(options);
+    auto csv = MakeCSVData({"\"" + a + "\\\"" + b + "\"," + b + "\\," + a + "\n"});
+    AssertParseOk(parser, csv);
+    AssertColumnsEq(parser, {{a + "\"" + b}, {b + "," + a}});
+  }
+}
+
+TEST(BlockParser, MixedFieldLengths) {
+  // Whether the parser skips to special characters is decided from the start
+  // of each block, which may not be representative of the rest
+  const std::string a(100, 'a');
+  std::vector<std::string> short_rows(40, "1,\"x,y\"\n");
+  std::vector<std::string> long_rows(5, a + ",\"" + a + "\"\n");
+  std::vector<std::string> expected_first(short_rows.size(), "1");
+  std::vector<std::string> expected_second(short_rows.size(), "x,y");
+  expected_first.resize(short_rows.size() + long_rows.size(), a);
+  expected_second.resize(short_rows.size() + long_rows.size(), a);
+  {
+    std::vector<std::string> lines(short_rows);
+    lines.insert(lines.end(), long_rows.begin(), long_rows.end());
+    BlockParser parser(ParseOptions::Defaults());
+    AssertParseOk(parser, MakeCSVData(lines));
+    AssertColumnsEq(parser, {expected_first, expected_second});
+  }
+  {
+    std::vector<std::string> lines(long_rows);
+    lines.insert(lines.end(), short_rows.begin(), short_rows.end());
+    std::rotate(expected_first.begin(), expected_first.begin() + short_rows.size(),
+                expected_first.end());
+    std::rotate(expected_second.begin(), expected_second.begin() + short_rows.size(),
+                expected_second.end());
+    BlockParser parser(ParseOptions::Defaults());
+    AssertParseOk(parser, MakeCSVData(lines));
+    AssertColumnsEq(parser, {expected_first, expected_second});
+  }
+}
+
 }  // namespace csv
 }  // namespace arrow
@@ -17,8 +17,11 @@
 
 #include "arrow/csv/reader.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
+#include <deque>
+#include <future>
 #include <limits>
 #include <memory>
 #include <sstream>
@@ -30,13 +33,16 @@
 #include "arrow/buffer.h"
 #include "arrow/csv/chunker.h"
 #include "arrow/csv/column_builder.h"
+#include "arrow/csv/converter.h"
 #include "arrow/csv/options.h"
 #include "arrow/csv/parser.h"
 #include "arrow/io/interfaces.h"
+#include "arrow/record_batch.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
 #include "arrow/table.h"
 #include "arrow/type.h"
+#include "arrow/util/checked_cast.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
@@ -56,26 +62,43 @@ class InputStream;
 
 namespace csv {
 
+using internal::checked_cast;
 using internal::GetCpuThreadPool;
 using internal::ThreadPool;
 
 /////////////////////////////////////////////////////////////////////////
 // Base class for common functionality
 
-class BaseTableReader : public csv::TableReader {
+class ReaderMixin {
  public:
-  BaseTableReader(MemoryPool* pool, std::shared_ptr<io::InputStream> input,
-                  const ReadOptions& read_options, const ParseOptions& parse_options,
-                  const ConvertOptions& convert_options)
+  ReaderMixin(MemoryPool* pool, std::shared_ptr<io::InputStream> input,
+              const ReadOptions& read_options, const ParseOptions& parse_options,
+              const ConvertOptions& convert_options)
       : pool_(pool),
         read_options_(read_options),
         parse_options_(parse_options),
         convert_options_(convert_options),
         input_(std::move(input)) {}
 
-  virtual Status Init() = 0;
-
  protected:
+  // A block of CSV data ready for parsing.  `partial` + `completion` is the row
+  // straddling the previous block and this one, `whole` holds the complete rows
+  // following it.
+  struct CSVBlock {
+    std::shared_ptr<Buffer> partial;
+    std::shared_ptr<Buffer> completion;
+    std::shared_ptr<Buffer> whole;
+    int64_t block_index;
+    bool is_final;
+  };
+
+  Status MakeBlockIterator(int32_t block_queue_size) {
+    ARROW_ASSIGN_OR_RAISE(block_iterator_,
+                          io::MakeInputStreamIterator(input_, read_options_.block_size));
+    return MakeReadaheadIterator(std::move(block_iterator_), block_queue_size)
+        .Value(&block_iterator_);
+  }
+
   Status ReadNextBlock(bool first_block, std::shared_ptr<Buffer>* out) {
     ARROW_ASSIGN_OR_RAISE(auto buf, block_iterator_.Next());
     if (buf == nullptr) {
@@ -183,6 +206,7 @@ class BaseTableReader : public csv::TableReader {
       ARROW_ASSIGN_OR_RAISE(auto builder, MakeCSVColumnBuilder(col_name, col_index));
       column_builders_.push_back(builder);
       builder_names_.push_back(col_name);
+      builder_col_indices_.push_back(col_index);
     }
     return Status::OK();
   }
@@ -199,9 +223,10 @@ class BaseTableReader : public csv::TableReader {
     // For each column name in include_columns, build the corresponding ColumnBuilder
     for (const auto& col_name : include_columns) {
       std::shared_ptr<ColumnBuilder> builder;
+      int32_t col_index = -1;
       auto it = col_indices.find(col_name);
       if (it != col_indices.end()) {
-        auto col_index = it->second;
+        col_index = it->second;
         ARROW_ASSIGN_OR_RAISE(builder, MakeCSVColumnBuilder(col_name, col_index));
       } else {
         // Column not in the CSV file
@@ -215,6 +240,7 @@ class BaseTableReader : public csv::TableReader {
       }
       column_builders_.push_back(builder);
       builder_names_.push_back(col_name);
+      builder_col_indices_.push_back(col_index);
     }
     return Status::OK();
   }
@@ -257,10 +283,49 @@ class BaseTableReader : public csv::TableReader {
     return res;
   }
 
-  Status ParseAndInsert(const std::shared_ptr<Buffer>& partial,
-                        const std::shared_ptr<Buffer>& completion,
-                        const std::shared_ptr<Buffer>& block, int64_t block_index,
-                        bool is_final, uint32_t* out_parsed_size = nullptr) {
+  // Start cutting CSV blocks, the first one beginning with `block`
+  void StartBlocks(std::shared_ptr<Buffer> block) {
+    chunker_ = MakeChunker(parse_options_);
+    partial_ = std::make_shared<Buffer>("");
+    block_ = std::move(block);
+    next_block_index_ = 0;
+  }
+
+  // Cut the next block of CSV rows.  Returns false at end of input.
+  Result<bool> NextCSVBlock(CSVBlock* out) {
+    if (!block_) {
+      return false;
+    }
+    std::shared_ptr<Buffer> next_block, whole, completion, next_partial;
+
+    ARROW_ASSIGN_OR_RAISE(next_block, block_iterator_.Next());
+    bool is_final = (next_block == nullptr);
+
+    if (is_final) {
+      // End of file reached => compute completion from penultimate block
+      RETURN_NOT_OK(chunker_->ProcessFinal(partial_, block_, &completion, &whole));
+    } else {
+      std::shared_ptr<Buffer> starts_with_whole;
+      // Get completion of partial from previous block.
+      RETURN_NOT_OK(chunker_->ProcessWithPartial(partial_, block_, &completion,
+                                                 &starts_with_whole));
+
+      // Get a complete CSV block inside `partial + block`, and keep
+      // the rest for the next iteration.
+      RETURN_NOT_OK(chunker_->Process(starts_with_whole, &whole, &next_partial));
+    }
+
+    *out = CSVBlock{partial_, completion, whole, next_block_index_++, is_final};
+    partial_ = std::move(next_partial);
+    block_ = std::move(next_block);
+    return true;
+  }
+
+  Result<std::shared_ptr<BlockParser>> Parse(const std::shared_ptr<Buffer>& partial,
+                                             const std::shared_ptr<Buffer>& completion,
+                                             const std::shared_ptr<Buffer>& block,
+                                             bool is_final,
+                                             uint32_t* out_parsed_size = nullptr) {
     static constexpr int32_t max_num_rows = std::numeric_limits<int32_t>::max();
     auto parser =
         std::make_shared<BlockParser>(pool_, parse_options_, num_csv_cols_, max_num_rows);
@@ -288,6 +353,15 @@ class BaseTableReader : public csv::TableReader {
     if (out_parsed_size) {
       *out_parsed_size = parsed_size;
     }
+    return parser;
+  }
+
+  Status ParseAndInsert(const std::shared_ptr<Buffer>& partial,
+                        const std::shared_ptr<Buffer>& completion,
+                        const std::shared_ptr<Buffer>& block, int64_t block_index,
+                        bool is_final, uint32_t* out_parsed_size = nullptr) {
+    ARROW_ASSIGN_OR_RAISE(auto parser,
+                          Parse(partial, completion, block, is_final, out_parsed_size));
     return ProcessData(parser, block_index);
   }
 
@@ -326,6 +400,9 @@ class BaseTableReader : public csv::TableReader {
   std::vector<std::shared_ptr<ColumnBuilder>> column_builders_;
   // Names of columns, in same order as column_builders_
   std::vector<std::string> builder_names_;
+  // Indices of columns in the CSV file (-1 if missing), in same order as
+  // column_builders_
+  std::vector<int32_t> builder_col_indices_;
 
   std::shared_ptr<io::InputStream> input_;
   Iterator<std::shared_ptr<Buffer>> block_iterator_;
@@ -333,6 +410,19 @@ class BaseTableReader : public csv::TableReader {
 
   // Whether there was a trailing CR at the end of last parsed line
   bool trailing_cr_ = false;
+
+  // State for NextCSVBlock()
+  std::unique_ptr<Chunker> chunker_;
+  std::shared_ptr<Buffer> partial_;
+  std::shared_ptr<Buffer> block_;
+  int64_t next_block_index_ = 0;
+};
+
+class BaseTableReader : public ReaderMixin, public csv::TableReader {
+ public:
+  using ReaderMixin::ReaderMixin;
+
+  virtual Status Init() = 0;
 };
 
 /////////////////////////////////////////////////////////////////////////
@@ -343,13 +433,8 @@ class SerialTableReader : public BaseTableReader {
   using BaseTableReader::BaseTableReader;
 
   Status Init() override {
-    ARROW_ASSIGN_OR_RAISE(block_iterator_,
-                          io::MakeInputStreamIterator(input_, read_options_.block_size));
-
     // Since we're converting serially, no need to readahead more than one block
-    int32_t block_queue_size = 1;
-    return MakeReadaheadIterator(std::move(block_iterator_), block_queue_size)
-        .Value(&block_iterator_);
+    return MakeBlockIterator(/*block_queue_size=*/1);
   }
 
   Result<std::shared_ptr<Table>> Read() override {
@@ -421,14 +506,7 @@ class ThreadedTableReader : public BaseTableReader {
     }
   }
 
-  Status Init() override {
-    ARROW_ASSIGN_OR_RAISE(block_iterator_,
-                          io::MakeInputStreamIterator(input_, read_options_.block_size));
-
-    int32_t block_queue_size = thread_pool_->GetCapacity();
-    return MakeReadaheadIterator(std::move(block_iterator_), block_queue_size)
-        .Value(&block_iterator_);
-  }
+  Status Init() override { return MakeBlockIterator(thread_pool_->GetCapacity()); }
 
   Result<std::shared_ptr<Table>> Read() override {
     task_group_ = internal::TaskGroup::MakeThreaded(thread_pool_);
@@ -440,49 +518,209 @@ class ThreadedTableReader : public BaseTableReader {
       return Status::Invalid("Empty CSV file");
     }
     RETURN_NOT_OK(ProcessHeader(block, &block));
+    StartBlocks(std::move(block));
 
-    auto chunker = MakeChunker(parse_options_);
-    auto empty = std::make_shared<Buffer>("");
-    auto partial = empty;
-    int64_t block_index = 0;
+    CSVBlock csv_block;
+    while (true) {
+      ARROW_ASSIGN_OR_RAISE(bool have_block, NextCSVBlock(&csv_block));
+      if (!have_block) {
+        break;
+      }
+      // Launch parse task
+      task_group_->Append([this, csv_block] {
+        return ParseAndInsert(csv_block.partial, csv_block.completion, csv_block.whole,
+                              csv_block.block_index, csv_block.is_final);
+      });
+    }
 
-    while (block) {
-      std::shared_ptr<Buffer> next_block, whole, completion, next_partial;
+    // Finish conversion, create schema and table
+    RETURN_NOT_OK(task_group_->Finish());
+    return MakeTable();
+  }
 
-      ARROW_ASSIGN_OR_RAISE(next_block, block_iterator_.Next());
-      bool is_final = (next_block == nullptr);
+ protected:
+  ThreadPool* thread_pool_;
+};
 
-      if (is_final) {
-        // End of file reached => compute completion from penultimate block
-        RETURN_NOT_OK(chunker->ProcessFinal(partial, block, &completion, &whole));
-      } else {
-        std::shared_ptr<Buffer> starts_with_whole;
-        // Get completion of partial from previous block.
-        RETURN_NOT_OK(
-            chunker->ProcessWithPartial(partial, block, &completion, &starts_with_whole));
+/////////////////////////////////////////////////////////////////////////
+// StreamingReader implementation
 
-        // Get a complete CSV block inside `partial + block`, and keep
-        // the rest for the next iteration.
-        RETURN_NOT_OK(chunker->Process(starts_with_whole, &whole, &next_partial));
-      }
+class StreamingReaderImpl : public ReaderMixin, public csv::StreamingReader {
+ public:
+  // `thread_pool` is null for serial reading
+  StreamingReaderImpl(MemoryPool* pool, std::shared_ptr<io::InputStream> input,
+                      const ReadOptions& read_options, const ParseOptions& parse_options,
+                      const ConvertOptions& convert_options, ThreadPool* thread_pool)
+      : ReaderMixin(pool, input, read_options, parse_options, convert_options),
+        thread_pool_(thread_pool) {}
 
-      // Launch parse task
-      task_group_->Append([this, partial, completion, whole, block_index, is_final] {
-        return ParseAndInsert(partial, completion, whole, block_index, is_final);
-      });
-      block_index++;
+  ~StreamingReaderImpl() override {
+    // Tasks refer to this reader, make sure they are finished before destroying it
+    if (task_group_) {
+      ARROW_UNUSED(task_group_->Finish());
+    }
+    for (auto& future : pending_batches_) {
+      future.wait();
+    }
+  }
 
-      partial = next_partial;
-      block = next_block;
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  // Read the header and the blocks used for type inference
+  Status Init() {
+    if (thread_pool_) {
+      max_blocks_in_flight_ = thread_pool_->GetCapacity();
+      task_group_ = internal::TaskGroup::MakeThreaded(thread_pool_);
+    } else {
+      max_blocks_in_flight_ = 1;
+      task_group_ = internal::TaskGroup::MakeSerial();
     }
+    RETURN_NOT_OK(MakeBlockIterator(max_blocks_in_flight_));
 
-    // Finish conversion, create schema and table
+    std::shared_ptr<Buffer> block;
+    RETURN_NOT_OK(ReadFirstBlock(&block));
+    if (!block) {
+      return Status::Invalid("Empty CSV file");
+    }
+    RETURN_NOT_OK(ProcessHeader(block, &block));
+    StartBlocks(std::move(block));
+
+    // Convert the first blocks with type-inferring column builders, as TableReader
+    CSVBlock csv_block;
+    int64_t num_blocks = 0;
+    while (num_blocks < std::max(read_options_.streaming_inference_blocks, 1)) {
+      ARROW_ASSIGN_OR_RAISE(bool have_block, NextCSVBlock(&csv_block));
+      if (!have_block) {
+        break;
+      }
+      task_group_->Append([this, csv_block] {
+        return ParseAndInsert(csv_block.partial, csv_block.completion, csv_block.whole,
+                              csv_block.block_index, csv_block.is_final);
+      });
+      ++num_blocks;
+    }
     RETURN_NOT_OK(task_group_->Finish());
-    return MakeTable();
+    task_group_.reset();
+
+    ARROW_ASSIGN_OR_RAISE(auto table, MakeTable());
+    schema_ = table->schema();
+    for (int64_t i = 0; i < num_blocks; ++i) {
+      std::vector<std::shared_ptr<Array>> columns;
+      for (const auto& column : table->columns()) {
+        columns.push_back(column->chunk(static_cast<int>(i)));
+      }
+      const int64_t num_rows = columns.empty() ? 0 : columns[0]->length();
+      if (num_rows > 0) {
+        inferred_batches_.push_back(RecordBatch::Make(schema_, num_rows, columns));
+      }
+    }
+    // Release the chunks held by the column builders
+    column_builders_.clear();
+
+    return MakeConverters();
+  }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* batch) override {
+    if (!inferred_batches_.empty()) {
+      *batch = std::move(inferred_batches_.front());
+      inferred_batches_.pop_front();
+      return Status::OK();
+    }
+    while (true) {
+      std::shared_ptr<RecordBatch> next;
+      if (thread_pool_) {
+        RETURN_NOT_OK(ScheduleBlocks());
+        if (pending_batches_.empty()) {
+          batch->reset();
+          return Status::OK();
+        }
+        auto future = std::move(pending_batches_.front());
+        pending_batches_.pop_front();
+        ARROW_ASSIGN_OR_RAISE(next, future.get());
+      } else {
+        CSVBlock csv_block;
+        ARROW_ASSIGN_OR_RAISE(bool have_block, NextCSVBlock(&csv_block));
+        if (!have_block) {
+          batch->reset();
+          return Status::OK();
+        }
+        ARROW_ASSIGN_OR_RAISE(next, ParseAndConvert(csv_block));
+      }
+      // Blocks without a row end yield no rows
+      if (next->num_rows() > 0) {
+        *batch = std::move(next);
+        return Status::OK();
+      }
+    }
   }
 
  protected:
+  // Make converters for the types frozen after inference
+  Status MakeConverters() {
+    for (int i = 0; i < schema_->num_fields(); ++i) {
+      const auto& type = schema_->field(i)->type();
+      std::shared_ptr<Converter> converter;
+      if (builder_col_indices_[i] < 0) {
+        // Column of nulls, not in the CSV file
+      } else if (type->id() == Type::DICTIONARY) {
+        // The cardinality limit only matters while inferring
+        const auto& value_type = checked_cast<const DictionaryType&>(*type).value_type();
+        ARROW_ASSIGN_OR_RAISE(
+            converter, DictionaryConverter::Make(value_type, convert_options_, pool_));
+      } else {
+        ARROW_ASSIGN_OR_RAISE(converter, Converter::Make(type, convert_options_, pool_));
+      }
+      converters_.push_back(std::move(converter));
+    }
+    return Status::OK();
+  }
+
+  // Keep up to max_blocks_in_flight_ blocks parsing and converting
+  Status ScheduleBlocks() {
+    while (!eof_ && static_cast<int>(pending_batches_.size()) < max_blocks_in_flight_) {
+      CSVBlock csv_block;
+      ARROW_ASSIGN_OR_RAISE(bool have_block, NextCSVBlock(&csv_block));
+      if (!have_block) {
+        eof_ = true;
+        break;
+      }
+      ARROW_ASSIGN_OR_RAISE(auto future, thread_pool_->Submit([this, csv_block] {
+        return ParseAndConvert(csv_block);
+      }));
+      pending_batches_.push_back(std::move(future));
+    }
+    return Status::OK();
+  }
+
+  Result<std::shared_ptr<RecordBatch>> ParseAndConvert(const CSVBlock& csv_block) {
+    ARROW_ASSIGN_OR_RAISE(auto parser, Parse(csv_block.partial, csv_block.completion,
+                                             csv_block.whole, csv_block.is_final));
+    const int32_t num_rows = parser->num_rows();
+    std::vector<std::shared_ptr<Array>> columns(converters_.size());
+    for (size_t i = 0; i < converters_.size(); ++i) {
+      if (converters_[i]) {
+        ARROW_ASSIGN_OR_RAISE(columns[i],
+                              converters_[i]->Convert(*parser, builder_col_indices_[i]));
+      } else {
+        RETURN_NOT_OK(
+            MakeArrayOfNull(pool_, schema_->field(static_cast<int>(i))->type(), num_rows,
+                            &columns[i]));
+      }
+    }
+    return RecordBatch::Make(schema_, num_rows, std::move(columns));
+  }
+
   ThreadPool* thread_pool_;
+  int32_t max_blocks_in_flight_ = 1;
+  bool eof_ = false;
+
+  std::shared_ptr<Schema> schema_;
+  // Converters for each column of schema_, null for columns not in the CSV file
+  std::vector<std::shared_ptr<Converter>> converters_;
+  // Batches converted during type inference
+  std::deque<std::shared_ptr<RecordBatch>> inferred_batches_;
+  // Batches being converted on the thread pool, in block order
+  std::deque<std::future<Result<std::shared_ptr<RecordBatch>>>> pending_batches_;
 };
 
 /////////////////////////////////////////////////////////////////////////
@@ -504,6 +742,20 @@ Result<std::shared_ptr<TableReader>> TableReader::Make(
   return reader;
 }
 
+/////////////////////////////////////////////////////////////////////////
+// StreamingReader factory function
+
+Result<std::shared_ptr<StreamingReader>> StreamingReader::Make(
+    MemoryPool* pool, std::shared_ptr<io::InputStream> input,
+    const ReadOptions& read_options, const ParseOptions& parse_options,
+    const ConvertOptions& convert_options) {
+  ThreadPool* thread_pool = read_options.use_threads ? GetCpuThreadPool() : nullptr;
+  auto reader = std::make_shared<StreamingReaderImpl>(
+      pool, input, read_options, parse_options, convert_options, thread_pool);
+  RETURN_NOT_OK(reader->Init());
+  return reader;
+}
+
 /////////////////////////////////////////////////////////////////////////
 // Deprecated API(s)
 
@@ -20,6 +20,7 @@
 #include <memory>
 
 #include "arrow/csv/options.h"  // IWYU pragma: keep
+#include "arrow/record_batch.h"
 #include "arrow/result.h"
 #include "arrow/type_fwd.h"
 #include "arrow/util/visibility.h"
@@ -55,5 +56,29 @@ class ARROW_EXPORT TableReader {
                      std::shared_ptr<TableReader>* out);
 };
 
+/// \brief A class that reads a CSV file incrementally, as record batches
+///
+/// Each batch holds the rows of one block of input (see ReadOptions::block_size),
+/// so that memory use does not grow with the file size.  Column types are
+/// inferred from the first ReadOptions::streaming_inference_blocks blocks and
+/// then frozen: a value in a later block that does not convert to the inferred
+/// type makes ReadNext() fail.  Pass ConvertOptions::column_types to avoid this.
+///
+/// If ReadOptions::use_threads is true, blocks are parsed and converted in
+/// parallel on the CPU thread pool, with at most as many blocks in flight as
+/// the pool has threads.
+class ARROW_EXPORT StreamingReader : public RecordBatchReader {
+ public:
+  virtual ~StreamingReader() = default;
+
+  /// Create a StreamingReader instance
+  ///
+  /// This reads the header and the blocks used for type inference, so that
+  /// schema() is available.
+  static Result<std::shared_ptr<StreamingReader>> Make(
+      MemoryPool* pool, std::shared_ptr<io::InputStream> input, const ReadOptions&,
+      const ParseOptions&, const ConvertOptions&);
+};
+
 }  // namespace csv
 }  // namespace arrow
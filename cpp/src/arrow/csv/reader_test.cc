@@ -0,0 +1,161 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/buffer.h"
+#include "arrow/csv/options.h"
+#include "arrow/csv/reader.h"
+#include "arrow/io/memory.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/type.h"
+
+namespace arrow {
+namespace csv {
+
+// A CSV file with an integer and a string column, and `num_rows` rows
+static std::string MakeIntStringCSV(int64_t num_rows) {
+  std::string csv = "i,s\n";
+  for (int64_t i = 0; i < num_rows; ++i) {
+    csv += std::to_string(i) + ",str" + std::to_string(i % 7) + "\n";
+  }
+  return csv;
+}
+
+static std::shared_ptr<io::InputStream> MakeInput(std::string csv) {
+  return std::make_shared<io::BufferReader>(Buffer::FromString(std::move(csv)));
+}
+
+class TestStreamingReader : public ::testing::TestWithParam<bool> {
+ public:
+  void SetUp() override {
+    read_options_ = ReadOptions::Defaults();
+    read_options_.use_threads = GetParam();
+    read_options_.block_size = 1000;
+    parse_options_ = ParseOptions::Defaults();
+    convert_options_ = ConvertOptions::Defaults();
+  }
+
+  Result<std::shared_ptr<StreamingReader>> MakeReader(const std::string& csv) {
+    return StreamingReader::Make(default_memory_pool(), MakeInput(csv), read_options_,
+                                 parse_options_, convert_options_);
+  }
+
+  Result<std::shared_ptr<Table>> ReadTable(const std::string& csv) {
+    ARROW_ASSIGN_OR_RAISE(
+        auto reader, TableReader::Make(default_memory_pool(), MakeInput(csv),
+                                       read_options_, parse_options_, convert_options_));
+    return reader->Read();
+  }
+
+ protected:
+  ReadOptions read_options_;
+  ParseOptions parse_options_;
+  ConvertOptions convert_options_;
+};
+
+TEST_P(TestStreamingReader, Basics) {
+  const auto csv = MakeIntStringCSV(2000);
+  ASSERT_OK_AND_ASSIGN(auto reader, MakeReader(csv));
+  AssertSchemaEqual(*schema({field("i", int64()), field("s", utf8())}),
+                    *reader->schema());
+
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  ASSERT_OK(reader->ReadAll(&batches));
+  // One batch per block
+  ASSERT_GT(batches.size(), 10);
+  for (const auto& batch : batches) {
+    ASSERT_OK(batch->ValidateFull());
+    ASSERT_GT(batch->num_rows(), 0);
+  }
+  // End of stream is sticky
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(reader->ReadNext(&batch));
+  ASSERT_EQ(batch, nullptr);
+
+  ASSERT_OK_AND_ASSIGN(auto expected, ReadTable(csv));
+  std::shared_ptr<Table> actual;
+  ASSERT_OK(Table::FromRecordBatches(batches, &actual));
+  AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+}
+
+TEST_P(TestStreamingReader, HeaderOnly) {
+  ASSERT_OK_AND_ASSIGN(auto reader, MakeReader("a,b\n"));
+  ASSERT_EQ(reader->schema()->num_fields(), 2);
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(reader->ReadNext(&batch));
+  ASSERT_EQ(batch, nullptr);
+
+  ASSERT_RAISES(Invalid, MakeReader(""));
+}
+
+TEST_P(TestStreamingReader, FrozenInference) {
+  // The first blocks only have integers, the last one has a string
+  auto csv = MakeIntStringCSV(1000) + "xyz,str\n";
+
+  ASSERT_OK_AND_ASSIGN(auto reader, MakeReader(csv));
+  ASSERT_EQ(reader->schema()->field(0)->type()->id(), Type::INT64);
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  ASSERT_RAISES(Invalid, reader->ReadAll(&batches));
+
+  // Inferring over all blocks loosens the type
+  read_options_.streaming_inference_blocks = 1000;
+  ASSERT_OK_AND_ASSIGN(reader, MakeReader(csv));
+  ASSERT_EQ(reader->schema()->field(0)->type()->id(), Type::STRING);
+  ASSERT_OK(reader->ReadAll(&batches));
+
+  // Explicit column types are never inferred
+  read_options_.streaming_inference_blocks = 1;
+  convert_options_.column_types["i"] = utf8();
+  ASSERT_OK_AND_ASSIGN(reader, MakeReader(csv));
+  ASSERT_OK(reader->ReadAll(&batches));
+}
+
+TEST_P(TestStreamingReader, IncludeColumns) {
+  convert_options_.include_columns = {"s", "missing"};
+  convert_options_.include_missing_columns = true;
+  convert_options_.column_types["missing"] = int32();
+  convert_options_.auto_dict_encode = true;
+  const auto csv = MakeIntStringCSV(500);
+
+  ASSERT_OK_AND_ASSIGN(auto reader, MakeReader(csv));
+  AssertSchemaEqual(*schema({field("s", dictionary(int32(), utf8())),
+                             field("missing", int32())}),
+                    *reader->schema());
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  ASSERT_OK(reader->ReadAll(&batches));
+  int64_t num_rows = 0;
+  for (const auto& batch : batches) {
+    ASSERT_OK(batch->ValidateFull());
+    ASSERT_EQ(batch->column(1)->null_count(), batch->num_rows());
+    num_rows += batch->num_rows();
+  }
+  ASSERT_EQ(num_rows, 500);
+}
+
+INSTANTIATE_TEST_CASE_P(SerialAndThreaded, TestStreamingReader, ::testing::Bool());
+
+}  // namespace csv
+}  // namespace arrow
@@ -0,0 +1,490 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/csv/writer.h"
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer_builder.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/record_batch.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/formatting.h"
+#include "arrow/util/string_view.h"
+#include "arrow/util/task_group.h"
+#include "arrow/util/thread_pool.h"
+#include "arrow/visitor_inline.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+using internal::StringFormatter;
+
+namespace csv {
+
+namespace {
+
+// ----------------------------------------------------------------------
+// Quoting and escaping of string values
+
+class ValueWriter {
+ public:
+  explicit ValueWriter(const WriteOptions& options) : options_(options) {
+    std::memset(special_, 0, sizeof(special_));
+    MarkSpecial(options.delimiter);
+    MarkSpecial('\r');
+    MarkSpecial('\n');
+    if (options.quoting) {
+      MarkSpecial(options.quote_char);
+    }
+    if (options.escaping) {
+      MarkSpecial(options.escape_char);
+    }
+  }
+
+  Status Write(util::string_view value, BufferBuilder* out) const {
+    if (value.empty()) {
+      // Quoted values are never null, so that empty strings survive a roundtrip
+      return options_.quoting ? AppendChars(options_.quote_char, options_.quote_char, out)
+                              : Status::OK();
+    }
+    if (ARROW_PREDICT_TRUE(!HasSpecialChars(value))) {
+      return out->Append(value.data(), static_cast<int64_t>(value.size()));
+    }
+    if (options_.quoting) {
+      return WriteQuoted(value, out);
+    }
+    if (options_.escaping) {
+      return WriteEscaped(value, out);
+    }
+    return Status::Invalid("CSV value '", value,
+                           "' has special characters but neither quoting "
+                           "nor escaping is enabled");
+  }
+
+ protected:
+  void MarkSpecial(char c) { special_[static_cast<uint8_t>(c)] = true; }
+
+  bool HasSpecialChars(util::string_view value) const {
+    for (const char c : value) {
+      if (special_[static_cast<uint8_t>(c)]) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  static Status AppendChars(char first, char second, BufferBuilder* out) {
+    const char chars[2] = {first, second};
+    return out->Append(chars, 2);
+  }
+
+  Status WriteQuoted(util::string_view value, BufferBuilder* out) const {
+    // At worst, each character is doubled or escaped
+    RETURN_NOT_OK(out->Reserve(2 * static_cast<int64_t>(value.size()) + 2));
+    out->UnsafeAppend(&options_.quote_char, 1);
+    for (const char c : value) {
+      if (c == options_.quote_char) {
+        if (options_.double_quote) {
+          out->UnsafeAppend(&options_.quote_char, 1);
+        } else if (options_.escaping) {
+          out->UnsafeAppend(&options_.escape_char, 1);
+        } else {
+          return Status::Invalid("CSV value '", value,
+                                 "' has a quote character but neither double "
+                                 "quoting nor escaping is enabled");
+        }
+      } else if (options_.escaping && c == options_.escape_char) {
+        out->UnsafeAppend(&options_.escape_char, 1);
+      }
+      out->UnsafeAppend(&c, 1);
+    }
+    out->UnsafeAppend(&options_.quote_char, 1);
+    return Status::OK();
+  }
+
+  Status WriteEscaped(util::string_view value, BufferBuilder* out) const {
+    RETURN_NOT_OK(out->Reserve(2 * static_cast<int64_t>(value.size())));
+    for (const char c : value) {
+      if (special_[static_cast<uint8_t>(c)]) {
+        out->UnsafeAppend(&options_.escape_char, 1);
+      }
+      out->UnsafeAppend(&c, 1);
+    }
+    return Status::OK();
+  }
+
+  const WriteOptions options_;
+  bool special_[256];
+};
+
+// ----------------------------------------------------------------------
+// Per-column formatting
+
+// Formats the values of an array into a contiguous buffer, which is reused
+// from one array to the next
+class ColumnFormatter {
+ public:
+  explicit ColumnFormatter(MemoryPool* pool) : data_builder_(pool) {}
+  virtual ~ColumnFormatter() = default;
+
+  /// Format the values of `array`, replacing the previous ones
+  Status Format(const Array& array) {
+    data_builder_.Rewind(0);
+    value_ends_.clear();
+    value_ends_.reserve(array.length());
+    return FormatValues(array);
+  }
+
+  int64_t data_size() const { return data_builder_.length(); }
+
+  /// The formatted value at index `i`, empty for nulls
+  util::string_view value(int64_t i) const {
+    const int64_t start = i == 0 ? 0 : value_ends_[i - 1];
+    return util::string_view(reinterpret_cast<const char*>(data_builder_.data()) + start,
+                             value_ends_[i] - start);
+  }
+
+  Status VisitNull() {
+    FinishValue();
+    return Status::OK();
+  }
+
+ protected:
+  virtual Status FormatValues(const Array& array) = 0;
+
+  void FinishValue() { value_ends_.push_back(data_builder_.length()); }
+
+  BufferBuilder data_builder_;
+  std::vector<int64_t> value_ends_;
+};
+
+class NullColumnFormatter : public ColumnFormatter {
+ public:
+  using ColumnFormatter::ColumnFormatter;
+
+ protected:
+  Status FormatValues(const Array& array) override {
+    value_ends_.resize(array.length(), 0);
+    return Status::OK();
+  }
+};
+
+// Numbers, booleans and temporal values, using StringFormatter
+template <typename T>
+class PrimitiveColumnFormatter : public ColumnFormatter {
+ public:
+  PrimitiveColumnFormatter(const std::shared_ptr<DataType>& type, MemoryPool* pool)
+      : ColumnFormatter(pool), formatter_(type) {}
+
+  Status VisitValue(typename StringFormatter<T>::value_type value) {
+    RETURN_NOT_OK(formatter_(value, [this](util::string_view v) {
+      return data_builder_.Append(v.data(), static_cast<int64_t>(v.size()));
+    }));
+    FinishValue();
+    return Status::OK();
+  }
+
+ protected:
+  Status FormatValues(const Array& array) override {
+    return ArrayDataVisitor<T>::Visit(*array.data(), this);
+  }
+
+  StringFormatter<T> formatter_;
+};
+
+// String and binary values, quoted or escaped as needed
+template <typename T>
+class BinaryColumnFormatter : public ColumnFormatter {
+ public:
+  BinaryColumnFormatter(const ValueWriter* value_writer, MemoryPool* pool)
+      : ColumnFormatter(pool), value_writer_(value_writer) {}
+
+  Status VisitValue(util::string_view value) {
+    RETURN_NOT_OK(value_writer_->Write(value, &data_builder_));
+    FinishValue();
+    return Status::OK();
+  }
+
+ protected:
+  Status FormatValues(const Array& array) override {
+    return ArrayDataVisitor<T>::Visit(*array.data(), this);
+  }
+
+  const ValueWriter* value_writer_;
+};
+
+class DecimalColumnFormatter : public ColumnFormatter {
+ public:
+  using ColumnFormatter::ColumnFormatter;
+
+ protected:
+  Status FormatValues(const Array& array) override {
+    const auto& decimal_array = checked_cast<const Decimal128Array&>(array);
+    for (int64_t i = 0; i < array.length(); ++i) {
+      if (!array.IsNull(i)) {
+        const std::string value = decimal_array.FormatValue(i);
+        RETURN_NOT_OK(data_builder_.Append(value.data(), value.size()));
+      }
+      FinishValue();
+    }
+    return Status::OK();
+  }
+};
+
+// Dictionary values are formatted once, then copied for each index
+class DictionaryColumnFormatter : public ColumnFormatter {
+ public:
+  DictionaryColumnFormatter(std::unique_ptr<ColumnFormatter> dictionary_formatter,
+                            MemoryPool* pool)
+      : ColumnFormatter(pool), dictionary_formatter_(std::move(dictionary_formatter)) {}
+
+ protected:
+  Status FormatValues(const Array& array) override {
+    const auto& dict_array = checked_cast<const DictionaryArray&>(array);
+    // All chunks of a column often share the same dictionary
+    const auto& dictionary = array.data()->dictionary;
+    if (dictionary != formatted_dictionary_) {
+      RETURN_NOT_OK(dictionary_formatter_->Format(*dictionary));
+      formatted_dictionary_ = dictionary;
+    }
+
+    const auto& indices = *dict_array.indices();
+    switch (indices.type_id()) {
+      case Type::INT8:
+        return FormatIndices<Int8Type>(indices);
+      case Type::INT16:
+        return FormatIndices<Int16Type>(indices);
+      case Type::INT32:
+        return FormatIndices<Int32Type>(indices);
+      case Type::INT64:
+        return FormatIndices<Int64Type>(indices);
+      default:
+        return Status::NotImplemented("CSV writing of dictionary indices of type ",
+                                      indices.type()->ToString());
+    }
+  }
+
+  template <typename IndexType>
+  Status FormatIndices(const Array& indices) {
+    const auto* index_values =
+        checked_cast<const NumericArray<IndexType>&>(indices).raw_values();
+    for (int64_t i = 0; i < indices.length(); ++i) {
+      if (!indices.IsNull(i)) {
+        const auto value = dictionary_formatter_->value(index_values[i]);
+        RETURN_NOT_OK(data_builder_.Append(value.data(), value.size()));
+      }
+      FinishValue();
+    }
+    return Status::OK();
+  }
+
+  std::unique_ptr<ColumnFormatter> dictionary_formatter_;
+  std::shared_ptr<Array> formatted_dictionary_;
+};
+
+Result<std::unique_ptr<ColumnFormatter>> MakeColumnFormatter(
+    const std::shared_ptr<DataType>& type, const ValueWriter* value_writer,
+    MemoryPool* pool) {
+  std::unique_ptr<ColumnFormatter> formatter;
+
+  switch (type->id()) {
+#define PRIMITIVE_CASE(TYPE_ID, TYPE)                                \
+  case TYPE_ID:                                                      \
+    formatter.reset(new PrimitiveColumnFormatter<TYPE>(type, pool)); \
+    break;
+
+#define BINARY_CASE(TYPE_ID, TYPE)                                        \
+  case TYPE_ID:                                                           \
+    formatter.reset(new BinaryColumnFormatter<TYPE>(value_writer, pool)); \
+    break;
+
+    PRIMITIVE_CASE(Type::BOOL, BooleanType)
+    PRIMITIVE_CASE(Type::INT8, Int8Type)
+    PRIMITIVE_CASE(Type::INT16, Int16Type)
+    PRIMITIVE_CASE(Type::INT32, Int32Type)
+    PRIMITIVE_CASE(Type::INT64, Int64Type)
+    PRIMITIVE_CASE(Type::UINT8, UInt8Type)
+    PRIMITIVE_CASE(Type::UINT16, UInt16Type)
+    PRIMITIVE_CASE(Type::UINT32, UInt32Type)
+    PRIMITIVE_CASE(Type::UINT64, UInt64Type)
+    PRIMITIVE_CASE(Type::FLOAT, FloatType)
+    PRIMITIVE_CASE(Type::DOUBLE, DoubleType)
+    PRIMITIVE_CASE(Type::DATE32, Date32Type)
+    PRIMITIVE_CASE(Type::DATE64, Date64Type)
+    PRIMITIVE_CASE(Type::TIMESTAMP, TimestampType)
+    BINARY_CASE(Type::STRING, StringType)
+    BINARY_CASE(Type::BINARY, BinaryType)
+    BINARY_CASE(Type::LARGE_STRING, LargeStringType)
+    BINARY_CASE(Type::LARGE_BINARY, LargeBinaryType)
+    BINARY_CASE(Type::FIXED_SIZE_BINARY, FixedSizeBinaryType)
+
+#undef PRIMITIVE_CASE
+#undef BINARY_CASE
+
+    case Type::NA:
+      formatter.reset(new NullColumnFormatter(pool));
+      break;
+
+    case Type::DECIMAL:
+      formatter.reset(new DecimalColumnFormatter(pool));
+      break;
+
+    case Type::DICTIONARY: {
+      const auto& value_type = checked_cast<const DictionaryType&>(*type).value_type();
+      ARROW_ASSIGN_OR_RAISE(auto dictionary_formatter,
+                            MakeColumnFormatter(value_type, value_writer, pool));
+      formatter.reset(
+          new DictionaryColumnFormatter(std::move(dictionary_formatter), pool));
+      break;
+    }
+
+    default:
+      return Status::NotImplemented("CSV writing of ", type->ToString(),
+                                    " is not supported");
+  }
+  return formatter;
+}
+
+// ----------------------------------------------------------------------
+// Writer
+
+class CSVWriter {
+ public:
+  CSVWriter(const WriteOptions& options, MemoryPool* pool, io::OutputStream* output)
+      : options_(options),
+        value_writer_(options),
+        pool_(pool),
+        output_(output),
+        row_builder_(pool) {}
+
+  Status Init(const Schema& schema) {
+    if (options_.batch_size <= 0) {
+      return Status::Invalid("WriteOptions: batch_size must be strictly positive");
+    }
+    if (options_.quoting && options_.escaping &&
+        options_.quote_char == options_.escape_char) {
+      return Status::Invalid("WriteOptions: quote_char and escape_char must differ");
+    }
+    for (const auto& field : schema.fields()) {
+      ARROW_ASSIGN_OR_RAISE(auto formatter,
+                            MakeColumnFormatter(field->type(), &value_writer_, pool_));
+      formatters_.push_back(std::move(formatter));
+    }
+    return options_.include_header ? WriteHeader(schema) : Status::OK();
+  }
+
+  /// Write a batch of at most options_.batch_size rows
+  Status WriteBatch(const RecordBatch& batch) {
+    RETURN_NOT_OK(FormatColumns(batch));
+
+    const int num_columns = batch.num_columns();
+    // One delimiter or line ending after each value
+    int64_t size = batch.num_rows() * num_columns;
+    for (const auto& formatter : formatters_) {
+      size += formatter->data_size();
+    }
+    row_builder_.Rewind(0);
+    RETURN_NOT_OK(row_builder_.Reserve(size));
+    for (int64_t row = 0; row < batch.num_rows(); ++row) {
+      for (int i = 0; i < num_columns; ++i) {
+        const auto value = formatters_[i]->value(row);
+        row_builder_.UnsafeAppend(value.data(), static_cast<int64_t>(value.size()));
+        row_builder_.UnsafeAppend(1, i + 1 < num_columns ? options_.delimiter : '\n');
+      }
+    }
+    return output_->Write(row_builder_.data(), row_builder_.length());
+  }
+
+ protected:
+  Status WriteHeader(const Schema& schema) {
+    row_builder_.Rewind(0);
+    const int num_fields = schema.num_fields();
+    for (int i = 0; i < num_fields; ++i) {
+      RETURN_NOT_OK(value_writer_.Write(schema.field(i)->name(), &row_builder_));
+      const char separator = i + 1 < num_fields ? options_.delimiter : '\n';
+      RETURN_NOT_OK(row_builder_.Append(1, separator));
+    }
+    return output_->Write(row_builder_.data(), row_builder_.length());
+  }
+
+  Status FormatColumns(const RecordBatch& batch) {
+    if (!options_.use_threads || batch.num_columns() < 2) {
+      for (int i = 0; i < batch.num_columns(); ++i) {
+        RETURN_NOT_OK(formatters_[i]->Format(*batch.column(i)));
+      }
+      return Status::OK();
+    }
+    auto task_group = internal::TaskGroup::MakeThreaded(internal::GetCpuThreadPool());
+    for (int i = 0; i < batch.num_columns(); ++i) {
+      auto column = batch.column(i);
+      ColumnFormatter* formatter = formatters_[i].get();
+      task_group->Append([formatter, column] { return formatter->Format(*column); });
+    }
+    return task_group->Finish();
+  }
+
+  const WriteOptions options_;
+  const ValueWriter value_writer_;
+  MemoryPool* pool_;
+  io::OutputStream* output_;
+  std::vector<std::unique_ptr<ColumnFormatter>> formatters_;
+  BufferBuilder row_builder_;
+};
+
+}  // namespace
+
+Status WriteCSV(const Table& table, const WriteOptions& options, MemoryPool* pool,
+                io::OutputStream* output) {
+  CSVWriter writer(options, pool, output);
+  RETURN_NOT_OK(writer.Init(*table.schema()));
+
+  TableBatchReader reader(table);
+  reader.set_chunksize(options.batch_size);
+  std::shared_ptr<RecordBatch> batch;
+  while (true) {
+    RETURN_NOT_OK(reader.ReadNext(&batch));
+    if (batch == NULLPTR) {
+      return Status::OK();
+    }
+    RETURN_NOT_OK(writer.WriteBatch(*batch));
+  }
+}
+
+Status WriteCSV(const RecordBatch& batch, const WriteOptions& options, MemoryPool* pool,
+                io::OutputStream* output) {
+  CSVWriter writer(options, pool, output);
+  RETURN_NOT_OK(writer.Init(*batch.schema()));
+
+  for (int64_t offset = 0; offset < batch.num_rows(); offset += options.batch_size) {
+    RETURN_NOT_OK(writer.WriteBatch(*batch.Slice(offset, options.batch_size)));
+  }
+  return Status::OK();
+}
+
+}  // namespace csv
+}  // namespace arrow
@@ -0,0 +1,58 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include "arrow/csv/options.h"  // IWYU pragma: keep
+#include "arrow/status.h"
+#include "arrow/type_fwd.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace io {
+class OutputStream;
+}  // namespace io
+
+namespace csv {
+
+/// \brief Write a Table as CSV to an output stream
+///
+/// Rows are formatted by batches of WriteOptions::batch_size, each column of
+/// a batch into its own buffer (in parallel if WriteOptions::use_threads is
+/// true), then written out as one contiguous chunk.
+///
+/// Null values are written as empty fields.  Dates are written as "YYYY-MM-DD",
+/// timestamps as "YYYY-MM-DD HH:MM:SS[.fraction]" in UTC, and dictionary arrays
+/// as their decoded values.  Other nested and temporal types are not supported.
+///
+/// With a single column, a null value (or, without quoting, an empty string)
+/// is written as an empty line.  Such a file must be read back with
+/// ParseOptions::ignore_empty_lines set to false, otherwise those rows are
+/// skipped.
+ARROW_EXPORT
+Status WriteCSV(const Table& table, const WriteOptions& options, MemoryPool* pool,
+                io::OutputStream* output);
+
+/// \brief Write a RecordBatch as CSV to an output stream
+///
+/// \see WriteCSV(const Table&, const WriteOptions&, MemoryPool*, io::OutputStream*)
+ARROW_EXPORT
+Status WriteCSV(const RecordBatch& batch, const WriteOptions& options, MemoryPool* pool,
+                io::OutputStream* output);
+
+}  // namespace csv
+}  // namespace arrow
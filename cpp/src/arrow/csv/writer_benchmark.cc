@@ -0,0 +1,96 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "benchmark/benchmark.h"
+
+#include <memory>
+#include <string>
+
+#include "arrow/buffer.h"
+#include "arrow/csv/options.h"
+#include "arrow/csv/reader.h"
+#include "arrow/csv/writer.h"
+#include "arrow/io/memory.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+
+namespace arrow {
+namespace csv {
+
+constexpr int64_t kNumRows = 100000;
+
+// A table of integer, floating-point, timestamp and string columns
+static std::shared_ptr<Table> MakeBenchmarkTable() {
+  random::RandomArrayGenerator rng(42);
+  auto ints = rng.Int64(kNumRows, -1000000000, 1000000000, /*null_probability=*/0.05);
+  auto doubles = rng.Float64(kNumRows, -1e6, 1e6, /*null_probability=*/0.05);
+  auto strings = rng.String(kNumRows, /*min_length=*/0, /*max_length=*/20,
+                            /*null_probability=*/0.05);
+  auto timestamp_type = timestamp(TimeUnit::SECOND);
+  std::shared_ptr<Array> timestamps;
+  ABORT_NOT_OK(ints->View(timestamp_type, &timestamps));
+  auto table_schema =
+      schema({field("i", int64()), field("d", float64()), field("s", utf8()),
+              field("t", timestamp_type)});
+  return Table::Make(table_schema, {ints, doubles, strings, timestamps});
+}
+
+static std::shared_ptr<Buffer> WriteBenchmarkTable(const Table& table,
+                                                   const WriteOptions& options) {
+  auto output = *io::BufferOutputStream::Create();
+  ABORT_NOT_OK(WriteCSV(table, options, default_memory_pool(), output.get()));
+  return *output->Finish();
+}
+
+static void WriteCSVTable(benchmark::State& state) {  // NOLINT non-const reference
+  const auto table = MakeBenchmarkTable();
+  auto options = WriteOptions::Defaults();
+  options.use_threads = state.range(0);
+
+  int64_t bytes_written = 0;
+  while (state.KeepRunning()) {
+    bytes_written += WriteBenchmarkTable(*table, options)->size();
+  }
+
+  state.SetBytesProcessed(bytes_written);
+  state.SetItemsProcessed(state.iterations() * kNumRows);
+}
+
+// Reading back the same data, for comparison
+static void ReadCSVTable(benchmark::State& state) {  // NOLINT non-const reference
+  const auto csv = WriteBenchmarkTable(*MakeBenchmarkTable(), WriteOptions::Defaults());
+  auto read_options = ReadOptions::Defaults();
+  read_options.use_threads = state.range(0);
+
+  while (state.KeepRunning()) {
+    auto reader = *TableReader::Make(
+        default_memory_pool(), std::make_shared<io::BufferReader>(csv), read_options,
+        ParseOptions::Defaults(), ConvertOptions::Defaults());
+    auto table = *reader->Read();
+    benchmark::DoNotOptimize(table);
+  }
+
+  state.SetBytesProcessed(state.iterations() * csv->size());
+  state.SetItemsProcessed(state.iterations() * kNumRows);
+}
+
+BENCHMARK(WriteCSVTable)->ArgName("use_threads")->Arg(false)->Arg(true)->UseRealTime();
+BENCHMARK(ReadCSVTable)->ArgName("use_threads")->Arg(false)->Arg(true)->UseRealTime();
+
+}  // namespace csv
+}  // namespace arrow
@@ -0,0 +1,239 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/csv/options.h"
+#include "arrow/csv/reader.h"
+#include "arrow/csv/writer.h"
+#include "arrow/io/memory.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/type.h"
+
+namespace arrow {
+namespace csv {
+
+static Result<std::string> WriteToString(const RecordBatch& batch,
+                                         const WriteOptions& options) {
+  ARROW_ASSIGN_OR_RAISE(auto output, io::BufferOutputStream::Create());
+  RETURN_NOT_OK(WriteCSV(batch, options, default_memory_pool(), output.get()));
+  ARROW_ASSIGN_OR_RAISE(auto buffer, output->Finish());
+  return buffer->ToString();
+}
+
+static std::shared_ptr<RecordBatch> MakeStringBatch(
+    const std::vector<std::string>& values) {
+  std::shared_ptr<Array> array;
+  ArrayFromVector<StringType, std::string>(values, &array);
+  return RecordBatch::Make(schema({field("s", utf8())}), array->length(), {array});
+}
+
+TEST(WriteCSV, Basics) {
+  std::shared_ptr<Array> ints, doubles, bools, strings;
+  ArrayFromVector<Int64Type>({true, false, true}, {1, 0, -300}, &ints);
+  ArrayFromVector<DoubleType>({true, true, false}, {1.5, -0.25, 0}, &doubles);
+  ArrayFromVector<BooleanType, bool>({true, false, true}, &bools);
+  ArrayFromVector<StringType, std::string>({false, true, true}, {"", "", "a,b"},
+                                           &strings);
+  auto batch = RecordBatch::Make(schema({field("i", int64()), field("d", float64()),
+                                         field("b", boolean()), field("s", utf8())}),
+                                 3, {ints, doubles, bools, strings});
+
+  auto options = WriteOptions::Defaults();
+  ASSERT_OK_AND_ASSIGN(auto csv, WriteToString(*batch, options));
+  ASSERT_EQ(csv,
+            "i,d,b,s\n"
+            "1,1.5,true,\n"
+            ",-0.25,false,\"\"\n"
+            "-300,,true,\"a,b\"\n");
+
+  options.include_header = false;
+  options.delimiter = ';';
+  ASSERT_OK_AND_ASSIGN(csv, WriteToString(*batch, options));
+  ASSERT_EQ(csv,
+            "1;1.5;true;\n"
+            ";-0.25;false;\"\"\n"
+            "-300;;true;a,b\n");
+}
+
+TEST(WriteCSV, QuotingAndEscaping) {
+  auto batch = MakeStringBatch({"plain", "with \"quote\"", "new\nline", "back\\slash"});
+  auto options = WriteOptions::Defaults();
+  options.include_header = false;
+
+  ASSERT_OK_AND_ASSIGN(auto csv, WriteToString(*batch, options));
+  ASSERT_EQ(csv, "plain\n\"with \"\"quote\"\"\"\n\"new\nline\"\nback\\slash\n");
+
+  options.double_quote = false;
+  ASSERT_RAISES(Invalid, WriteToString(*batch, options));
+
+  options.escaping = true;
+  ASSERT_OK_AND_ASSIGN(csv, WriteToString(*batch, options));
+  ASSERT_EQ(csv, "plain\n\"with \\\"quote\\\"\"\n\"new\nline\"\n\"back\\\\slash\"\n");
+
+  options.quoting = false;
+  ASSERT_OK_AND_ASSIGN(csv, WriteToString(*batch, options));
+  ASSERT_EQ(csv, "plain\nwith \"quote\"\nnew\\\nline\nback\\\\slash\n");
+
+  options.escaping = false;
+  ASSERT_RAISES(Invalid, WriteToString(*batch, options));
+
+  // Column names are quoted too
+  options = WriteOptions::Defaults();
+  batch = RecordBatch::Make(schema({field("a,b", utf8())}), 0,
+                            {batch->column(0)->Slice(0, 0)});
+  ASSERT_OK_AND_ASSIGN(csv, WriteToString(*batch, options));
+  ASSERT_EQ(csv, "\"a,b\"\n");
+}
+
+TEST(WriteCSV, Temporal) {
+  std::shared_ptr<Array> dates, timestamps;
+  ArrayFromVector<Date32Type>({true, false}, {11016, 0}, &dates);
+  ArrayFromVector<TimestampType, int64_t>(timestamp(TimeUnit::MILLI), {true, true},
+                                          {0, 951782403123LL}, &timestamps);
+  auto batch = RecordBatch::Make(
+      schema({field("d", date32()), field("t", timestamp(TimeUnit::MILLI))}), 2,
+      {dates, timestamps});
+
+  ASSERT_OK_AND_ASSIGN(auto csv, WriteToString(*batch, WriteOptions::Defaults()));
+  ASSERT_EQ(csv,
+            "d,t\n"
+            "2000-02-29,1970-01-01 00:00:00.000\n"
+            ",2000-02-29 00:00:03.123\n");
+}
+
+TEST(WriteCSV, Dictionary) {
+  std::shared_ptr<Array> indices, dictionary, dict_array;
+  ArrayFromVector<Int8Type>({true, true, false, true}, {1, 0, 0, 1}, &indices);
+  ArrayFromVector<StringType, std::string>({"x", "y z"}, &dictionary);
+  auto type = arrow::dictionary(int8(), utf8());
+  ASSERT_OK(DictionaryArray::FromArrays(type, indices, dictionary, &dict_array));
+  auto batch = RecordBatch::Make(schema({field("d", type)}), 4, {dict_array});
+
+  auto options = WriteOptions::Defaults();
+  // The dictionary is shared between batches
+  options.batch_size = 3;
+  ASSERT_OK_AND_ASSIGN(auto csv, WriteToString(*batch, options));
+  ASSERT_EQ(csv, "d\ny z\nx\n\ny z\n");
+}
+
+TEST(WriteCSV, Errors) {
+  auto batch = MakeStringBatch({"a"});
+  auto options = WriteOptions::Defaults();
+  options.batch_size = 0;
+  ASSERT_RAISES(Invalid, WriteToString(*batch, options));
+
+  auto type = list(int32());
+  std::shared_ptr<Array> array;
+  ASSERT_OK(MakeArrayOfNull(type, 1, &array));
+  batch = RecordBatch::Make(schema({field("l", type)}), 1, {array});
+  ASSERT_RAISES(NotImplemented, WriteToString(*batch, WriteOptions::Defaults()));
+}
+
+class TestWriteCSVRoundtrip : public ::testing::TestWithParam<bool> {};
+
+TEST_P(TestWriteCSVRoundtrip, Table) {
+  const int64_t num_rows = 1000;
+  std::vector<int64_t> ints;
+  std::vector<double> doubles;
+  std::vector<std::string> strings;
+  std::vector<bool> is_valid;
+  for (int64_t i = 0; i < num_rows; ++i) {
+    ints.push_back(i * 7919 - 500000);
+    doubles.push_back(static_cast<double>(i) / 8);
+    strings.push_back(i % 3 == 0 ? "a \"quoted\", value" : std::to_string(i) + "s");
+    is_valid.push_back(i % 11 != 0);
+  }
+  std::shared_ptr<ChunkedArray> int_column, double_column, string_column;
+  const std::vector<std::vector<bool>> chunk_validity = {
+      std::vector<bool>(is_valid.begin(), is_valid.begin() + 300),
+      std::vector<bool>(is_valid.begin() + 300, is_valid.end())};
+  ChunkedArrayFromVector<Int64Type>(
+      chunk_validity,
+      {std::vector<int64_t>(ints.begin(), ints.begin() + 300),
+       std::vector<int64_t>(ints.begin() + 300, ints.end())},
+      &int_column);
+  ChunkedArrayFromVector<DoubleType>(
+      {std::vector<double>(doubles.begin(), doubles.begin() + 300),
+       std::vector<double>(doubles.begin() + 300, doubles.end())},
+      &double_column);
+  ChunkedArrayFromVector<StringType, std::string>(
+      {std::vector<std::string>(strings.begin(), strings.begin() + 300),
+       std::vector<std::string>(strings.begin() + 300, strings.end())},
+      &string_column);
+  auto table = Table::Make(
+      schema({field("i", int64()), field("d", float64()), field("s", utf8())}),
+      {int_column, double_column, string_column});
+
+  auto write_options = WriteOptions::Defaults();
+  write_options.use_threads = GetParam();
+  write_options.batch_size = 128;
+  ASSERT_OK_AND_ASSIGN(auto output, io::BufferOutputStream::Create());
+  ASSERT_OK(WriteCSV(*table, write_options, default_memory_pool(), output.get()));
+  ASSERT_OK_AND_ASSIGN(auto buffer, output->Finish());
+
+  auto read_options = ReadOptions::Defaults();
+  read_options.use_threads = GetParam();
+  ASSERT_OK_AND_ASSIGN(
+      auto reader,
+      TableReader::Make(default_memory_pool(), std::make_shared<io::BufferReader>(buffer),
+                        read_options, ParseOptions::Defaults(),
+                        ConvertOptions::Defaults()));
+  ASSERT_OK_AND_ASSIGN(auto actual, reader->Read());
+  AssertTablesEqual(*table, *actual, /*same_chunk_layout=*/false);
+}
+
+TEST_P(TestWriteCSVRoundtrip, OneColumnWithNulls) {
+  // Nulls of a one-column table are written as empty lines
+  std::shared_ptr<ChunkedArray> column;
+  ChunkedArrayFromVector<Int64Type>({{true, false, true}, {false, false, true}},
+                                    {{1, 0, 3}, {0, 0, 6}}, &column);
+  auto table = Table::Make(schema({field("i", int64())}), {column});
+
+  auto write_options = WriteOptions::Defaults();
+  write_options.use_threads = GetParam();
+  write_options.batch_size = 4;
+  ASSERT_OK_AND_ASSIGN(auto output, io::BufferOutputStream::Create());
+  ASSERT_OK(WriteCSV(*table, write_options, default_memory_pool(), output.get()));
+  ASSERT_OK_AND_ASSIGN(auto buffer, output->Finish());
+  ASSERT_EQ("i\n1\n\n3\n\n\n6\n", buffer->ToString());
+
+  auto read_options = ReadOptions::Defaults();
+  read_options.use_threads = GetParam();
+  auto parse_options = ParseOptions::Defaults();
+  parse_options.ignore_empty_lines = false;
+  ASSERT_OK_AND_ASSIGN(
+      auto reader,
+      TableReader::Make(default_memory_pool(), std::make_shared<io::BufferReader>(buffer),
+                        read_options, parse_options, ConvertOptions::Defaults()));
+  ASSERT_OK_AND_ASSIGN(auto actual, reader->Read());
+  AssertTablesEqual(*table, *actual, /*same_chunk_layout=*/false);
+}
+
+INSTANTIATE_TEST_CASE_P(SerialAndThreaded, TestWriteCSVRoundtrip, ::testing::Bool());
+
+}  // namespace csv
+}  // namespace arrow
@@ -234,6 +234,41 @@ TEST(TestProjector, NonTrivial) {
   AssertBatchesEqual(*expected_batch, *reconciled_batch);
 }
 
+TEST(TestProjector, FilterAndProject) {
+  auto from_schema =
+      schema({field("f64", float64()), field("b", boolean()), field("i32", int32())});
+  auto batch = RecordBatchFromJSON(from_schema, R"([
+    {"f64": 0.5, "b": true, "i32": 1},
+    {"f64": 1.5, "b": false, "i32": 2},
+    {"f64": 2.5, "b": null, "i32": null},
+    {"f64": null, "b": true, "i32": 4},
+    {"f64": 4.5, "b": false, "i32": 5}
+  ])");
+  auto to_schema =
+      schema({field("i32", int32()), field("str", utf8()), field("f64", float64())});
+  RecordBatchProjector projector(to_schema);
+
+  // Nulls in the filter yield null rows, like compute::Filter
+  auto filter = ArrayFromJSON(boolean(), "[true, false, null, true, false]");
+  ASSERT_OK_AND_ASSIGN(auto filtered, projector.FilterAndProject(*batch, *filter));
+  ASSERT_OK(filtered->ValidateFull());
+  AssertBatchesEqual(*RecordBatchFromJSON(to_schema, R"([
+    {"i32": 1, "str": null, "f64": 0.5},
+    {"i32": null, "str": null, "f64": null},
+    {"i32": 4, "str": null, "f64": null}
+  ])"),
+                     *filtered);
+
+  ASSERT_OK_AND_ASSIGN(filtered, projector.FilterAndProject(
+                                     *batch->Slice(1, 3),
+                                     *ArrayFromJSON(boolean(), "[false, false, false]")));
+  ASSERT_EQ(filtered->num_rows(), 0);
+  ASSERT_OK(filtered->ValidateFull());
+
+  ASSERT_RAISES(TypeError, projector.FilterAndProject(*batch, *batch->column(0)));
+  ASSERT_RAISES(Invalid, projector.FilterAndProject(*batch, *filter->Slice(1)));
+}
+
 class TestEndToEnd : public TestDataset {
   void SetUp() {
     bool nullable = false;
@@ -17,7 +17,10 @@
 
 #include "arrow/dataset/file_parquet.h"
 
+#include <algorithm>
 #include <memory>
+#include <string>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -25,15 +28,23 @@
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/filter.h"
 #include "arrow/dataset/scanner.h"
+#include "arrow/scalar.h"
 #include "arrow/table.h"
+#include "arrow/util/checked_cast.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/range.h"
 #include "parquet/arrow/reader.h"
 #include "parquet/arrow/schema.h"
+#include "parquet/bloom_filter.h"
+#include "parquet/exception.h"
 #include "parquet/file_reader.h"
+#include "parquet/page_index.h"
 #include "parquet/statistics.h"
 
 namespace arrow {
+
+using internal::checked_cast;
+
 namespace dataset {
 
 using parquet::arrow::SchemaField;
@@ -43,13 +54,18 @@ using parquet::arrow::StatisticsAsScalars;
 /// \brief A ScanTask backed by a parquet file and a RowGroup within a parquet file.
 class ParquetScanTask : public ScanTask {
  public:
-  ParquetScanTask(int row_group, std::vector<int> column_projection,
+  ParquetScanTask(int row_group, std::shared_ptr<parquet::RowRanges> rows,
+                  std::shared_ptr<parquet::PageIndex> page_index,
+                  std::vector<int> column_projection, std::vector<int> filter_columns,
                   std::shared_ptr<parquet::arrow::FileReader> reader,
                   std::shared_ptr<ScanOptions> options,
                   std::shared_ptr<ScanContext> context)
       : ScanTask(std::move(options), std::move(context)),
         row_group_(row_group),
+        rows_(std::move(rows)),
+        page_index_(std::move(page_index)),
         column_projection_(std::move(column_projection)),
+        filter_columns_(std::move(filter_columns)),
         reader_(std::move(reader)) {}
 
   Result<RecordBatchIterator> Execute() override {
@@ -60,40 +76,342 @@ class ParquetScanTask : public ScanTask {
     // Thus the memory incurred by the RecordBatchReader is allocated when
     // Scan is called.
     std::unique_ptr<RecordBatchReader> record_batch_reader;
-    RETURN_NOT_OK(reader_->GetRecordBatchReader({row_group_}, column_projection_,
-                                                &record_batch_reader));
+    if (!filter_columns_.empty()) {
+      // Only decode the other columns for the rows satisfying the filter
+      std::vector<parquet::RowRanges> row_selections;
+      if (rows_ != nullptr) {
+        row_selections.push_back(*rows_);
+      }
+      RETURN_NOT_OK(reader_->GetFilteredRecordBatchReader(
+          {row_group_}, column_projection_, filter_columns_, MakeRowFilter(),
+          row_selections, page_index_, &record_batch_reader));
+    } else if (rows_ != nullptr) {
+      // Only read the pages holding the rows which may satisfy the filter
+      RETURN_NOT_OK(reader_->GetRecordBatchReader({row_group_}, column_projection_,
+                                                  {*rows_}, page_index_,
+                                                  &record_batch_reader));
+    } else {
+      RETURN_NOT_OK(reader_->GetRecordBatchReader({row_group_}, column_projection_,
+                                                  &record_batch_reader));
+    }
 
     std::shared_ptr<RecordBatchReader> r = std::move(record_batch_reader);
     return MakeFunctionIterator([r] { return r->Next(); });
   }
 
  private:
+  // Evaluate the filter of the scan on the batches of the filter columns. The
+  // scan filters the batches read again, this only spares decoding the other
+  // columns of the rows filtered out.
+  parquet::arrow::RowFilter MakeRowFilter() const {
+    auto filter = options_->filter;
+    auto evaluator = options_->evaluator;
+    auto pool = context_->pool;
+    return [filter, evaluator, pool](const std::shared_ptr<RecordBatch>& batch,
+                                     std::shared_ptr<Array>* selection) -> Status {
+      ARROW_ASSIGN_OR_RAISE(auto datum, evaluator->Evaluate(*filter, *batch, pool));
+      if (datum.is_array()) {
+        *selection = datum.make_array();
+        return Status::OK();
+      }
+      // A scalar selection keeps either all rows or none
+      ARROW_ASSIGN_OR_RAISE(auto filtered, evaluator->Filter(datum, batch, pool));
+      return MakeArrayFromScalar(pool, BooleanScalar(filtered->num_rows() > 0),
+                                 batch->num_rows(), selection);
+    };
+  }
+
   int row_group_;
+  // The rows of the RowGroup to read, or null for all of them
+  std::shared_ptr<parquet::RowRanges> rows_;
+  std::shared_ptr<parquet::PageIndex> page_index_;
   std::vector<int> column_projection_;
+  // The columns to decode first to evaluate the filter, or empty
+  std::vector<int> filter_columns_;
   // The ScanTask _must_ hold a reference to reader_ because there's no
   // guarantee the producing ParquetScanTaskIterator is still alive. This is a
   // contract required by record_batch_reader_
   std::shared_ptr<parquet::arrow::FileReader> reader_;
 };
 
-// Skip RowGroups with a filter and metadata
+template <typename M>
+static Result<SchemaManifest> GetSchemaManifest(const M& metadata) {
+  SchemaManifest manifest;
+  RETURN_NOT_OK(SchemaManifest::Make(
+      metadata.schema(), nullptr, parquet::default_arrow_reader_properties(), &manifest));
+  return manifest;
+}
+
+static std::shared_ptr<Expression> PageStatisticsAsExpression(
+    const SchemaField& schema_field, const parquet::ColumnIndex& column_index, int page,
+    int64_t num_rows) {
+  auto field = schema_field.field;
+  auto field_expr = field_ref(field->name());
+
+  if (column_index.null_pages()[page]) {
+    return equal(field_expr, scalar(MakeNullScalar(field->type())));
+  }
+
+  std::shared_ptr<Scalar> min, max;
+  auto statistics = column_index.page_statistics(page, num_rows);
+  if (!StatisticsAsScalars(*statistics, &min, &max).ok()) {
+    return scalar(true);
+  }
+
+  return and_(greater_equal(field_expr, scalar(min)),
+              less_equal(field_expr, scalar(max)));
+}
+
+// The rows in both a and b
+static parquet::RowRanges IntersectRowRanges(const parquet::RowRanges& a,
+                                             const parquet::RowRanges& b) {
+  parquet::RowRanges out;
+  size_t i = 0, j = 0;
+  while (i < a.size() && j < b.size()) {
+    const int64_t first = std::max(a[i].first, b[j].first);
+    const int64_t last = std::min(a[i].last, b[j].last);
+    if (first < last) {
+      out.push_back({first, last});
+    }
+    if (a[i].last < b[j].last) {
+      ++i;
+    } else {
+      ++j;
+    }
+  }
+  return out;
+}
+
+// Hash integers as the Parquet writer does for a column of the physical type
+template <typename ArrowType>
+static bool HashIntegers(const Array& values, const parquet::ColumnDescriptor& descr,
+                         const parquet::BloomFilter& filter, uint64_t* hashes) {
+  const auto* raw_values =
+      checked_cast<const NumericArray<ArrowType>&>(values).raw_values();
+  const int num_values = static_cast<int>(values.length());
+  switch (descr.physical_type()) {
+    case parquet::Type::INT32: {
+      std::vector<int32_t> ints(num_values);
+      for (int i = 0; i < num_values; ++i) {
+        ints[i] = static_cast<int32_t>(raw_values[i]);
+      }
+      filter.Hashes(ints.data(), num_values, hashes);
+      return true;
+    }
+    case parquet::Type::INT64: {
+      std::vector<int64_t> ints(num_values);
+      for (int i = 0; i < num_values; ++i) {
+        ints[i] = static_cast<int64_t>(raw_values[i]);
+      }
+      filter.Hashes(ints.data(), num_values, hashes);
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+
+// Hash non-null values of the Arrow type of a column as the Parquet writer
+// does, or return false if the Bloom filter of the column can't be probed
+// with them. Floating point values are not supported, as 0.0 and -0.0 hash
+// differently.
+static bool HashValues(const Array& values, const parquet::ColumnDescriptor& descr,
+                       const parquet::BloomFilter& filter,
+                       std::vector<uint64_t>* hashes) {
+  const int num_values = static_cast<int>(values.length());
+  hashes->resize(num_values);
+  switch (values.type_id()) {
+    case Type::INT8:
+      return HashIntegers<Int8Type>(values, descr, filter, hashes->data());
+    case Type::INT16:
+      return HashIntegers<Int16Type>(values, descr, filter, hashes->data());
+    case Type::INT32:
+      return HashIntegers<Int32Type>(values, descr, filter, hashes->data());
+    case Type::INT64:
+      return HashIntegers<Int64Type>(values, descr, filter, hashes->data());
+    case Type::UINT8:
+      return HashIntegers<UInt8Type>(values, descr, filter, hashes->data());
+    case Type::UINT16:
+      return HashIntegers<UInt16Type>(values, descr, filter, hashes->data());
+    case Type::UINT32:
+      return HashIntegers<UInt32Type>(values, descr, filter, hashes->data());
+    case Type::UINT64:
+      return HashIntegers<UInt64Type>(values, descr, filter, hashes->data());
+    case Type::DATE32:
+      return HashIntegers<Date32Type>(values, descr, filter, hashes->data());
+    case Type::STRING:
+    case Type::BINARY: {
+      if (descr.physical_type() != parquet::Type::BYTE_ARRAY) {
+        return false;
+      }
+      const auto& binary = checked_cast<const BinaryArray&>(values);
+      std::vector<parquet::ByteArray> byte_arrays(num_values);
+      for (int i = 0; i < num_values; ++i) {
+        auto view = binary.GetView(i);
+        byte_arrays[i] =
+            parquet::ByteArray(static_cast<uint32_t>(view.size()),
+                               reinterpret_cast<const uint8_t*>(view.data()));
+      }
+      filter.Hashes(byte_arrays.data(), num_values, hashes->data());
+      return true;
+    }
+    case Type::FIXED_SIZE_BINARY: {
+      const auto& binary = checked_cast<const FixedSizeBinaryArray&>(values);
+      if (descr.physical_type() != parquet::Type::FIXED_LEN_BYTE_ARRAY ||
+          descr.type_length() != binary.byte_width()) {
+        return false;
+      }
+      std::vector<parquet::FLBA> flbas(num_values);
+      for (int i = 0; i < num_values; ++i) {
+        flbas[i] = parquet::FLBA(binary.GetValue(i));
+      }
+      filter.Hashes(flbas.data(), binary.byte_width(), num_values, hashes->data());
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+
+// The Bloom filters of the filter columns of a RowGroup, read on demand. They
+// exclude equality and membership tests of values absent from a column, which
+// statistics rarely do.
+class RowGroupBloomFilters {
+ public:
+  RowGroupBloomFilters(std::shared_ptr<parquet::RowGroupReader> row_group,
+                       const std::vector<SchemaField>& filter_columns)
+      : row_group_(std::move(row_group)) {
+    for (const auto& schema_field : filter_columns) {
+      columns_[schema_field.field->name()] = &schema_field;
+    }
+  }
+
+  // Whether no row of the RowGroup satisfies the expression
+  bool Excludes(const Expression& expr) {
+    switch (expr.type()) {
+      case ExpressionType::AND: {
+        const auto& and_expr = checked_cast<const AndExpression&>(expr);
+        return Excludes(*and_expr.left_operand()) || Excludes(*and_expr.right_operand());
+      }
+      case ExpressionType::OR: {
+        const auto& or_expr = checked_cast<const OrExpression&>(expr);
+        return Excludes(*or_expr.left_operand()) && Excludes(*or_expr.right_operand());
+      }
+      case ExpressionType::COMPARISON: {
+        const auto& cmp = checked_cast<const ComparisonExpression&>(expr);
+        if (cmp.op() != compute::CompareOperator::EQUAL) {
+          return false;
+        }
+        const Expression* lhs = cmp.left_operand().get();
+        const Expression* rhs = cmp.right_operand().get();
+        if (lhs->type() == ExpressionType::SCALAR) {
+          std::swap(lhs, rhs);
+        }
+        if (lhs->type() != ExpressionType::FIELD ||
+            rhs->type() != ExpressionType::SCALAR) {
+          return false;
+        }
+        const auto& value = checked_cast<const ScalarExpression&>(*rhs).value();
+        std::shared_ptr<Array> values;
+        if (!value->is_valid || !MakeArrayFromScalar(*value, 1, &values).ok()) {
+          return false;
+        }
+        return ExcludesValues(checked_cast<const FieldExpression&>(*lhs).name(), *values);
+      }
+      case ExpressionType::IN: {
+        const auto& in = checked_cast<const InExpression&>(expr);
+        if (in.operand()->type() != ExpressionType::FIELD ||
+            in.set()->null_count() != 0) {
+          return false;
+        }
+        return ExcludesValues(checked_cast<const FieldExpression&>(*in.operand()).name(),
+                              *in.set());
+      }
+      default:
+        return false;
+    }
+  }
+
+ private:
+  // Whether none of the values is in the column
+  bool ExcludesValues(const std::string& name, const Array& values) {
+    auto it = columns_.find(name);
+    if (it == columns_.end() || !values.type()->Equals(*it->second->field->type())) {
+      return false;
+    }
+    const int column = it->second->column_index;
+    const parquet::BloomFilter* filter = GetBloomFilter(column);
+    if (filter == nullptr) {
+      return false;
+    }
+    const parquet::ColumnDescriptor* descr =
+        row_group_->metadata()->schema()->Column(column);
+    if (!HashValues(values, *descr, *filter, &hashes_)) {
+      return false;
+    }
+    const int num_values = static_cast<int>(hashes_.size());
+    std::unique_ptr<bool[]> found(new bool[num_values]);
+    filter->FindHashes(hashes_.data(), num_values, found.get());
+    return std::none_of(found.get(), found.get() + num_values,
+                        [](bool value_found) { return value_found; });
+  }
+
+  const parquet::BloomFilter* GetBloomFilter(int column) {
+    auto it = bloom_filters_.find(column);
+    if (it == bloom_filters_.end()) {
+      std::unique_ptr<parquet::BloomFilter> filter;
+      if (row_group_->metadata()->ColumnChunk(column)->has_bloom_filter()) {
+        filter = row_group_->GetColumnBloomFilter(column);
+      }
+      it = bloom_filters_.emplace(column, std::move(filter)).first;
+    }
+    return it->second.get();
+  }
+
+  std::shared_ptr<parquet::RowGroupReader> row_group_;
+  std::unordered_map<std::string, const SchemaField*> columns_;
+  std::unordered_map<int, std::unique_ptr<parquet::BloomFilter>> bloom_filters_;
+  std::vector<uint64_t> hashes_;
+};
+
+// Skip RowGroups, and pages within RowGroups, with a filter and metadata
 class RowGroupSkipper {
  public:
   static constexpr int kIterationDone = -1;
 
   RowGroupSkipper(std::shared_ptr<parquet::FileMetaData> metadata,
-                  std::shared_ptr<Expression> filter)
-      : metadata_(std::move(metadata)), filter_(std::move(filter)), row_group_idx_(0) {
+                  std::shared_ptr<Expression> filter,
+                  parquet::ParquetFileReader* reader = NULLPTR,
+                  std::vector<int> column_projection = {})
+      : metadata_(std::move(metadata)),
+        filter_(std::move(filter)),
+        reader_(reader),
+        column_projection_(std::move(column_projection)),
+        row_group_idx_(0),
+        rows_skipped_(0),
+        initialized_(false) {
     num_row_groups_ = metadata_->num_row_groups();
   }
 
-  int Next() {
+  // Return the next RowGroup to read. If only some of its rows may satisfy
+  // the filter, they are returned in rows, otherwise rows is set to null.
+  int Next(std::shared_ptr<parquet::RowRanges>* rows) {
+    if (!initialized_) {
+      Initialize();
+    }
+
     while (row_group_idx_ < num_row_groups_) {
       const auto row_group_idx = row_group_idx_++;
       const auto row_group = metadata_->RowGroup(row_group_idx);
 
       const auto num_rows = row_group->num_rows();
-      if (CanSkip(*row_group)) {
+      if (can_skip_[row_group_idx]) {
+        rows_skipped_ += num_rows;
+        continue;
+      }
+
+      *rows = SelectRows(row_group_idx, *row_group);
+      if (*rows != nullptr && (*rows)->empty()) {
         rows_skipped_ += num_rows;
         continue;
       }
@@ -104,7 +422,81 @@ class RowGroupSkipper {
     return kIterationDone;
   }
 
+  // The page index of the RowGroups not skipped with their statistics, for
+  // the filter and projected columns, or null if not read
+  const std::shared_ptr<parquet::PageIndex>& page_index() const { return page_index_; }
+
  private:
+  // Check the statistics of all RowGroups, then the Bloom filters of the
+  // remaining ones, and read the page index of those left in a single pass
+  // over the file
+  void Initialize() {
+    initialized_ = true;
+    std::vector<int> row_groups;
+    can_skip_.resize(num_row_groups_);
+    for (int i = 0; i < num_row_groups_; ++i) {
+      can_skip_[i] = CanSkip(*metadata_->RowGroup(i));
+      if (!can_skip_[i]) {
+        row_groups.push_back(i);
+      }
+    }
+    if (reader_ == nullptr || filter_->Equals(true) || row_groups.empty()) {
+      return;
+    }
+
+    auto maybe_manifest = GetSchemaManifest(*metadata_);
+    if (!maybe_manifest.ok()) {
+      return;
+    }
+    auto manifest = std::move(maybe_manifest).ValueOrDie();
+    auto fields = FieldsInExpression(*filter_);
+    std::unordered_set<std::string> filter_fields(fields.begin(), fields.end());
+    std::unordered_set<int> columns(column_projection_.begin(),
+                                    column_projection_.end());
+    for (const auto& schema_field : manifest.schema_fields) {
+      if (schema_field.is_leaf() &&
+          filter_fields.count(schema_field.field->name()) != 0) {
+        filter_columns_.push_back(schema_field);
+        columns.insert(schema_field.column_index);
+      }
+    }
+    if (filter_columns_.empty()) {
+      return;
+    }
+
+    SkipWithBloomFilters(&row_groups);
+    if (row_groups.empty()) {
+      return;
+    }
+
+    // Errors with the page index are ignored and post-filtering will apply.
+    try {
+      page_index_ = reader_->ReadPageIndex(
+          row_groups, std::vector<int>(columns.begin(), columns.end()));
+    } catch (const ::parquet::ParquetException&) {
+      page_index_ = nullptr;
+    }
+  }
+
+  // Skip the RowGroups whose Bloom filters exclude the filter, and remove
+  // them from row_groups
+  void SkipWithBloomFilters(std::vector<int>* row_groups) {
+    std::vector<int> remaining;
+    for (int i : *row_groups) {
+      // Errors with Bloom filters are ignored and post-filtering will apply.
+      try {
+        RowGroupBloomFilters bloom_filters(reader_->RowGroup(i), filter_columns_);
+        can_skip_[i] = bloom_filters.Excludes(*filter_);
+      } catch (const ::parquet::ParquetException&) {
+        can_skip_[i] = false;
+      }
+      if (!can_skip_[i]) {
+        remaining.push_back(i);
+      }
+    }
+    *row_groups = std::move(remaining);
+  }
+
   bool CanSkip(const parquet::RowGroupMetaData& metadata) const {
     auto maybe_stats_expr = RowGroupStatisticsAsExpression(metadata);
     // Errors with statistics are ignored and post-filtering will apply.
@@ -117,29 +509,91 @@ class RowGroupSkipper {
     return (expr->IsNull() || expr->Equals(false));
   }
 
+  // The statistics of a column chunk cover all of its pages and are often too
+  // wide to exclude the filter. The page index narrows the rows which may
+  // satisfy the filter down to the pages whose statistics do not exclude it.
+  // Return null if all rows may satisfy the filter.
+  std::shared_ptr<parquet::RowRanges> SelectRows(
+      int row_group_idx, const parquet::RowGroupMetaData& metadata) const {
+    if (page_index_ == nullptr) {
+      return nullptr;
+    }
+
+    const int64_t num_rows = metadata.num_rows();
+    parquet::RowRanges rows = {{0, num_rows}};
+    // Errors with the page index are ignored and post-filtering will apply.
+    try {
+      for (const auto& schema_field : filter_columns_) {
+        const int column = schema_field.column_index;
+        auto column_index = page_index_->GetColumnIndex(row_group_idx, column);
+        auto offset_index = page_index_->GetOffsetIndex(row_group_idx, column);
+        if (column_index == nullptr || offset_index == nullptr) {
+          continue;
+        }
+        const auto& locations = offset_index->page_locations();
+        const int num_pages = static_cast<int>(locations.size());
+        if (num_pages == 0 ||
+            static_cast<int>(column_index->null_pages().size()) != num_pages) {
+          continue;
+        }
+
+        // The rows of the pages not excluding the filter
+        parquet::RowRanges column_rows;
+        for (int page = 0; page < num_pages; ++page) {
+          const int64_t first_row = locations[page].first_row_index;
+          const int64_t end_row =
+              page + 1 < num_pages ? locations[page + 1].first_row_index : num_rows;
+          auto page_expr = PageStatisticsAsExpression(schema_field, *column_index, page,
+                                                      end_row - first_row);
+          auto expr = filter_->Assume(page_expr);
+          if (expr->IsNull() || expr->Equals(false)) {
+            continue;
+          }
+          if (!column_rows.empty() && column_rows.back().last == first_row) {
+            column_rows.back().last = end_row;
+          } else {
+            column_rows.push_back({first_row, end_row});
+          }
+        }
+        rows = IntersectRowRanges(rows, column_rows);
+      }
+    } catch (const ::parquet::ParquetException&) {
+      return nullptr;
+    }
+
+    if (rows.size() == 1 && rows[0].first == 0 && rows[0].last == num_rows) {
+      return nullptr;
+    }
+    return std::make_shared<parquet::RowRanges>(std::move(rows));
+  }
+
   std::shared_ptr<parquet::FileMetaData> metadata_;
   std::shared_ptr<Expression> filter_;
+  parquet::ParquetFileReader* reader_;
+  std::vector<int> column_projection_;
   int row_group_idx_;
   int num_row_groups_;
   int64_t rows_skipped_;
-};
 
-template <typename M>
-static Result<SchemaManifest> GetSchemaManifest(const M& metadata) {
-  SchemaManifest manifest;
-  RETURN_NOT_OK(SchemaManifest::Make(
-      metadata.schema(), nullptr, parquet::default_arrow_reader_properties(), &manifest));
-  return manifest;
-}
+  bool initialized_;
+  std::vector<bool> can_skip_;
+  std::vector<SchemaField> filter_columns_;
+  std::shared_ptr<parquet::PageIndex> page_index_;
+};
 
 class ParquetScanTaskIterator {
  public:
   static Result<ScanTaskIterator> Make(
       std::shared_ptr<ScanOptions> options, std::shared_ptr<ScanContext> context,
-      std::unique_ptr<parquet::ParquetFileReader> reader) {
+      std::unique_ptr<parquet::ParquetFileReader> reader,
+      const ParquetFileFormat::ReaderOptions& reader_options) {
     auto metadata = reader->metadata();
 
     auto column_projection = InferColumnProjection(*metadata, options);
+    std::vector<int> filter_columns;
+    if (reader_options.late_materialization) {
+      filter_columns = InferFilterColumns(*metadata, *options);
+    }
 
     std::unique_ptr<parquet::arrow::FileReader> arrow_reader;
     RETURN_NOT_OK(parquet::arrow::FileReader::Make(context->pool, std::move(reader),
@@ -147,19 +601,21 @@ class ParquetScanTaskIterator {
 
     return ScanTaskIterator(ParquetScanTaskIterator(
         std::move(options), std::move(context), std::move(column_projection),
-        std::move(metadata), std::move(arrow_reader)));
+        std::move(filter_columns), std::move(metadata), std::move(arrow_reader)));
   }
 
   Result<std::shared_ptr<ScanTask>> Next() {
-    auto row_group = skipper_.Next();
+    std::shared_ptr<parquet::RowRanges> rows;
+    auto row_group = skipper_.Next(&rows);
 
     // Iteration is done.
     if (row_group == RowGroupSkipper::kIterationDone) {
       return nullptr;
     }
 
-    return std::shared_ptr<ScanTask>(
-        new ParquetScanTask(row_group, column_projection_, reader_, options_, context_));
+    return std::shared_ptr<ScanTask>(new ParquetScanTask(
+        row_group, std::move(rows), skipper_.page_index(), column_projection_,
+        filter_columns_, reader_, options_, context_));
   }
 
  private:
@@ -196,6 +652,38 @@ class ParquetScanTaskIterator {
     return columns_selection;
   }
 
+  // The columns read by the filter, if they can be decoded and the filter
+  // evaluated before the other columns, otherwise nothing. The filter must
+  // only reference fields of the file having the types of the scan's schema,
+  // not e.g. partition fields.
+  static std::vector<int> InferFilterColumns(const parquet::FileMetaData& metadata,
+                                             const ScanOptions& options) {
+    if (options.filter == nullptr || options.filter->Equals(true) ||
+        options.evaluator == nullptr) {
+      return {};
+    }
+    auto maybe_manifest = GetSchemaManifest(metadata);
+    if (!maybe_manifest.ok()) {
+      return {};
+    }
+    auto manifest = std::move(maybe_manifest).ValueOrDie();
+
+    std::vector<int> filter_columns;
+    for (const auto& name : FieldsInExpression(*options.filter)) {
+      auto it = std::find_if(manifest.schema_fields.begin(), manifest.schema_fields.end(),
+                             [&name](const SchemaField& schema_field) {
+                               return schema_field.field->name() == name;
+                             });
+      auto field = options.schema()->GetFieldByName(name);
+      if (it == manifest.schema_fields.end() || field == nullptr ||
+          !field->type()->Equals(*it->field->type())) {
+        return {};
+      }
+      AddColumnIndices(*it, &filter_columns);
+    }
+    return filter_columns;
+  }
+
   static void AddColumnIndices(const SchemaField& schema_field,
                                std::vector<int>* column_projection) {
     if (schema_field.is_leaf()) {
@@ -211,17 +699,21 @@ class ParquetScanTaskIterator {
   ParquetScanTaskIterator(std::shared_ptr<ScanOptions> options,
                           std::shared_ptr<ScanContext> context,
                           std::vector<int> column_projection,
+                          std::vector<int> filter_columns,
                           std::shared_ptr<parquet::FileMetaData> metadata,
                           std::unique_ptr<parquet::arrow::FileReader> reader)
       : options_(std::move(options)),
         context_(std::move(context)),
         column_projection_(std::move(column_projection)),
-        skipper_(std::move(metadata), options_->filter),
+        filter_columns_(std::move(filter_columns)),
+        skipper_(std::move(metadata), options_->filter, reader->parquet_reader(),
+                 column_projection_),
         reader_(std::move(reader)) {}
 
   std::shared_ptr<ScanOptions> options_;
   std::shared_ptr<ScanContext> context_;
   std::vector<int> column_projection_;
+  std::vector<int> filter_columns_;
   RowGroupSkipper skipper_;
   std::shared_ptr<parquet::arrow::FileReader> reader_;
 };
@@ -260,12 +752,14 @@ Result<ScanTaskIterator> ParquetFileFormat::ScanFile(
     const FileSource& source, std::shared_ptr<ScanOptions> options,
     std::shared_ptr<ScanContext> context) const {
   ARROW_ASSIGN_OR_RAISE(auto reader, OpenReader(source, context->pool));
-  return ParquetScanTaskIterator::Make(options, context, std::move(reader));
+  return ParquetScanTaskIterator::Make(options, context, std::move(reader),
+                                       reader_options);
 }
 
 Result<std::shared_ptr<Fragment>> ParquetFileFormat::MakeFragment(
     const FileSource& source, std::shared_ptr<ScanOptions> options) {
-  return std::make_shared<ParquetFragment>(source, options);
+  return std::make_shared<ParquetFragment>(
+      source, std::make_shared<ParquetFileFormat>(*this), options);
 }
 
 Result<std::unique_ptr<parquet::ParquetFileReader>> ParquetFileFormat::OpenReader(
@@ -36,6 +36,18 @@ namespace dataset {
 /// \brief A FileFormat implementation that reads from Parquet files
 class ARROW_DS_EXPORT ParquetFileFormat : public FileFormat {
  public:
+  /// \brief Options affecting how Parquet files are read
+  struct ReaderOptions {
+    /// Decode the columns referenced by the filter of a scan first, and the
+    /// other columns only for the rows satisfying it, see
+    /// parquet::arrow::FileReader::GetFilteredRecordBatchReader. Only applies
+    /// when the filter references columns of the file, of the same types as in
+    /// the schema of the scan.
+    bool late_materialization = true;
+  };
+
+  ReaderOptions reader_options;
+
   std::string type_name() const override { return "parquet"; }
 
   Result<bool> IsSupported(const FileSource& source) const override;
@@ -61,6 +73,10 @@ class ARROW_DS_EXPORT ParquetFragment : public FileFragment {
   ParquetFragment(const FileSource& source, std::shared_ptr<ScanOptions> options)
       : FileFragment(source, std::make_shared<ParquetFileFormat>(), options) {}
 
+  ParquetFragment(const FileSource& source, std::shared_ptr<ParquetFileFormat> format,
+                  std::shared_ptr<ScanOptions> options)
+      : FileFragment(source, std::move(format), options) {}
+
   bool splittable() const override { return true; }
 };
 
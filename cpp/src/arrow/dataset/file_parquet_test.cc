@@ -25,6 +25,7 @@
 #include "arrow/dataset/filter.h"
 #include "arrow/dataset/test_util.h"
 #include "arrow/record_batch.h"
+#include "arrow/table.h"
 #include "arrow/testing/generator.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/util.h"
@@ -395,5 +396,108 @@ TEST_F(TestParquetFileFormatPushDown, Basic) {
                             kNumRowGroups - 5);
 }
 
+TEST_F(TestParquetFileFormatPushDown, PageIndex) {
+  // A single row group whose two pages hold disjoint ranges of values: the
+  // column chunk statistics span both ranges but the page index does not.
+  auto table = TableFromJSON(schema({field("i64", int64())}), {R"([
+    {"i64": 0}, {"i64": 1}, {"i64": 2}, {"i64": 3}, {"i64": 4},
+    {"i64": 100}, {"i64": 101}, {"i64": 102}, {"i64": 103}, {"i64": 104}
+  ])"});
+
+  for (bool write_page_index : {false, true}) {
+    WriterProperties::Builder builder;
+    builder.data_pagesize(1)->write_batch_size(5)->disable_dictionary();
+    if (write_page_index) {
+      builder.enable_write_page_index();
+    }
+    auto sink = CreateOutputStream();
+    ASSERT_OK(WriteTable(*table, default_memory_pool(), sink, table->num_rows(),
+                         builder.build()));
+    ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+    FileSource source(buffer);
+    opts_ = ScanOptions::Make(table->schema());
+    auto fragment = std::make_shared<ParquetFragment>(source, opts_);
+
+    // With the page index, only the page holding the matching row is read
+    opts_->filter = ("i64"_ == int64_t(3)).Copy();
+    CountRowsAndBatchesInScan(*fragment, write_page_index ? 5 : 10, 1);
+    opts_->filter = ("i64"_ >= int64_t(101)).Copy();
+    CountRowsAndBatchesInScan(*fragment, write_page_index ? 5 : 10, 1);
+    opts_->filter = ("i64"_ == int64_t(50)).Copy();
+    CountRowsAndBatchesInScan(*fragment, write_page_index ? 0 : 10,
+                              write_page_index ? 0 : 1);
+  }
+}
+
+TEST_F(TestParquetFileFormatPushDown, BloomFilter) {
+  // Two row groups whose statistics both span the values of the other: only
+  // the Bloom filters exclude the values absent from a row group.
+  auto table = TableFromJSON(schema({field("i64", int64()), field("str", utf8())}),
+                             {R"([
+    {"i64": 0, "str": "a"}, {"i64": 10, "str": "c"},
+    {"i64": 5, "str": "b"}, {"i64": 15, "str": "d"}
+  ])"});
+
+  for (bool bloom_filter : {false, true}) {
+    WriterProperties::Builder builder;
+    if (bloom_filter) {
+      builder.enable_bloom_filter("i64")->enable_bloom_filter("str");
+    }
+    auto sink = CreateOutputStream();
+    ASSERT_OK(WriteTable(*table, default_memory_pool(), sink, 2, builder.build()));
+    ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+    FileSource source(buffer);
+    opts_ = ScanOptions::Make(table->schema());
+    auto fragment = std::make_shared<ParquetFragment>(source, opts_);
+
+    opts_->filter = ("i64"_ == int64_t(5)).Copy();
+    CountRowsAndBatchesInScan(*fragment, bloom_filter ? 2 : 4, bloom_filter ? 1 : 2);
+    opts_->filter = ("str"_ == "c").Copy();
+    CountRowsAndBatchesInScan(*fragment, bloom_filter ? 2 : 4, bloom_filter ? 1 : 2);
+    opts_->filter = "str"_.In(ArrayFromJSON(utf8(), R"(["b", "x"])")).Copy();
+    CountRowsAndBatchesInScan(*fragment, bloom_filter ? 2 : 4, bloom_filter ? 1 : 2);
+    opts_->filter = ("i64"_ == int64_t(7) or "str"_ == "bb").Copy();
+    CountRowsAndBatchesInScan(*fragment, bloom_filter ? 0 : 4, bloom_filter ? 0 : 2);
+    // Only some of the values are in each row group
+    opts_->filter = "i64"_.In(ArrayFromJSON(int64(), "[0, 15]")).Copy();
+    CountRowsAndBatchesInScan(*fragment, 4, 2);
+    // Bloom filters don't exclude ranges
+    opts_->filter = ("i64"_ > int64_t(11)).Copy();
+    CountRowsAndBatchesInScan(*fragment, 2, 1);
+  }
+}
+
+TEST_F(TestParquetFileFormatPushDown, LateMaterialization) {
+  // The row group statistics span the filtered values: only decoding the
+  // filter column first excludes rows before the scan filters the batches.
+  auto table = TableFromJSON(schema({field("i64", int64()), field("str", utf8())}),
+                             {R"([
+    {"i64": 0, "str": "a"}, {"i64": 1, "str": "b"}, {"i64": 2, "str": "c"},
+    {"i64": 3, "str": "d"}, {"i64": 4, "str": "e"}, {"i64": 5, "str": "f"}
+  ])"});
+  auto sink = CreateOutputStream();
+  ASSERT_OK(WriteTable(*table, default_memory_pool(), sink, table->num_rows()));
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+  FileSource source(buffer);
+
+  for (bool late_materialization : {false, true}) {
+    auto format = std::make_shared<ParquetFileFormat>();
+    format->reader_options.late_materialization = late_materialization;
+    opts_ = ScanOptions::Make(table->schema());
+    opts_->evaluator = std::make_shared<TreeEvaluator>();
+    auto fragment = std::make_shared<ParquetFragment>(source, format, opts_);
+
+    opts_->filter = ("i64"_ == int64_t(3)).Copy();
+    CountRowsAndBatchesInScan(*fragment, late_materialization ? 1 : 6, 1);
+    opts_->filter = ("i64"_ > int64_t(1) and "str"_ != "e").Copy();
+    CountRowsAndBatchesInScan(*fragment, late_materialization ? 3 : 6, 1);
+    opts_->filter = ("str"_ == "cc").Copy();
+    CountRowsAndBatchesInScan(*fragment, late_materialization ? 0 : 6,
+                              late_materialization ? 0 : 1);
+  }
+}
+
 }  // namespace dataset
 }  // namespace arrow
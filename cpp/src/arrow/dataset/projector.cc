@@ -17,23 +17,89 @@
 
 #include "arrow/dataset/projector.h"
 
+#include <limits>
 #include <memory>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "arrow/array.h"
+#include "arrow/buffer_builder.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/take.h"
 #include "arrow/dataset/type_fwd.h"
 #include "arrow/record_batch.h"
 #include "arrow/result.h"
 #include "arrow/scalar.h"
 #include "arrow/status.h"
 #include "arrow/type.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
 
 namespace arrow {
+
+using internal::checked_cast;
+
 namespace dataset {
 
+namespace {
+
+// Convert a boolean filter to the indices of the rows it selects, with a null index
+// wherever the filter is null (so that compute::Take yields a null, as compute::Filter
+// would).
+template <typename IndexType>
+Result<std::shared_ptr<Array>> SelectionVector(const BooleanArray& filter,
+                                               MemoryPool* pool) {
+  using IndexCType = typename IndexType::c_type;
+
+  const int64_t length = filter.length();
+  const int64_t null_count = filter.null_count();
+  const int64_t max_selected =
+      internal::CountSetBits(filter.values()->data(), filter.offset(), length) +
+      null_count;
+
+  TypedBufferBuilder<IndexCType> indices_builder(pool);
+  TypedBufferBuilder<bool> is_valid_builder(pool);
+  RETURN_NOT_OK(indices_builder.Reserve(max_selected));
+
+  if (null_count == 0) {
+    internal::BitmapReader reader(filter.values()->data(), filter.offset(), length);
+    for (int64_t i = 0; i < length; ++i, reader.Next()) {
+      if (reader.IsSet()) {
+        indices_builder.UnsafeAppend(static_cast<IndexCType>(i));
+      }
+    }
+  } else {
+    RETURN_NOT_OK(is_valid_builder.Reserve(max_selected));
+    internal::BitmapReader reader(filter.values()->data(), filter.offset(), length);
+    internal::BitmapReader is_valid_reader(filter.null_bitmap_data(), filter.offset(),
+                                           length);
+    for (int64_t i = 0; i < length; ++i, reader.Next(), is_valid_reader.Next()) {
+      if (!is_valid_reader.IsSet()) {
+        indices_builder.UnsafeAppend(0);
+        is_valid_builder.UnsafeAppend(false);
+      } else if (reader.IsSet()) {
+        indices_builder.UnsafeAppend(static_cast<IndexCType>(i));
+        is_valid_builder.UnsafeAppend(true);
+      }
+    }
+  }
+
+  const int64_t num_selected = indices_builder.length();
+  const int64_t selection_null_count = is_valid_builder.false_count();
+  std::shared_ptr<Buffer> indices, is_valid;
+  RETURN_NOT_OK(indices_builder.Finish(&indices));
+  if (null_count != 0) {
+    RETURN_NOT_OK(is_valid_builder.Finish(&is_valid));
+  }
+  return MakeArray(ArrayData::Make(TypeTraits<IndexType>::type_singleton(), num_selected,
+                                   {std::move(is_valid), std::move(indices)},
+                                   selection_null_count));
+}
+
+}  // namespace
+
 RecordBatchProjector::RecordBatchProjector(std::shared_ptr<Schema> to)
     : to_(std::move(to)),
       missing_columns_(to_->num_fields(), nullptr),
@@ -77,6 +143,47 @@ Result<std::shared_ptr<RecordBatch>> RecordBatchProjector::Project(
   return RecordBatch::Make(to_, batch.num_rows(), std::move(columns));
 }
 
+Result<std::shared_ptr<RecordBatch>> RecordBatchProjector::FilterAndProject(
+    const RecordBatch& batch, const Array& filter, MemoryPool* pool) {
+  if (filter.type_id() != Type::BOOL) {
+    return Status::TypeError("Filter should be a boolean array, got ", *filter.type());
+  }
+  if (filter.length() != batch.num_rows()) {
+    return Status::Invalid("Filter length (", filter.length(),
+                           ") doesn't match the number of rows (", batch.num_rows(), ")");
+  }
+  if (from_ == nullptr || !batch.schema()->Equals(*from_)) {
+    RETURN_NOT_OK(SetInputSchema(batch.schema(), pool));
+  }
+
+  std::shared_ptr<Array> selection;
+  const auto& boolean_filter = checked_cast<const BooleanArray&>(filter);
+  if (batch.num_rows() <= std::numeric_limits<uint32_t>::max()) {
+    ARROW_ASSIGN_OR_RAISE(selection, SelectionVector<UInt32Type>(boolean_filter, pool));
+  } else {
+    ARROW_ASSIGN_OR_RAISE(selection, SelectionVector<UInt64Type>(boolean_filter, pool));
+  }
+  const int64_t num_selected = selection->length();
+
+  if (missing_columns_length_ < num_selected) {
+    RETURN_NOT_OK(ResizeMissingColumns(num_selected, pool));
+  }
+
+  compute::FunctionContext ctx(pool);
+  std::vector<std::shared_ptr<Array>> columns(to_->num_fields());
+
+  for (int i = 0; i < to_->num_fields(); ++i) {
+    if (column_indices_[i] != kNoMatch) {
+      RETURN_NOT_OK(compute::Take(&ctx, *batch.column(column_indices_[i]), *selection,
+                                  compute::TakeOptions(), &columns[i]));
+    } else {
+      columns[i] = missing_columns_[i]->Slice(0, num_selected);
+    }
+  }
+
+  return RecordBatch::Make(to_, num_selected, std::move(columns));
+}
+
 Status RecordBatchProjector::SetInputSchema(std::shared_ptr<Schema> from,
                                             MemoryPool* pool) {
   from_ = std::move(from);
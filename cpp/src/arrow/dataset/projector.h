@@ -53,6 +53,17 @@ class ARROW_DS_EXPORT RecordBatchProjector {
   Result<std::shared_ptr<RecordBatch>> Project(const RecordBatch& batch,
                                                MemoryPool* pool = default_memory_pool());
 
+  /// Project the rows of a record batch selected by a boolean filter.
+  ///
+  /// The result is the same as compute::Filter followed by Project(), but the filter is
+  /// converted to a selection vector only once, and only the columns present in the
+  /// projected schema are gathered through it. Columns of the record batch which are
+  /// not projected, for example columns only referenced by a filter expression, are
+  /// never materialized.
+  Result<std::shared_ptr<RecordBatch>> FilterAndProject(
+      const RecordBatch& batch, const Array& filter,
+      MemoryPool* pool = default_memory_pool());
+
   const std::shared_ptr<Schema>& schema() const { return to_; }
 
   Status SetInputSchema(std::shared_ptr<Schema> from,
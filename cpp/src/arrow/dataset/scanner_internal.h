@@ -27,19 +27,6 @@
 namespace arrow {
 namespace dataset {
 
-static inline RecordBatchIterator FilterRecordBatch(RecordBatchIterator it,
-                                                    const ExpressionEvaluator& evaluator,
-                                                    const Expression& filter,
-                                                    MemoryPool* pool) {
-  return MakeMaybeMapIterator(
-      [&filter, &evaluator, pool](std::shared_ptr<RecordBatch> in) {
-        return evaluator.Evaluate(filter, *in, pool).Map([&](compute::Datum selection) {
-          return evaluator.Filter(selection, in);
-        });
-      },
-      std::move(it));
-}
-
 static inline RecordBatchIterator ProjectRecordBatch(RecordBatchIterator it,
                                                      RecordBatchProjector* projector,
                                                      MemoryPool* pool) {
@@ -48,6 +35,25 @@ static inline RecordBatchIterator ProjectRecordBatch(RecordBatchIterator it,
       std::move(it));
 }
 
+// Evaluate the filter once per batch, then gather only the projected columns through
+// the resulting selection
+static inline RecordBatchIterator FilterAndProjectRecordBatch(
+    RecordBatchIterator it, const ExpressionEvaluator& evaluator,
+    const Expression& filter, RecordBatchProjector* projector, MemoryPool* pool) {
+  return MakeMaybeMapIterator(
+      [&filter, &evaluator, projector,
+       pool](std::shared_ptr<RecordBatch> in) -> Result<std::shared_ptr<RecordBatch>> {
+        ARROW_ASSIGN_OR_RAISE(auto selection, evaluator.Evaluate(filter, *in, pool));
+        if (selection.is_array()) {
+          return projector->FilterAndProject(*in, *selection.make_array(), pool);
+        }
+        // A scalar selection keeps either all rows or none, without copying
+        ARROW_ASSIGN_OR_RAISE(auto filtered, evaluator.Filter(selection, in, pool));
+        return projector->Project(*filtered, pool);
+      },
+      std::move(it));
+}
+
 class FilterAndProjectScanTask : public ScanTask {
  public:
   explicit FilterAndProjectScanTask(std::shared_ptr<ScanTask> task)
@@ -55,10 +61,13 @@ class FilterAndProjectScanTask : public ScanTask {
 
   Result<RecordBatchIterator> Execute() override {
     ARROW_ASSIGN_OR_RAISE(auto it, task_->Execute());
-    auto filter_it = FilterRecordBatch(std::move(it), *options_->evaluator,
-                                       *options_->filter, context_->pool);
-    return ProjectRecordBatch(std::move(filter_it), &task_->options()->projector,
-                              context_->pool);
+    if (options_->filter->Equals(true)) {
+      return ProjectRecordBatch(std::move(it), &task_->options()->projector,
+                                context_->pool);
+    }
+    return FilterAndProjectRecordBatch(std::move(it), *options_->evaluator,
+                                       *options_->filter, &task_->options()->projector,
+                                       context_->pool);
   }
 
  private:
@@ -101,6 +101,28 @@ TEST_F(TestScanner, FilteredScan) {
   AssertScannerEqualsRepetitionsOf(MakeScanner(batch), filtered_batch);
 }
 
+TEST_F(TestScanner, FilteredScanOnUnprojectedColumn) {
+  SetSchema({field("i32", int32()), field("f64", float64())});
+  auto batch = RecordBatchFromJSON(schema_, R"([
+    {"i32": 1, "f64": 0.5},
+    {"i32": -1, "f64": 1.5},
+    {"i32": 3, "f64": 2.5},
+    {"i32": 2, "f64": null}
+  ])");
+
+  // The filter only references a column which isn't projected
+  options_ = options_->ReplaceSchema(schema({field("f64", float64())}));
+  options_->filter = ("i32"_ > 0).Copy();
+  options_->evaluator = std::make_shared<TreeEvaluator>();
+
+  auto filtered_batch = RecordBatchFromJSON(options_->schema(), R"([
+    {"f64": 0.5},
+    {"f64": 2.5},
+    {"f64": null}
+  ])");
+  AssertScannerEqualsRepetitionsOf(MakeScanner(batch), filtered_batch);
+}
+
 TEST_F(TestScanner, MaterializeMissingColumn) {
   SetSchema({field("i32", int32()), field("f64", float64())});
   auto batch_missing_f64 =
@@ -20,6 +20,8 @@
 #include <algorithm>
 #include <atomic>
 #include <condition_variable>
+#include <future>
+#include <memory>
 #include <mutex>
 #include <sstream>
 #include <unordered_map>
@@ -343,7 +345,8 @@ Status GetObjectRange(Aws::S3::S3Client* client, const S3Path& path, int64_t sta
 }
 
 // A RandomAccessFile that reads from a S3 object
-class ObjectInputFile : public io::RandomAccessFile {
+class ObjectInputFile : public io::RandomAccessFile,
+                        public std::enable_shared_from_this<ObjectInputFile> {
  public:
   ObjectInputFile(Aws::S3::S3Client* client, const S3Path& path)
       : client_(client), path_(path) {}
@@ -453,6 +456,15 @@ class ObjectInputFile : public io::RandomAccessFile {
     return buf;
   }
 
+  // Each read is a GetObject request paying a full network round-trip,
+  // issue it in the background so that several can be in flight at once
+  std::future<Result<std::shared_ptr<Buffer>>> ReadAsync(int64_t position,
+                                                         int64_t nbytes) override {
+    auto self = shared_from_this();
+    return io::internal::SubmitIO(
+        [self, position, nbytes]() { return self->ReadAt(position, nbytes); });
+  }
+
   Result<int64_t> Read(int64_t nbytes, void* out) override {
     ARROW_ASSIGN_OR_RAISE(int64_t bytes_read, ReadAt(pos_, nbytes, out));
     pos_ += bytes_read;
@@ -0,0 +1,124 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/io/caching.h"
+
+#include <algorithm>
+#include <future>
+#include <iterator>
+#include <utility>
+
+#include "arrow/buffer.h"
+#include "arrow/io/util_internal.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/util/thread_pool.h"
+
+namespace arrow {
+namespace io {
+
+constexpr int64_t CacheOptions::kDefaultHoleSizeLimit;
+constexpr int64_t CacheOptions::kDefaultRangeSizeLimit;
+
+CacheOptions CacheOptions::Defaults() {
+  return CacheOptions{kDefaultHoleSizeLimit, kDefaultRangeSizeLimit};
+}
+
+namespace internal {
+
+namespace {
+
+struct RangeCacheEntry {
+  ReadRange range;
+  std::shared_future<Result<std::shared_ptr<Buffer>>> future;
+};
+
+}  // namespace
+
+struct ReadRangeCache::Impl {
+  std::shared_ptr<RandomAccessFile> file;
+  CacheOptions options;
+  // Ordered by offset, so that a range can be looked up by binary search.
+  // Coalesced ranges never contain each other, hence they are also ordered
+  // by end offset.
+  std::vector<RangeCacheEntry> entries;
+};
+
+ReadRangeCache::ReadRangeCache(std::shared_ptr<RandomAccessFile> file,
+                               CacheOptions options)
+    : impl_(new Impl()) {
+  impl_->file = std::move(file);
+  impl_->options = options;
+}
+
+ReadRangeCache::~ReadRangeCache() {}
+
+Status ReadRangeCache::Cache(std::vector<ReadRange> ranges) {
+  ranges = CoalesceReadRanges(std::move(ranges), impl_->options.hole_size_limit,
+                              impl_->options.range_size_limit);
+  // Let the file prefetch, e.g. into the OS page cache, while the reads are queued
+  RETURN_NOT_OK(impl_->file->WillNeed(ranges));
+  auto pool = GetIOThreadPool();
+  std::vector<RangeCacheEntry> new_entries;
+  new_entries.reserve(ranges.size());
+  for (const auto& range : ranges) {
+    std::shared_ptr<RandomAccessFile> file = impl_->file;
+    ARROW_ASSIGN_OR_RAISE(auto future, pool->Submit([file, range]() {
+      return file->ReadAt(range.offset, range.length);
+    }));
+    new_entries.push_back({range, future.share()});
+  }
+
+  std::vector<RangeCacheEntry> merged;
+  merged.reserve(impl_->entries.size() + new_entries.size());
+  std::merge(impl_->entries.begin(), impl_->entries.end(), new_entries.begin(),
+             new_entries.end(), std::back_inserter(merged),
+             [](const RangeCacheEntry& a, const RangeCacheEntry& b) {
+               return a.range.offset < b.range.offset;
+             });
+  impl_->entries = std::move(merged);
+  return Status::OK();
+}
+
+Result<std::shared_ptr<Buffer>> ReadRangeCache::Read(ReadRange range) {
+  if (range.length == 0) {
+    static const uint8_t byte = 0;
+    return std::make_shared<Buffer>(&byte, 0);
+  }
+
+  const auto it = std::lower_bound(
+      impl_->entries.begin(), impl_->entries.end(), range,
+      [](const RangeCacheEntry& entry, const ReadRange& range) {
+        return entry.range.offset + entry.range.length < range.offset + range.length;
+      });
+  if (it == impl_->entries.end() || !it->range.Contains(range)) {
+    return Status::Invalid("ReadRangeCache did not find matching cache entry for range (",
+                           range.offset, ", ", range.length, ")");
+  }
+
+  // Copy the shared_future: get() is only thread-safe on distinct instances
+  auto future = it->future;
+  ARROW_ASSIGN_OR_RAISE(auto buffer, future.get());
+  const int64_t offset = range.offset - it->range.offset;
+  const int64_t length = std::max<int64_t>(
+      0, std::min<int64_t>(range.length, buffer->size() - offset));
+  return SliceBuffer(std::move(buffer), offset, length);
+}
+
+}  // namespace internal
+}  // namespace io
+}  // namespace arrow
@@ -0,0 +1,88 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "arrow/io/interfaces.h"
+#include "arrow/type_fwd.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace io {
+
+/// \brief Options for coalescing and caching reads, see ReadRangeCache
+struct ARROW_EXPORT CacheOptions {
+  static constexpr int64_t kDefaultHoleSizeLimit = 8192;
+  static constexpr int64_t kDefaultRangeSizeLimit = 32 * 1024 * 1024;
+
+  /// \brief The maximum distance in bytes between two consecutive
+  ///   ranges; beyond this value, ranges are not combined
+  int64_t hole_size_limit;
+  /// \brief The maximum size in bytes of a combined range; if
+  ///   combining two consecutive ranges would produce a range of a
+  ///   size greater than this, they are not combined
+  int64_t range_size_limit;
+
+  bool operator==(const CacheOptions& other) const {
+    return hole_size_limit == other.hole_size_limit &&
+           range_size_limit == other.range_size_limit;
+  }
+
+  /// \brief Options suitable for high-latency filesystems such as S3:
+  ///   reading a few extra kilobytes is cheaper than an extra request
+  static CacheOptions Defaults();
+};
+
+namespace internal {
+
+/// \brief A read cache designed to hide I/O latencies when reading.
+///
+/// The caller first gives all the ranges it will need with Cache(). The cache
+/// coalesces them according to its CacheOptions and fetches the coalesced
+/// ranges concurrently on the I/O thread pool. Each range can then be read
+/// with Read(), which waits for its coalesced range if needed.
+///
+/// Read() may be called concurrently from several threads, but not
+/// concurrently with Cache().
+class ARROW_EXPORT ReadRangeCache {
+ public:
+  ReadRangeCache(std::shared_ptr<RandomAccessFile> file, CacheOptions options);
+  ~ReadRangeCache();
+
+  /// \brief Start fetching the given ranges in the background
+  ///
+  /// The ranges may overlap each other, but not previously cached ranges.
+  Status Cache(std::vector<ReadRange> ranges);
+
+  /// \brief Read a range previously given to Cache()
+  ///
+  /// Like RandomAccessFile::ReadAt, the returned buffer can be shorter than
+  /// requested if the range extends beyond the end of the file.
+  Result<std::shared_ptr<Buffer>> Read(ReadRange range);
+
+ protected:
+  struct Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace internal
+}  // namespace io
+}  // namespace arrow
@@ -26,6 +26,7 @@
 #undef Realloc
 #undef Free
 #else
+#include <fcntl.h>
 #include <sys/mman.h>
 #include <unistd.h>  // IWYU pragma: keep
 #endif
@@ -39,6 +40,7 @@
 #include <mutex>
 #include <sstream>
 #include <string>
+#include <vector>
 
 // ----------------------------------------------------------------------
 // Other Arrow includes
@@ -262,6 +264,20 @@ class ReadableFile::ReadableFileImpl : public OSFile {
     return buffer;
   }
 
+  Status WillNeed(const std::vector<ReadRange>& ranges) {
+    RETURN_NOT_OK(CheckClosed());
+    for (const auto& range : ranges) {
+      RETURN_NOT_OK(internal::ValidateRegion(range.offset, range.length));
+#if defined(POSIX_FADV_WILLNEED)
+      int ret = posix_fadvise(fd_, range.offset, range.length, POSIX_FADV_WILLNEED);
+      if (ret != 0) {
+        return ::arrow::internal::IOErrorFromErrno(ret, "posix_fadvise failed");
+      }
+#endif
+    }
+    return Status::OK();
+  }
+
  private:
   MemoryPool* pool_;
 };
@@ -326,6 +342,19 @@ Result<int64_t> ReadableFile::DoGetSize() { return impl_->size(); }
 
 Status ReadableFile::DoSeek(int64_t pos) { return impl_->Seek(pos); }
 
+std::future<Result<std::shared_ptr<Buffer>>> ReadableFile::ReadAsync(int64_t position,
+                                                                     int64_t nbytes) {
+  // Capture the implementation rather than this file, so that the read can
+  // complete (or fail, if the file was closed) even after the file is destroyed
+  std::shared_ptr<ReadableFileImpl> impl = impl_;
+  return internal::SubmitIO(
+      [impl, position, nbytes]() { return impl->ReadBufferAt(position, nbytes); });
+}
+
+Status ReadableFile::WillNeed(const std::vector<ReadRange>& ranges) {
+  return impl_->WillNeed(ranges);
+}
+
 int ReadableFile::file_descriptor() const { return impl_->fd(); }
 
 // ----------------------------------------------------------------------
@@ -700,6 +729,37 @@ Result<std::shared_ptr<Buffer>> MemoryMappedFile::ReadAt(int64_t position,
   return memory_map_->Slice(position, nbytes);
 }
 
+Status MemoryMappedFile::WillNeed(const std::vector<ReadRange>& ranges) {
+  RETURN_NOT_OK(memory_map_->CheckClosed());
+  auto guard_resize = memory_map_->writable()
+                          ? std::unique_lock<std::mutex>(memory_map_->resize_lock())
+                          : std::unique_lock<std::mutex>();
+  for (const auto& range : ranges) {
+    ARROW_ASSIGN_OR_RAISE(
+        int64_t length,
+        internal::ValidateReadRegion(range.offset, range.length, memory_map_->size()));
+#if defined(MADV_WILLNEED)
+    if (length == 0) {
+      continue;
+    }
+    // madvise() requires a page-aligned address.  The mapped region starts
+    // on a page boundary, so the aligned address is still mapped.
+    static const int64_t page_size = static_cast<int64_t>(sysconf(_SC_PAGESIZE));
+    const uintptr_t address =
+        reinterpret_cast<uintptr_t>(memory_map_->data() + range.offset);
+    const uintptr_t aligned_address = address & ~static_cast<uintptr_t>(page_size - 1);
+    length += static_cast<int64_t>(address - aligned_address);
+    if (madvise(reinterpret_cast<void*>(aligned_address), static_cast<size_t>(length),
+                MADV_WILLNEED) != 0) {
+      return ::arrow::internal::IOErrorFromErrno(errno, "madvise failed");
+    }
+#else
+    ARROW_UNUSED(length);
+#endif
+  }
+  return Status::OK();
+}
+
 Result<int64_t> MemoryMappedFile::ReadAt(int64_t position, int64_t nbytes, void* out) {
   RETURN_NOT_OK(memory_map_->CheckClosed());
   auto guard_resize = memory_map_->writable()
@@ -21,8 +21,10 @@
 #define ARROW_IO_FILE_H
 
 #include <cstdint>
+#include <future>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "arrow/io/concurrency.h"
 #include "arrow/io/interfaces.h"
@@ -138,6 +140,14 @@ class ARROW_EXPORT ReadableFile
 
   int file_descriptor() const;
 
+  /// \brief Read from the file on the I/O thread pool
+  std::future<Result<std::shared_ptr<Buffer>>> ReadAsync(int64_t position,
+                                                         int64_t nbytes) override;
+
+  /// \brief Hint the OS to prefetch the given ranges, with posix_fadvise()
+  /// where available
+  Status WillNeed(const std::vector<ReadRange>& ranges) override;
+
  private:
   friend RandomAccessFileConcurrencyWrapper<ReadableFile>;
 
@@ -158,7 +168,7 @@ class ARROW_EXPORT ReadableFile
   Status DoSeek(int64_t position);
 
   class ARROW_NO_EXPORT ReadableFileImpl;
-  std::unique_ptr<ReadableFileImpl> impl_;
+  std::shared_ptr<ReadableFileImpl> impl_;
 };
 
 /// \brief A file interface that uses memory-mapped files for memory interactions
@@ -223,6 +233,9 @@ class ARROW_EXPORT MemoryMappedFile : public ReadWriteFileInterface {
 
   bool supports_zero_copy() const override;
 
+  /// Hint the OS to page in the given ranges, with madvise() where available
+  Status WillNeed(const std::vector<ReadRange>& ranges) override;
+
   /// Write data at the current position in the file. Thread-safe
   Status Write(const void* data, int64_t nbytes) override;
   /// \cond FALSE
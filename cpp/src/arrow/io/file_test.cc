@@ -364,6 +364,31 @@ TEST_F(TestReadableFile, ReadAt) {
   ASSERT_RAISES(Invalid, file_->ReadAt(0, 1));
 }
 
+TEST_F(TestReadableFile, ReadAsync) {
+  MakeTestFile();
+  OpenFile();
+
+  auto fut1 = file_->ReadAsync(1, 10);
+  auto fut2 = file_->ReadAsync(0, 4);
+  ASSERT_OK_AND_ASSIGN(auto buf1, fut1.get());
+  ASSERT_OK_AND_ASSIGN(auto buf2, fut2.get());
+  AssertBufferEqual(*buf1, "estdata");
+  AssertBufferEqual(*buf2, "test");
+
+  ASSERT_RAISES(Invalid, file_->ReadAsync(-1, 1).get());
+}
+
+TEST_F(TestReadableFile, WillNeed) {
+  MakeTestFile();
+  OpenFile();
+
+  ASSERT_OK(file_->WillNeed({}));
+  ASSERT_OK(file_->WillNeed({{0, 4}, {4, 4}}));
+  // Hints beyond the end of the file are harmless
+  ASSERT_OK(file_->WillNeed({{2, 100}}));
+  ASSERT_RAISES(Invalid, file_->WillNeed({{-1, 4}}));
+}
+
 TEST_F(TestReadableFile, SeekingRequired) {
   MakeTestFile();
   OpenFile();
@@ -625,6 +650,17 @@ TEST_F(TestMemoryMappedFile, InvalidReads) {
   ASSERT_RAISES(Invalid, result->ReadAt(1, -1, buffer));
 }
 
+TEST_F(TestMemoryMappedFile, WillNeed) {
+  const int64_t buffer_size = 1024;
+  std::string path = "io-memory-map-will-need";
+  ASSERT_OK_AND_ASSIGN(auto result, InitMemoryMap(buffer_size * 5, path));
+
+  ASSERT_OK(result->WillNeed({}));
+  ASSERT_OK(result->WillNeed({{0, 10}, {1000, 2000}, {buffer_size * 5, 0}}));
+  ASSERT_RAISES(IOError, result->WillNeed({{buffer_size * 5 + 1, 1}}));
+  ASSERT_RAISES(Invalid, result->WillNeed({{-1, 10}}));
+}
+
 TEST_F(TestMemoryMappedFile, WriteResizeRead) {
   const int64_t buffer_size = 1024;
   const int reps = 5;
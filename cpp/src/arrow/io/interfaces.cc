@@ -19,11 +19,14 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <functional>
+#include <future>
 #include <memory>
 #include <mutex>
 #include <sstream>
 #include <typeinfo>
 #include <utility>
+#include <vector>
 
 #include "arrow/buffer.h"
 #include "arrow/io/concurrency.h"
@@ -33,6 +36,7 @@
 #include "arrow/util/iterator.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/string_view.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 namespace io {
@@ -121,6 +125,17 @@ Result<std::shared_ptr<Buffer>> RandomAccessFile::ReadAt(int64_t position,
   return Read(nbytes);
 }
 
+std::future<Result<std::shared_ptr<Buffer>>> RandomAccessFile::ReadAsync(int64_t position,
+                                                                         int64_t nbytes) {
+  std::promise<Result<std::shared_ptr<Buffer>>> promise;
+  promise.set_value(ReadAt(position, nbytes));
+  return promise.get_future();
+}
+
+Status RandomAccessFile::WillNeed(const std::vector<ReadRange>& ranges) {
+  return Status::OK();
+}
+
 Status RandomAccessFile::ReadAt(int64_t position, int64_t nbytes, int64_t* bytes_read,
                                 void* out) {
   return ReadAt(position, nbytes, out).Value(bytes_read);
@@ -255,6 +270,62 @@ Status ValidateRegion(int64_t offset, int64_t size) {
   return Status::OK();
 }
 
+std::vector<ReadRange> CoalesceReadRanges(std::vector<ReadRange> ranges,
+                                          int64_t hole_size_limit,
+                                          int64_t range_size_limit) {
+  ranges.erase(std::remove_if(ranges.begin(), ranges.end(),
+                              [](const ReadRange& range) { return range.length == 0; }),
+               ranges.end());
+  if (ranges.empty()) {
+    return ranges;
+  }
+  std::sort(ranges.begin(), ranges.end(), [](const ReadRange& a, const ReadRange& b) {
+    return a.offset < b.offset;
+  });
+
+  std::vector<ReadRange> coalesced;
+  ReadRange current = ranges[0];
+  for (size_t i = 1; i < ranges.size(); ++i) {
+    const ReadRange& next = ranges[i];
+    const int64_t current_end = current.offset + current.length;
+    const int64_t next_end = next.offset + next.length;
+    if (next_end <= current_end) {
+      // Already covered, e.g. overlapping padded ranges
+      continue;
+    }
+    if (next.offset - current_end <= hole_size_limit &&
+        next_end - current.offset <= range_size_limit) {
+      current.length = next_end - current.offset;
+    } else {
+      coalesced.push_back(current);
+      current = next;
+    }
+  }
+  coalesced.push_back(current);
+  return coalesced;
+}
+
+std::future<Result<std::shared_ptr<Buffer>>> SubmitIO(
+    std::function<Result<std::shared_ptr<Buffer>>()> read) {
+  auto maybe_future = GetIOThreadPool()->Submit(std::move(read));
+  if (!maybe_future.ok()) {
+    std::promise<Result<std::shared_ptr<Buffer>>> promise;
+    promise.set_value(maybe_future.status());
+    return promise.get_future();
+  }
+  return std::move(maybe_future).ValueOrDie();
+}
+
+// The number of I/O threads is independent of the number of CPU cores:
+// the threads mostly wait on the device or network.
+static constexpr int kDefaultIOThreadPoolCapacity = 8;
+
+::arrow::internal::ThreadPool* GetIOThreadPool() {
+  static std::shared_ptr<::arrow::internal::ThreadPool> singleton =
+      *::arrow::internal::ThreadPool::MakeEternal(kDefaultIOThreadPoolCapacity);
+  return singleton.get();
+}
+
 #ifndef NDEBUG
 
 // Debug mode concurrency checking
@@ -313,5 +384,12 @@ void SharedExclusiveChecker::UnlockExclusive() {}
 #endif
 
 }  // namespace internal
+
+int GetIOThreadPoolCapacity() { return internal::GetIOThreadPool()->GetCapacity(); }
+
+Status SetIOThreadPoolCapacity(int threads) {
+  return internal::GetIOThreadPool()->SetCapacity(threads);
+}
+
 }  // namespace io
 }  // namespace arrow
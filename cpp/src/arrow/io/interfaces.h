@@ -18,6 +18,7 @@
 #pragma once
 
 #include <cstdint>
+#include <future>
 #include <memory>
 #include <string>
 #include <vector>
@@ -31,6 +32,24 @@
 namespace arrow {
 namespace io {
 
+/// \brief A byte range in a file
+struct ARROW_EXPORT ReadRange {
+  int64_t offset;
+  int64_t length;
+
+  friend bool operator==(const ReadRange& left, const ReadRange& right) {
+    return (left.offset == right.offset && left.length == right.length);
+  }
+  friend bool operator!=(const ReadRange& left, const ReadRange& right) {
+    return !(left == right);
+  }
+
+  /// \brief Whether this range covers all of the other range
+  bool Contains(const ReadRange& other) const {
+    return (offset <= other.offset && offset + length >= other.offset + other.length);
+  }
+};
+
 /// DEPRECATED.  Use the FileSystem API in arrow::fs instead.
 struct ObjectType {
   enum type { FILE, DIRECTORY };
@@ -245,6 +264,26 @@ class ARROW_EXPORT RandomAccessFile : public InputStream, public Seekable {
   /// \return A buffer containing the bytes read, or an error
   virtual Result<std::shared_ptr<Buffer>> ReadAt(int64_t position, int64_t nbytes);
 
+  /// EXPERIMENTAL: Read data asynchronously from given file position.
+  ///
+  /// The returned future yields the same result as ReadAt(position, nbytes).
+  /// This allows callers to overlap I/O with other work, e.g. decoding the
+  /// previously read data.
+  ///
+  /// The default RandomAccessFile-provided implementation reads synchronously
+  /// and returns an already satisfied future.  Implementations backed by a
+  /// slow device or network read in the background on the I/O thread pool
+  /// (see GetIOThreadPoolCapacity()).
+  virtual std::future<Result<std::shared_ptr<Buffer>>> ReadAsync(int64_t position,
+                                                                 int64_t nbytes);
+
+  /// EXPERIMENTAL: Inform that the given ranges may be read soon.
+  ///
+  /// Some implementations might arrange to prefetch some of the data,
+  /// e.g. into the OS page cache.  The default RandomAccessFile-provided
+  /// implementation does nothing.
+  virtual Status WillNeed(const std::vector<ReadRange>& ranges);
+
   // Deprecated APIs
 
   ARROW_DEPRECATED("Use Result-returning overload")
@@ -287,5 +326,24 @@ ARROW_EXPORT
 Result<Iterator<std::shared_ptr<Buffer>>> MakeInputStreamIterator(
     std::shared_ptr<InputStream> stream, int64_t block_size);
 
+/// \brief Get the capacity of the global I/O thread pool
+///
+/// Return the number of worker threads in the thread pool to which
+/// Arrow dispatches various I/O-bound tasks.  This is an ideal number,
+/// not necessarily the exact number of threads at a given point in time.
+///
+/// You can change this number using SetIOThreadPoolCapacity().
+ARROW_EXPORT int GetIOThreadPoolCapacity();
+
+/// \brief Set the capacity of the global I/O thread pool
+///
+/// Set the number of worker threads in the thread pool to which
+/// Arrow dispatches various I/O-bound tasks.  I/O tasks mostly wait on
+/// the underlying device or network, so this is usually larger than
+/// the number of CPU cores, especially for high-latency filesystems.
+///
+/// The current number is returned by GetIOThreadPoolCapacity().
+ARROW_EXPORT Status SetIOThreadPoolCapacity(int threads);
+
 }  // namespace io
 }  // namespace arrow
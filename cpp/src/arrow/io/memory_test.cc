@@ -21,13 +21,16 @@
 #include <cstring>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <gtest/gtest.h>
 
 #include "arrow/buffer.h"
+#include "arrow/io/caching.h"
 #include "arrow/io/interfaces.h"
 #include "arrow/io/memory.h"
 #include "arrow/io/slow.h"
+#include "arrow/io/util_internal.h"
 #include "arrow/status.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/util.h"
@@ -380,5 +383,87 @@ TEST(TestInputStreamIterator, Closed) {
   ASSERT_RAISES(Invalid, it.Next().status());
 }
 
+TEST(CoalesceReadRanges, Basics) {
+  auto check = [](std::vector<ReadRange> ranges,
+                  std::vector<ReadRange> expected) -> void {
+    const int64_t hole_size_limit = 9;
+    const int64_t range_size_limit = 99;
+    auto coalesced =
+        internal::CoalesceReadRanges(ranges, hole_size_limit, range_size_limit);
+    ASSERT_EQ(coalesced, expected);
+  };
+
+  check({}, {});
+  // Zero sized range that ends up in empty list
+  check({{110, 0}}, {});
+  // Combination on 1 zero sized range and 1 non-zero sized range
+  check({{110, 10}, {120, 0}}, {{110, 10}});
+  // 1 non-zero sized range
+  check({{110, 10}}, {{110, 10}});
+  // No holes + unordered ranges
+  check({{130, 10}, {110, 10}, {120, 10}}, {{110, 30}});
+  // No holes
+  check({{110, 10}, {120, 10}, {130, 10}}, {{110, 30}});
+  // Small holes only
+  check({{110, 11}, {130, 0}, {130, 10}, {145, 10}}, {{110, 45}});
+  // Large holes
+  check({{110, 10}, {130, 10}}, {{110, 10}, {130, 10}});
+  check({{110, 11}, {130, 0}, {130, 10}, {145, 10}, {165, 10}},
+        {{110, 45}, {165, 10}});
+  // With range size limit
+  check({{110, 11}, {130, 0}, {130, 10}, {145, 90}}, {{110, 30}, {145, 90}});
+  check({{110, 11}, {130, 0}, {130, 10}, {145, 90}, {240, 10}},
+        {{110, 30}, {145, 90}, {240, 10}});
+  // Overlapping and contained ranges
+  check({{110, 20}, {120, 20}}, {{110, 30}});
+  check({{110, 200}, {120, 20}, {320, 10}}, {{110, 200}, {320, 10}});
+}
+
+TEST(RangeReadCache, Basics) {
+  auto file =
+      std::make_shared<BufferReader>(Buffer::FromString("abcdefghijklmnopqrstuvwxyz"));
+  CacheOptions options = CacheOptions::Defaults();
+  options.hole_size_limit = 2;
+  options.range_size_limit = 10;
+  internal::ReadRangeCache cache(file, options);
+
+  ASSERT_OK(cache.Cache({{1, 2}, {3, 2}, {8, 2}, {20, 2}, {25, 0}}));
+  ASSERT_OK(cache.Cache({{10, 4}, {14, 0}, {15, 4}}));
+
+  ASSERT_OK_AND_ASSIGN(auto buf, cache.Read({20, 2}));
+  AssertBufferEqual(*buf, "uv");
+  ASSERT_OK_AND_ASSIGN(buf, cache.Read({1, 2}));
+  AssertBufferEqual(*buf, "bc");
+  ASSERT_OK_AND_ASSIGN(buf, cache.Read({3, 2}));
+  AssertBufferEqual(*buf, "de");
+  ASSERT_OK_AND_ASSIGN(buf, cache.Read({8, 2}));
+  AssertBufferEqual(*buf, "ij");
+  ASSERT_OK_AND_ASSIGN(buf, cache.Read({10, 4}));
+  AssertBufferEqual(*buf, "klmn");
+  ASSERT_OK_AND_ASSIGN(buf, cache.Read({15, 4}));
+  AssertBufferEqual(*buf, "pqrs");
+  // Zero-sized
+  ASSERT_OK_AND_ASSIGN(buf, cache.Read({14, 0}));
+  AssertBufferEqual(*buf, "");
+  ASSERT_OK_AND_ASSIGN(buf, cache.Read({25, 0}));
+  AssertBufferEqual(*buf, "");
+
+  // Non-cached ranges
+  ASSERT_RAISES(Invalid, cache.Read({20, 3}));
+  ASSERT_RAISES(Invalid, cache.Read({19, 3}));
+  ASSERT_RAISES(Invalid, cache.Read({0, 3}));
+  ASSERT_RAISES(Invalid, cache.Read({25, 2}));
+}
+
+TEST(RangeReadCache, ShortRead) {
+  auto file = std::make_shared<BufferReader>(Buffer::FromString("abcdef"));
+  internal::ReadRangeCache cache(file, CacheOptions::Defaults());
+
+  // A range extending beyond the end of the file is truncated, as with ReadAt
+  ASSERT_OK(cache.Cache({{2, 10}}));
+  ASSERT_OK_AND_ASSIGN(auto buf, cache.Read({2, 10}));
+  AssertBufferEqual(*buf, "cdef");
+}
+
 }  // namespace io
 }  // namespace arrow
@@ -17,10 +17,23 @@
 
 #pragma once
 
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <memory>
+#include <vector>
+
 #include "arrow/io/interfaces.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
+
+namespace internal {
+
+class ThreadPool;
+
+}  // namespace internal
+
 namespace io {
 namespace internal {
 
@@ -38,6 +51,21 @@ ARROW_EXPORT Status ValidateWriteRegion(int64_t offset, int64_t size, int64_t fi
 // knowing the file size.
 ARROW_EXPORT Status ValidateRegion(int64_t offset, int64_t size);
 
+// Sort the given ranges and merge those which are closer than hole_size_limit
+// bytes, as long as the merged range stays smaller than range_size_limit bytes.
+// Empty ranges are dropped.  Ranges contained in another range are always merged.
+ARROW_EXPORT std::vector<ReadRange> CoalesceReadRanges(std::vector<ReadRange> ranges,
+                                                       int64_t hole_size_limit,
+                                                       int64_t range_size_limit);
+
+// Return the process-global thread pool for I/O-bound tasks.
+ARROW_EXPORT ::arrow::internal::ThreadPool* GetIOThreadPool();
+
+// Run a read on the I/O thread pool, e.g. to implement ReadAsync().  The
+// callable must keep alive whatever it reads from.
+ARROW_EXPORT std::future<Result<std::shared_ptr<Buffer>>> SubmitIO(
+    std::function<Result<std::shared_ptr<Buffer>>()> read);
+
 }  // namespace internal
 }  // namespace io
 }  // namespace arrow
@@ -240,8 +240,10 @@ std::string FormatMessageType(Message::Type type) {
   return "unknown";
 }
 
-Status ReadMessage(int64_t offset, int32_t metadata_length, io::RandomAccessFile* file,
-                   std::unique_ptr<Message>* message) {
+// Read the length-prefixed flatbuffer of a message and return it without prefix
+static Status ReadPrefixedMetadata(int64_t offset, int32_t metadata_length,
+                                   io::RandomAccessFile* file,
+                                   std::shared_ptr<Buffer>* metadata) {
   if (static_cast<size_t>(metadata_length) < sizeof(int32_t)) {
     return Status::Invalid("metadata_length should be at least 4");
   }
@@ -286,11 +288,26 @@ Status ReadMessage(int64_t offset, int32_t metadata_length, io::RandomAccessFile
                            ", metadata length: ", metadata_length);
   }
 
-  std::shared_ptr<Buffer> metadata =
-      SliceBuffer(buffer, prefix_size, buffer->size() - prefix_size);
+  *metadata = SliceBuffer(buffer, prefix_size, buffer->size() - prefix_size);
+  return Status::OK();
+}
+
+Status ReadMessage(int64_t offset, int32_t metadata_length, io::RandomAccessFile* file,
+                   std::unique_ptr<Message>* message) {
+  std::shared_ptr<Buffer> metadata;
+  RETURN_NOT_OK(ReadPrefixedMetadata(offset, metadata_length, file, &metadata));
   return Message::ReadFrom(offset + metadata_length, metadata, file, message);
 }
 
+Status ReadMessageMetadata(int64_t offset, int32_t metadata_length,
+                           io::RandomAccessFile* file,
+                           std::unique_ptr<Message>* message) {
+  std::shared_ptr<Buffer> metadata;
+  RETURN_NOT_OK(ReadPrefixedMetadata(offset, metadata_length, file, &metadata));
+  RETURN_NOT_OK(MaybeAlignMetadata(&metadata));
+  return Message::Open(metadata, /*body=*/NULLPTR, message);
+}
+
 Status AlignStream(io::InputStream* stream, int32_t alignment) {
   ARROW_ASSIGN_OR_RAISE(int64_t position, stream->Tell());
   return stream->Advance(PaddedLength(position, alignment) - position);
@@ -355,7 +372,7 @@ Result<std::unique_ptr<Message>> DoReadMessage(io::InputStream* file, MemoryPool
 
   std::unique_ptr<Message> message;
   RETURN_NOT_OK(Message::ReadFrom(metadata, file, &message));
-  return std::move(message);
+  return message;
 }
 
 }  // namespace
@@ -186,6 +186,21 @@ ARROW_EXPORT
 Status ReadMessage(const int64_t offset, const int32_t metadata_length,
                    io::RandomAccessFile* file, std::unique_ptr<Message>* message);
 
+/// \brief Read the metadata of an encapsulated IPC message from position in
+/// file, leaving its body unread
+///
+/// The body, if any, starts at offset + metadata_length in the file. The body
+/// of the returned message is null.
+///
+/// \param[in] offset the position in the file where the message starts
+/// \param[in] metadata_length the total number of bytes to read from file
+/// \param[in] file the seekable file interface to read from
+/// \param[out] message the message read, without its body
+/// \return Status success or failure
+ARROW_EXPORT
+Status ReadMessageMetadata(const int64_t offset, const int32_t metadata_length,
+                           io::RandomAccessFile* file, std::unique_ptr<Message>* message);
+
 /// \brief Advance stream to an 8-byte offset if its position is not a multiple
 /// of 8 already
 /// \param[in] stream an input stream
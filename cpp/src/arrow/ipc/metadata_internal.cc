@@ -17,7 +17,9 @@
 
 #include "arrow/ipc/metadata_internal.h"
 
+#include <algorithm>
 #include <cstdint>
+#include <cstring>
 #include <memory>
 #include <sstream>
 #include <unordered_map>
@@ -34,9 +36,11 @@
 #include "arrow/status.h"
 #include "arrow/tensor.h"
 #include "arrow/type.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/key_value_metadata.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
 #include "arrow/util/ubsan.h"
 #include "arrow/visitor_inline.h"
 
@@ -829,16 +833,25 @@ Status SchemaToFlatbuffer(FBB& fbb, const Schema& schema, DictionaryMemo* dictio
   return Status::OK();
 }
 
-Result<std::shared_ptr<Buffer>> WriteFBMessage(FBB& fbb,
-                                               flatbuf::MessageHeader header_type,
-                                               flatbuffers::Offset<void> header,
-                                               int64_t body_length) {
+Result<std::shared_ptr<Buffer>> WriteFBMessage(
+    FBB& fbb, flatbuf::MessageHeader header_type, flatbuffers::Offset<void> header,
+    int64_t body_length, flatbuffers::Offset<KVVector> custom_metadata = 0) {
   auto message = flatbuf::CreateMessage(fbb, kCurrentMetadataVersion, header_type, header,
-                                        body_length);
+                                        body_length, custom_metadata);
   fbb.Finish(message);
   return WriteFlatbufferBuilder(fbb);
 }
 
+static flatbuffers::Offset<KVVector> CompressionToFlatbuffer(
+    FBB& fbb, Compression::type compression) {
+  if (compression == Compression::UNCOMPRESSED) {
+    return 0;
+  }
+  std::vector<KeyValueOffset> key_values = {AppendKeyValue(
+      fbb, kCompressionMetadataKey, util::Codec::GetCodecAsString(compression))};
+  return fbb.CreateVector(key_values);
+}
+
 using FieldNodeVector =
     flatbuffers::Offset<flatbuffers::Vector<const flatbuf::FieldNode*>>;
 using BufferVector = flatbuffers::Offset<flatbuffers::Vector<const flatbuf::Buffer*>>;
@@ -1043,12 +1056,13 @@ Status WriteSchemaMessage(const Schema& schema, DictionaryMemo* dictionary_memo,
 Status WriteRecordBatchMessage(int64_t length, int64_t body_length,
                                const std::vector<FieldMetadata>& nodes,
                                const std::vector<BufferMetadata>& buffers,
+                               Compression::type compression,
                                std::shared_ptr<Buffer>* out) {
   FBB fbb;
   RecordBatchOffset record_batch;
   RETURN_NOT_OK(MakeRecordBatch(fbb, length, body_length, nodes, buffers, &record_batch));
   return WriteFBMessage(fbb, flatbuf::MessageHeader::RecordBatch, record_batch.Union(),
-                        body_length)
+                        body_length, CompressionToFlatbuffer(fbb, compression))
       .Value(out);
 }
 
@@ -1101,13 +1115,14 @@ Result<std::shared_ptr<Buffer>> WriteSparseTensorMessage(
 Status WriteDictionaryMessage(int64_t id, int64_t length, int64_t body_length,
                               const std::vector<FieldMetadata>& nodes,
                               const std::vector<BufferMetadata>& buffers,
+                              Compression::type compression,
                               std::shared_ptr<Buffer>* out) {
   FBB fbb;
   RecordBatchOffset record_batch;
   RETURN_NOT_OK(MakeRecordBatch(fbb, length, body_length, nodes, buffers, &record_batch));
   auto dictionary_batch = flatbuf::CreateDictionaryBatch(fbb, id, record_batch).Union();
   return WriteFBMessage(fbb, flatbuf::MessageHeader::DictionaryBatch, dictionary_batch,
-                        body_length)
+                        body_length, CompressionToFlatbuffer(fbb, compression))
       .Value(out);
 }
 
@@ -1186,6 +1201,118 @@ Status GetSchema(const void* opaque_schema, DictionaryMemo* dictionary_memo,
   return Status::OK();
 }
 
+Status GetCompression(const flatbuf::Message* message, Compression::type* out) {
+  *out = Compression::UNCOMPRESSED;
+  const KVVector* fb_metadata = message->custom_metadata();
+  if (fb_metadata == nullptr) {
+    return Status::OK();
+  }
+  for (const auto& pair : *fb_metadata) {
+    CHECK_FLATBUFFERS_NOT_NULL(pair->key(), "custom_metadata.key");
+    if (pair->key()->str() != kCompressionMetadataKey) {
+      continue;
+    }
+    CHECK_FLATBUFFERS_NOT_NULL(pair->value(), "custom_metadata.value");
+    const std::string name = pair->value()->str();
+    for (auto codec : {Compression::SNAPPY, Compression::GZIP, Compression::BROTLI,
+                       Compression::ZSTD, Compression::LZ4, Compression::LZO,
+                       Compression::BZ2}) {
+      if (name == util::Codec::GetCodecAsString(codec)) {
+        *out = codec;
+        return Status::OK();
+      }
+    }
+    return Status::Invalid("Unrecognized IPC body compression: ", name);
+  }
+  return Status::OK();
+}
+
+Result<std::shared_ptr<Buffer>> CompressBodyBuffer(const Buffer& buffer,
+                                                   util::Codec* codec, MemoryPool* pool) {
+  const int64_t prefix_length = static_cast<int64_t>(sizeof(int64_t));
+  const int64_t max_length = codec->MaxCompressedLen(buffer.size(), buffer.data());
+
+  std::shared_ptr<ResizableBuffer> result;
+  RETURN_NOT_OK(AllocateResizableBuffer(
+      pool, prefix_length + std::max(max_length, buffer.size()), &result));
+  uint8_t* out = result->mutable_data();
+
+  ARROW_ASSIGN_OR_RAISE(int64_t actual_length,
+                        codec->Compress(buffer.size(), buffer.data(), max_length,
+                                        out + prefix_length));
+  int64_t uncompressed_length = buffer.size();
+  if (actual_length >= buffer.size()) {
+    // Incompressible data, e.g. random or already compressed values
+    uncompressed_length = kBufferNotCompressed;
+    actual_length = buffer.size();
+    std::memcpy(out + prefix_length, buffer.data(), static_cast<size_t>(buffer.size()));
+  }
+  uncompressed_length = BitUtil::ToLittleEndian(uncompressed_length);
+  std::memcpy(out, &uncompressed_length, sizeof(int64_t));
+  RETURN_NOT_OK(result->Resize(prefix_length + actual_length, /*shrink_to_fit=*/false));
+  return result;
+}
+
+Result<std::shared_ptr<Buffer>> DecompressBodyBuffer(
+    const std::shared_ptr<Buffer>& buffer, util::Codec* codec, int64_t max_length,
+    MemoryPool* pool) {
+  const int64_t prefix_length = static_cast<int64_t>(sizeof(int64_t));
+  if (buffer->size() < prefix_length) {
+    return Status::IOError("Compressed IPC body buffer is too short: ", buffer->size(),
+                           " bytes");
+  }
+  const int64_t uncompressed_length =
+      BitUtil::FromLittleEndian(util::SafeLoadAs<int64_t>(buffer->data()));
+  if (uncompressed_length == kBufferNotCompressed) {
+    return SliceBuffer(buffer, prefix_length, buffer->size() - prefix_length);
+  }
+  if (uncompressed_length < 0) {
+    return Status::IOError("Invalid uncompressed length in IPC body buffer: ",
+                           uncompressed_length);
+  }
+  if (uncompressed_length > max_length) {
+    return Status::IOError("Uncompressed length of IPC body buffer (",
+                           uncompressed_length, " bytes) exceeds the maximum of ",
+                           max_length, " bytes for its array");
+  }
+
+  std::shared_ptr<Buffer> result;
+  RETURN_NOT_OK(AllocateBuffer(pool, uncompressed_length, &result));
+  ARROW_ASSIGN_OR_RAISE(
+      int64_t actual_length,
+      codec->Decompress(buffer->size() - prefix_length, buffer->data() + prefix_length,
+                        uncompressed_length, result->mutable_data()));
+  if (actual_length != uncompressed_length) {
+    return Status::IOError("IPC body buffer decompressed to ", actual_length,
+                           " bytes, expected ", uncompressed_length);
+  }
+  return result;
+}
+
+Status ParallelForWithCodec(Compression::type compression, int compression_level,
+                            bool use_threads, int num_buffers,
+                            const std::function<Status(util::Codec*, int)>& func) {
+  if (num_buffers == 0) {
+    return Status::OK();
+  }
+  const int num_tasks =
+      use_threads ? std::min(num_buffers, GetCpuThreadPoolCapacity()) : 1;
+  auto run_task = [&](int task) -> Status {
+    ARROW_ASSIGN_OR_RAISE(auto codec,
+                          util::Codec::Create(compression, compression_level));
+    // Interleave the buffers of the tasks, as successive buffers of a batch
+    // often have similar sizes
+    for (int i = task; i < num_buffers; i += num_tasks) {
+      RETURN_NOT_OK(func(codec.get(), i));
+    }
+    return Status::OK();
+  };
+  if (num_tasks > 1) {
+    return ::arrow::internal::ParallelFor(num_tasks, run_task);
+  }
+  return run_task(0);
+}
+
 Status GetTensorMetadata(const Buffer& metadata, std::shared_ptr<DataType>* type,
                          std::vector<int64_t>* shape, std::vector<int64_t>* strides,
                          std::vector<std::string>* dim_names) {
@@ -22,6 +22,7 @@
 
 #include <cstdint>
 #include <cstring>
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
@@ -34,6 +35,7 @@
 #include "arrow/sparse_tensor.h"
 #include "arrow/status.h"
 #include "arrow/type_fwd.h"
+#include "arrow/util/compression.h"
 #include "arrow/util/macros.h"
 
 #include "generated/Message_generated.h"
@@ -135,6 +137,43 @@ Status GetSparseTensorMetadata(const Buffer& metadata, std::shared_ptr<DataType>
                                std::vector<std::string>* dim_names, int64_t* length,
                                SparseTensorFormat::type* sparse_tensor_format_id);
 
+// ----------------------------------------------------------------------
+// EXPERIMENTAL: Body buffer compression
+//
+// When a record batch or dictionary message names a codec in its custom
+// metadata, each of its non-empty body buffers starts with its uncompressed
+// length, as a little-endian int64, followed by the compressed data. A length
+// of kBufferNotCompressed means the data following it is not compressed.
+
+// Key of the custom metadata entry naming the codec, as given by
+// Codec::GetCodecAsString
+constexpr char kCompressionMetadataKey[] = "ARROW:experimental_compression";
+
+constexpr int64_t kBufferNotCompressed = -1;
+
+// Get the codec of the body buffers of a message, UNCOMPRESSED if they are
+// not compressed
+Status GetCompression(const flatbuf::Message* message, Compression::type* out);
+
+// Compress a body buffer, or only prefix it if compression does not make it
+// smaller
+Result<std::shared_ptr<Buffer>> CompressBodyBuffer(const Buffer& buffer,
+                                                   util::Codec* codec, MemoryPool* pool);
+
+// Decompress a body buffer, or slice it if it was not compressed. Fails
+// without allocating if the uncompressed length in the prefix is negative or
+// larger than max_length.
+Result<std::shared_ptr<Buffer>> DecompressBodyBuffer(
+    const std::shared_ptr<Buffer>& buffer, util::Codec* codec, int64_t max_length,
+    MemoryPool* pool);
+
+// Call func(codec, i) for i in [0, num_buffers), on the CPU thread pool if
+// use_threads is true. Each task has a codec of its own, since codecs may
+// keep state between calls.
+Status ParallelForWithCodec(Compression::type compression, int compression_level,
+                            bool use_threads, int num_buffers,
+                            const std::function<Status(util::Codec*, int)>& func);
+
 static inline Status VerifyMessage(const uint8_t* data, int64_t size,
                                    const flatbuf::Message** out) {
   flatbuffers::Verifier verifier(data, size, /*max_depth=*/128);
@@ -158,6 +197,7 @@ Status WriteSchemaMessage(const Schema& schema, DictionaryMemo* dictionary_memo,
 Status WriteRecordBatchMessage(const int64_t length, const int64_t body_length,
                                const std::vector<FieldMetadata>& nodes,
                                const std::vector<BufferMetadata>& buffers,
+                               Compression::type compression,
                                std::shared_ptr<Buffer>* out);
 
 Result<std::shared_ptr<Buffer>> WriteTensorMessage(const Tensor& tensor,
@@ -175,6 +215,7 @@ Status WriteDictionaryMessage(const int64_t id, const int64_t length,
                               const int64_t body_length,
                               const std::vector<FieldMetadata>& nodes,
                               const std::vector<BufferMetadata>& buffers,
+                              Compression::type compression,
                               std::shared_ptr<Buffer>* out);
 
 static inline Result<std::shared_ptr<Buffer>> WriteFlatbufferBuilder(
@@ -19,6 +19,8 @@
 
 #include <cstdint>
 
+#include "arrow/memory_pool.h"
+#include "arrow/util/compression.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
@@ -44,6 +46,27 @@ struct ARROW_EXPORT IpcOptions {
   /// consisting of a 4-byte prefix instead of 8 byte
   bool write_legacy_ipc_format = false;
 
+  /// \brief EXPERIMENTAL: Codec used to compress the body buffers of record
+  /// batch and dictionary messages
+  ///
+  /// Each buffer is compressed separately with the codec's one-shot API, and
+  /// left uncompressed when that does not make it smaller. The codec is recorded
+  /// in the message's custom metadata, so that readers decompress the buffers
+  /// whatever their own options. LZ4 and ZSTD are the intended codecs, though
+  /// any codec supporting one-shot compression works. Readers from other Arrow
+  /// implementations or older versions cannot read compressed messages.
+  Compression::type compression = Compression::UNCOMPRESSED;
+
+  /// \brief Compression level given to the codec, if compression is enabled
+  int compression_level = util::kUseDefaultCompressionLevel;
+
+  /// \brief Use the global CPU thread pool to compress or decompress body
+  /// buffers in parallel
+  bool use_threads = true;
+
+  /// \brief Memory pool for the body buffers decompressed when reading
+  MemoryPool* memory_pool = default_memory_pool();
+
   static IpcOptions Defaults();
 };
 
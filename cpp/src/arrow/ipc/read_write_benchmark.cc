@@ -47,10 +47,10 @@ std::shared_ptr<RecordBatch> MakeRecordBatch(int64_t total_size, int64_t num_fie
   return RecordBatch::Make(schema, length, arrays);
 }
 
-static void WriteRecordBatch(benchmark::State& state) {  // NOLINT non-const reference
+static void BenchmarkWriteRecordBatch(benchmark::State& state,  // NOLINT non-const
+                                      const ipc::IpcOptions& options) {
   // 1MB
   constexpr int64_t kTotalSize = 1 << 20;
-  auto options = ipc::IpcOptions::Defaults();
 
   std::shared_ptr<ResizableBuffer> buffer;
   ABORT_NOT_OK(AllocateResizableBuffer(kTotalSize & 2, &buffer));
@@ -69,10 +69,10 @@ static void WriteRecordBatch(benchmark::State& state) {  // NOLINT non-const ref
   state.SetBytesProcessed(int64_t(state.iterations()) * kTotalSize);
 }
 
-static void ReadRecordBatch(benchmark::State& state) {  // NOLINT non-const reference
+static void BenchmarkReadRecordBatch(benchmark::State& state,  // NOLINT non-const
+                                     const ipc::IpcOptions& options) {
   // 1MB
   constexpr int64_t kTotalSize = 1 << 20;
-  auto options = ipc::IpcOptions::Defaults();
 
   std::shared_ptr<ResizableBuffer> buffer;
   ABORT_NOT_OK(AllocateResizableBuffer(kTotalSize & 2, &buffer));
@@ -101,7 +101,90 @@ static void ReadRecordBatch(benchmark::State& state) {  // NOLINT non-const refe
   state.SetBytesProcessed(int64_t(state.iterations()) * kTotalSize);
 }
 
+static void BenchmarkReadFileRecordBatch(benchmark::State& state,  // NOLINT non-const
+                                         const std::vector<int>* field_indices) {
+  // 1MB
+  constexpr int64_t kTotalSize = 1 << 20;
+
+  std::shared_ptr<ResizableBuffer> buffer;
+  ABORT_NOT_OK(AllocateResizableBuffer(0, &buffer));
+  auto record_batch = MakeRecordBatch(kTotalSize, state.range(0));
+
+  io::BufferOutputStream stream(buffer);
+  std::shared_ptr<ipc::RecordBatchWriter> writer;
+  ABORT_NOT_OK(ipc::RecordBatchFileWriter::Open(&stream, record_batch->schema(),
+                                                ipc::IpcOptions::Defaults())
+                   .Value(&writer));
+  ABORT_NOT_OK(writer->WriteRecordBatch(*record_batch));
+  ABORT_NOT_OK(writer->Close());
+  ABORT_NOT_OK(stream.Close());
+
+  io::BufferReader source(buffer);
+  std::shared_ptr<ipc::RecordBatchFileReader> reader;
+  ABORT_NOT_OK(ipc::RecordBatchFileReader::Open(&source, &reader));
+
+  while (state.KeepRunning()) {
+    std::shared_ptr<RecordBatch> result;
+    Status st = field_indices == nullptr
+                    ? reader->ReadRecordBatch(0, &result)
+                    : reader->ReadRecordBatch(0, *field_indices, &result);
+    if (!st.ok()) {
+      state.SkipWithError("Failed to read!");
+    }
+  }
+  state.SetBytesProcessed(int64_t(state.iterations()) * kTotalSize);
+}
+
+static void ReadFileRecordBatch(benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkReadFileRecordBatch(state, nullptr);
+}
+
+static void ReadFileRecordBatchTwoFields(
+    benchmark::State& state) {  // NOLINT non-const reference
+  const std::vector<int> field_indices = {0, static_cast<int>(state.range(0)) - 1};
+  BenchmarkReadFileRecordBatch(state, &field_indices);
+}
+
+static ipc::IpcOptions CompressedOptions(Compression::type codec) {
+  auto options = ipc::IpcOptions::Defaults();
+  options.compression = codec;
+  return options;
+}
+
+static void WriteRecordBatch(benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkWriteRecordBatch(state, ipc::IpcOptions::Defaults());
+}
+
+static void ReadRecordBatch(benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkReadRecordBatch(state, ipc::IpcOptions::Defaults());
+}
+
+static void WriteRecordBatchLz4(benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkWriteRecordBatch(state, CompressedOptions(Compression::LZ4));
+}
+
+static void ReadRecordBatchLz4(benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkReadRecordBatch(state, CompressedOptions(Compression::LZ4));
+}
+
+static void WriteRecordBatchZstd(benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkWriteRecordBatch(state, CompressedOptions(Compression::ZSTD));
+}
+
+static void ReadRecordBatchZstd(benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkReadRecordBatch(state, CompressedOptions(Compression::ZSTD));
+}
+
 BENCHMARK(WriteRecordBatch)->RangeMultiplier(4)->Range(1, 1 << 13)->UseRealTime();
 BENCHMARK(ReadRecordBatch)->RangeMultiplier(4)->Range(1, 1 << 13)->UseRealTime();
+BENCHMARK(ReadFileRecordBatch)->RangeMultiplier(4)->Range(2, 1 << 13)->UseRealTime();
+BENCHMARK(ReadFileRecordBatchTwoFields)
+    ->RangeMultiplier(4)
+    ->Range(2, 1 << 13)
+    ->UseRealTime();
+BENCHMARK(WriteRecordBatchLz4)->RangeMultiplier(4)->Range(1, 1 << 13)->UseRealTime();
+BENCHMARK(ReadRecordBatchLz4)->RangeMultiplier(4)->Range(1, 1 << 13)->UseRealTime();
+BENCHMARK(WriteRecordBatchZstd)->RangeMultiplier(4)->Range(1, 1 << 13)->UseRealTime();
+BENCHMARK(ReadRecordBatchZstd)->RangeMultiplier(4)->Range(1, 1 << 13)->UseRealTime();
 
 }  // namespace arrow
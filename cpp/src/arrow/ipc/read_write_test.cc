@@ -17,6 +17,7 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <cstring>
 #include <limits>
 #include <memory>
 #include <ostream>
@@ -47,7 +48,9 @@
 #include "arrow/type.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/compression.h"
 #include "arrow/util/key_value_metadata.h"
+#include "arrow/util/ubsan.h"
 
 #include "generated/Message_generated.h"  // IWYU pragma: keep
 
@@ -725,6 +728,20 @@ struct FileWriterHelper {
     return Status::OK();
   }
 
+  Status ReadBatchFields(const std::vector<int>& field_indices,
+                         BatchVector* out_batches) {
+    auto buf_reader = std::make_shared<io::BufferReader>(buffer_);
+    std::shared_ptr<RecordBatchFileReader> reader;
+    RETURN_NOT_OK(RecordBatchFileReader::Open(buf_reader.get(), footer_offset_, &reader));
+
+    for (int i = 0; i < num_batches_written_; ++i) {
+      std::shared_ptr<RecordBatch> chunk;
+      RETURN_NOT_OK(reader->ReadRecordBatch(i, field_indices, &chunk));
+      out_batches->push_back(chunk);
+    }
+    return Status::OK();
+  }
+
   std::shared_ptr<ResizableBuffer> buffer_;
   std::unique_ptr<io::BufferOutputStream> sink_;
   std::shared_ptr<RecordBatchWriter> writer_;
@@ -763,6 +780,17 @@ struct StreamWriterHelper {
   std::shared_ptr<RecordBatchWriter> writer_;
 };
 
+std::vector<Compression::type> AvailableIpcCodecs() {
+  std::vector<Compression::type> codecs;
+  for (auto codec : {Compression::LZ4, Compression::ZSTD, Compression::GZIP,
+                     Compression::BROTLI, Compression::SNAPPY}) {
+    if (util::Codec::IsAvailable(codec)) {
+      codecs.push_back(codec);
+    }
+  }
+  return codecs;
+}
+
 // Parameterized mixin with tests for RecordBatchStreamWriter / RecordBatchFileWriter
 
 template <class WriterHelperType>
@@ -901,6 +929,16 @@ TEST_P(TestFileFormat, RoundTrip) {
   options.write_legacy_ipc_format = true;
   TestRoundTrip(*GetParam(), options);
   TestZeroLengthRoundTrip(*GetParam(), options);
+
+  for (auto codec : AvailableIpcCodecs()) {
+    for (bool use_threads : {false, true}) {
+      options = IpcOptions::Defaults();
+      options.compression = codec;
+      options.use_threads = use_threads;
+      TestRoundTrip(*GetParam(), options);
+      TestZeroLengthRoundTrip(*GetParam(), options);
+    }
+  }
 }
 
 TEST_P(TestStreamFormat, RoundTrip) {
@@ -911,6 +949,77 @@ TEST_P(TestStreamFormat, RoundTrip) {
   options.write_legacy_ipc_format = true;
   TestRoundTrip(*GetParam(), options);
   TestZeroLengthRoundTrip(*GetParam(), options);
+
+  for (auto codec : AvailableIpcCodecs()) {
+    for (bool use_threads : {false, true}) {
+      options = IpcOptions::Defaults();
+      options.compression = codec;
+      options.use_threads = use_threads;
+      TestRoundTrip(*GetParam(), options);
+      TestZeroLengthRoundTrip(*GetParam(), options);
+    }
+  }
+}
+
+void CheckProjectedRead(const BatchVector& in_batches, const IpcOptions& options) {
+  FileWriterHelper writer_helper;
+  ASSERT_OK(writer_helper.Init(in_batches[0]->schema(), options));
+  for (const auto& batch : in_batches) {
+    ASSERT_OK(writer_helper.WriteBatch(batch));
+  }
+  ASSERT_OK(writer_helper.Finish());
+
+  const int num_fields = in_batches[0]->num_columns();
+  std::vector<std::vector<int>> selections = {{}};
+  for (int i = 0; i < num_fields; ++i) {
+    selections.push_back({i});
+  }
+  // All fields, in reverse order
+  std::vector<int> reversed(num_fields);
+  for (int i = 0; i < num_fields; ++i) {
+    reversed[i] = num_fields - 1 - i;
+  }
+  selections.push_back(reversed);
+  if (num_fields > 0) {
+    selections.push_back({0, 0});
+  }
+
+  for (const auto& field_indices : selections) {
+    BatchVector out_batches;
+    ASSERT_OK(writer_helper.ReadBatchFields(field_indices, &out_batches));
+    ASSERT_EQ(out_batches.size(), in_batches.size());
+    for (size_t i = 0; i < in_batches.size(); ++i) {
+      const RecordBatch& out = *out_batches[i];
+      ASSERT_OK(out.ValidateFull());
+      ASSERT_EQ(out.num_rows(), in_batches[i]->num_rows());
+      ASSERT_EQ(out.num_columns(), static_cast<int>(field_indices.size()));
+      for (size_t j = 0; j < field_indices.size(); ++j) {
+        const int field_index = field_indices[j];
+        ASSERT_TRUE(out.schema()->field(static_cast<int>(j))->Equals(
+            in_batches[i]->schema()->field(field_index)));
+        AssertArraysEqual(*in_batches[i]->column(field_index),
+                          *out.column(static_cast<int>(j)));
+      }
+    }
+  }
+
+  BatchVector out_batches;
+  ASSERT_RAISES(Invalid, writer_helper.ReadBatchFields({num_fields}, &out_batches));
+  ASSERT_RAISES(Invalid, writer_helper.ReadBatchFields({-1}, &out_batches));
+}
+
+TEST_P(TestFileFormat, ProjectedRead) {
+  std::shared_ptr<RecordBatch> batch1;
+  std::shared_ptr<RecordBatch> batch2;
+  ASSERT_OK((*GetParam())(&batch1));  // NOLINT clang-tidy gtest issue
+  ASSERT_OK((*GetParam())(&batch2));  // NOLINT clang-tidy gtest issue
+
+  CheckProjectedRead({batch1, batch2}, IpcOptions::Defaults());
+  for (auto codec : AvailableIpcCodecs()) {
+    IpcOptions options;
+    options.compression = codec;
+    CheckProjectedRead({batch1, batch2}, options);
+  }
 }
 
 INSTANTIATE_TEST_CASE_P(GenericIpcRoundTripTests, TestIpcRoundTrip, BATCH_CASES());
@@ -958,6 +1067,148 @@ TEST_F(TestStreamFormat, DifferentSchema) { TestWriteDifferentSchema(); }
 
 TEST_F(TestFileFormat, DifferentSchema) { TestWriteDifferentSchema(); }
 
+class TestProjectedFileRead : public ::testing::Test, public io::MemoryMapFixture {
+ public:
+  void TearDown() { io::MemoryMapFixture::TearDown(); }
+};
+
+TEST_F(TestProjectedFileRead, MemoryMappedIsZeroCopy) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(MakeIntRecordBatch(&batch));
+  ASSERT_EQ(batch->num_columns(), 2);
+
+  ASSERT_OK_AND_ASSIGN(auto mmap, InitMemoryMap(1 << 20, "test-projected-read"));
+  ASSERT_OK_AND_ASSIGN(auto writer, RecordBatchFileWriter::Open(
+                                        mmap.get(), batch->schema(),
+                                        IpcOptions::Defaults()));
+  ASSERT_OK(writer->WriteRecordBatch(*batch));
+  ASSERT_OK(writer->Close());
+  ASSERT_OK_AND_ASSIGN(int64_t footer_offset, mmap->Tell());
+
+  std::shared_ptr<RecordBatchFileReader> reader;
+  ASSERT_OK(RecordBatchFileReader::Open(mmap.get(), footer_offset, &reader));
+  ASSERT_OK_AND_ASSIGN(auto file_data, mmap->ReadAt(0, footer_offset));
+
+  // Read the batch's metadata first, then the second field only
+  std::shared_ptr<RecordBatch> first, second;
+  ASSERT_OK(reader->ReadRecordBatch(0, {0}, &first));
+  ASSERT_OK(reader->ReadRecordBatch(0, {1}, &second));
+  AssertArraysEqual(*batch->column(0), *first->column(0));
+  AssertArraysEqual(*batch->column(1), *second->column(0));
+
+  // The buffers point into the mapping
+  for (const auto& buffer : second->column(0)->data()->buffers) {
+    if (buffer != nullptr) {
+      ASSERT_GE(buffer->data(), file_data->data());
+      ASSERT_LE(buffer->data() + buffer->size(), file_data->data() + file_data->size());
+    }
+  }
+}
+
+TEST(TestBodyCompression, IncompressibleBuffersStayUncompressed) {
+  constexpr int64_t kLength = 10000;
+  constexpr int64_t kSize = kLength * sizeof(int64_t);
+
+  std::shared_ptr<Buffer> zeros, random_data;
+  ASSERT_OK(AllocateBuffer(kSize, &zeros));
+  ASSERT_OK(AllocateBuffer(kSize, &random_data));
+  std::memset(zeros->mutable_data(), 0, kSize);
+  random_bytes(kSize, /*seed=*/0, random_data->mutable_data());
+
+  auto schema = ::arrow::schema({field("zeros", int64()), field("random", int64())});
+  auto batch = RecordBatch::Make(schema, kLength,
+                                 {std::make_shared<Int64Array>(kLength, zeros),
+                                  std::make_shared<Int64Array>(kLength, random_data)});
+
+  for (auto codec : AvailableIpcCodecs()) {
+    SCOPED_TRACE(util::Codec::GetCodecAsString(codec));
+    IpcOptions options;
+    options.compression = codec;
+
+    internal::IpcPayload payload;
+    ASSERT_OK(internal::GetRecordBatchPayload(*batch, options, default_memory_pool(),
+                                              &payload));
+    // Validity bitmaps, then values, of each column
+    ASSERT_EQ(payload.body_buffers.size(), 4);
+    ASSERT_EQ(payload.body_buffers[0]->size(), 0);
+    ASSERT_LT(payload.body_buffers[1]->size(), kSize / 10);
+    const Buffer& random_values = *payload.body_buffers[3];
+    ASSERT_EQ(random_values.size(), sizeof(int64_t) + kSize);
+    ASSERT_EQ(util::SafeLoadAs<int64_t>(random_values.data()),
+              internal::kBufferNotCompressed);
+
+    StreamWriterHelper writer_helper;
+    ASSERT_OK(writer_helper.Init(schema, options));
+    ASSERT_OK(writer_helper.WriteBatch(batch));
+    ASSERT_OK(writer_helper.Finish());
+    ASSERT_LT(writer_helper.buffer_->size(), kSize + kSize / 10);
+
+    BatchVector out_batches;
+    ASSERT_OK(writer_helper.ReadBatches(&out_batches));
+    ASSERT_EQ(out_batches.size(), 1);
+    ASSERT_OK(out_batches[0]->ValidateFull());
+    CompareBatch(*batch, *out_batches[0]);
+  }
+}
+
+TEST(TestBodyCompression, DecompressedLengthIsBounded) {
+  constexpr int64_t kLength = 1000;
+  constexpr int64_t kSize = kLength * sizeof(int64_t);
+
+  std::shared_ptr<Buffer> zeros;
+  ASSERT_OK(AllocateBuffer(kSize, &zeros));
+  std::memset(zeros->mutable_data(), 0, kSize);
+  auto schema = ::arrow::schema({field("zeros", int64())});
+  auto batch =
+      RecordBatch::Make(schema, kLength, {std::make_shared<Int64Array>(kLength, zeros)});
+
+  for (auto codec : AvailableIpcCodecs()) {
+    SCOPED_TRACE(util::Codec::GetCodecAsString(codec));
+    IpcOptions options;
+    options.compression = codec;
+    internal::IpcPayload payload;
+    ASSERT_OK(internal::GetRecordBatchPayload(*batch, options, default_memory_pool(),
+                                              &payload));
+    ASSERT_EQ(payload.body_buffers.size(), 2);
+
+    ProxyMemoryPool pool(default_memory_pool());
+    IpcOptions read_options;
+    read_options.memory_pool = &pool;
+    auto read_payload = [&]() -> Status {
+      ARROW_ASSIGN_OR_RAISE(auto stream, io::BufferOutputStream::Create(0));
+      int32_t metadata_length;
+      RETURN_NOT_OK(
+          internal::WriteIpcPayload(payload, options, stream.get(), &metadata_length));
+      ARROW_ASSIGN_OR_RAISE(auto buffer, stream->Finish());
+      io::BufferReader buffer_reader(buffer);
+      std::unique_ptr<Message> message;
+      RETURN_NOT_OK(ReadMessage(&buffer_reader, &message));
+      ARROW_ASSIGN_OR_RAISE(auto body_reader, Buffer::GetReader(message->body()));
+      std::shared_ptr<RecordBatch> out;
+      return ReadRecordBatch(*message->metadata(), schema, /*dictionary_memo=*/nullptr,
+                             read_options, body_reader.get(), &out);
+    };
+
+    // The values are decompressed into the pool of the read options
+    ASSERT_OK(read_payload());
+    ASSERT_GE(pool.max_memory(), kSize);
+
+    // Uncompressed lengths beyond what the array length allows are rejected
+    std::shared_ptr<Buffer> values;
+    ASSERT_OK(AllocateBuffer(payload.body_buffers[1]->size(), &values));
+    std::memcpy(values->mutable_data(), payload.body_buffers[1]->data(),
+                values->size());
+    payload.body_buffers[1] = values;
+    for (int64_t length : {kSize * 2, static_cast<int64_t>(1) << 62,
+                           static_cast<int64_t>(-2)}) {
+      const int64_t prefix = BitUtil::ToLittleEndian(length);
+      std::memcpy(values->mutable_data(), &prefix, sizeof(prefix));
+      ASSERT_RAISES(IOError, read_payload());
+    }
+    ASSERT_LT(pool.max_memory(), kSize * 2);
+  }
+}
+
 TEST(TestRecordBatchStreamReader, EmptyStreamWithDictionaries) {
   // ARROW-6006
   auto f0 = arrow::field("f0", arrow::dictionary(arrow::int8(), arrow::utf8()));
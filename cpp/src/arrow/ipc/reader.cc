@@ -17,8 +17,10 @@
 
 #include "arrow/ipc/reader.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
+#include <limits>
 #include <sstream>
 #include <string>
 #include <type_traits>
@@ -40,7 +42,9 @@
 #include "arrow/tensor.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/ubsan.h"
 #include "arrow/visitor_inline.h"
 
 #include "generated/File_generated.h"  // IWYU pragma: export
@@ -97,8 +101,10 @@ Status InvalidMessageType(Message::Type expected, Message::Type actual) {
 /// Accessor class for flatbuffers metadata
 class IpcComponentSource {
  public:
-  IpcComponentSource(const flatbuf::RecordBatch* metadata, io::RandomAccessFile* file)
-      : metadata_(metadata), file_(file) {}
+  /// The buffers are read from file, starting at body_offset
+  IpcComponentSource(const flatbuf::RecordBatch* metadata, io::RandomAccessFile* file,
+                     int64_t body_offset = 0)
+      : metadata_(metadata), file_(file), body_offset_(body_offset) {}
 
   Status GetBuffer(int buffer_index, std::shared_ptr<Buffer>* out) {
     auto buffers = metadata_->buffers();
@@ -118,7 +124,14 @@ class IpcComponentSource {
             "Buffer ", buffer_index,
             " did not start on 8-byte aligned offset: ", buffer->offset());
       }
-      return file_->ReadAt(buffer->offset(), buffer->length()).Value(out);
+      ARROW_ASSIGN_OR_RAISE(
+          *out, file_->ReadAt(body_offset_ + buffer->offset(), buffer->length()));
+      if ((*out)->size() < buffer->length()) {
+        return Status::IOError("Expected to be able to read ", buffer->length(),
+                               " bytes for buffer ", buffer_index, ", got ",
+                               (*out)->size());
+      }
+      return Status::OK();
     }
   }
 
@@ -140,6 +153,7 @@ class IpcComponentSource {
  private:
   const flatbuf::RecordBatch* metadata_;
   io::RandomAccessFile* file_;
+  int64_t body_offset_;
 };
 
 /// Bookkeeping struct for loading array objects from their constituent pieces of raw data
@@ -153,6 +167,9 @@ struct ArrayLoaderContext {
   int buffer_index;
   int field_index;
   int max_recursion_depth;
+  // If true, the field and buffer indices are advanced past an array without
+  // reading its buffers
+  bool skip_io;
 };
 
 static Status LoadArray(const Field& field, ArrayLoaderContext* context, ArrayData* out);
@@ -173,6 +190,9 @@ class ArrayLoader {
   }
 
   Status GetBuffer(int buffer_index, std::shared_ptr<Buffer>* out) {
+    if (context_->skip_io) {
+      return Status::OK();
+    }
     return context_->source->GetBuffer(buffer_index, out);
   }
 
@@ -365,38 +385,194 @@ Status ReadRecordBatch(const Message& message, const std::shared_ptr<Schema>& sc
 // ----------------------------------------------------------------------
 // Array loading
 
+// A body buffer of an array, with its layout. The byte width of variable-width
+// data is that of the array's offsets.
+struct BodyBuffer {
+  ArrayData* array;
+  int index;
+  DataTypeLayout::BufferSpec spec;
+};
+
+static void AppendBodyBuffers(const std::vector<std::shared_ptr<ArrayData>>& arrays,
+                              std::vector<BodyBuffer>* out) {
+  for (const auto& array : arrays) {
+    const auto layout = array->type->layout();
+    const int num_specs = static_cast<int>(layout.buffers.size());
+    for (int i = 0; i < static_cast<int>(array->buffers.size()); ++i) {
+      const auto& buffer = array->buffers[i];
+      if (buffer && buffer->size() > 0) {
+        auto spec = i < num_specs ? layout.buffers[i] : DataTypeLayout::AlwaysNull();
+        if (spec.kind == DataTypeLayout::VARIABLE_WIDTH) {
+          spec.byte_width = i > 0 ? layout.buffers[i - 1].byte_width : -1;
+        }
+        out->push_back({array.get(), i, spec});
+      }
+    }
+    // Dictionaries were decompressed when their own message was read
+    AppendBodyBuffers(array->child_data, out);
+  }
+}
+
+// The largest decompressed size accepted for a body buffer, from the length of
+// its array and its layout, with room for padding to 64 bytes. Variable-width
+// data is bounded by the last offset, so the offsets must be decompressed first.
+static int64_t MaxBodyBufferLength(const BodyBuffer& body_buffer) {
+  // Saturate rather than overflow on corrupt array lengths
+  constexpr int64_t kMaxLength = std::numeric_limits<int64_t>::max() - 64;
+  const ArrayData& array = *body_buffer.array;
+  const int64_t num_values = std::max<int64_t>(array.length, 0);
+  const int64_t byte_width = body_buffer.spec.byte_width;
+  int64_t length = 0;
+  switch (body_buffer.spec.kind) {
+    case DataTypeLayout::BITMAP:
+      length = num_values / 8 + 1;
+      break;
+    case DataTypeLayout::FIXED_WIDTH:
+      // Offsets have one more entry than the array has values
+      if (byte_width > 0) {
+        length = num_values < kMaxLength / byte_width - 1
+                     ? (num_values + 1) * byte_width
+                     : kMaxLength;
+      }
+      break;
+    case DataTypeLayout::VARIABLE_WIDTH: {
+      const auto& offsets = array.buffers[body_buffer.index - 1];
+      if (offsets != nullptr && (byte_width == 4 || byte_width == 8) &&
+          offsets->size() / byte_width > num_values) {
+        const uint8_t* last_offset = offsets->data() + num_values * byte_width;
+        length = byte_width == 4 ? util::SafeLoadAs<int32_t>(last_offset)
+                                 : util::SafeLoadAs<int64_t>(last_offset);
+      }
+      break;
+    }
+    default:
+      break;
+  }
+  length = std::min(std::max<int64_t>(length, 0), kMaxLength);
+  return BitUtil::RoundUpToMultipleOf64(length);
+}
+
+static Status DecompressBodyBuffers(Compression::type compression,
+                                    const IpcOptions& options,
+                                    std::vector<std::shared_ptr<ArrayData>>* arrays) {
+  std::vector<BodyBuffer> buffers;
+  AppendBodyBuffers(*arrays, &buffers);
+  // Decompress variable-width data last, as it is bounded by its offsets
+  const auto data_begin =
+      std::stable_partition(buffers.begin(), buffers.end(), [](const BodyBuffer& b) {
+        return b.spec.kind != DataTypeLayout::VARIABLE_WIDTH;
+      });
+  const int num_first = static_cast<int>(data_begin - buffers.begin());
+
+  auto decompress_buffers = [&](int begin, int end) {
+    auto decompress_buffer = [&](util::Codec* codec, int i) -> Status {
+      const BodyBuffer& body_buffer = buffers[begin + i];
+      std::shared_ptr<Buffer>* buffer = &body_buffer.array->buffers[body_buffer.index];
+      return internal::DecompressBodyBuffer(*buffer, codec,
+                                            MaxBodyBufferLength(body_buffer),
+                                            options.memory_pool)
+          .Value(buffer);
+    };
+    return internal::ParallelForWithCodec(compression, util::kUseDefaultCompressionLevel,
+                                          options.use_threads, end - begin,
+                                          decompress_buffer);
+  };
+  RETURN_NOT_OK(decompress_buffers(0, num_first));
+  return decompress_buffers(num_first, static_cast<int>(buffers.size()));
+}
+
+// The indices of the first field node and of the first buffer of a top-level
+// field in the metadata of a record batch. They depend on the schema only.
+struct FieldPosition {
+  int field_index;
+  int buffer_index;
+};
+
+static Status GetFieldPositions(const Schema& schema, const IpcOptions& options,
+                                IpcComponentSource* source,
+                                const DictionaryMemo* dictionary_memo,
+                                std::vector<FieldPosition>* out) {
+  ArrayLoaderContext context{source,
+                             dictionary_memo,
+                             /*buffer_index=*/0,
+                             /*field_index=*/0,
+                             options.max_recursion_depth,
+                             /*skip_io=*/true};
+  out->resize(schema.num_fields());
+  for (int i = 0; i < schema.num_fields(); ++i) {
+    (*out)[i] = FieldPosition{context.field_index, context.buffer_index};
+    ArrayData arr;
+    RETURN_NOT_OK(LoadArray(*schema.field(i), &context, &arr));
+  }
+  return Status::OK();
+}
+
+// Load the fields of a record batch, or only those given by field_indices (in
+// that order) if it is not null. The selected fields are located with
+// field_positions, without visiting the others.
 static Status LoadRecordBatchFromSource(const std::shared_ptr<Schema>& schema,
-                                        int64_t num_rows, int max_recursion_depth,
+                                        const std::vector<int>* field_indices,
+                                        const std::vector<FieldPosition>* field_positions,
+                                        int64_t num_rows, Compression::type compression,
+                                        const IpcOptions& options,
                                         IpcComponentSource* source,
                                         const DictionaryMemo* dictionary_memo,
                                         std::shared_ptr<RecordBatch>* out) {
-  ArrayLoaderContext context{source, dictionary_memo, /*field_index=*/0,
-                             /*buffer_index=*/0, max_recursion_depth};
-
-  std::vector<std::shared_ptr<ArrayData>> arrays(schema->num_fields());
-  for (int i = 0; i < schema->num_fields(); ++i) {
+  ArrayLoaderContext context{source,
+                             dictionary_memo,
+                             /*buffer_index=*/0,
+                             /*field_index=*/0,
+                             options.max_recursion_depth,
+                             /*skip_io=*/false};
+
+  const int num_out_fields = field_indices == nullptr
+                                 ? schema->num_fields()
+                                 : static_cast<int>(field_indices->size());
+  std::vector<std::shared_ptr<ArrayData>> arrays(num_out_fields);
+  std::vector<std::shared_ptr<Field>> fields(num_out_fields);
+  for (int j = 0; j < num_out_fields; ++j) {
+    int i = j;
+    if (field_indices != nullptr) {
+      DCHECK_NE(field_positions, nullptr);
+      i = (*field_indices)[j];
+      if (i < 0 || i >= schema->num_fields()) {
+        return Status::Invalid("Field index ", i, " out of range for schema with ",
+                               schema->num_fields(), " fields");
+      }
+      context.field_index = (*field_positions)[i].field_index;
+      context.buffer_index = (*field_positions)[i].buffer_index;
+    }
     auto arr = std::make_shared<ArrayData>();
     RETURN_NOT_OK(LoadArray(*schema->field(i), &context, arr.get()));
     if (num_rows != arr->length) {
       return Status::IOError("Array length did not match record batch length");
     }
-    arrays[i] = std::move(arr);
+    arrays[j] = std::move(arr);
+    fields[j] = schema->field(i);
+  }
+
+  if (compression != Compression::UNCOMPRESSED) {
+    RETURN_NOT_OK(DecompressBodyBuffers(compression, options, &arrays));
   }
 
-  *out = RecordBatch::Make(schema, num_rows, std::move(arrays));
+  auto out_schema = field_indices == nullptr
+                        ? schema
+                        : ::arrow::schema(std::move(fields), schema->metadata());
+  *out = RecordBatch::Make(std::move(out_schema), num_rows, std::move(arrays));
   return Status::OK();
 }
 
 static inline Status ReadRecordBatch(const flatbuf::RecordBatch* metadata,
                                      const std::shared_ptr<Schema>& schema,
                                      const DictionaryMemo* dictionary_memo,
+                                     Compression::type compression,
                                      const IpcOptions& options,
                                      io::RandomAccessFile* file,
                                      std::shared_ptr<RecordBatch>* out) {
   IpcComponentSource source(metadata, file);
-  return LoadRecordBatchFromSource(schema, metadata->length(),
-                                   options.max_recursion_depth, &source, dictionary_memo,
-                                   out);
+  return LoadRecordBatchFromSource(schema, /*field_indices=*/nullptr,
+                                   /*field_positions=*/nullptr, metadata->length(),
+                                   compression, options, &source, dictionary_memo, out);
 }
 
 Status ReadRecordBatch(const Buffer& metadata, const std::shared_ptr<Schema>& schema,
@@ -409,7 +585,10 @@ Status ReadRecordBatch(const Buffer& metadata, const std::shared_ptr<Schema>& sc
     return Status::IOError(
         "Header-type of flatbuffer-encoded Message is not RecordBatch.");
   }
-  return ReadRecordBatch(batch, schema, dictionary_memo, options, file, out);
+  Compression::type compression;
+  RETURN_NOT_OK(internal::GetCompression(message, &compression));
+  return ReadRecordBatch(batch, schema, dictionary_memo, compression, options, file,
+                         out);
 }
 
 Status ReadDictionary(const Buffer& metadata, DictionaryMemo* dictionary_memo,
@@ -437,8 +616,10 @@ Status ReadDictionary(const Buffer& metadata, DictionaryMemo* dictionary_memo,
   std::shared_ptr<RecordBatch> batch;
   auto batch_meta = dictionary_batch->data();
   CHECK_FLATBUFFERS_NOT_NULL(batch_meta, "DictionaryBatch.data");
+  Compression::type compression;
+  RETURN_NOT_OK(internal::GetCompression(message, &compression));
   RETURN_NOT_OK(ReadRecordBatch(batch_meta, ::arrow::schema({value_field}),
-                                dictionary_memo, options, file, &batch));
+                                dictionary_memo, compression, options, file, &batch));
   if (batch->num_columns() != 1) {
     return Status::Invalid("Dictionary record batch must only contain one field");
   }
@@ -704,7 +885,41 @@ class RecordBatchFileReader::RecordBatchFileReaderImpl {
     return Status::OK();
   }
 
-  Status ReadRecordBatch(int i, std::shared_ptr<RecordBatch>* batch) {
+  // The metadata of a record batch, as read and verified once
+  struct RecordBatchMetadata {
+    // Holds the flatbuffer, without the message body
+    std::unique_ptr<Message> message;
+    const flatbuf::RecordBatch* batch;
+    Compression::type compression;
+  };
+
+  Status GetRecordBatchMetadata(int i, const RecordBatchMetadata** out) {
+    RecordBatchMetadata* metadata = &record_batch_metadata_[i];
+    if (metadata->message == nullptr) {
+      const FileBlock block = GetRecordBatchBlock(i);
+      if (!BitUtil::IsMultipleOf8(block.offset) ||
+          !BitUtil::IsMultipleOf8(block.metadata_length) ||
+          !BitUtil::IsMultipleOf8(block.body_length)) {
+        return Status::Invalid("Unaligned block in IPC file");
+      }
+      std::unique_ptr<Message> message;
+      RETURN_NOT_OK(
+          ReadMessageMetadata(block.offset, block.metadata_length, file_, &message));
+      CHECK_MESSAGE_TYPE(Message::RECORD_BATCH, message->type());
+
+      // Message::Open verified the flatbuffer
+      const flatbuf::Message* fb_message =
+          flatbuf::GetMessage(message->metadata()->data());
+      metadata->batch = fb_message->header_as_RecordBatch();
+      RETURN_NOT_OK(internal::GetCompression(fb_message, &metadata->compression));
+      metadata->message = std::move(message);
+    }
+    *out = metadata;
+    return Status::OK();
+  }
+
+  Status ReadRecordBatch(int i, const std::vector<int>* field_indices,
+                         std::shared_ptr<RecordBatch>* batch) {
     DCHECK_GE(i, 0);
     DCHECK_LT(i, num_record_batches());
 
@@ -713,13 +928,38 @@ class RecordBatchFileReader::RecordBatchFileReaderImpl {
       read_dictionaries_ = true;
     }
 
-    std::unique_ptr<Message> message;
-    RETURN_NOT_OK(ReadMessageFromBlock(GetRecordBatchBlock(i), &message));
+    const RecordBatchMetadata* metadata;
+    RETURN_NOT_OK(GetRecordBatchMetadata(i, &metadata));
+    const FileBlock block = GetRecordBatchBlock(i);
+    const int64_t body_offset = block.offset + block.metadata_length;
+    const auto options = IpcOptions::Defaults();
+
+    if (field_indices != nullptr) {
+      // Read the buffers of the selected fields only, each with its own read.
+      // Memory-mapped files return slices of the mapping without copying.
+      IpcComponentSource source(metadata->batch, file_, body_offset);
+      if (field_positions_.empty() && schema_->num_fields() > 0) {
+        RETURN_NOT_OK(GetFieldPositions(*schema_, options, &source, &dictionary_memo_,
+                                        &field_positions_));
+      }
+      return LoadRecordBatchFromSource(schema_, field_indices, &field_positions_,
+                                       metadata->batch->length(), metadata->compression,
+                                       options, &source, &dictionary_memo_, batch);
+    }
 
-    CHECK_HAS_BODY(*message);
-    ARROW_ASSIGN_OR_RAISE(auto reader, Buffer::GetReader(message->body()));
-    return ::arrow::ipc::ReadRecordBatch(*message->metadata(), schema_, &dictionary_memo_,
-                                         reader.get(), batch);
+    // Read the whole body at once, then slice the buffers out of it
+    const int64_t body_length = metadata->message->body_length();
+    ARROW_ASSIGN_OR_RAISE(auto body, file_->ReadAt(body_offset, body_length));
+    if (body->size() < body_length) {
+      return Status::IOError("Expected to be able to read ", body_length,
+                             " bytes for message body, got ", body->size());
+    }
+    io::BufferReader reader(body);
+    IpcComponentSource source(metadata->batch, &reader);
+    return LoadRecordBatchFromSource(
+        schema_, /*field_indices=*/nullptr, /*field_positions=*/nullptr,
+        metadata->batch->length(), metadata->compression, options, &source,
+        &dictionary_memo_, batch);
   }
 
   Status ReadSchema() {
@@ -736,6 +976,7 @@ class RecordBatchFileReader::RecordBatchFileReaderImpl {
     file_ = file;
     footer_offset_ = footer_offset;
     RETURN_NOT_OK(ReadFooter());
+    record_batch_metadata_.resize(num_record_batches());
     return ReadSchema();
   }
 
@@ -757,6 +998,13 @@ class RecordBatchFileReader::RecordBatchFileReaderImpl {
   bool read_dictionaries_ = false;
   DictionaryMemo dictionary_memo_;
 
+  // The metadata of the record batches read so far, by index
+  std::vector<RecordBatchMetadata> record_batch_metadata_;
+
+  // Where the metadata of each field starts in a record batch, computed on the
+  // first projected read
+  std::vector<FieldPosition> field_positions_;
+
   // Reconstructed schema, including any read dictionaries
   std::shared_ptr<Schema> schema_;
 };
@@ -802,7 +1050,13 @@ MetadataVersion RecordBatchFileReader::version() const { return impl_->version()
 
 Status RecordBatchFileReader::ReadRecordBatch(int i,
                                               std::shared_ptr<RecordBatch>* batch) {
-  return impl_->ReadRecordBatch(i, batch);
+  return impl_->ReadRecordBatch(i, /*field_indices=*/nullptr, batch);
+}
+
+Status RecordBatchFileReader::ReadRecordBatch(int i,
+                                              const std::vector<int>& field_indices,
+                                              std::shared_ptr<RecordBatch>* batch) {
+  return impl_->ReadRecordBatch(i, &field_indices, batch);
 }
 
 static Status ReadContiguousPayload(io::InputStream* file,
@@ -21,6 +21,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <vector>
 
 #include "arrow/ipc/dictionary.h"
 #include "arrow/ipc/message.h"
@@ -160,6 +161,22 @@ class ARROW_EXPORT RecordBatchFileReader {
   /// \return Status
   Status ReadRecordBatch(int i, std::shared_ptr<RecordBatch>* batch);
 
+  /// \brief Read some fields of a particular record batch from the file
+  ///
+  /// Only the buffers of the selected fields are read, so that the cost of
+  /// reading depends on the fields selected rather than on the size of the
+  /// batch. With a zero-copy input source such as io::MemoryMappedFile, the
+  /// buffers are slices of the file and no memory is copied. The metadata of
+  /// each record batch is read and verified once, then cached by the reader.
+  ///
+  /// \param[in] i the index of the record batch to return
+  /// \param[in] field_indices the indices in schema() of the fields to read,
+  /// in the order of the returned columns
+  /// \param[out] batch the read batch
+  /// \return Status
+  Status ReadRecordBatch(int i, const std::vector<int>& field_indices,
+                         std::shared_ptr<RecordBatch>* batch);
+
  private:
   RecordBatchFileReader();
 
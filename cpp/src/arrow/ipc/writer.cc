@@ -157,7 +157,7 @@ class RecordBatchSerializer : public ArrayVisitor {
   // Override this for writing dictionary metadata
   virtual Status SerializeMetadata(int64_t num_rows) {
     return WriteRecordBatchMessage(num_rows, out_->body_length, field_nodes_,
-                                   buffer_meta_, &out_->metadata);
+                                   buffer_meta_, options_.compression, &out_->metadata);
   }
 
   Status Assemble(const RecordBatch& batch) {
@@ -172,6 +172,11 @@ class RecordBatchSerializer : public ArrayVisitor {
       RETURN_NOT_OK(VisitArray(*batch.column(i)));
     }
 
+    const bool compressed = options_.compression != Compression::UNCOMPRESSED;
+    if (compressed) {
+      RETURN_NOT_OK(CompressBodyBuffers());
+    }
+
     // The position for the start of a buffer relative to the passed frame of
     // reference. May be 0 or some other position in an address space
     int64_t offset = buffer_start_offset_;
@@ -190,7 +195,9 @@ class RecordBatchSerializer : public ArrayVisitor {
         padding = BitUtil::RoundUpToMultipleOf8(size) - size;
       }
 
-      buffer_meta_.push_back({offset, size + padding});
+      // The codec needs the exact length of compressed data, so padding is
+      // left out of the length of compressed buffers
+      buffer_meta_.push_back({offset, compressed ? size : size + padding});
       offset += size + padding;
     }
 
@@ -206,6 +213,21 @@ class RecordBatchSerializer : public ArrayVisitor {
   }
 
  protected:
+  Status CompressBodyBuffers() {
+    std::vector<std::shared_ptr<Buffer>>& buffers = out_->body_buffers;
+    auto compress_buffer = [&](util::Codec* codec, int i) -> Status {
+      // Zero-length buffers, like the placeholders of absent validity
+      // bitmaps, are left as they are
+      if (buffers[i] && buffers[i]->size() > 0) {
+        ARROW_ASSIGN_OR_RAISE(buffers[i], CompressBodyBuffer(*buffers[i], codec, pool_));
+      }
+      return Status::OK();
+    };
+    return ParallelForWithCodec(options_.compression, options_.compression_level,
+                                options_.use_threads, static_cast<int>(buffers.size()),
+                                compress_buffer);
+  }
+
   template <typename ArrayType>
   Status VisitFixedWidth(const ArrayType& array) {
     std::shared_ptr<Buffer> data = array.values();
@@ -518,7 +540,8 @@ class DictionaryWriter : public RecordBatchSerializer {
 
   Status SerializeMetadata(int64_t num_rows) override {
     return WriteDictionaryMessage(dictionary_id_, num_rows, out_->body_length,
-                                  field_nodes_, buffer_meta_, &out_->metadata);
+                                  field_nodes_, buffer_meta_, options_.compression,
+                                  &out_->metadata);
   }
 
   Status Assemble(const std::shared_ptr<Array>& dictionary) {
@@ -1205,7 +1228,7 @@ Result<std::shared_ptr<RecordBatchWriter>> RecordBatchStreamWriter::Open(
   // ctor is private
   auto result = std::shared_ptr<RecordBatchStreamWriter>(new RecordBatchStreamWriter());
   result->impl_.reset(new RecordBatchStreamWriterImpl(sink, schema, options));
-  return std::move(result);
+  return result;
 }
 
 Result<std::shared_ptr<RecordBatchWriter>> RecordBatchStreamWriter::Open(
@@ -1233,7 +1256,7 @@ Result<std::shared_ptr<RecordBatchWriter>> RecordBatchFileWriter::Open(
   // ctor is private
   auto result = std::shared_ptr<RecordBatchFileWriter>(new RecordBatchFileWriter());
   result->file_impl_.reset(new RecordBatchFileWriterImpl(sink, schema, options));
-  return std::move(result);
+  return result;
 }
 
 Result<std::shared_ptr<RecordBatchWriter>> RecordBatchFileWriter::Open(
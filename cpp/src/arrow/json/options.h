@@ -38,6 +38,16 @@ enum class UnexpectedFieldBehavior : char {
   InferType
 };
 
+enum class ParserBackend : char {
+  /// Documents are parsed one at a time by rapidjson's SAX reader
+  RapidJSON,
+  /// EXPERIMENTAL: Blocks are first classified with SIMD instructions into an
+  /// index of structural characters, which is then walked to parse the
+  /// documents. It has not been shown to be faster than RapidJSON, compare
+  /// them with parser_benchmark before selecting it.
+  StructuralIndex
+};
+
 struct ARROW_EXPORT ParseOptions {
   // Parsing options
 
@@ -52,6 +62,10 @@ struct ARROW_EXPORT ParseOptions {
   /// How JSON fields outside of explicit_schema (if given) are treated
   UnexpectedFieldBehavior unexpected_field_behavior = UnexpectedFieldBehavior::InferType;
 
+  /// Which parser implementation is used. The readers use RapidJSON unless
+  /// told otherwise.
+  ParserBackend parser_backend = ParserBackend::RapidJSON;
+
   /// Create parsing options with default values
   static ParseOptions Defaults();
 };
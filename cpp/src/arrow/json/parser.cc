@@ -31,6 +31,7 @@
 #include "arrow/array.h"
 #include "arrow/buffer_builder.h"
 #include "arrow/builder.h"
+#include "arrow/json/structural_index_internal.h"
 #include "arrow/memory_pool.h"
 #include "arrow/type.h"
 #include "arrow/util/logging.h"
@@ -637,8 +638,11 @@ class HandlerBase : public BlockParser,
   }
   /// @}
 
-  /// \brief Set up builders using an expected Schema
-  Status Initialize(const std::shared_ptr<Schema>& s) {
+  /// \brief Set up builders using an expected Schema, and the parser backend
+  Status Initialize(const std::shared_ptr<Schema>& s, ParserBackend backend) {
+    if (backend == ParserBackend::StructuralIndex) {
+      structural_parser_ = make_unique<StructuralParser>();
+    }
     auto type = struct_({});
     if (s) {
       type = struct_(s->fields());
@@ -703,6 +707,9 @@ class HandlerBase : public BlockParser,
   template <typename Handler>
   Status DoParse(Handler& handler, const std::shared_ptr<Buffer>& json) {
     RETURN_NOT_OK(ReserveScalarStorage(json->size()));
+    if (structural_parser_) {
+      return structural_parser_->Parse(string_view(*json), &handler, &num_rows_);
+    }
     rj::MemoryStream ms(reinterpret_cast<const char*>(json->data()), json->size());
     using InputStream = rj::EncodedInputStream<rj::UTF8<>, rj::MemoryStream>;
     return DoParse(handler, InputStream(ms));
@@ -842,6 +849,8 @@ class HandlerBase : public BlockParser,
   // top of this stack == field_index_
   std::vector<int> field_index_stack_;
   StringBuilder scalar_values_builder_;
+  // null unless ParserBackend::StructuralIndex was requested
+  std::unique_ptr<StructuralParser> structural_parser_;
 };
 
 template <UnexpectedFieldBehavior>
@@ -1085,7 +1094,8 @@ Status BlockParser::Make(MemoryPool* pool, const ParseOptions& options,
       *out = make_unique<Handler<UnexpectedFieldBehavior::InferType>>(pool);
       break;
   }
-  return static_cast<HandlerBase&>(**out).Initialize(options.explicit_schema);
+  return static_cast<HandlerBase&>(**out).Initialize(options.explicit_schema,
+                                                     options.parser_backend);
 }
 
 Status BlockParser::Make(const ParseOptions& options, std::unique_ptr<BlockParser>* out) {
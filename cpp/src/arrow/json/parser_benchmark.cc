@@ -102,17 +102,49 @@ static void BenchmarkJSONParsing(benchmark::State& state,  // NOLINT non-const r
   state.SetBytesProcessed(state.iterations() * json->size());
 }
 
-static void ParseJSONBlockWithSchema(
-    benchmark::State& state) {  // NOLINT non-const reference
+static void BenchmarkParseJSONBlockWithSchema(
+    benchmark::State& state, ParserBackend backend) {  // NOLINT non-const reference
   const int32_t num_rows = 5000;
   auto options = ParseOptions::Defaults();
   options.unexpected_field_behavior = UnexpectedFieldBehavior::Error;
   options.explicit_schema = TestSchema();
+  options.parser_backend = backend;
 
   auto json = TestJsonData(num_rows);
   BenchmarkJSONParsing(state, std::make_shared<Buffer>(json), num_rows, options);
 }
 
+static void ParseJSONBlockWithSchema(
+    benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkParseJSONBlockWithSchema(state, ParserBackend::RapidJSON);
+}
+
+static void ParseJSONBlockWithSchemaStructuralIndex(
+    benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkParseJSONBlockWithSchema(state, ParserBackend::StructuralIndex);
+}
+
+static void BenchmarkParseJSONPrettyPrinted(
+    benchmark::State& state, ParserBackend backend) {  // NOLINT non-const reference
+  const int32_t num_rows = 5000;
+  auto options = ParseOptions::Defaults();
+  options.unexpected_field_behavior = UnexpectedFieldBehavior::InferType;
+  options.parser_backend = backend;
+
+  auto json = TestJsonData(num_rows, /* pretty */ true);
+  BenchmarkJSONParsing(state, std::make_shared<Buffer>(json), num_rows, options);
+}
+
+static void ParseJSONPrettyPrinted(
+    benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkParseJSONPrettyPrinted(state, ParserBackend::RapidJSON);
+}
+
+static void ParseJSONPrettyPrintedStructuralIndex(
+    benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkParseJSONPrettyPrinted(state, ParserBackend::StructuralIndex);
+}
+
 static void BenchmarkJSONReading(benchmark::State& state,  // NOLINT non-const reference
                                  const std::string& json, int32_t num_rows,
                                  ReadOptions read_options, ParseOptions parse_options) {
@@ -158,6 +190,9 @@ static void ReadJSONBlockWithSchemaMultiThread(
 BENCHMARK(ChunkJSONPrettyPrinted);
 BENCHMARK(ChunkJSONLineDelimited);
 BENCHMARK(ParseJSONBlockWithSchema);
+BENCHMARK(ParseJSONBlockWithSchemaStructuralIndex);
+BENCHMARK(ParseJSONPrettyPrinted);
+BENCHMARK(ParseJSONPrettyPrintedStructuralIndex);
 
 BENCHMARK(ReadJSONBlockWithSchemaSingleThread);
 BENCHMARK(ReadJSONBlockWithSchemaMultiThread)->UseRealTime();
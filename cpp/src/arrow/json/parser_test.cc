@@ -16,6 +16,7 @@
 // under the License.
 
 #include <string>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -24,6 +25,7 @@
 
 #include "arrow/json/options.h"
 #include "arrow/json/parser.h"
+#include "arrow/json/structural_index_internal.h"
 #include "arrow/json/test_common.h"
 #include "arrow/status.h"
 #include "arrow/testing/gtest_util.h"
@@ -94,11 +96,22 @@ void AssertParseColumns(ParseOptions options, string_view src_str,
 
 // TODO(bkietz) parameterize (at least some of) these tests over UnexpectedFieldBehavior
 
-TEST(BlockParserWithSchema, Basics) {
-  auto options = ParseOptions::Defaults();
-  options.explicit_schema =
-      schema({field("hello", float64()), field("world", boolean()), field("yo", utf8())});
-  options.unexpected_field_behavior = UnexpectedFieldBehavior::Ignore;
+// All parser tests run against each parser backend
+
+class BlockParserWithSchema : public ::testing::TestWithParam<ParserBackend> {
+ public:
+  ParseOptions Options(std::shared_ptr<Schema> explicit_schema) {
+    auto options = ParseOptions::Defaults();
+    options.explicit_schema = std::move(explicit_schema);
+    options.unexpected_field_behavior = UnexpectedFieldBehavior::Ignore;
+    options.parser_backend = GetParam();
+    return options;
+  }
+};
+
+TEST_P(BlockParserWithSchema, Basics) {
+  auto options = Options(schema(
+      {field("hello", float64()), field("world", boolean()), field("yo", utf8())}));
   AssertParseColumns(
       options, scalars_only_src(),
       {field("hello", utf8()), field("world", boolean()), field("yo", utf8())},
@@ -106,33 +119,53 @@ TEST(BlockParserWithSchema, Basics) {
        "[\"thing\", null, \"\xe5\xbf\x8d\", null]"});
 }
 
-TEST(BlockParserWithSchema, Empty) {
-  auto options = ParseOptions::Defaults();
-  options.explicit_schema =
-      schema({field("hello", float64()), field("world", boolean()), field("yo", utf8())});
-  options.unexpected_field_behavior = UnexpectedFieldBehavior::Ignore;
+TEST_P(BlockParserWithSchema, Empty) {
+  auto options = Options(schema(
+      {field("hello", float64()), field("world", boolean()), field("yo", utf8())}));
   AssertParseColumns(
       options, "",
       {field("hello", utf8()), field("world", boolean()), field("yo", utf8())},
       {"[]", "[]", "[]"});
 }
 
-TEST(BlockParserWithSchema, SkipFieldsOutsideSchema) {
-  auto options = ParseOptions::Defaults();
-  options.explicit_schema = schema({field("hello", float64()), field("yo", utf8())});
-  options.unexpected_field_behavior = UnexpectedFieldBehavior::Ignore;
+TEST_P(BlockParserWithSchema, SkipFieldsOutsideSchema) {
+  auto options = Options(schema({field("hello", float64()), field("yo", utf8())}));
   AssertParseColumns(options, scalars_only_src(),
                      {field("hello", utf8()), field("yo", utf8())},
                      {"[\"3.5\", \"3.25\", \"3.125\", \"0.0\"]",
                       "[\"thing\", null, \"\xe5\xbf\x8d\", null]"});
 }
 
-class BlockParserTypeError : public ::testing::TestWithParam<UnexpectedFieldBehavior> {
+TEST_P(BlockParserWithSchema, Nested) {
+  auto options = Options(schema({field("yo", utf8()), field("arr", list(int32())),
+                                 field("nuf", struct_({field("ps", int32())}))}));
+  AssertParseColumns(options, nested_src(),
+                     {field("yo", utf8()), field("arr", list(utf8())),
+                      field("nuf", struct_({field("ps", utf8())}))},
+                     {"[\"thing\", null, \"\xe5\xbf\x8d\", null]",
+                      R"([["1", "2", "3"], ["2"], [], null])",
+                      R"([{"ps":null}, null, {"ps":"78"}, {"ps":"90"}])"});
+}
+
+TEST_P(BlockParserWithSchema, FailOnIncompleteJson) {
+  auto options = Options(schema({field("a", int32())}));
+  std::shared_ptr<Array> parsed;
+  ASSERT_RAISES(Invalid, ParseFromString(options, "{\"a\":0, \"b\"", &parsed));
+}
+
+INSTANTIATE_TEST_CASE_P(BlockParserWithSchema, BlockParserWithSchema,
+                        ::testing::Values(ParserBackend::RapidJSON,
+                                          ParserBackend::StructuralIndex));
+
+class BlockParserTypeError
+    : public ::testing::TestWithParam<
+          std::tuple<ParserBackend, UnexpectedFieldBehavior>> {
  public:
   ParseOptions Options(std::shared_ptr<Schema> explicit_schema) {
     auto options = ParseOptions::Defaults();
     options.explicit_schema = std::move(explicit_schema);
-    options.unexpected_field_behavior = GetParam();
+    options.parser_backend = std::get<0>(GetParam());
+    options.unexpected_field_behavior = std::get<1>(GetParam());
     return options;
   }
 };
@@ -170,46 +203,34 @@ TEST_P(BlockParserTypeError, FailOnDuplicateKeys) {
       testing::StartsWith("JSON parse error: Column(/a) was specified twice in row 0"));
 }
 
-INSTANTIATE_TEST_CASE_P(BlockParserTypeError, BlockParserTypeError,
-                        ::testing::Values(UnexpectedFieldBehavior::Ignore,
-                                          UnexpectedFieldBehavior::Error,
-                                          UnexpectedFieldBehavior::InferType));
-
-TEST(BlockParserWithSchema, Nested) {
-  auto options = ParseOptions::Defaults();
-  options.explicit_schema = schema({field("yo", utf8()), field("arr", list(int32())),
-                                    field("nuf", struct_({field("ps", int32())}))});
-  options.unexpected_field_behavior = UnexpectedFieldBehavior::Ignore;
-  AssertParseColumns(options, nested_src(),
-                     {field("yo", utf8()), field("arr", list(utf8())),
-                      field("nuf", struct_({field("ps", utf8())}))},
-                     {"[\"thing\", null, \"\xe5\xbf\x8d\", null]",
-                      R"([["1", "2", "3"], ["2"], [], null])",
-                      R"([{"ps":null}, null, {"ps":"78"}, {"ps":"90"}])"});
-}
+INSTANTIATE_TEST_CASE_P(
+    BlockParserTypeError, BlockParserTypeError,
+    ::testing::Combine(::testing::Values(ParserBackend::RapidJSON,
+                                         ParserBackend::StructuralIndex),
+                       ::testing::Values(UnexpectedFieldBehavior::Ignore,
+                                         UnexpectedFieldBehavior::Error,
+                                         UnexpectedFieldBehavior::InferType)));
 
-TEST(BlockParserWithSchema, FailOnIncompleteJson) {
-  auto options = ParseOptions::Defaults();
-  options.explicit_schema = schema({field("a", int32())});
-  options.unexpected_field_behavior = UnexpectedFieldBehavior::Ignore;
-  std::shared_ptr<Array> parsed;
-  ASSERT_RAISES(Invalid, ParseFromString(options, "{\"a\":0, \"b\"", &parsed));
-}
+class BlockParserBackend : public ::testing::TestWithParam<ParserBackend> {
+ public:
+  ParseOptions Options() {
+    auto options = ParseOptions::Defaults();
+    options.unexpected_field_behavior = UnexpectedFieldBehavior::InferType;
+    options.parser_backend = GetParam();
+    return options;
+  }
+};
 
-TEST(BlockParser, Basics) {
-  auto options = ParseOptions::Defaults();
-  options.unexpected_field_behavior = UnexpectedFieldBehavior::InferType;
+TEST_P(BlockParserBackend, Basics) {
   AssertParseColumns(
-      options, scalars_only_src(),
+      Options(), scalars_only_src(),
       {field("hello", utf8()), field("world", boolean()), field("yo", utf8())},
       {"[\"3.5\", \"3.25\", \"3.125\", \"0.0\"]", "[false, null, null, true]",
        "[\"thing\", null, \"\xe5\xbf\x8d\", null]"});
 }
 
-TEST(BlockParser, Nested) {
-  auto options = ParseOptions::Defaults();
-  options.unexpected_field_behavior = UnexpectedFieldBehavior::InferType;
-  AssertParseColumns(options, nested_src(),
+TEST_P(BlockParserBackend, Nested) {
+  AssertParseColumns(Options(), nested_src(),
                      {field("yo", utf8()), field("arr", list(utf8())),
                       field("nuf", struct_({field("ps", utf8())}))},
                      {"[\"thing\", null, \"\xe5\xbf\x8d\", null]",
@@ -217,11 +238,20 @@ TEST(BlockParser, Nested) {
                       R"([{"ps":null}, null, {"ps":"78"}, {"ps":"90"}])"});
 }
 
-TEST(BlockParser, AdHoc) {
-  auto options = ParseOptions::Defaults();
-  options.unexpected_field_behavior = UnexpectedFieldBehavior::InferType;
+TEST_P(BlockParserBackend, NestedAllFields) {
+  AssertParseColumns(Options(), nested_src(),
+                     {field("hello", utf8()), field("yo", utf8()),
+                      field("arr", list(utf8())),
+                      field("nuf", struct_({field("ps", utf8())}))},
+                     {R"(["3.5", "3.25", "3.125", "0.0"])",
+                      "[\"thing\", null, \"\xe5\xbf\x8d\", null]",
+                      R"([["1", "2", "3"], ["2"], [], null])",
+                      R"([{"ps":null}, null, {"ps":"78"}, {"ps":"90"}])"});
+}
+
+TEST_P(BlockParserBackend, AdHoc) {
   AssertParseColumns(
-      options, R"({"a": [1], "b": {"c": true, "d": "1991-02-03"}}
+      Options(), R"({"a": [1], "b": {"c": true, "d": "1991-02-03"}}
 {"a": [], "b": {"c": false, "d": "2019-04-01"}}
 )",
       {field("a", list(utf8())),
@@ -230,5 +260,69 @@ TEST(BlockParser, AdHoc) {
        R"([{"c":true, "d": "1991-02-03"}, {"c":false, "d":"2019-04-01"}])"});
 }
 
+TEST_P(BlockParserBackend, StringEscapes) {
+  AssertParseColumns(
+      Options(), R"({"a": "\"\\\/\b\f\n\r\t", "b": "\u00e9\ud83d\ude00"}
+{"a": "[{\":,}]", "b": "\\"}
+)",
+      {field("a", utf8()), field("b", utf8())},
+      {R"(["\"\\/\b\f\n\r\t", "[{\":,}]"])", "[\"\xc3\xa9\xf0\x9f\x98\x80\", \"\\\\\"]"});
+}
+
+TEST_P(BlockParserBackend, NumbersAsStrings) {
+  AssertParseColumns(Options(), R"({"a": -0.5e+10, "b": NaN, "c": -Infinity}
+{"a": 0, "b": 1E-3, "c": 12}
+)",
+                     {field("a", utf8()), field("b", utf8()), field("c", utf8())},
+                     {R"(["-0.5e+10", "0"])", R"(["NaN", "1E-3"])",
+                      R"(["-Infinity", "12"])"});
+}
+
+TEST_P(BlockParserBackend, LongValues) {
+  // Strings and runs of backslashes crossing 64-byte boundaries
+  std::string json, expected = "[";
+  for (int length = 0; length < 200; length += 7) {
+    std::string value(length, 'x');
+    value += std::string(length % 5, '\\');
+    std::string escaped;
+    for (char c : value) {
+      escaped += c == '\\' ? "\\\\" : std::string(1, c);
+    }
+    json += "{\"a\": \"" + escaped + "\", \"b\": [" + std::to_string(length) + "]}\n";
+    expected += (length == 0 ? "\"" : ", \"") + escaped + "\"";
+  }
+  expected += "]";
+  std::shared_ptr<Array> parsed;
+  ASSERT_OK(ParseFromString(Options(), json, &parsed));
+  auto column = std::static_pointer_cast<StructArray>(parsed)->GetFieldByName("a");
+  AssertUnconvertedArraysEqual(*ArrayFromJSON(utf8(), expected), *column);
+}
+
+TEST_P(BlockParserBackend, FailOnMalformed) {
+  for (auto json :
+       {"{\"a\":0, \"b\"", "{\"a\" 0}", "{\"a\":0 \"b\":1}", "{\"a\":[0 1]}",
+        "{\"a\":01}", "{\"a\":1.}", "{\"a\":tru}", "{\"a\":\"b}", "{\"a\":\"\\x\"}",
+        "{\"a\":\"\\ud800\"}", "{\"a\":0,}", "{\"a\":[0,]}", "{\"a\":\"b\"c}"}) {
+    SCOPED_TRACE(json);
+    std::shared_ptr<Array> parsed;
+    ASSERT_RAISES(Invalid, ParseFromString(Options(), json, &parsed));
+  }
+}
+
+INSTANTIATE_TEST_CASE_P(BlockParserBackend, BlockParserBackend,
+                        ::testing::Values(ParserBackend::RapidJSON,
+                                          ParserBackend::StructuralIndex));
+
+TEST(StructuralIndex, Basics) {
+  StructuralIndex index;
+  // Operators and the first byte of each scalar, outside strings
+  ASSERT_OK(index.Build(R"( {"a{\":": [12, true, "x\\"]} )"));
+  std::vector<uint32_t> expected = {1, 2, 9, 11, 12, 14, 16, 20, 22, 27, 28};
+  ASSERT_EQ(index.positions(), expected);
+
+  ASSERT_OK(index.Build(""));
+  ASSERT_TRUE(index.positions().empty());
+}
+
 }  // namespace json
 }  // namespace arrow
@@ -17,6 +17,8 @@
 
 #include "arrow/json/reader.h"
 
+#include <deque>
+#include <future>
 #include <utility>
 #include <vector>
 
@@ -29,6 +31,7 @@
 #include "arrow/json/parser.h"
 #include "arrow/record_batch.h"
 #include "arrow/table.h"
+#include "arrow/type.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/string_view.h"
@@ -45,6 +48,139 @@ using internal::ThreadPool;
 
 namespace json {
 
+namespace {
+
+// The JSON objects of a block of input, some of them straddling the previous block
+struct JSONBlock {
+  std::shared_ptr<Buffer> partial;
+  std::shared_ptr<Buffer> completion;
+  std::shared_ptr<Buffer> whole;
+  int64_t block_index;
+};
+
+// Split a stream of input blocks into JSONBlocks
+class BlockSplitter {
+ public:
+  BlockSplitter(const ParseOptions& parse_options,
+                Iterator<std::shared_ptr<Buffer>> block_iterator)
+      : chunker_(MakeChunker(parse_options)),
+        block_iterator_(std::move(block_iterator)),
+        partial_(std::make_shared<Buffer>("")) {}
+
+  // Return false at end of input
+  Result<bool> Next(JSONBlock* out) {
+    if (block_index_ == 0) {
+      ARROW_ASSIGN_OR_RAISE(block_, block_iterator_.Next());
+    }
+    if (block_ == nullptr) {
+      return false;
+    }
+
+    std::shared_ptr<Buffer> next_block, whole, completion, next_partial;
+    ARROW_ASSIGN_OR_RAISE(next_block, block_iterator_.Next());
+
+    if (next_block == nullptr) {
+      // End of file reached => compute completion from penultimate block
+      RETURN_NOT_OK(chunker_->ProcessFinal(partial_, block_, &completion, &whole));
+    } else {
+      std::shared_ptr<Buffer> starts_with_whole;
+      // Get completion of partial from previous block.
+      RETURN_NOT_OK(chunker_->ProcessWithPartial(partial_, block_, &completion,
+                                                 &starts_with_whole));
+
+      // Get all whole objects entirely inside the current buffer
+      RETURN_NOT_OK(chunker_->Process(starts_with_whole, &whole, &next_partial));
+    }
+
+    *out = JSONBlock{partial_, completion, whole, block_index_++};
+    partial_ = std::move(next_partial);
+    block_ = std::move(next_block);
+    return true;
+  }
+
+ private:
+  std::unique_ptr<Chunker> chunker_;
+  Iterator<std::shared_ptr<Buffer>> block_iterator_;
+  std::shared_ptr<Buffer> block_;
+  std::shared_ptr<Buffer> partial_;
+  int64_t block_index_ = 0;
+};
+
+Status MakeBlockIterator(const std::shared_ptr<io::InputStream>& input,
+                         const ReadOptions& read_options, int readahead,
+                         Iterator<std::shared_ptr<Buffer>>* out) {
+  ARROW_ASSIGN_OR_RAISE(auto it,
+                        io::MakeInputStreamIterator(input, read_options.block_size));
+  return MakeReadaheadIterator(std::move(it), readahead).Value(out);
+}
+
+// Parse a block into an unconverted StructArray (see BlockParser)
+Status ParseBlock(MemoryPool* pool, const ParseOptions& parse_options,
+                  const JSONBlock& block, std::shared_ptr<Array>* out) {
+  const auto& partial = block.partial;
+  const auto& completion = block.completion;
+  const auto& whole = block.whole;
+
+  std::unique_ptr<BlockParser> parser;
+  RETURN_NOT_OK(BlockParser::Make(pool, parse_options, &parser));
+  RETURN_NOT_OK(parser->ReserveScalarStorage(partial->size() + completion->size() +
+                                             whole->size()));
+
+  if (partial->size() != 0 || completion->size() != 0) {
+    std::shared_ptr<Buffer> straddling;
+    if (partial->size() == 0) {
+      straddling = completion;
+    } else if (completion->size() == 0) {
+      straddling = partial;
+    } else {
+      RETURN_NOT_OK(ConcatenateBuffers({partial, completion}, pool, &straddling));
+    }
+    RETURN_NOT_OK(parser->Parse(straddling));
+  }
+
+  if (whole->size() != 0) {
+    RETURN_NOT_OK(parser->Parse(whole));
+  }
+
+  return parser->Finish(out);
+}
+
+// The promotion graph to use if unexpected fields are type-inferred, null otherwise
+const PromotionGraph* OptionalPromotionGraph(const ParseOptions& parse_options) {
+  return parse_options.unexpected_field_behavior == UnexpectedFieldBehavior::InferType
+             ? GetPromotionGraph()
+             : nullptr;
+}
+
+// Convert a parsed block to a RecordBatch, starting from the fields of `base_schema`
+//
+// If unexpected fields are type-inferred, the resulting schema may have additional
+// or promoted fields.
+Status ConvertBlock(MemoryPool* pool, const ParseOptions& parse_options,
+                    const std::shared_ptr<Schema>& base_schema,
+                    const std::shared_ptr<Array>& parsed,
+                    std::shared_ptr<RecordBatch>* out) {
+  std::shared_ptr<ChunkedArrayBuilder> builder;
+  RETURN_NOT_OK(MakeChunkedArrayBuilder(TaskGroup::MakeSerial(), pool,
+                                        OptionalPromotionGraph(parse_options),
+                                        struct_(base_schema->fields()), &builder));
+
+  builder->Insert(0, field("", parsed->type()), parsed);
+  std::shared_ptr<ChunkedArray> converted_chunked;
+  RETURN_NOT_OK(builder->Finish(&converted_chunked));
+  auto converted = static_cast<const StructArray*>(converted_chunked->chunk(0).get());
+
+  std::vector<std::shared_ptr<Array>> columns(converted->num_fields());
+  for (int i = 0; i < converted->num_fields(); ++i) {
+    columns[i] = converted->field(i);
+  }
+  *out = RecordBatch::Make(schema(converted->type()->children()), converted->length(),
+                           std::move(columns));
+  return Status::OK();
+}
+
+}  // namespace
+
 class TableReaderImpl : public TableReader,
                         public std::enable_shared_from_this<TableReaderImpl> {
  public:
@@ -54,56 +190,30 @@ class TableReaderImpl : public TableReader,
       : pool_(pool),
         read_options_(read_options),
         parse_options_(parse_options),
-        chunker_(MakeChunker(parse_options_)),
         task_group_(std::move(task_group)) {}
 
   Status Init(std::shared_ptr<io::InputStream> input) {
-    ARROW_ASSIGN_OR_RAISE(auto it,
-                          io::MakeInputStreamIterator(input, read_options_.block_size));
-    return MakeReadaheadIterator(std::move(it), task_group_->parallelism())
-        .Value(&block_iterator_);
+    Iterator<std::shared_ptr<Buffer>> block_iterator;
+    RETURN_NOT_OK(MakeBlockIterator(input, read_options_, task_group_->parallelism(),
+                                    &block_iterator));
+    splitter_.reset(new BlockSplitter(parse_options_, std::move(block_iterator)));
+    return Status::OK();
   }
 
   Status Read(std::shared_ptr<Table>* out) override {
     RETURN_NOT_OK(MakeBuilder());
 
-    ARROW_ASSIGN_OR_RAISE(auto block, block_iterator_.Next());
-    if (block == nullptr) {
+    JSONBlock block;
+    ARROW_ASSIGN_OR_RAISE(bool have_block, splitter_->Next(&block));
+    if (!have_block) {
       return Status::Invalid("Empty JSON file");
     }
 
     auto self = shared_from_this();
-    auto empty = std::make_shared<Buffer>("");
-
-    int64_t block_index = 0;
-    std::shared_ptr<Buffer> partial = empty;
-
-    while (block != nullptr) {
-      std::shared_ptr<Buffer> next_block, whole, completion, next_partial;
-
-      ARROW_ASSIGN_OR_RAISE(next_block, block_iterator_.Next());
-
-      if (next_block == nullptr) {
-        // End of file reached => compute completion from penultimate block
-        RETURN_NOT_OK(chunker_->ProcessFinal(partial, block, &completion, &whole));
-      } else {
-        std::shared_ptr<Buffer> starts_with_whole;
-        // Get completion of partial from previous block.
-        RETURN_NOT_OK(chunker_->ProcessWithPartial(partial, block, &completion,
-                                                   &starts_with_whole));
-
-        // Get all whole objects entirely inside the current buffer
-        RETURN_NOT_OK(chunker_->Process(starts_with_whole, &whole, &next_partial));
-      }
-
+    while (have_block) {
       // Launch parse task
-      task_group_->Append([self, partial, completion, whole, block_index] {
-        return self->ParseAndInsert(partial, completion, whole, block_index);
-      });
-      block_index++;
-
-      partial = next_partial;
-      block = next_block;
+      task_group_->Append([self, block] { return self->ParseAndInsert(block); });
+      ARROW_ASSIGN_OR_RAISE(have_block, splitter_->Next(&block));
     }
 
     std::shared_ptr<ChunkedArray> array;
@@ -117,51 +227,180 @@ class TableReaderImpl : public TableReader,
                     ? struct_(parse_options_.explicit_schema->fields())
                     : struct_({});
 
-    auto promotion_graph =
-        parse_options_.unexpected_field_behavior == UnexpectedFieldBehavior::InferType
-            ? GetPromotionGraph()
-            : nullptr;
+    return MakeChunkedArrayBuilder(task_group_, pool_,
+                                   OptionalPromotionGraph(parse_options_), type,
+                                   &builder_);
+  }
+
+  Status ParseAndInsert(const JSONBlock& block) {
+    std::shared_ptr<Array> parsed;
+    RETURN_NOT_OK(ParseBlock(pool_, parse_options_, block, &parsed));
+    builder_->Insert(block.block_index, field("", parsed->type()), parsed);
+    return Status::OK();
+  }
+
+  MemoryPool* pool_;
+  ReadOptions read_options_;
+  ParseOptions parse_options_;
+  std::shared_ptr<TaskGroup> task_group_;
+  std::unique_ptr<BlockSplitter> splitter_;
+  std::shared_ptr<ChunkedArrayBuilder> builder_;
+};
+
+class StreamingReaderImpl : public StreamingReader {
+ public:
+  // `thread_pool` is null for serial reading
+  StreamingReaderImpl(MemoryPool* pool, const ReadOptions& read_options,
+                      const ParseOptions& parse_options, ThreadPool* thread_pool)
+      : pool_(pool),
+        read_options_(read_options),
+        parse_options_(parse_options),
+        thread_pool_(thread_pool),
+        schema_(parse_options_.explicit_schema ? parse_options_.explicit_schema
+                                               : ::arrow::schema({})) {}
+
+  ~StreamingReaderImpl() override {
+    // Tasks refer to this reader, make sure they are finished before destroying it
+    for (auto& future : pending_blocks_) {
+      future.wait();
+    }
+  }
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
 
-    return MakeChunkedArrayBuilder(task_group_, pool_, promotion_graph, type, &builder_);
+  // Read the first block, to infer the initial schema
+  Status Init(std::shared_ptr<io::InputStream> input) {
+    max_blocks_in_flight_ = thread_pool_ ? thread_pool_->GetCapacity() : 1;
+    Iterator<std::shared_ptr<Buffer>> block_iterator;
+    RETURN_NOT_OK(
+        MakeBlockIterator(input, read_options_, max_blocks_in_flight_, &block_iterator));
+    splitter_.reset(new BlockSplitter(parse_options_, std::move(block_iterator)));
+
+    JSONBlock block;
+    ARROW_ASSIGN_OR_RAISE(bool have_block, splitter_->Next(&block));
+    if (!have_block) {
+      return Status::Invalid("Empty JSON file");
+    }
+    DecodedBlock decoded;
+    RETURN_NOT_OK(Decode(block, schema_, &decoded));
+    return Accept(std::move(decoded), &first_batch_);
   }
 
-  Status ParseAndInsert(const std::shared_ptr<Buffer>& partial,
-                        const std::shared_ptr<Buffer>& completion,
-                        const std::shared_ptr<Buffer>& whole, int64_t block_index) {
-    std::unique_ptr<BlockParser> parser;
-    RETURN_NOT_OK(BlockParser::Make(pool_, parse_options_, &parser));
-    RETURN_NOT_OK(parser->ReserveScalarStorage(partial->size() + completion->size() +
-                                               whole->size()));
-
-    if (partial->size() != 0 || completion->size() != 0) {
-      std::shared_ptr<Buffer> straddling;
-      if (partial->size() == 0) {
-        straddling = completion;
-      } else if (completion->size() == 0) {
-        straddling = partial;
+  Status ReadNext(std::shared_ptr<RecordBatch>* batch) override {
+    if (first_batch_ != nullptr) {
+      *batch = std::move(first_batch_);
+      if ((*batch)->num_rows() > 0) {
+        return Status::OK();
+      }
+    }
+    while (true) {
+      DecodedBlock decoded;
+      if (thread_pool_) {
+        RETURN_NOT_OK(ScheduleBlocks());
+        if (pending_blocks_.empty()) {
+          batch->reset();
+          return Status::OK();
+        }
+        auto future = std::move(pending_blocks_.front());
+        pending_blocks_.pop_front();
+        RETURN_NOT_OK(future.get().Value(&decoded));
       } else {
-        RETURN_NOT_OK(ConcatenateBuffers({partial, completion}, pool_, &straddling));
+        JSONBlock block;
+        ARROW_ASSIGN_OR_RAISE(bool have_block, splitter_->Next(&block));
+        if (!have_block) {
+          batch->reset();
+          return Status::OK();
+        }
+        RETURN_NOT_OK(Decode(block, schema_, &decoded));
+      }
+      RETURN_NOT_OK(Accept(std::move(decoded), batch));
+      // Blocks without a whole object yield no rows
+      if ((*batch)->num_rows() > 0) {
+        return Status::OK();
       }
-      RETURN_NOT_OK(parser->Parse(straddling));
     }
+  }
+
+ protected:
+  struct DecodedBlock {
+    // The schema the block was converted from
+    std::shared_ptr<Schema> base_schema;
+    std::shared_ptr<Array> parsed;
+    Status convert_status;
+    std::shared_ptr<RecordBatch> batch;
+  };
+
+  // Parse a block and convert it from `base_schema`.  A conversion error is only
+  // reported once the block is accepted, as it may be fixed by a schema change.
+  Status Decode(const JSONBlock& block, std::shared_ptr<Schema> base_schema,
+                DecodedBlock* out) {
+    out->base_schema = std::move(base_schema);
+    RETURN_NOT_OK(ParseBlock(pool_, parse_options_, block, &out->parsed));
+    out->convert_status =
+        ConvertBlock(pool_, parse_options_, out->base_schema, out->parsed, &out->batch);
+    return Status::OK();
+  }
 
-    if (whole->size() != 0) {
-      RETURN_NOT_OK(parser->Parse(whole));
+  // Take a decoded block as the next batch, in block order, and unify the schema
+  Status Accept(DecodedBlock decoded, std::shared_ptr<RecordBatch>* out) {
+    if (decoded.base_schema != schema_) {
+      // The schema changed since the block was converted: convert it again,
+      // so as to extend the current schema rather than an earlier one
+      decoded.convert_status =
+          ConvertBlock(pool_, parse_options_, schema_, decoded.parsed, &decoded.batch);
     }
+    RETURN_NOT_OK(decoded.convert_status);
+    if (!decoded.batch->schema()->Equals(*schema_, /*check_metadata=*/false)) {
+      schema_ = decoded.batch->schema();
+    } else {
+      // Make the batch share the current schema, so that blocks in flight
+      // need not be converted again
+      std::vector<std::shared_ptr<Array>> columns(decoded.batch->num_columns());
+      for (int i = 0; i < decoded.batch->num_columns(); ++i) {
+        columns[i] = decoded.batch->column(i);
+      }
+      decoded.batch =
+          RecordBatch::Make(schema_, decoded.batch->num_rows(), std::move(columns));
+    }
+    *out = std::move(decoded.batch);
+    return Status::OK();
+  }
 
-    std::shared_ptr<Array> parsed;
-    RETURN_NOT_OK(parser->Finish(&parsed));
-    builder_->Insert(block_index, field("", parsed->type()), parsed);
+  // Keep up to max_blocks_in_flight_ blocks parsing and converting
+  Status ScheduleBlocks() {
+    while (!eof_ && static_cast<int>(pending_blocks_.size()) < max_blocks_in_flight_) {
+      JSONBlock block;
+      ARROW_ASSIGN_OR_RAISE(bool have_block, splitter_->Next(&block));
+      if (!have_block) {
+        eof_ = true;
+        break;
+      }
+      auto base_schema = schema_;
+      ARROW_ASSIGN_OR_RAISE(
+          auto future,
+          thread_pool_->Submit([this, block, base_schema]() -> Result<DecodedBlock> {
+            DecodedBlock decoded;
+            RETURN_NOT_OK(Decode(block, base_schema, &decoded));
+            return decoded;
+          }));
+      pending_blocks_.push_back(std::move(future));
+    }
     return Status::OK();
   }
 
   MemoryPool* pool_;
   ReadOptions read_options_;
   ParseOptions parse_options_;
-  std::unique_ptr<Chunker> chunker_;
-  std::shared_ptr<TaskGroup> task_group_;
-  Iterator<std::shared_ptr<Buffer>> block_iterator_;
-  std::shared_ptr<ChunkedArrayBuilder> builder_;
+  ThreadPool* thread_pool_;
+  int32_t max_blocks_in_flight_ = 1;
+  bool eof_ = false;
+
+  std::unique_ptr<BlockSplitter> splitter_;
+  // The schema unified over the batches accepted so far
+  std::shared_ptr<Schema> schema_;
+  std::shared_ptr<RecordBatch> first_batch_;
+  // Blocks being decoded on the thread pool, in block order
+  std::deque<std::future<Result<DecodedBlock>>> pending_blocks_;
 };
 
 Status TableReader::Make(MemoryPool* pool, std::shared_ptr<io::InputStream> input,
@@ -181,6 +420,18 @@ Status TableReader::Make(MemoryPool* pool, std::shared_ptr<io::InputStream> inpu
   return Status::OK();
 }
 
+Status StreamingReader::Make(MemoryPool* pool, std::shared_ptr<io::InputStream> input,
+                             const ReadOptions& read_options,
+                             const ParseOptions& parse_options,
+                             std::shared_ptr<StreamingReader>* out) {
+  auto thread_pool = read_options.use_threads ? GetCpuThreadPool() : nullptr;
+  auto ptr = std::make_shared<StreamingReaderImpl>(pool, read_options, parse_options,
+                                                   thread_pool);
+  RETURN_NOT_OK(ptr->Init(input));
+  *out = std::move(ptr);
+  return Status::OK();
+}
+
 Status ParseOne(ParseOptions options, std::shared_ptr<Buffer> json,
                 std::shared_ptr<RecordBatch>* out) {
   std::unique_ptr<BlockParser> parser;
@@ -189,29 +440,8 @@ Status ParseOne(ParseOptions options, std::shared_ptr<Buffer> json,
   std::shared_ptr<Array> parsed;
   RETURN_NOT_OK(parser->Finish(&parsed));
 
-  auto type =
-      options.explicit_schema ? struct_(options.explicit_schema->fields()) : struct_({});
-  auto promotion_graph =
-      options.unexpected_field_behavior == UnexpectedFieldBehavior::InferType
-          ? GetPromotionGraph()
-          : nullptr;
-  std::shared_ptr<ChunkedArrayBuilder> builder;
-  RETURN_NOT_OK(MakeChunkedArrayBuilder(internal::TaskGroup::MakeSerial(),
-                                        default_memory_pool(), promotion_graph, type,
-                                        &builder));
-
-  builder->Insert(0, field("", type), parsed);
-  std::shared_ptr<ChunkedArray> converted_chunked;
-  RETURN_NOT_OK(builder->Finish(&converted_chunked));
-  auto converted = static_cast<const StructArray*>(converted_chunked->chunk(0).get());
-
-  std::vector<std::shared_ptr<Array>> columns(converted->num_fields());
-  for (int i = 0; i < converted->num_fields(); ++i) {
-    columns[i] = converted->field(i);
-  }
-  *out = RecordBatch::Make(schema(converted->type()->children()), converted->length(),
-                           std::move(columns));
-  return Status::OK();
+  auto base_schema = options.explicit_schema ? options.explicit_schema : schema({});
+  return ConvertBlock(default_memory_pool(), options, base_schema, parsed, out);
 }
 
 }  // namespace json
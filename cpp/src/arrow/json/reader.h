@@ -20,6 +20,7 @@
 #include <memory>
 
 #include "arrow/json/options.h"
+#include "arrow/record_batch.h"
 #include "arrow/status.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/visibility.h"
@@ -55,6 +56,36 @@ class ARROW_EXPORT TableReader {
                      std::shared_ptr<TableReader>* out);
 };
 
+/// \brief A class that reads a JSON file incrementally, as record batches
+///
+/// The file is expected to consist of individual line-separated JSON objects.
+/// Each batch holds the objects of one block of input (see
+/// ReadOptions::block_size), so that unbounded streams can be consumed.
+///
+/// If ParseOptions::unexpected_field_behavior is InferType, the schema evolves
+/// as the stream is read: fields that first appear in a later block are
+/// appended, and fields whose values do not fit the type inferred so far are
+/// promoted (for example from null to any type, or from int64 to double).
+/// Batches already returned are left as is, so consecutive batches may have
+/// different schemas; schema() is the schema unified over the batches read so
+/// far, and any later batch's schema extends or promotes it.
+///
+/// If ReadOptions::use_threads is true, blocks are parsed and converted in
+/// parallel on the CPU thread pool, with at most as many blocks in flight as
+/// the pool has threads.  A block converted before a schema change in a
+/// preceding block is converted again from its parsed representation.
+class ARROW_EXPORT StreamingReader : public RecordBatchReader {
+ public:
+  virtual ~StreamingReader() = default;
+
+  /// Create a StreamingReader instance
+  ///
+  /// This reads the first block, so that schema() is available.
+  static Status Make(MemoryPool* pool, std::shared_ptr<io::InputStream> input,
+                     const ReadOptions&, const ParseOptions&,
+                     std::shared_ptr<StreamingReader>* out);
+};
+
 ARROW_EXPORT Status ParseOne(ParseOptions options, std::shared_ptr<Buffer> json,
                              std::shared_ptr<RecordBatch>* out);
 
@@ -288,5 +288,104 @@ TEST(ReaderTest, ListArrayWithFewValues) {
   AssertTablesEqual(*actual_table, *expected_table);
 }
 
+class StreamingReaderTest : public ::testing::TestWithParam<bool> {
+ public:
+  void SetUp() override {
+    read_options_.use_threads = GetParam();
+    parse_options_.unexpected_field_behavior = UnexpectedFieldBehavior::InferType;
+  }
+
+  Status MakeReader(util::string_view input) {
+    std::shared_ptr<io::InputStream> stream;
+    RETURN_NOT_OK(MakeStream(input, &stream));
+    return StreamingReader::Make(default_memory_pool(), stream, read_options_,
+                                 parse_options_, &reader_);
+  }
+
+  ParseOptions parse_options_ = ParseOptions::Defaults();
+  ReadOptions read_options_ = ReadOptions::Defaults();
+  std::shared_ptr<StreamingReader> reader_;
+};
+
+INSTANTIATE_TEST_CASE_P(StreamingReaderTest, StreamingReaderTest,
+                        ::testing::Values(false, true));
+
+TEST_P(StreamingReaderTest, Basics) {
+  std::string json;
+  for (int i = 0; i < 1000; ++i) {
+    json += "{\"a\":" + std::to_string(i) + ",\"b\":\"s" + std::to_string(i % 7) +
+            "\"}\n";
+  }
+  read_options_.block_size = 1000;
+  ASSERT_OK(MakeReader(json));
+  AssertSchemaEqual(*schema({field("a", int64()), field("b", utf8())}),
+                    *reader_->schema());
+
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  ASSERT_OK(reader_->ReadAll(&batches));
+  // One batch per block
+  ASSERT_GT(batches.size(), 10);
+  for (const auto& batch : batches) {
+    ASSERT_OK(batch->ValidateFull());
+    ASSERT_GT(batch->num_rows(), 0);
+  }
+  // End of stream is sticky
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(reader_->ReadNext(&batch));
+  ASSERT_EQ(batch, nullptr);
+
+  std::shared_ptr<io::InputStream> stream;
+  ASSERT_OK(MakeStream(json, &stream));
+  std::shared_ptr<TableReader> table_reader;
+  ASSERT_OK(TableReader::Make(default_memory_pool(), stream, read_options_,
+                              parse_options_, &table_reader));
+  std::shared_ptr<Table> expected, actual;
+  ASSERT_OK(table_reader->Read(&expected));
+  ASSERT_OK(Table::FromRecordBatches(batches, &actual));
+  AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+}
+
+TEST_P(StreamingReaderTest, SchemaEvolution) {
+  std::string json;
+  for (int i = 0; i < 50; ++i) {
+    json += "{\"a\":1,\"c\":null}\n";
+  }
+  for (int i = 0; i < 50; ++i) {
+    json += "{\"a\":2.5,\"b\":true,\"c\":\"x\"}\n";
+  }
+  read_options_.block_size = 64;
+  ASSERT_OK(MakeReader(json));
+  AssertSchemaEqual(*schema({field("a", int64()), field("c", null())}),
+                    *reader_->schema());
+
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  ASSERT_OK(reader_->ReadAll(&batches));
+  int64_t num_rows = 0;
+  for (const auto& batch : batches) {
+    ASSERT_OK(batch->ValidateFull());
+    num_rows += batch->num_rows();
+  }
+  ASSERT_EQ(num_rows, 100);
+
+  // Earlier batches are left as is, later ones have promoted and new fields
+  auto final_schema =
+      schema({field("a", float64()), field("c", utf8()), field("b", boolean())});
+  AssertSchemaEqual(*batches.front()->schema(),
+                    *schema({field("a", int64()), field("c", null())}));
+  AssertSchemaEqual(*batches.back()->schema(), *final_schema);
+  AssertSchemaEqual(*reader_->schema(), *final_schema);
+}
+
+TEST_P(StreamingReaderTest, Errors) {
+  ASSERT_RAISES(Invalid, MakeReader(""));
+
+  parse_options_.unexpected_field_behavior = UnexpectedFieldBehavior::Error;
+  parse_options_.explicit_schema = schema({field("a", int64())});
+  read_options_.block_size = 16;
+  ASSERT_OK(MakeReader("{\"a\":1}\n{\"a\":2}\n{\"a\":3}\n{\"b\":4}\n"));
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  ASSERT_RAISES(Invalid, reader_->ReadAll(&batches));
+}
+
 }  // namespace json
 }  // namespace arrow
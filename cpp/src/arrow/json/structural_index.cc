@@ -0,0 +1,330 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/json/structural_index_internal.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "arrow/util/bit_util.h"
+#include "arrow/util/cpu_info.h"
+
+namespace arrow {
+namespace json {
+
+using ::arrow::internal::CpuInfo;
+using ::arrow::internal::DispatchLevel;
+
+constexpr const char* StructuralParser::kInvalidValue;
+constexpr const char* StructuralParser::kMissName;
+constexpr const char* StructuralParser::kMissColon;
+constexpr const char* StructuralParser::kMissCommaOrCurlyBracket;
+constexpr const char* StructuralParser::kMissCommaOrSquareBracket;
+
+namespace {
+
+struct ClassifyStructuralsDynamic {
+  using FunctionType = decltype(&ClassifyStructurals<DispatchLevel::NONE>);
+
+  static std::vector<std::pair<DispatchLevel, FunctionType>> implementations() {
+    std::vector<std::pair<DispatchLevel, FunctionType>> impls = {
+        {DispatchLevel::NONE, ClassifyStructurals<DispatchLevel::NONE>}};
+    // The vectorized implementations compute the string extents with a
+    // carry-less multiplication
+    if (CpuInfo::GetInstance()->IsSupported(CpuInfo::CLMUL)) {
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+      impls.emplace_back(DispatchLevel::AVX2, ClassifyStructuralsAvx2);
+#endif
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+      impls.emplace_back(DispatchLevel::AVX512, ClassifyStructuralsAvx512);
+#endif
+    }
+    return impls;
+  }
+};
+
+// Return the first quote, backslash or control character in [p, end)
+const char* FindStringSpecial(const char* p, const char* end) {
+#if defined(ARROW_HAVE_SSE2)
+  const __m128i quote_char = _mm_set1_epi8('"');
+  const __m128i backslash_char = _mm_set1_epi8('\\');
+  const __m128i max_control_char = _mm_set1_epi8(0x1F);
+  for (; end - p >= 16; p += 16) {
+    const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    const __m128i matches = _mm_or_si128(
+        _mm_or_si128(_mm_cmpeq_epi8(v, quote_char), _mm_cmpeq_epi8(v, backslash_char)),
+        _mm_cmpeq_epi8(_mm_min_epu8(v, max_control_char), v));
+    const auto bits = static_cast<uint32_t>(_mm_movemask_epi8(matches));
+    if (bits != 0) {
+      return p + BitUtil::CountTrailingZeros(bits);
+    }
+  }
+#endif
+  for (; p < end; ++p) {
+    const auto c = static_cast<uint8_t>(*p);
+    if (c == '"' || c == '\\' || c < 0x20) {
+      return p;
+    }
+  }
+  return end;
+}
+
+bool ParseHex4(const char* p, const char* end, uint32_t* out) {
+  if (end - p < 4) {
+    return false;
+  }
+  uint32_t value = 0;
+  for (int i = 0; i < 4; ++i) {
+    const char c = p[i];
+    value <<= 4;
+    if (c >= '0' && c <= '9') {
+      value |= c - '0';
+    } else if (c >= 'a' && c <= 'f') {
+      value |= c - 'a' + 10;
+    } else if (c >= 'A' && c <= 'F') {
+      value |= c - 'A' + 10;
+    } else {
+      return false;
+    }
+  }
+  *out = value;
+  return true;
+}
+
+void AppendUtf8(uint32_t codepoint, std::string* out) {
+  if (codepoint < 0x80) {
+    out->push_back(static_cast<char>(codepoint));
+  } else if (codepoint < 0x800) {
+    out->push_back(static_cast<char>(0xC0 | (codepoint >> 6)));
+    out->push_back(static_cast<char>(0x80 | (codepoint & 0x3F)));
+  } else if (codepoint < 0x10000) {
+    out->push_back(static_cast<char>(0xE0 | (codepoint >> 12)));
+    out->push_back(static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F)));
+    out->push_back(static_cast<char>(0x80 | (codepoint & 0x3F)));
+  } else {
+    out->push_back(static_cast<char>(0xF0 | (codepoint >> 18)));
+    out->push_back(static_cast<char>(0x80 | ((codepoint >> 12) & 0x3F)));
+    out->push_back(static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F)));
+    out->push_back(static_cast<char>(0x80 | (codepoint & 0x3F)));
+  }
+}
+
+bool IsScalarEnd(char c) {
+  switch (c) {
+    case ' ':
+    case '\t':
+    case '\r':
+    case '\n':
+    case '{':
+    case '}':
+    case '[':
+    case ']':
+    case ':':
+    case ',':
+      return true;
+    default:
+      return false;
+  }
+}
+
+bool IsDigit(char c) { return c >= '0' && c <= '9'; }
+
+}  // namespace
+
+Status StructuralIndex::Build(util::string_view json) {
+  static ::arrow::internal::DynamicDispatch<ClassifyStructuralsDynamic> dispatch;
+
+  if (json.size() > std::numeric_limits<uint32_t>::max()) {
+    return Status::Invalid("JSON block too large for the structural index: ",
+                           json.size(), " bytes");
+  }
+  const auto data = reinterpret_cast<const uint8_t*>(json.data());
+  const auto size = static_cast<int64_t>(json.size());
+  const int64_t full_words = size / 64;
+  const int64_t num_words = (size + 63) / 64;
+
+  StructuralState state;
+  bits_.resize(num_words);
+  dispatch.func(data, full_words, bits_.data(), &state);
+  if (num_words > full_words) {
+    // Last, partial word: classify a space-padded copy
+    const int64_t tail_size = size - full_words * 64;
+    uint8_t padded[64];
+    std::memset(padded, ' ', sizeof(padded));
+    std::memcpy(padded, data + full_words * 64, tail_size);
+    dispatch.func(padded, 1, bits_.data() + full_words, &state);
+  }
+
+  positions_.clear();
+  // A guess, as a token every 8 bytes is typical of line-delimited records
+  positions_.reserve(json.size() / 8);
+  for (int64_t w = 0; w < num_words; ++w) {
+    const auto base = static_cast<uint32_t>(w * 64);
+    for (uint64_t bits = bits_[w]; bits != 0; bits &= bits - 1) {
+      positions_.push_back(base + BitUtil::CountTrailingZeros(bits));
+    }
+  }
+  return Status::OK();
+}
+
+Status StructuralParser::ParseString(uint32_t pos, int32_t row,
+                                     util::string_view* out) {
+  static constexpr const char* kMissQuotationMark =
+      "Missing a closing quotation mark in string.";
+  const char* end = data_ + size_;
+  const char* p = data_ + pos + 1;
+  const char* special = FindStringSpecial(p, end);
+  if (ARROW_PREDICT_TRUE(special != end && *special == '"')) {
+    // Nothing to unescape
+    *out = util::string_view(p, special - p);
+    return Status::OK();
+  }
+
+  string_buffer_.clear();
+  while (true) {
+    if (special == end) {
+      return ParseError(kMissQuotationMark, row);
+    }
+    string_buffer_.append(p, special - p);
+    switch (*special) {
+      case '"':
+        *out = util::string_view(string_buffer_);
+        return Status::OK();
+      case '\\':
+        break;
+      default:
+        return ParseError(*special == '\0' ? kMissQuotationMark
+                                           : "Invalid encoding in string.",
+                          row);
+    }
+    p = special + 1;
+    if (p == end) {
+      return ParseError(kMissQuotationMark, row);
+    }
+    switch (*p++) {
+      case '"':
+        string_buffer_.push_back('"');
+        break;
+      case '\\':
+        string_buffer_.push_back('\\');
+        break;
+      case '/':
+        string_buffer_.push_back('/');
+        break;
+      case 'b':
+        string_buffer_.push_back('\b');
+        break;
+      case 'f':
+        string_buffer_.push_back('\f');
+        break;
+      case 'n':
+        string_buffer_.push_back('\n');
+        break;
+      case 'r':
+        string_buffer_.push_back('\r');
+        break;
+      case 't':
+        string_buffer_.push_back('\t');
+        break;
+      case 'u': {
+        uint32_t codepoint;
+        if (!ParseHex4(p, end, &codepoint)) {
+          return ParseError("Incorrect hex digit after \\u escape in string.", row);
+        }
+        p += 4;
+        if (codepoint >= 0xD800 && codepoint <= 0xDBFF) {
+          // A high surrogate must be followed by a low surrogate
+          uint32_t low;
+          if (end - p < 2 || p[0] != '\\' || p[1] != 'u' ||
+              !ParseHex4(p + 2, end, &low) || low < 0xDC00 || low > 0xDFFF) {
+            return ParseError("The surrogate pair in string is invalid.", row);
+          }
+          p += 6;
+          codepoint = 0x10000 + ((codepoint - 0xD800) << 10) + (low - 0xDC00);
+        }
+        AppendUtf8(codepoint, &string_buffer_);
+        break;
+      }
+      default:
+        return ParseError("Invalid escape character in string.", row);
+    }
+    special = FindStringSpecial(p, end);
+  }
+}
+
+util::string_view StructuralParser::ScanScalar(uint32_t pos) const {
+  const char* begin = data_ + pos;
+  const char* end = data_ + size_;
+  const char* p = begin;
+  while (p < end && !IsScalarEnd(*p)) {
+    ++p;
+  }
+  return util::string_view(begin, p - begin);
+}
+
+Status StructuralParser::ValidateNumber(util::string_view number, int32_t row) {
+  const char* p = number.data();
+  const char* end = p + number.size();
+  if (p < end && *p == '-') {
+    ++p;
+  }
+  if (p == end) {
+    return ParseError(kInvalidValue, row);
+  }
+  // NaN, Inf and Infinity as rapidjson's kParseNanAndInfFlag
+  const util::string_view rest(p, end - p);
+  if (rest == "NaN" || rest == "Inf" || rest == "Infinity") {
+    return Status::OK();
+  }
+
+  if (*p == '0') {
+    ++p;
+  } else if (IsDigit(*p)) {
+    while (p < end && IsDigit(*p)) ++p;
+  } else {
+    return ParseError(kInvalidValue, row);
+  }
+  if (p < end && *p == '.') {
+    ++p;
+    if (p == end || !IsDigit(*p)) {
+      return ParseError("Missing fraction part in number.", row);
+    }
+    while (p < end && IsDigit(*p)) ++p;
+  }
+  if (p < end && (*p == 'e' || *p == 'E')) {
+    ++p;
+    if (p < end && (*p == '+' || *p == '-')) ++p;
+    if (p == end || !IsDigit(*p)) {
+      return ParseError("Missing exponent in number.", row);
+    }
+    while (p < end && IsDigit(*p)) ++p;
+  }
+  if (p != end) {
+    return ParseError(kInvalidValue, row);
+  }
+  return Status::OK();
+}
+
+Status StructuralParser::ParseError(const char* message, int32_t row) {
+  return Status::Invalid("JSON parse error: ", message, " in row ", row);
+}
+
+}  // namespace json
+}  // namespace arrow
@@ -0,0 +1,79 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <immintrin.h>
+
+#include "arrow/json/structural_index_internal.h"
+
+namespace arrow {
+namespace json {
+
+void ClassifyStructuralsAvx2(const uint8_t* data, int64_t num_words, uint64_t* out_bits,
+                             StructuralState* state) {
+  const __m256i quote_char = _mm256_set1_epi8('"');
+  const __m256i backslash_char = _mm256_set1_epi8('\\');
+  const __m256i space = _mm256_set1_epi8(' ');
+  const __m256i tab = _mm256_set1_epi8('\t');
+  const __m256i cr = _mm256_set1_epi8('\r');
+  const __m256i lf = _mm256_set1_epi8('\n');
+  // '[' and ']' are '{' and '}' without the 0x20 bit
+  const __m256i case_bit = _mm256_set1_epi8(0x20);
+  const __m256i open_brace = _mm256_set1_epi8('{');
+  const __m256i close_brace = _mm256_set1_epi8('}');
+  const __m256i colon = _mm256_set1_epi8(':');
+  const __m256i comma = _mm256_set1_epi8(',');
+  const __m128i all_ones = _mm_set1_epi8(-1);
+
+  auto to_bits = [](__m256i lo_matches, __m256i hi_matches) -> uint64_t {
+    const auto lo_bits = static_cast<uint32_t>(_mm256_movemask_epi8(lo_matches));
+    const auto hi_bits = static_cast<uint32_t>(_mm256_movemask_epi8(hi_matches));
+    return static_cast<uint64_t>(lo_bits) | (static_cast<uint64_t>(hi_bits) << 32);
+  };
+  auto whitespace_matches = [&](__m256i v) {
+    return _mm256_or_si256(
+        _mm256_or_si256(_mm256_cmpeq_epi8(v, space), _mm256_cmpeq_epi8(v, tab)),
+        _mm256_or_si256(_mm256_cmpeq_epi8(v, cr), _mm256_cmpeq_epi8(v, lf)));
+  };
+  auto operator_matches = [&](__m256i v) {
+    const __m256i folded = _mm256_or_si256(v, case_bit);
+    return _mm256_or_si256(
+        _mm256_or_si256(_mm256_cmpeq_epi8(folded, open_brace),
+                        _mm256_cmpeq_epi8(folded, close_brace)),
+        _mm256_or_si256(_mm256_cmpeq_epi8(v, colon), _mm256_cmpeq_epi8(v, comma)));
+  };
+
+  for (int64_t w = 0; w < num_words; ++w, data += 64) {
+    const __m256i lo = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+    const __m256i hi = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + 32));
+    const uint64_t backslash = to_bits(_mm256_cmpeq_epi8(lo, backslash_char),
+                                       _mm256_cmpeq_epi8(hi, backslash_char));
+    const uint64_t quotes =
+        to_bits(_mm256_cmpeq_epi8(lo, quote_char), _mm256_cmpeq_epi8(hi, quote_char)) &
+        ~FindEscaped(backslash, state);
+    const uint64_t whitespace = to_bits(whitespace_matches(lo), whitespace_matches(hi));
+    const uint64_t operators = to_bits(operator_matches(lo), operator_matches(hi));
+
+    // Prefix XOR as a carry-less multiplication by all ones
+    const uint64_t quote_parity = static_cast<uint64_t>(_mm_cvtsi128_si64(
+        _mm_clmulepi64_si128(_mm_set_epi64x(0, static_cast<int64_t>(quotes)),
+                             all_ones, 0)));
+    out_bits[w] = FindStructurals(quotes, quote_parity, whitespace, operators, state);
+  }
+}
+
+}  // namespace json
+}  // namespace arrow
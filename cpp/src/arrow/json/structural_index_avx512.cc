@@ -0,0 +1,64 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <immintrin.h>
+
+#include "arrow/json/structural_index_internal.h"
+
+namespace arrow {
+namespace json {
+
+void ClassifyStructuralsAvx512(const uint8_t* data, int64_t num_words,
+                               uint64_t* out_bits, StructuralState* state) {
+  const __m512i quote_char = _mm512_set1_epi8('"');
+  const __m512i backslash_char = _mm512_set1_epi8('\\');
+  const __m512i space = _mm512_set1_epi8(' ');
+  const __m512i tab = _mm512_set1_epi8('\t');
+  const __m512i cr = _mm512_set1_epi8('\r');
+  const __m512i lf = _mm512_set1_epi8('\n');
+  // '[' and ']' are '{' and '}' without the 0x20 bit
+  const __m512i case_bit = _mm512_set1_epi8(0x20);
+  const __m512i open_brace = _mm512_set1_epi8('{');
+  const __m512i close_brace = _mm512_set1_epi8('}');
+  const __m512i colon = _mm512_set1_epi8(':');
+  const __m512i comma = _mm512_set1_epi8(',');
+  const __m128i all_ones = _mm_set1_epi8(-1);
+
+  for (int64_t w = 0; w < num_words; ++w, data += 64) {
+    const __m512i v = _mm512_loadu_si512(data);
+    const __m512i folded = _mm512_or_si512(v, case_bit);
+    const uint64_t backslash = _mm512_cmpeq_epi8_mask(v, backslash_char);
+    const uint64_t quotes =
+        _mm512_cmpeq_epi8_mask(v, quote_char) & ~FindEscaped(backslash, state);
+    const uint64_t whitespace =
+        _mm512_cmpeq_epi8_mask(v, space) | _mm512_cmpeq_epi8_mask(v, tab) |
+        _mm512_cmpeq_epi8_mask(v, cr) | _mm512_cmpeq_epi8_mask(v, lf);
+    const uint64_t operators =
+        _mm512_cmpeq_epi8_mask(folded, open_brace) |
+        _mm512_cmpeq_epi8_mask(folded, close_brace) |
+        _mm512_cmpeq_epi8_mask(v, colon) | _mm512_cmpeq_epi8_mask(v, comma);
+
+    // Prefix XOR as a carry-less multiplication by all ones
+    const uint64_t quote_parity = static_cast<uint64_t>(_mm_cvtsi128_si64(
+        _mm_clmulepi64_si128(_mm_set_epi64x(0, static_cast<int64_t>(quotes)),
+                             all_ones, 0)));
+    out_bits[w] = FindStructurals(quotes, quote_parity, whitespace, operators, state);
+  }
+}
+
+}  // namespace json
+}  // namespace arrow
@@ -0,0 +1,378 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "arrow/json/parser.h"
+#include "arrow/status.h"
+#include "arrow/util/dispatch.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/sse_util.h"
+#include "arrow/util/string_view.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace json {
+
+// Parsing of JSON data in two stages, in the manner of simdjson:
+//
+// 1. The input is classified 64 bytes at a time into bitmaps of quotes,
+//    backslashes, whitespace and operators ({}[]:,).  Escaped quotes are
+//    removed and the extent of strings is computed as a prefix XOR of the
+//    quote bits.  What remains is the "structural index": the positions of the
+//    operators and of the first byte of each scalar (string, number, literal)
+//    outside strings.
+// 2. The structural index is walked with a small state machine, which
+//    validates the grammar and calls the handler of a BlockParser as
+//    rapidjson's SAX reader would.
+
+/// Carried over from one 64-byte word to the next
+struct StructuralState {
+  // 1 if the first byte of the next word is escaped by a backslash
+  uint64_t next_is_escaped = 0;
+  // All ones if the next word starts inside a string, zero otherwise
+  uint64_t in_string = 0;
+  // 1 if the last byte of the previous word is part of a scalar other than a
+  // string
+  uint64_t prev_scalar = 0;
+};
+
+/// Inclusive prefix XOR of the bits of `word`: bit i of the result is the
+/// parity of bits [0, i]
+template <::arrow::internal::DispatchLevel Level>
+inline uint64_t PrefixXor(uint64_t word) {
+  word ^= word << 1;
+  word ^= word << 2;
+  word ^= word << 4;
+  word ^= word << 8;
+  word ^= word << 16;
+  word ^= word << 32;
+  return word;
+}
+
+/// Return the bits of the bytes escaped by a backslash, i.e. those following
+/// an odd-length run of backslashes
+inline uint64_t FindEscaped(uint64_t backslash, StructuralState* state) {
+  if (backslash == 0) {
+    const uint64_t escaped = state->next_is_escaped;
+    state->next_is_escaped = 0;
+    return escaped;
+  }
+  // A backslash escaped by the previous word can't start a run
+  const uint64_t potential_escape = backslash & ~state->next_is_escaped;
+  // Subtracting the run starts from the odd bits carries through each run,
+  // leaving the parity of its length on the byte following it
+  constexpr uint64_t kOddBits = 0xAAAAAAAAAAAAAAAAULL;
+  const uint64_t maybe_escaped = potential_escape << 1;
+  const uint64_t escape_and_terminal_code =
+      ((maybe_escaped | kOddBits) - potential_escape) ^ kOddBits;
+  const uint64_t escaped =
+      escape_and_terminal_code ^ (backslash | state->next_is_escaped);
+  state->next_is_escaped = (escape_and_terminal_code & backslash) >> 63;
+  return escaped;
+}
+
+/// Compute the structural bits of a word from its classified bytes
+///
+/// `quotes` must exclude escaped quotes, and `quote_parity` is
+/// PrefixXor(quotes).
+inline uint64_t FindStructurals(uint64_t quotes, uint64_t quote_parity,
+                                uint64_t whitespace, uint64_t operators,
+                                StructuralState* state) {
+  // Opening quotes and string contents (closing quotes excluded)
+  const uint64_t in_string = quote_parity ^ state->in_string;
+  state->in_string = static_cast<uint64_t>(static_cast<int64_t>(in_string) >> 63);
+  // String contents and closing quotes
+  const uint64_t string_tail = in_string ^ quotes;
+
+  const uint64_t scalar = ~(operators | whitespace);
+  const uint64_t nonquote_scalar = scalar & ~quotes;
+  const uint64_t follows_nonquote_scalar = (nonquote_scalar << 1) | state->prev_scalar;
+  state->prev_scalar = nonquote_scalar >> 63;
+  const uint64_t scalar_start = scalar & ~follows_nonquote_scalar;
+
+  return (operators | scalar_start) & ~string_tail;
+}
+
+/// Classify `num_words` * 64 bytes of `data` into `out_bits`, one bit per
+/// byte, set for structural characters
+template <::arrow::internal::DispatchLevel Level>
+void ClassifyStructurals(const uint8_t* data, int64_t num_words, uint64_t* out_bits,
+                         StructuralState* state) {
+  for (int64_t w = 0; w < num_words; ++w, data += 64) {
+    uint64_t quotes = 0, backslash = 0, whitespace = 0, operators = 0;
+#if defined(ARROW_HAVE_SSE2)
+    const __m128i quote_char = _mm_set1_epi8('"');
+    const __m128i backslash_char = _mm_set1_epi8('\\');
+    const __m128i space = _mm_set1_epi8(' ');
+    const __m128i tab = _mm_set1_epi8('\t');
+    const __m128i cr = _mm_set1_epi8('\r');
+    const __m128i lf = _mm_set1_epi8('\n');
+    // '[' and ']' are '{' and '}' without the 0x20 bit
+    const __m128i case_bit = _mm_set1_epi8(0x20);
+    const __m128i open_brace = _mm_set1_epi8('{');
+    const __m128i close_brace = _mm_set1_epi8('}');
+    const __m128i colon = _mm_set1_epi8(':');
+    const __m128i comma = _mm_set1_epi8(',');
+    auto to_bits = [](__m128i matches, int i) -> uint64_t {
+      return static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(matches)))
+             << (i * 16);
+    };
+    for (int i = 0; i < 4; ++i) {
+      const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i * 16));
+      quotes |= to_bits(_mm_cmpeq_epi8(v, quote_char), i);
+      backslash |= to_bits(_mm_cmpeq_epi8(v, backslash_char), i);
+      whitespace |= to_bits(
+          _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, space), _mm_cmpeq_epi8(v, tab)),
+                       _mm_or_si128(_mm_cmpeq_epi8(v, cr), _mm_cmpeq_epi8(v, lf))),
+          i);
+      const __m128i folded = _mm_or_si128(v, case_bit);
+      operators |= to_bits(
+          _mm_or_si128(
+              _mm_or_si128(_mm_cmpeq_epi8(folded, open_brace),
+                           _mm_cmpeq_epi8(folded, close_brace)),
+              _mm_or_si128(_mm_cmpeq_epi8(v, colon), _mm_cmpeq_epi8(v, comma))),
+          i);
+    }
+#else
+    for (int i = 0; i < 64; ++i) {
+      const uint8_t c = data[i];
+      const uint64_t bit = static_cast<uint64_t>(1) << i;
+      quotes |= c == '"' ? bit : 0;
+      backslash |= c == '\\' ? bit : 0;
+      whitespace |= (c == ' ' || c == '\t' || c == '\r' || c == '\n') ? bit : 0;
+      operators |= (c == '{' || c == '}' || c == '[' || c == ']' || c == ':' || c == ',')
+                       ? bit
+                       : 0;
+    }
+#endif
+    quotes &= ~FindEscaped(backslash, state);
+    out_bits[w] = FindStructurals(quotes, PrefixXor<Level>(quotes), whitespace,
+                                  operators, state);
+  }
+}
+
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+void ClassifyStructuralsAvx2(const uint8_t* data, int64_t num_words, uint64_t* out_bits,
+                             StructuralState* state);
+#endif
+
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+void ClassifyStructuralsAvx512(const uint8_t* data, int64_t num_words,
+                               uint64_t* out_bits, StructuralState* state);
+#endif
+
+/// \brief The positions of the structural characters of a JSON buffer
+class ARROW_EXPORT StructuralIndex {
+ public:
+  /// Index `json`, replacing any previous contents
+  Status Build(util::string_view json);
+
+  const std::vector<uint32_t>& positions() const { return positions_; }
+
+ protected:
+  std::vector<uint64_t> bits_;
+  std::vector<uint32_t> positions_;
+};
+
+/// \brief A JSON parser walking a StructuralIndex
+///
+/// Handler must provide rapidjson's SAX handler interface.  As with
+/// rapidjson's kParseNumbersAsStringsFlag, numbers are passed unconverted to
+/// Handler::RawNumber, and NaN and (-)Infinity are accepted as numbers.
+class ARROW_EXPORT StructuralParser {
+ public:
+  /// \brief Parse a block of whitespace separated JSON documents
+  ///
+  /// `*num_rows` is incremented for each document.
+  template <typename Handler>
+  Status Parse(util::string_view json, Handler* handler, int32_t* num_rows) {
+    RETURN_NOT_OK(index_.Build(json));
+    data_ = json.data();
+    size_ = json.size();
+    next_ = 0;
+    while (next_ < index_.positions().size()) {
+      if (*num_rows >= kMaxParserNumRows) {
+        return Status::Invalid("Exceeded maximum rows");
+      }
+      RETURN_NOT_OK(ParseDocument(handler, *num_rows));
+      ++*num_rows;
+    }
+    return Status::OK();
+  }
+
+ protected:
+  enum class State : uint8_t { kValue, kKey, kAfterValue };
+
+  struct Scope {
+    bool is_object;
+    uint32_t size;
+  };
+
+  template <typename Handler>
+  Status ParseDocument(Handler* handler, int32_t row) {
+    scopes_.clear();
+    uint32_t pos = index_.positions()[next_++];
+    State state = State::kValue;
+    while (true) {
+      switch (state) {
+        case State::kValue:
+          switch (data_[pos]) {
+            case '{':
+              if (!handler->StartObject()) return handler->Error();
+              if (!NextToken(&pos)) return ParseError(kMissName, row);
+              if (data_[pos] == '}') {
+                if (!handler->EndObject(0)) return handler->Error();
+                state = State::kAfterValue;
+              } else {
+                scopes_.push_back({true, 0});
+                state = State::kKey;
+              }
+              break;
+            case '[':
+              if (!handler->StartArray()) return handler->Error();
+              if (!NextToken(&pos)) return ParseError(kInvalidValue, row);
+              if (data_[pos] == ']') {
+                if (!handler->EndArray(0)) return handler->Error();
+                state = State::kAfterValue;
+              } else {
+                scopes_.push_back({false, 0});
+              }
+              break;
+            case '"': {
+              util::string_view value;
+              RETURN_NOT_OK(ParseString(pos, row, &value));
+              if (!handler->String(value.data(), static_cast<uint32_t>(value.size()))) {
+                return handler->Error();
+              }
+              state = State::kAfterValue;
+              break;
+            }
+            default: {
+              const util::string_view scalar = ScanScalar(pos);
+              bool ok;
+              if (scalar == "null") {
+                ok = handler->Null();
+              } else if (scalar == "true") {
+                ok = handler->Bool(true);
+              } else if (scalar == "false") {
+                ok = handler->Bool(false);
+              } else {
+                RETURN_NOT_OK(ValidateNumber(scalar, row));
+                ok = handler->RawNumber(scalar.data(),
+                                        static_cast<uint32_t>(scalar.size()));
+              }
+              if (!ok) return handler->Error();
+              state = State::kAfterValue;
+              break;
+            }
+          }
+          break;
+
+        case State::kKey: {
+          if (data_[pos] != '"') return ParseError(kMissName, row);
+          util::string_view key;
+          RETURN_NOT_OK(ParseString(pos, row, &key));
+          if (!handler->Key(key.data(), static_cast<uint32_t>(key.size()))) {
+            return handler->Error();
+          }
+          if (!NextToken(&pos) || data_[pos] != ':') return ParseError(kMissColon, row);
+          if (!NextToken(&pos)) return ParseError(kInvalidValue, row);
+          state = State::kValue;
+          break;
+        }
+
+        case State::kAfterValue: {
+          if (scopes_.empty()) {
+            return Status::OK();
+          }
+          Scope& scope = scopes_.back();
+          const bool have_token = NextToken(&pos);
+          if (scope.is_object) {
+            if (!have_token) return ParseError(kMissCommaOrCurlyBracket, row);
+            if (data_[pos] == ',') {
+              ++scope.size;
+              if (!NextToken(&pos)) return ParseError(kMissName, row);
+              state = State::kKey;
+            } else if (data_[pos] == '}') {
+              if (!handler->EndObject(scope.size + 1)) return handler->Error();
+              scopes_.pop_back();
+            } else {
+              return ParseError(kMissCommaOrCurlyBracket, row);
+            }
+          } else {
+            if (!have_token) return ParseError(kMissCommaOrSquareBracket, row);
+            if (data_[pos] == ',') {
+              ++scope.size;
+              if (!NextToken(&pos)) return ParseError(kInvalidValue, row);
+              state = State::kValue;
+            } else if (data_[pos] == ']') {
+              if (!handler->EndArray(scope.size + 1)) return handler->Error();
+              scopes_.pop_back();
+            } else {
+              return ParseError(kMissCommaOrSquareBracket, row);
+            }
+          }
+          break;
+        }
+      }
+    }
+  }
+
+  bool NextToken(uint32_t* pos) {
+    if (ARROW_PREDICT_FALSE(next_ == index_.positions().size())) {
+      return false;
+    }
+    *pos = index_.positions()[next_++];
+    return true;
+  }
+
+  /// Parse the string starting with the quote at `pos`, unescaping it if needed
+  Status ParseString(uint32_t pos, int32_t row, util::string_view* out);
+
+  /// Return the scalar starting at `pos`, up to the next whitespace or operator
+  util::string_view ScanScalar(uint32_t pos) const;
+
+  static Status ValidateNumber(util::string_view number, int32_t row);
+
+  static Status ParseError(const char* message, int32_t row);
+
+  // The same messages as rapidjson's
+  static constexpr const char* kInvalidValue = "Invalid value.";
+  static constexpr const char* kMissName = "Missing a name for object member.";
+  static constexpr const char* kMissColon =
+      "Missing a colon after a name of object member.";
+  static constexpr const char* kMissCommaOrCurlyBracket =
+      "Missing a comma or '}' after an object member.";
+  static constexpr const char* kMissCommaOrSquareBracket =
+      "Missing a comma or ']' after an array element.";
+
+  StructuralIndex index_;
+  const char* data_ = NULLPTR;
+  size_t size_ = 0;
+  size_t next_ = 0;
+  std::vector<Scope> scopes_;
+  std::string string_buffer_;
+};
+
+}  // namespace json
+}  // namespace arrow
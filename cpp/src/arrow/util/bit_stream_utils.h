@@ -58,7 +58,7 @@ class BitWriter {
   int buffer_len() const { return max_bytes_; }
 
   /// Writes a value to buffered_values_, flushing to buffer_ if necessary.  This is bit
-  /// packed.  Returns false if there was not enough space. num_bits must be <= 32.
+  /// packed.  Returns false if there was not enough space. num_bits must be <= 64.
   bool PutValue(uint64_t v, int num_bits);
 
   /// Writes v to the next aligned byte using num_bytes. If T is larger than
@@ -72,9 +72,11 @@ class BitWriter {
   /// For more details on vlq:
   /// en.wikipedia.org/wiki/Variable-length_quantity
   bool PutVlqInt(uint32_t v);
+  bool PutVlqInt(uint64_t v);
 
   // Writes an int zigzag encoded.
   bool PutZigZagVlqInt(int32_t v);
+  bool PutZigZagVlqInt(int64_t v);
 
   /// Get a pointer to the next aligned byte and advance the underlying buffer
   /// by num_bytes.
@@ -127,7 +129,7 @@ class BitReader {
   }
 
   /// Gets the next value from the buffer.  Returns true if 'v' could be read or false if
-  /// there are not enough bytes left. num_bits must be <= 32.
+  /// there are not enough bytes left. num_bits must be <= 64.
   template <typename T>
   bool GetValue(int num_bits, T* v);
 
@@ -135,6 +137,12 @@ class BitReader {
   template <typename T>
   int GetBatch(int num_bits, T* v, int batch_size);
 
+  /// Like GetBatch for num_bits <= 32, but stores dictionary[index] for each
+  /// index read.  For dictionaries of 4-byte and 8-byte values, the
+  /// unpacking and the lookup are fused.
+  template <typename T>
+  int GetBatchWithDict(int num_bits, const T* dictionary, T* v, int batch_size);
+
   /// Reads a 'num_bytes'-sized value from the buffer and stores it in 'v'. T
   /// needs to be a little-endian native type and big enough to store
   /// 'num_bytes'. The value is assumed to be byte-aligned so the stream will
@@ -147,9 +155,11 @@ class BitReader {
   /// the beginning of a byte. Return false if there were not enough bytes in
   /// the buffer.
   bool GetVlqInt(int32_t* v);
+  bool GetVlqInt(int64_t* v);
 
   // Reads a zigzag encoded int `into` v.
   bool GetZigZagVlqInt(int32_t* v);
+  bool GetZigZagVlqInt(int64_t* v);
 
   /// Returns the number of bytes left in the stream, not including the current
   /// byte (i.e., there may be an additional fraction of a byte).
@@ -161,6 +171,9 @@ class BitReader {
   /// Maximum byte length of a vlq encoded int
   static const int MAX_VLQ_BYTE_LEN = 5;
 
+  /// Maximum byte length of a vlq encoded int64
+  static const int MAX_VLQ_BYTE_LEN_64 = 10;
+
  private:
   const uint8_t* buffer_;
   int max_bytes_;
@@ -174,9 +187,9 @@ class BitReader {
 };
 
 inline bool BitWriter::PutValue(uint64_t v, int num_bits) {
-  // TODO: revisit this limit if necessary (can be raised to 64 by fixing some edge cases)
-  DCHECK_LE(num_bits, 32);
-  DCHECK_EQ(v >> num_bits, 0) << "v = " << v << ", num_bits = " << num_bits;
+  DCHECK_LE(num_bits, 64);
+  DCHECK(num_bits == 64 || v >> num_bits == 0)
+      << "v = " << v << ", num_bits = " << num_bits;
 
   if (ARROW_PREDICT_FALSE(byte_offset_ * 8 + bit_offset_ + num_bits > max_bytes_ * 8))
     return false;
@@ -190,7 +203,8 @@ inline bool BitWriter::PutValue(uint64_t v, int num_bits) {
     buffered_values_ = 0;
     byte_offset_ += 8;
     bit_offset_ -= 64;
-    buffered_values_ = v >> (num_bits - bit_offset_);
+    // A shift by 64 would be undefined; no bits are left over then
+    buffered_values_ = bit_offset_ == 0 ? 0 : v >> (num_bits - bit_offset_);
   }
   DCHECK_LT(bit_offset_, 64);
   return true;
@@ -235,6 +249,16 @@ inline bool BitWriter::PutVlqInt(uint32_t v) {
   return result;
 }
 
+inline bool BitWriter::PutVlqInt(uint64_t v) {
+  bool result = true;
+  while ((v & 0xFFFFFFFFFFFFFF80ULL) != 0ULL) {
+    result &= PutAligned<uint8_t>(static_cast<uint8_t>((v & 0x7F) | 0x80), 1);
+    v >>= 7;
+  }
+  result &= PutAligned<uint8_t>(static_cast<uint8_t>(v & 0x7F), 1);
+  return result;
+}
+
 namespace detail {
 
 template <typename T>
@@ -264,9 +288,12 @@ inline void GetValue_(int num_bits, T* v, int max_bytes, const uint8_t* buffer,
 #pragma warning(push)
 #pragma warning(disable : 4800 4805)
 #endif
-    // Read bits of v that crossed into new buffered_values_
-    *v = *v | static_cast<T>(BitUtil::TrailingBits(*buffered_values, *bit_offset)
-                             << (num_bits - *bit_offset));
+    // Read bits of v that crossed into new buffered_values_. There are none if
+    // v ended on the boundary, and shifting by 64 would be undefined then.
+    if (*bit_offset > 0) {
+      *v = *v | static_cast<T>(BitUtil::TrailingBits(*buffered_values, *bit_offset)
+                               << (num_bits - *bit_offset));
+    }
 #ifdef _MSC_VER
 #pragma warning(pop)
 #endif
@@ -284,8 +311,7 @@ inline bool BitReader::GetValue(int num_bits, T* v) {
 template <typename T>
 inline int BitReader::GetBatch(int num_bits, T* v, int batch_size) {
   DCHECK(buffer_ != NULL);
-  // TODO: revisit this limit if necessary
-  DCHECK_LE(num_bits, 32);
+  DCHECK_LE(num_bits, 64);
   DCHECK_LE(num_bits, static_cast<int>(sizeof(T) * 8));
 
   int bit_offset = bit_offset_;
@@ -308,13 +334,16 @@ inline int BitReader::GetBatch(int num_bits, T* v, int batch_size) {
     }
   }
 
-  if (sizeof(T) == 4) {
+  // unpack32 only reads whole groups of 32 values
+  const bool unpack = batch_size - i >= 32;
+  if (unpack && sizeof(T) == 4) {
+    DCHECK_LE(num_bits, 32);
     int num_unpacked =
         internal::unpack32(reinterpret_cast<const uint32_t*>(buffer + byte_offset),
                            reinterpret_cast<uint32_t*>(v + i), batch_size - i, num_bits);
     i += num_unpacked;
     byte_offset += num_unpacked * num_bits / 8;
-  } else {
+  } else if (unpack && num_bits <= 32) {
     const int buffer_size = 1024;
     uint32_t unpack_buffer[buffer_size];
     while (i < batch_size) {
@@ -359,6 +388,78 @@ inline int BitReader::GetBatch(int num_bits, T* v, int batch_size) {
   return batch_size;
 }
 
+template <typename T>
+inline int BitReader::GetBatchWithDict(int num_bits, const T* dictionary, T* v,
+                                       int batch_size) {
+  DCHECK(buffer_ != NULL);
+  DCHECK_LE(num_bits, 32);
+
+  int bit_offset = bit_offset_;
+  int byte_offset = byte_offset_;
+  uint64_t buffered_values = buffered_values_;
+  int max_bytes = max_bytes_;
+  const uint8_t* buffer = buffer_;
+
+  uint64_t needed_bits = num_bits * batch_size;
+  uint64_t remaining_bits = (max_bytes - byte_offset) * 8 - bit_offset;
+  if (remaining_bits < needed_bits) {
+    batch_size = static_cast<int>(remaining_bits) / num_bits;
+  }
+
+  int i = 0;
+  uint32_t index;
+  for (; i < batch_size && bit_offset != 0; ++i) {
+    detail::GetValue_(num_bits, &index, max_bytes, buffer, &bit_offset, &byte_offset,
+                      &buffered_values);
+    v[i] = dictionary[index];
+  }
+
+  const auto* in = reinterpret_cast<const uint32_t*>(buffer + byte_offset);
+  int num_unpacked = 0;
+  // The unpack32 functions only read whole groups of 32 values
+  const bool unpack = batch_size - i >= 32;
+  if (unpack && sizeof(T) == 4) {
+    num_unpacked =
+        internal::unpack32_gather32(in, dictionary, v + i, batch_size - i, num_bits);
+  } else if (unpack && sizeof(T) == 8) {
+    num_unpacked =
+        internal::unpack32_gather64(in, dictionary, v + i, batch_size - i, num_bits);
+  } else {
+    const int buffer_size = 1024;
+    uint32_t indices[buffer_size];
+    while (batch_size - i - num_unpacked >= 32) {
+      const int unpacked = internal::unpack32(
+          in, indices, std::min(buffer_size, batch_size - i - num_unpacked), num_bits);
+      for (int k = 0; k < unpacked; ++k) {
+        v[i + num_unpacked + k] = dictionary[indices[k]];
+      }
+      in += unpacked * num_bits / 32;
+      num_unpacked += unpacked;
+    }
+  }
+  i += num_unpacked;
+  byte_offset += num_unpacked * num_bits / 8;
+
+  int bytes_remaining = max_bytes - byte_offset;
+  if (bytes_remaining >= 8) {
+    memcpy(&buffered_values, buffer + byte_offset, 8);
+  } else {
+    memcpy(&buffered_values, buffer + byte_offset, bytes_remaining);
+  }
+
+  for (; i < batch_size; ++i) {
+    detail::GetValue_(num_bits, &index, max_bytes, buffer, &bit_offset, &byte_offset,
+                      &buffered_values);
+    v[i] = dictionary[index];
+  }
+
+  bit_offset_ = bit_offset;
+  byte_offset_ = byte_offset;
+  buffered_values_ = buffered_values;
+
+  return batch_size;
+}
+
 template <typename T>
 inline bool BitReader::GetAligned(int num_bytes, T* v) {
   DCHECK_LE(num_bytes, static_cast<int>(sizeof(T)));
@@ -396,12 +497,33 @@ inline bool BitReader::GetVlqInt(int32_t* v) {
   return true;
 }
 
+inline bool BitReader::GetVlqInt(int64_t* v) {
+  uint64_t u = 0;
+  int shift = 0;
+  int num_bytes = 0;
+  uint8_t byte = 0;
+  do {
+    if (!GetAligned<uint8_t>(1, &byte)) return false;
+    u |= static_cast<uint64_t>(byte & 0x7F) << shift;
+    shift += 7;
+    DCHECK_LE(++num_bytes, MAX_VLQ_BYTE_LEN_64);
+  } while ((byte & 0x80) != 0);
+  *v = static_cast<int64_t>(u);
+  return true;
+}
+
 inline bool BitWriter::PutZigZagVlqInt(int32_t v) {
   // Note negative left shift is undefined
   uint32_t u = (static_cast<uint32_t>(v) << 1) ^ (v >> 31);
   return PutVlqInt(u);
 }
 
+inline bool BitWriter::PutZigZagVlqInt(int64_t v) {
+  // Note negative left shift is undefined
+  uint64_t u = (static_cast<uint64_t>(v) << 1) ^ (v >> 63);
+  return PutVlqInt(u);
+}
+
 inline bool BitReader::GetZigZagVlqInt(int32_t* v) {
   int32_t u_signed;
   if (!GetVlqInt(&u_signed)) return false;
@@ -410,6 +532,14 @@ inline bool BitReader::GetZigZagVlqInt(int32_t* v) {
   return true;
 }
 
+inline bool BitReader::GetZigZagVlqInt(int64_t* v) {
+  int64_t u_signed;
+  if (!GetVlqInt(&u_signed)) return false;
+  uint64_t u = static_cast<uint64_t>(u_signed);
+  *reinterpret_cast<uint64_t*>(v) = (u >> 1) ^ -(static_cast<int64_t>(u & 1));
+  return true;
+}
+
 }  // namespace BitUtil
 }  // namespace arrow
 
@@ -38,6 +38,7 @@
 #include "arrow/status.h"
 #include "arrow/util/align_util.h"
 #include "arrow/util/bit_util.h"
+#include "arrow/util/bitmap_ops_internal.h"
 #include "arrow/util/logging.h"
 
 namespace arrow {
@@ -262,17 +263,15 @@ template <typename Op>
 void AlignedBitmapOp(const uint8_t* left, int64_t left_offset, const uint8_t* right,
                      int64_t right_offset, uint8_t* out, int64_t out_offset,
                      int64_t length) {
-  Op op;
+  static internal::DynamicDispatch<internal::AlignedBitmapOpDynamic<Op>> dispatch;
   DCHECK_EQ(left_offset % 8, right_offset % 8);
   DCHECK_EQ(left_offset % 8, out_offset % 8);
 
-  const int64_t nbytes = BitUtil::BytesForBits(length + left_offset);
+  const int64_t nbytes = BitUtil::BytesForBits(length + left_offset % 8);
   left += left_offset / 8;
   right += right_offset / 8;
   out += out_offset / 8;
-  for (int64_t i = 0; i < nbytes; ++i) {
-    out[i] = op(left[i], right[i]);
-  }
+  dispatch.func(left, right, out, nbytes);
 }
 
 template <typename Op>
@@ -20,6 +20,7 @@
 #include <algorithm>
 #include <array>
 #include <bitset>
+#include <cstdint>
 #include <vector>
 
 #include "arrow/buffer.h"
@@ -28,6 +29,7 @@
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/util.h"
 #include "arrow/util/bit_util.h"
+#include "arrow/util/bpacking.h"
 
 namespace arrow {
 
@@ -384,6 +386,74 @@ BENCHMARK(GenerateBitsUnrolled)->Arg(kBufferSize);
 BENCHMARK(CopyBitmapWithoutOffset)->Arg(kBufferSize);
 BENCHMARK(CopyBitmapWithOffset)->Arg(kBufferSize);
 
+// Unpack kUnpackValues bit-packed values of state.range(0) bits, or look them
+// up in a dictionary of Word values
+constexpr int kUnpackValues = 4096;
+
+static std::vector<uint32_t> BitPackedIndices(int num_bits) {
+  std::vector<uint32_t> packed(kUnpackValues / 32 * num_bits);
+  random_bytes(packed.size() * sizeof(uint32_t), 0,
+               reinterpret_cast<uint8_t*>(packed.data()));
+  return packed;
+}
+
+static void Unpack32(benchmark::State& state) {  // NOLINT non-const reference
+  const int num_bits = static_cast<int>(state.range(0));
+  const std::vector<uint32_t> packed = BitPackedIndices(num_bits);
+  std::vector<uint32_t> out(kUnpackValues);
+  for (auto _ : state) {
+    internal::unpack32(packed.data(), out.data(), kUnpackValues, num_bits);
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetItemsProcessed(state.iterations() * kUnpackValues);
+}
+
+template <typename Word>
+static void Unpack32Gather(benchmark::State& state) {  // NOLINT non-const reference
+  const int num_bits = static_cast<int>(state.range(0));
+  const std::vector<uint32_t> packed = BitPackedIndices(num_bits);
+  std::vector<Word> dictionary(1ULL << num_bits);
+  std::vector<Word> out(kUnpackValues);
+  const auto gather =
+      sizeof(Word) == 4 ? internal::unpack32_gather32 : internal::unpack32_gather64;
+  for (auto _ : state) {
+    gather(packed.data(), dictionary.data(), out.data(), kUnpackValues, num_bits);
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetItemsProcessed(state.iterations() * kUnpackValues);
+}
+
+// The unpacking followed by a lookup, as before the fused gathers
+template <typename Word>
+static void Unpack32ThenLookup(benchmark::State& state) {  // NOLINT non-const reference
+  const int num_bits = static_cast<int>(state.range(0));
+  const std::vector<uint32_t> packed = BitPackedIndices(num_bits);
+  std::vector<Word> dictionary(1ULL << num_bits);
+  std::vector<uint32_t> indices(kUnpackValues);
+  std::vector<Word> out(kUnpackValues);
+  for (auto _ : state) {
+    internal::unpack32(packed.data(), indices.data(), kUnpackValues, num_bits);
+    for (int i = 0; i < kUnpackValues; ++i) {
+      out[i] = dictionary[indices[i]];
+    }
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetItemsProcessed(state.iterations() * kUnpackValues);
+}
+
+// Bit widths of dictionary indices
+static void SetGatherArgs(benchmark::internal::Benchmark* bench) {
+  for (int num_bits : {1, 8, 12, 16, 20}) {
+    bench->Arg(num_bits);
+  }
+}
+
+BENCHMARK(Unpack32)->DenseRange(1, 32, 1);
+BENCHMARK_TEMPLATE(Unpack32Gather, uint32_t)->Apply(SetGatherArgs);
+BENCHMARK_TEMPLATE(Unpack32Gather, uint64_t)->Apply(SetGatherArgs);
+BENCHMARK_TEMPLATE(Unpack32ThenLookup, uint32_t)->Apply(SetGatherArgs);
+BENCHMARK_TEMPLATE(Unpack32ThenLookup, uint64_t)->Apply(SetGatherArgs);
+
 #define AND_BENCHMARK_RANGES                      \
   {                                               \
     {kBufferSize * 4, kBufferSize * 16}, { 0, 2 } \
@@ -24,6 +24,7 @@
 #include <limits>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <gtest/gtest.h>
@@ -36,6 +37,9 @@
 #include "arrow/testing/gtest_util.h"
 #include "arrow/util/bit_stream_utils.h"
 #include "arrow/util/bit_util.h"
+#include "arrow/util/bitmap_ops_internal.h"
+#include "arrow/util/bpacking.h"
+#include "arrow/util/bpacking_simd_internal.h"
 #include "arrow/util/cpu_info.h"
 
 namespace arrow {
@@ -663,6 +667,42 @@ TEST_F(BitmapOp, Xor) {
   TestUnaligned(op, left, right, result);
 }
 
+template <typename Op>
+void CheckAlignedBitmapOpLevels() {
+  using internal::DispatchLevel;
+  std::vector<uint8_t> left(1000), right(1000), expected(1000), out(1000);
+  random_bytes(1000, 0x9a2f11, left.data());
+  random_bytes(1000, 0x7b5e40, right.data());
+  std::transform(left.begin(), left.end(), right.begin(), expected.begin(), Op());
+
+  auto check = [&](void (*func)(const uint8_t*, const uint8_t*, uint8_t*, int64_t)) {
+    for (int64_t nbytes : {0, 1, 7, 8, 9, 100, 1000}) {
+      std::fill(out.begin(), out.end(), 0);
+      func(left.data(), right.data(), out.data(), nbytes);
+      ASSERT_TRUE(std::equal(out.begin(), out.begin() + nbytes, expected.begin()));
+      ASSERT_TRUE(std::all_of(out.begin() + nbytes, out.end(),
+                              [](uint8_t byte) { return byte == 0; }));
+    }
+  };
+  check(internal::AlignedBitmapOpLoop<DispatchLevel::NONE, Op>);
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+  if (internal::CpuInfo::GetInstance()->IsSupported(internal::CpuInfo::AVX2)) {
+    check(internal::AlignedBitmapOpAvx2<Op>);
+  }
+#endif
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+  if (internal::CpuInfo::GetInstance()->IsSupported(internal::CpuInfo::AVX512)) {
+    check(internal::AlignedBitmapOpAvx512<Op>);
+  }
+#endif
+}
+
+TEST(BitmapOpDispatch, AlignedLevels) {
+  CheckAlignedBitmapOpLevels<std::bit_and<uint8_t>>();
+  CheckAlignedBitmapOpLevels<std::bit_or<uint8_t>>();
+  CheckAlignedBitmapOpLevels<std::bit_xor<uint8_t>>();
+}
+
 static inline int64_t SlowCountBits(const uint8_t* data, int64_t bit_offset,
                                     int64_t length) {
   int64_t count = 0;
@@ -1075,6 +1115,200 @@ TEST(BitStreamUtil, ZigZag) {
   TestZigZag(-std::numeric_limits<int32_t>::max());
 }
 
+static void TestZigZag64(int64_t v) {
+  uint8_t buffer[BitUtil::BitReader::MAX_VLQ_BYTE_LEN_64] = {};
+  BitUtil::BitWriter writer(buffer, sizeof(buffer));
+  BitUtil::BitReader reader(buffer, sizeof(buffer));
+  writer.PutZigZagVlqInt(v);
+  int64_t result;
+  EXPECT_TRUE(reader.GetZigZagVlqInt(&result));
+  EXPECT_EQ(v, result);
+}
+
+TEST(BitStreamUtil, ZigZag64) {
+  TestZigZag64(0);
+  TestZigZag64(1);
+  TestZigZag64(1234);
+  TestZigZag64(-1);
+  TestZigZag64(-1234);
+  TestZigZag64(std::numeric_limits<int64_t>::max());
+  TestZigZag64(std::numeric_limits<int64_t>::min());
+}
+
+TEST(BitStreamUtil, WideValues) {
+  // Values of 33 to 64 bits, some crossing the 64-bit boundaries of the
+  // writer's and reader's buffered words
+  std::vector<uint64_t> values;
+  std::vector<int> widths;
+  for (int num_bits = 1; num_bits <= 64; ++num_bits) {
+    const uint64_t mask = num_bits == 64 ? ~0ULL : (1ULL << num_bits) - 1;
+    values.push_back(0x9E3779B97F4A7C15ULL * static_cast<uint64_t>(num_bits) & mask);
+    widths.push_back(num_bits);
+  }
+
+  std::vector<uint8_t> buffer(64 * 64 / 8);
+  BitUtil::BitWriter writer(buffer.data(), static_cast<int>(buffer.size()));
+  for (size_t i = 0; i < values.size(); ++i) {
+    ASSERT_TRUE(writer.PutValue(values[i], widths[i]));
+  }
+  writer.Flush();
+
+  BitUtil::BitReader reader(buffer.data(), static_cast<int>(buffer.size()));
+  for (size_t i = 0; i < values.size(); ++i) {
+    uint64_t value = 0;
+    ASSERT_TRUE(reader.GetValue(widths[i], &value));
+    ASSERT_EQ(values[i], value) << "num_bits = " << widths[i];
+  }
+
+  // A batch of 64-bit values
+  BitUtil::BitWriter batch_writer(buffer.data(), static_cast<int>(buffer.size()));
+  for (uint64_t value : values) {
+    ASSERT_TRUE(batch_writer.PutValue(value, 64));
+  }
+  batch_writer.Flush();
+  std::vector<uint64_t> read_values(values.size());
+  BitUtil::BitReader batch_reader(buffer.data(), static_cast<int>(buffer.size()));
+  ASSERT_EQ(
+      static_cast<int>(values.size()),
+      batch_reader.GetBatch(64, read_values.data(), static_cast<int>(values.size())));
+  ASSERT_EQ(values, read_values);
+}
+
+// Bit-pack `num_values` values of num_bits bits, less than `max_value`, into
+// a buffer of exactly the packed size
+static void MakeBitPacked(int num_bits, int num_values, uint32_t max_value,
+                          std::vector<uint32_t>* values, std::vector<uint32_t>* packed) {
+  const uint64_t mask = (1ULL << num_bits) - 1;
+  values->resize(num_values);
+  packed->assign(num_values / 32 * num_bits, 0);
+  std::vector<uint8_t> bytes(packed->size() * 4 + 8);
+  BitUtil::BitWriter writer(bytes.data(), static_cast<int>(bytes.size()));
+  for (int i = 0; i < num_values; ++i) {
+    const uint64_t value = (0x9E3779B97F4A7C15ULL * (i + 1)) >> 17 & mask;
+    (*values)[i] = static_cast<uint32_t>(value % max_value);
+    ASSERT_TRUE(writer.PutValue((*values)[i], num_bits));
+  }
+  writer.Flush();
+  std::memcpy(packed->data(), bytes.data(), packed->size() * 4);
+}
+
+using Unpack32Func = int (*)(const uint32_t*, uint32_t*, int, int);
+using Unpack32GatherFunc = int (*)(const uint32_t*, const void*, void*, int, int);
+
+static std::vector<std::pair<std::string, Unpack32Func>> Unpack32Levels() {
+  std::vector<std::pair<std::string, Unpack32Func>> levels = {
+      {"default", internal::unpack32_default}, {"dispatched", internal::unpack32}};
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+  if (internal::CpuInfo::GetInstance()->IsSupported(internal::CpuInfo::AVX2)) {
+    levels.emplace_back("avx2", internal::unpack32_avx2);
+  }
+#endif
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+  if (internal::CpuInfo::GetInstance()->IsSupported(internal::CpuInfo::AVX512)) {
+    levels.emplace_back("avx512", internal::unpack32_avx512);
+  }
+#endif
+  return levels;
+}
+
+TEST(BitPacking, Unpack32Levels) {
+  for (const auto& level : Unpack32Levels()) {
+    for (int num_bits = 0; num_bits <= 32; ++num_bits) {
+      // Few blocks go through the padded copies only
+      for (int num_values : {32, 64, 96, 32 * 50}) {
+        std::vector<uint32_t> values, packed, out(num_values + 32, 0xDEADBEEF);
+        MakeBitPacked(num_bits, num_values, UINT32_MAX, &values, &packed);
+        // A trailing partial block is left alone
+        ASSERT_EQ(num_values, level.second(packed.data(), out.data(), num_values + 31,
+                                           num_bits));
+        ASSERT_TRUE(std::equal(values.begin(), values.end(), out.begin()))
+            << level.first << " num_bits = " << num_bits
+            << " num_values = " << num_values;
+        ASSERT_EQ(0xDEADBEEF, out[num_values]);
+      }
+    }
+  }
+}
+
+template <typename Word>
+void CheckUnpack32Gather(Unpack32GatherFunc func, const std::string& level) {
+  std::vector<Word> dictionary(1000);
+  for (size_t i = 0; i < dictionary.size(); ++i) {
+    dictionary[i] = static_cast<Word>(0x0123456789ABCDEFULL * (i + 1));
+  }
+  for (int num_bits = 0; num_bits <= 32; ++num_bits) {
+    const int num_values = 32 * 50;
+    std::vector<uint32_t> indices, packed;
+    MakeBitPacked(num_bits, num_values, static_cast<uint32_t>(dictionary.size()),
+                  &indices, &packed);
+    std::vector<Word> out(num_values);
+    ASSERT_EQ(num_values,
+              func(packed.data(), dictionary.data(), out.data(), num_values, num_bits));
+    for (int i = 0; i < num_values; ++i) {
+      ASSERT_EQ(dictionary[indices[i]], out[i])
+          << level << " num_bits = " << num_bits << " i = " << i;
+    }
+  }
+}
+
+TEST(BitPacking, Unpack32GatherLevels) {
+  CheckUnpack32Gather<uint32_t>(internal::unpack32_gather32, "dispatched");
+  CheckUnpack32Gather<uint64_t>(internal::unpack32_gather64, "dispatched");
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+  if (internal::CpuInfo::GetInstance()->IsSupported(internal::CpuInfo::AVX2)) {
+    CheckUnpack32Gather<uint32_t>(internal::unpack32_gather32_avx2, "avx2");
+  }
+#endif
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+  if (internal::CpuInfo::GetInstance()->IsSupported(internal::CpuInfo::AVX512)) {
+    CheckUnpack32Gather<uint32_t>(internal::unpack32_gather32_avx512, "avx512");
+    CheckUnpack32Gather<uint64_t>(internal::unpack32_gather64_avx512, "avx512");
+  }
+#endif
+}
+
+template <typename T>
+void CheckGetBatchWithDict(const std::vector<T>& dictionary) {
+  const int num_values = 1000;
+  const int num_bits = 7;
+  std::vector<uint8_t> buffer(num_values * num_bits / 8 + 1);
+  BitUtil::BitWriter writer(buffer.data(), static_cast<int>(buffer.size()));
+  std::vector<int> indices(num_values);
+  for (int i = 0; i < num_values; ++i) {
+    indices[i] = (i * 37) % static_cast<int>(dictionary.size());
+    ASSERT_TRUE(writer.PutValue(indices[i], num_bits));
+  }
+  writer.Flush();
+
+  // Batches starting at unaligned bit offsets, some too short for a block
+  BitUtil::BitReader reader(buffer.data(), static_cast<int>(buffer.size()));
+  std::vector<T> out(num_values);
+  int values_read = 0;
+  for (int batch_size : {3, 100, 5, 31, 500, 1000}) {
+    values_read += reader.GetBatchWithDict(
+        num_bits, dictionary.data(), out.data() + values_read,
+        std::min(batch_size, num_values - values_read));
+  }
+  ASSERT_EQ(num_values, values_read);
+  for (int i = 0; i < num_values; ++i) {
+    ASSERT_EQ(dictionary[indices[i]], out[i]) << i;
+  }
+}
+
+TEST(BitStreamUtil, GetBatchWithDict) {
+  std::vector<float> floats;
+  std::vector<int64_t> ints;
+  std::vector<std::array<int32_t, 3>> triples;
+  for (int i = 0; i < 100; ++i) {
+    floats.push_back(static_cast<float>(i) * 1.5f);
+    ints.push_back(static_cast<int64_t>(i) << 40);
+    triples.push_back({{i, -i, 2 * i}});
+  }
+  CheckGetBatchWithDict(floats);
+  CheckGetBatchWithDict(ints);
+  CheckGetBatchWithDict(triples);
+}
+
 TEST(BitUtil, RoundTripLittleEndianTest) {
   uint64_t value = 0xFF;
 
@@ -0,0 +1,46 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Bitmap operations compiled with AVX512 code generation, see
+// bitmap_ops_internal.h
+
+#include <cstdint>
+#include <functional>
+
+#include "arrow/util/bitmap_ops_internal.h"
+
+namespace arrow {
+namespace internal {
+
+template <typename Op>
+void AlignedBitmapOpAvx512(const uint8_t* left, const uint8_t* right, uint8_t* out,
+                           int64_t nbytes) {
+  AlignedBitmapOpLoop<DispatchLevel::AVX512, Op>(left, right, out, nbytes);
+}
+
+#define INSTANTIATE_BITMAP_OP(Op)                                         \
+  template void AlignedBitmapOpAvx512<Op>(const uint8_t*, const uint8_t*, \
+                                          uint8_t*, int64_t);
+
+INSTANTIATE_BITMAP_OP(std::bit_and<uint8_t>)
+INSTANTIATE_BITMAP_OP(std::bit_or<uint8_t>)
+INSTANTIATE_BITMAP_OP(std::bit_xor<uint8_t>)
+
+#undef INSTANTIATE_BITMAP_OP
+
+}  // namespace internal
+}  // namespace arrow
@@ -0,0 +1,111 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include "arrow/util/dispatch.h"
+
+namespace arrow {
+namespace internal {
+
+// ----------------------------------------------------------------------
+// Bitwise operations on byte-aligned bitmaps, with an implementation for each
+// DispatchLevel
+
+/// The bitwise operation of a std functor, applied to any unsigned word type
+template <DispatchLevel Level, typename Op>
+struct BitmapWordOp;
+
+template <DispatchLevel Level>
+struct BitmapWordOp<Level, std::bit_and<uint8_t>> {
+  template <typename Word>
+  static Word Call(Word left, Word right) {
+    return left & right;
+  }
+};
+
+template <DispatchLevel Level>
+struct BitmapWordOp<Level, std::bit_or<uint8_t>> {
+  template <typename Word>
+  static Word Call(Word left, Word right) {
+    return left | right;
+  }
+};
+
+template <DispatchLevel Level>
+struct BitmapWordOp<Level, std::bit_xor<uint8_t>> {
+  template <typename Word>
+  static Word Call(Word left, Word right) {
+    return left ^ right;
+  }
+};
+
+/// Compute out[i] = op(left[i], right[i]) for nbytes bytes, 64 bits at a time
+template <DispatchLevel Level, typename Op>
+void AlignedBitmapOpLoop(const uint8_t* left, const uint8_t* right, uint8_t* out,
+                         int64_t nbytes) {
+  using WordOp = BitmapWordOp<Level, Op>;
+  const int64_t nwords = nbytes / 8;
+  for (int64_t i = 0; i < nwords; ++i) {
+    uint64_t left_word, right_word;
+    std::memcpy(&left_word, left + i * 8, sizeof(uint64_t));
+    std::memcpy(&right_word, right + i * 8, sizeof(uint64_t));
+    const uint64_t out_word = WordOp::Call(left_word, right_word);
+    std::memcpy(out + i * 8, &out_word, sizeof(uint64_t));
+  }
+  for (int64_t i = nwords * 8; i < nbytes; ++i) {
+    out[i] = WordOp::Call(left[i], right[i]);
+  }
+}
+
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+template <typename Op>
+void AlignedBitmapOpAvx2(const uint8_t* left, const uint8_t* right, uint8_t* out,
+                         int64_t nbytes);
+#endif
+
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+template <typename Op>
+void AlignedBitmapOpAvx512(const uint8_t* left, const uint8_t* right, uint8_t* out,
+                           int64_t nbytes);
+#endif
+
+template <typename Op>
+struct AlignedBitmapOpDynamic {
+  using FunctionType = decltype(&AlignedBitmapOpLoop<DispatchLevel::NONE, Op>);
+
+  static std::vector<std::pair<DispatchLevel, FunctionType>> implementations() {
+    return {
+      {DispatchLevel::NONE, AlignedBitmapOpLoop<DispatchLevel::NONE, Op>}
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+      , {DispatchLevel::AVX2, AlignedBitmapOpAvx2<Op>}
+#endif
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+      , {DispatchLevel::AVX512, AlignedBitmapOpAvx512<Op>}
+#endif
+    };
+  }
+};
+
+}  // namespace internal
+}  // namespace arrow
@@ -0,0 +1,119 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/bpacking.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+#include "arrow/util/bpacking_simd_internal.h"
+#include "arrow/util/dispatch.h"
+
+namespace arrow {
+namespace internal {
+
+namespace {
+
+template <typename Word>
+int unpack32_gather_default(const uint32_t* in, const void* dictionary, void* out,
+                            int batch_size, int num_bits) {
+  const auto* dict = reinterpret_cast<const uint8_t*>(dictionary);
+  auto* out_bytes = reinterpret_cast<uint8_t*>(out);
+  constexpr int kBufferSize = 1024;
+  uint32_t indices[kBufferSize];
+  batch_size = batch_size / 32 * 32;
+  for (int i = 0; i < batch_size; i += kBufferSize) {
+    const int num_unpacked =
+        unpack32_default(in, indices, std::min(kBufferSize, batch_size - i), num_bits);
+    for (int k = 0; k < num_unpacked; ++k) {
+      std::memcpy(out_bytes + (i + k) * sizeof(Word), dict + indices[k] * sizeof(Word),
+                  sizeof(Word));
+    }
+    in += num_unpacked * num_bits / 32;
+  }
+  return batch_size;
+}
+
+struct Unpack32Dynamic {
+  using FunctionType = decltype(&unpack32_default);
+
+  static std::vector<std::pair<DispatchLevel, FunctionType>> implementations() {
+    return {
+      {DispatchLevel::NONE, unpack32_default}
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+      , {DispatchLevel::AVX2, unpack32_avx2}
+#endif
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+      , {DispatchLevel::AVX512, unpack32_avx512}
+#endif
+    };
+  }
+};
+
+struct Unpack32Gather32Dynamic {
+  using FunctionType = decltype(&unpack32_gather_default<uint32_t>);
+
+  static std::vector<std::pair<DispatchLevel, FunctionType>> implementations() {
+    return {
+      {DispatchLevel::NONE, unpack32_gather_default<uint32_t>}
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+      , {DispatchLevel::AVX2, unpack32_gather32_avx2}
+#endif
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+      , {DispatchLevel::AVX512, unpack32_gather32_avx512}
+#endif
+    };
+  }
+};
+
+struct Unpack32Gather64Dynamic {
+  using FunctionType = decltype(&unpack32_gather_default<uint64_t>);
+
+  static std::vector<std::pair<DispatchLevel, FunctionType>> implementations() {
+    return {
+      {DispatchLevel::NONE, unpack32_gather_default<uint64_t>}
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+      , {DispatchLevel::AVX512, unpack32_gather64_avx512}
+#endif
+    };
+  }
+};
+
+}  // namespace
+
+int unpack32(const uint32_t* in, uint32_t* out, int batch_size, int num_bits) {
+  static DynamicDispatch<Unpack32Dynamic> dispatch;
+  return dispatch.func(in, out, batch_size, num_bits);
+}
+
+int unpack32_gather32(const uint32_t* in, const void* dictionary, void* out,
+                      int batch_size, int num_bits) {
+  static DynamicDispatch<Unpack32Gather32Dynamic> dispatch;
+  return dispatch.func(in, dictionary, out, batch_size, num_bits);
+}
+
+int unpack32_gather64(const uint32_t* in, const void* dictionary, void* out,
+                      int batch_size, int num_bits) {
+  static DynamicDispatch<Unpack32Gather64Dynamic> dispatch;
+  return dispatch.func(in, dictionary, out, batch_size, num_bits);
+}
+
+}  // namespace internal
+}  // namespace arrow
@@ -27,8 +27,11 @@
 #ifndef ARROW_UTIL_BPACKING_H
 #define ARROW_UTIL_BPACKING_H
 
+#include <cstdint>
+
 #include "arrow/util/logging.h"
 #include "arrow/util/ubsan.h"
+#include "arrow/util/visibility.h"
 
 namespace arrow {
 namespace internal {
@@ -3720,7 +3723,9 @@ inline const uint32_t* nullunpacker32(const uint32_t* in, uint32_t* out) {
   return in;
 }
 
-inline int unpack32(const uint32_t* in, uint32_t* out, int batch_size, int num_bits) {
+/// Unpack batch_size / 32 * 32 values of num_bits bits, one value at a time
+inline int unpack32_default(const uint32_t* in, uint32_t* out, int batch_size,
+                            int num_bits) {
   batch_size = batch_size / 32 * 32;
   int num_loops = batch_size / 32;
 
@@ -3831,6 +3836,24 @@ inline int unpack32(const uint32_t* in, uint32_t* out, int batch_size, int num_b
   return batch_size;
 }
 
+/// \brief Unpack batch_size / 32 * 32 values of num_bits bits from `in` to `out`
+///
+/// This uses the widest SIMD implementation the CPU supports, see
+/// bpacking_simd_internal.h.  Returns the number of values unpacked.
+ARROW_EXPORT int unpack32(const uint32_t* in, uint32_t* out, int batch_size,
+                          int num_bits);
+
+/// \brief Like unpack32, but write dictionary[value] instead of each value
+///
+/// The dictionary holds 4-byte values; for dictionary indices, this fuses the
+/// unpacking and the dictionary lookup.
+ARROW_EXPORT int unpack32_gather32(const uint32_t* in, const void* dictionary, void* out,
+                                   int batch_size, int num_bits);
+
+/// \brief Like unpack32_gather32, for dictionaries of 8-byte values
+ARROW_EXPORT int unpack32_gather64(const uint32_t* in, const void* dictionary, void* out,
+                                   int batch_size, int num_bits);
+
 }  // namespace internal
 }  // namespace arrow
 
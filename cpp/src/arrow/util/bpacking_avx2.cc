@@ -0,0 +1,125 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Bit unpacking compiled with AVX2 code generation, see
+// bpacking_simd_internal.h
+
+#include <immintrin.h>
+
+#include <cstdint>
+#include <cstring>
+
+#include "arrow/util/bpacking_simd_internal.h"
+
+namespace arrow {
+namespace internal {
+
+namespace {
+
+constexpr int kLanes = 8;
+using Layout = UnpackLayout<DispatchLevel::AVX2, kLanes>;
+
+const Layout& GetLayout() {
+  static const Layout layout;
+  return layout;
+}
+
+inline __m256i LoadWords(const uint32_t* words) {
+  return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(words));
+}
+
+/// The shuffles and shifts of the groups of a bit width, kept in registers
+struct GroupVectors {
+  GroupVectors(const Layout::Group (&groups)[Layout::kNumGroups], int num_bits)
+      : mask(_mm256_set1_epi32(static_cast<int>((1ULL << num_bits) - 1))) {
+    for (int g = 0; g < Layout::kNumGroups; ++g) {
+      first_word[g] = groups[g].first_word;
+      word_index[g] = LoadWords(groups[g].word_index);
+      right_shift[g] = LoadWords(groups[g].right_shift);
+      left_shift[g] = LoadWords(groups[g].left_shift);
+    }
+  }
+
+  /// Unpack the kLanes values of group g of the block at `words`
+  __m256i Unpack(const uint32_t* words, int g) const {
+    words += first_word[g];
+    const __m256i lo = _mm256_permutevar8x32_epi32(LoadWords(words), word_index[g]);
+    const __m256i hi = _mm256_permutevar8x32_epi32(LoadWords(words + 1), word_index[g]);
+    const __m256i value = _mm256_or_si256(_mm256_srlv_epi32(lo, right_shift[g]),
+                                          _mm256_sllv_epi32(hi, left_shift[g]));
+    return _mm256_and_si256(value, mask);
+  }
+
+  int first_word[Layout::kNumGroups];
+  __m256i word_index[Layout::kNumGroups];
+  __m256i right_shift[Layout::kNumGroups];
+  __m256i left_shift[Layout::kNumGroups];
+  __m256i mask;
+};
+
+/// Unpack the values of num_bits bits (1 to 31) and pass each group of kLanes
+/// values to emit(values, out_index)
+template <typename Emit>
+int UnpackGroups(const uint32_t* in, int batch_size, int num_bits, Emit&& emit) {
+  const GroupVectors vectors(GetLayout().groups[num_bits], num_bits);
+  return UnpackBlocks<DispatchLevel::AVX2, kLanes>(
+      in, batch_size, num_bits, [&](const uint32_t* words, int block) {
+        for (int g = 0; g < Layout::kNumGroups; ++g) {
+          emit(vectors.Unpack(words, g), block * 32 + g * kLanes);
+        }
+      });
+}
+
+}  // namespace
+
+int unpack32_avx2(const uint32_t* in, uint32_t* out, int batch_size, int num_bits) {
+  batch_size = batch_size / 32 * 32;
+  if (num_bits == 0) {
+    std::memset(out, 0, batch_size * sizeof(uint32_t));
+    return batch_size;
+  }
+  if (num_bits == 32) {
+    std::memcpy(out, in, batch_size * sizeof(uint32_t));
+    return batch_size;
+  }
+  return UnpackGroups(in, batch_size, num_bits, [out](__m256i values, int i) {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), values);
+  });
+}
+
+int unpack32_gather32_avx2(const uint32_t* in, const void* dictionary, void* out,
+                           int batch_size, int num_bits) {
+  batch_size = batch_size / 32 * 32;
+  const auto* dict = reinterpret_cast<const int*>(dictionary);
+  auto* out_words = reinterpret_cast<uint32_t*>(out);
+  if (num_bits == 0 || num_bits == 32) {
+    // Constant indices, or indices too wide for the signed offsets of gathers
+    for (int i = 0; i < batch_size; ++i) {
+      uint32_t index = 0;
+      if (num_bits == 32) std::memcpy(&index, in + i, sizeof(uint32_t));
+      std::memcpy(out_words + i, dict + index, sizeof(uint32_t));
+    }
+    return batch_size;
+  }
+  return UnpackGroups(in, batch_size, num_bits, [&](__m256i indices, int i) {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out_words + i),
+                        _mm256_i32gather_epi32(dict, indices, 4));
+  });
+}
+
+}  // namespace internal
+}  // namespace arrow
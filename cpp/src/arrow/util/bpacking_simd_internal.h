@@ -0,0 +1,111 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+#include "arrow/util/dispatch.h"
+
+namespace arrow {
+namespace internal {
+
+// ----------------------------------------------------------------------
+// Bit unpacking with SIMD shuffles and shifts, with an implementation for each
+// DispatchLevel
+//
+// A block of 32 values of b bits takes b 32-bit words.  The values are
+// unpacked kLanes at a time: the words each lane needs are shuffled into
+// place, shifted right by the bit offset of the value, ORed with the next
+// word shifted left for values straddling two words, and masked.  The
+// implementations must not include bpacking.h, whose inline scalar unpackers
+// would otherwise be compiled with wider instruction sets.
+
+/// Where the values of a block of 32 values of each bit width start, for
+/// groups of kLanes values
+template <DispatchLevel Level, int kLanes>
+struct UnpackLayout {
+  static constexpr int kNumGroups = 32 / kLanes;
+
+  struct Group {
+    // The first word loaded for the group, relative to the block
+    int first_word;
+    // For each lane, the word holding the start of the value, relative to
+    // first_word, and the shifts aligning the value and its straddling bits
+    uint32_t word_index[kLanes];
+    uint32_t right_shift[kLanes];
+    uint32_t left_shift[kLanes];
+  };
+
+  UnpackLayout() {
+    for (int num_bits = 0; num_bits <= 32; ++num_bits) {
+      for (int g = 0; g < kNumGroups; ++g) {
+        Group* group = &groups[num_bits][g];
+        group->first_word = g * kLanes * num_bits / 32;
+        for (int lane = 0; lane < kLanes; ++lane) {
+          const int bit = (g * kLanes + lane) * num_bits;
+          group->word_index[lane] = static_cast<uint32_t>(bit / 32 - group->first_word);
+          group->right_shift[lane] = static_cast<uint32_t>(bit % 32);
+          // A shift by 32 gives zero for values within one word
+          group->left_shift[lane] = static_cast<uint32_t>(32 - bit % 32);
+        }
+      }
+    }
+  }
+
+  Group groups[33][kNumGroups];
+};
+
+/// Call unpack_block(words, block) for each of the batch_size / 32 blocks of
+/// num_bits-bit values in `in`, and return the number of values
+///
+/// The last group of a block reads up to kLanes words past the end of the
+/// block, so the blocks near the end of the input are first copied to a
+/// zero-padded buffer.
+template <DispatchLevel Level, int kLanes, typename UnpackBlock>
+int UnpackBlocks(const uint32_t* in, int batch_size, int num_bits,
+                 UnpackBlock&& unpack_block) {
+  const int num_blocks = batch_size / 32;
+  int block = 0;
+  for (; block < num_blocks && (num_blocks - block - 1) * num_bits >= kLanes; ++block) {
+    unpack_block(in + block * num_bits, block);
+  }
+  uint32_t padded[32 + kLanes] = {};
+  for (; block < num_blocks; ++block) {
+    std::memcpy(padded, in + block * num_bits, num_bits * sizeof(uint32_t));
+    unpack_block(padded, block);
+  }
+  return num_blocks * 32;
+}
+
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+int unpack32_avx2(const uint32_t* in, uint32_t* out, int batch_size, int num_bits);
+int unpack32_gather32_avx2(const uint32_t* in, const void* dictionary, void* out,
+                           int batch_size, int num_bits);
+#endif
+
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+int unpack32_avx512(const uint32_t* in, uint32_t* out, int batch_size, int num_bits);
+int unpack32_gather32_avx512(const uint32_t* in, const void* dictionary, void* out,
+                             int batch_size, int num_bits);
+int unpack32_gather64_avx512(const uint32_t* in, const void* dictionary, void* out,
+                             int batch_size, int num_bits);
+#endif
+
+}  // namespace internal
+}  // namespace arrow
@@ -46,6 +46,8 @@
 #include <mutex>
 #include <string>
 
+#include "arrow/result.h"
+#include "arrow/util/io_util.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/string.h"
 
@@ -123,8 +125,13 @@ static struct {
   int64_t flag;
 } flag_mappings[] = {
 #if (defined(__i386) || defined(_M_IX86) || defined(__x86_64__) || defined(_M_X64))
-    {"ssse3", CpuInfo::SSSE3},   {"sse4_1", CpuInfo::SSE4_1},
-    {"sse4_2", CpuInfo::SSE4_2}, {"popcnt", CpuInfo::POPCNT},
+    {"ssse3", CpuInfo::SSSE3},       {"sse4_1", CpuInfo::SSE4_1},
+    {"sse4_2", CpuInfo::SSE4_2},     {"popcnt", CpuInfo::POPCNT},
+    {"avx", CpuInfo::AVX},           {"avx2", CpuInfo::AVX2},
+    {"avx512f", CpuInfo::AVX512F},   {"avx512cd", CpuInfo::AVX512CD},
+    {"avx512vl", CpuInfo::AVX512VL}, {"avx512dq", CpuInfo::AVX512DQ},
+    {"avx512bw", CpuInfo::AVX512BW}, {"bmi1", CpuInfo::BMI1},
+    {"bmi2", CpuInfo::BMI2},         {"pclmulqdq", CpuInfo::CLMUL},
 #endif
 #if defined(__aarch64__)
     {"asimd", CpuInfo::ASIMD},
@@ -137,13 +144,23 @@ namespace {
 
 // Helper function to parse for hardware flags.
 // values contains a list of space-separated flags.  check to see if the flags we
-// care about are present.
+// care about are present.  Flags are matched as whole words, since some
+// names are prefixes of others (e.g. "avx" and "avx2").
 // Returns a bitmap of flags.
 int64_t ParseCPUFlags(const std::string& values) {
+  auto is_separator = [](char c) { return c == ' ' || c == '\t'; };
   int64_t flags = 0;
   for (int i = 0; i < num_flags; ++i) {
-    if (values.find(flag_mappings[i].name) != std::string::npos) {
-      flags |= flag_mappings[i].flag;
+    const std::string& name = flag_mappings[i].name;
+    size_t pos = 0;
+    while ((pos = values.find(name, pos)) != std::string::npos) {
+      const size_t end = pos + name.size();
+      if ((pos == 0 || is_separator(values[pos - 1])) &&
+          (end == values.size() || is_separator(values[end]))) {
+        flags |= flag_mappings[i].flag;
+        break;
+      }
+      pos = end;
     }
   }
   return flags;
@@ -152,6 +169,30 @@ int64_t ParseCPUFlags(const std::string& values) {
 }  // namespace
 #endif
 
+namespace {
+
+// Restrict the hardware flags to the instruction sets allowed by the
+// ARROW_USER_SIMD_LEVEL environment variable (NONE, AVX2, AVX512 or MAX),
+// e.g. to compare the dispatched implementations on the same machine.
+int64_t UserSimdLevelMask() {
+  auto maybe_level = GetEnvVar("ARROW_USER_SIMD_LEVEL");
+  if (!maybe_level.ok()) {
+    return ~int64_t(0);
+  }
+  std::string level = *maybe_level;
+  std::transform(level.begin(), level.end(), level.begin(), ::toupper);
+  if (level == "NONE") {
+    return ~(CpuInfo::AVX | CpuInfo::AVX2 | CpuInfo::AVX512);
+  } else if (level == "AVX2") {
+    return ~CpuInfo::AVX512;
+  } else if (level != "AVX512" && level != "MAX" && !level.empty()) {
+    ARROW_LOG(WARNING) << "Invalid value for ARROW_USER_SIMD_LEVEL: " << level;
+  }
+  return ~int64_t(0);
+}
+
+}  // namespace
+
 #ifdef _WIN32
 bool RetrieveCacheSize(int64_t* cache_sizes) {
   if (!cache_sizes) {
@@ -231,10 +272,28 @@ bool RetrieveCPUInfo(int64_t* hardware_flags, std::string* model_name) {
     }
   }
 
+  if (features_ECX[1]) *hardware_flags |= CpuInfo::CLMUL;
   if (features_ECX[9]) *hardware_flags |= CpuInfo::SSSE3;
   if (features_ECX[19]) *hardware_flags |= CpuInfo::SSE4_1;
   if (features_ECX[20]) *hardware_flags |= CpuInfo::SSE4_2;
   if (features_ECX[23]) *hardware_flags |= CpuInfo::POPCNT;
+  if (features_ECX[28]) *hardware_flags |= CpuInfo::AVX;
+
+  // Extended features, see the Intel SDM, CPUID leaf 07H
+  const int register_extended_id = 7;
+  if (highest_valid_id >= register_extended_id) {
+    __cpuidex(cpu_info.data(), register_extended_id, 0);
+    std::bitset<32> features_EBX = cpu_info[1];
+
+    if (features_EBX[3]) *hardware_flags |= CpuInfo::BMI1;
+    if (features_EBX[5]) *hardware_flags |= CpuInfo::AVX2;
+    if (features_EBX[8]) *hardware_flags |= CpuInfo::BMI2;
+    if (features_EBX[16]) *hardware_flags |= CpuInfo::AVX512F;
+    if (features_EBX[17]) *hardware_flags |= CpuInfo::AVX512DQ;
+    if (features_EBX[28]) *hardware_flags |= CpuInfo::AVX512CD;
+    if (features_EBX[30]) *hardware_flags |= CpuInfo::AVX512BW;
+    if (features_EBX[31]) *hardware_flags |= CpuInfo::AVX512VL;
+  }
   return true;
 }
 #endif
@@ -327,6 +386,7 @@ void CpuInfo::Init() {
     cycles_per_ms_ = 1000000;
   }
   original_hardware_flags_ = hardware_flags_;
+  hardware_flags_ &= UserSimdLevelMask();
 
   if (num_cores > 0) {
     num_cores_ = num_cores;
@@ -0,0 +1,123 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <utility>
+#include <vector>
+
+#include "arrow/util/cpu_info.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+namespace internal {
+
+// Runtime dispatch of hot loops to implementations using wider SIMD
+// instruction sets.
+//
+// The implementation for a given level is compiled in its own translation
+// unit, with the compiler flags for that instruction set (see
+// ARROW_RUNTIME_SIMD_LEVEL in the CMake options), and is only selected if
+// the CPU supports it.  ARROW_HAVE_RUNTIME_AVX2 and ARROW_HAVE_RUNTIME_AVX512
+// are defined when the corresponding implementations are built.  The
+// ARROW_USER_SIMD_LEVEL environment variable can lower the level used at
+// runtime, e.g. ARROW_USER_SIMD_LEVEL=NONE selects the baseline loops.
+//
+// To avoid ODR violations, code shared between levels must be templated on
+// the DispatchLevel, so that each level gets its own instantiations.
+
+enum class DispatchLevel : int {
+  // These dispatch levels, corresponding to instruction set features,
+  // are sorted in increasing order of preference.
+  NONE = 0,
+  AVX2,
+  AVX512,
+  MAX
+};
+
+/// \brief Whether the CPU supports the instruction sets of a dispatch level
+inline bool IsDispatchLevelSupported(DispatchLevel level) {
+  const auto cpu_info = CpuInfo::GetInstance();
+  switch (level) {
+    case DispatchLevel::NONE:
+      return true;
+    case DispatchLevel::AVX2:
+      return cpu_info->IsSupported(CpuInfo::AVX2);
+    case DispatchLevel::AVX512:
+      return cpu_info->IsSupported(CpuInfo::AVX512);
+    default:
+      return false;
+  }
+}
+
+/*
+  A function pointer resolved, on construction, to the implementation of the
+  highest level supported by the CPU.
+
+  Typical use:
+
+    static void my_function_default(...);
+    static void my_function_avx2(...);
+
+    struct MyDynamicFunction {
+      using FunctionType = decltype(&my_function_default);
+
+      static std::vector<std::pair<DispatchLevel, FunctionType>> implementations() {
+        return {
+          { DispatchLevel::NONE, my_function_default }
+    #if defined(ARROW_HAVE_RUNTIME_AVX2)
+          , { DispatchLevel::AVX2, my_function_avx2 }
+    #endif
+        };
+      }
+    };
+
+    void my_function(...) {
+      static DynamicDispatch<MyDynamicFunction> dispatch;
+      return dispatch.func(...);
+    }
+*/
+template <typename DynamicFunction>
+class DynamicDispatch {
+ protected:
+  using FunctionType = typename DynamicFunction::FunctionType;
+  using Implementation = std::pair<DispatchLevel, FunctionType>;
+
+ public:
+  DynamicDispatch() { Resolve(DynamicFunction::implementations()); }
+
+  FunctionType func = {};
+
+ protected:
+  void Resolve(const std::vector<Implementation>& implementations) {
+    Implementation cur{DispatchLevel::NONE, {}};
+
+    for (const auto& impl : implementations) {
+      if (impl.first >= cur.first && IsDispatchLevelSupported(impl.first)) {
+        cur = impl;
+      }
+    }
+
+    if (!cur.second) {
+      ARROW_LOG(FATAL) << "No supported implementation found for dynamic function";
+    }
+    func = cur.second;
+  }
+};
+
+}  // namespace internal
+}  // namespace arrow
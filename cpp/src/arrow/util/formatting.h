@@ -27,8 +27,10 @@
 #include "arrow/status.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/checked_cast.h"
 #include "arrow/util/string_view.h"
 #include "arrow/util/visibility.h"
+#include "arrow/vendored/datetime.h"
 
 namespace arrow {
 namespace internal {
@@ -223,5 +225,151 @@ class StringFormatter<DoubleType> : public FloatToStringFormatterMixin<DoubleTyp
   using FloatToStringFormatterMixin::FloatToStringFormatterMixin;
 };
 
+
+/////////////////////////////////////////////////////////////////////////
+// Temporal formatting
+
+namespace detail {
+
+// Write the `width` lowest decimal digits of `value` backwards, ending at `*cursor`
+template <typename Int>
+inline void FormatAllDigits(Int value, int width, char** cursor) {
+  for (; width >= 2; width -= 2) {
+    const char* digit_pair = FormatTwoDigits(value % 100);
+    *--*cursor = digit_pair[1];
+    *--*cursor = digit_pair[0];
+    value /= 100;
+  }
+  if (width == 1) {
+    *--*cursor = FormatDigit(value % 10);
+  }
+}
+
+template <typename Int>
+inline Int FloorDiv(Int value, Int divisor) {
+  const Int quotient = value / divisor;
+  return (value % divisor < 0) ? quotient - 1 : quotient;
+}
+
+// Maximum size of a "[-]YYYY[YYY]-MM-DD" date
+constexpr int kDateBufferSize = 13;
+
+// Write the "YYYY-MM-DD" date of `days` since the UNIX epoch backwards, ending
+// at `*cursor`.  Years outside of [0, 9999] get more digits and / or a sign.
+inline void FormatDate(int64_t days, char** cursor) {
+  using arrow_vendored::date::sys_days;
+  using arrow_vendored::date::year_month_day;
+  const year_month_day ymd{
+      sys_days{arrow_vendored::date::days{static_cast<int32_t>(days)}}};
+
+  FormatAllDigits(static_cast<unsigned>(ymd.day()), 2, cursor);
+  *--*cursor = '-';
+  FormatAllDigits(static_cast<unsigned>(ymd.month()), 2, cursor);
+  *--*cursor = '-';
+  const int32_t year = static_cast<int32_t>(ymd.year());
+  uint32_t abs_year = year < 0 ? -static_cast<uint32_t>(year) : year;
+  FormatAllDigits(abs_year % 10000, 4, cursor);
+  for (abs_year /= 10000; abs_year > 0; abs_year /= 10) {
+    *--*cursor = FormatDigit(abs_year % 10);
+  }
+  if (year < 0) {
+    *--*cursor = '-';
+  }
+}
+
+}  // namespace detail
+
+template <>
+class StringFormatter<Date32Type> {
+ public:
+  using value_type = Date32Type::c_type;
+
+  explicit StringFormatter(const std::shared_ptr<DataType>& = NULLPTR) {}
+
+  template <typename Appender>
+  Status operator()(value_type value, Appender&& append) {
+    char buffer[detail::kDateBufferSize];
+    char* cursor = buffer + detail::kDateBufferSize;
+    detail::FormatDate(value, &cursor);
+    return append(util::string_view(cursor, buffer + detail::kDateBufferSize - cursor));
+  }
+};
+
+template <>
+class StringFormatter<Date64Type> {
+ public:
+  using value_type = Date64Type::c_type;
+
+  explicit StringFormatter(const std::shared_ptr<DataType>& = NULLPTR) {}
+
+  template <typename Appender>
+  Status operator()(value_type value, Appender&& append) {
+    constexpr int64_t kMillisecondsPerDay = 86400000LL;
+    char buffer[detail::kDateBufferSize];
+    char* cursor = buffer + detail::kDateBufferSize;
+    detail::FormatDate(detail::FloorDiv(value, kMillisecondsPerDay), &cursor);
+    return append(util::string_view(cursor, buffer + detail::kDateBufferSize - cursor));
+  }
+};
+
+/// Timestamps are formatted as "YYYY-MM-DD HH:MM:SS", followed by as many
+/// fractional digits as the unit requires (e.g. ".123" for milliseconds).
+/// The timezone, if any, is not written: values are always in UTC.
+template <>
+class StringFormatter<TimestampType> {
+ public:
+  using value_type = TimestampType::c_type;
+
+  explicit StringFormatter(const std::shared_ptr<DataType>& type) {
+    switch (checked_cast<const TimestampType&>(*type).unit()) {
+      case TimeUnit::SECOND:
+        units_per_second_ = 1;
+        fraction_width_ = 0;
+        break;
+      case TimeUnit::MILLI:
+        units_per_second_ = 1000;
+        fraction_width_ = 3;
+        break;
+      case TimeUnit::MICRO:
+        units_per_second_ = 1000000;
+        fraction_width_ = 6;
+        break;
+      case TimeUnit::NANO:
+        units_per_second_ = 1000000000;
+        fraction_width_ = 9;
+        break;
+    }
+  }
+
+  template <typename Appender>
+  Status operator()(value_type value, Appender&& append) {
+    // Date, space, "HH:MM:SS", dot and fraction
+    constexpr int kBufferSize = detail::kDateBufferSize + 1 + 8 + 1 + 9;
+    char buffer[kBufferSize];
+    char* cursor = buffer + kBufferSize;
+
+    const int64_t units_per_day = units_per_second_ * 86400;
+    const int64_t days = detail::FloorDiv(value, units_per_day);
+    const int64_t units_in_day = value - days * units_per_day;
+    if (fraction_width_ > 0) {
+      detail::FormatAllDigits(units_in_day % units_per_second_, fraction_width_, &cursor);
+      *--cursor = '.';
+    }
+    const int64_t seconds_in_day = units_in_day / units_per_second_;
+    detail::FormatAllDigits(seconds_in_day % 60, 2, &cursor);
+    *--cursor = ':';
+    detail::FormatAllDigits(seconds_in_day / 60 % 60, 2, &cursor);
+    *--cursor = ':';
+    detail::FormatAllDigits(seconds_in_day / 3600, 2, &cursor);
+    *--cursor = ' ';
+    detail::FormatDate(days, &cursor);
+    return append(util::string_view(cursor, buffer + kBufferSize - cursor));
+  }
+
+ private:
+  int64_t units_per_second_ = 1;
+  int fraction_width_ = 0;
+};
+
 }  // namespace internal
 }  // namespace arrow
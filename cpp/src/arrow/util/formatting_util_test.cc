@@ -279,4 +279,56 @@ TEST(Formatting, Double) {
   AssertFormatting(formatter, -HUGE_VAL, "-inf");
 }
 
+TEST(Formatting, Date32) {
+  StringFormatter<Date32Type> formatter;
+
+  AssertFormatting(formatter, 0, "1970-01-01");
+  AssertFormatting(formatter, 1, "1970-01-02");
+  AssertFormatting(formatter, -1, "1969-12-31");
+  AssertFormatting(formatter, 11016, "2000-02-29");
+  AssertFormatting(formatter, -719528, "0000-01-01");
+  AssertFormatting(formatter, 2932896, "9999-12-31");
+  AssertFormatting(formatter, 2932897, "10000-01-01");
+  AssertFormatting(formatter, -719529, "-0001-12-31");
+}
+
+TEST(Formatting, Date64) {
+  StringFormatter<Date64Type> formatter;
+
+  AssertFormatting(formatter, 0, "1970-01-01");
+  AssertFormatting(formatter, 86400000LL, "1970-01-02");
+  AssertFormatting(formatter, 951782400000LL, "2000-02-29");
+  // Times within the day are ignored
+  AssertFormatting(formatter, 86399999LL, "1970-01-01");
+  AssertFormatting(formatter, -1, "1969-12-31");
+}
+
+TEST(Formatting, Timestamp) {
+  {
+    StringFormatter<TimestampType> formatter(timestamp(TimeUnit::SECOND));
+
+    AssertFormatting(formatter, 0, "1970-01-01 00:00:00");
+    AssertFormatting(formatter, 951782400 + 3723, "2000-02-29 01:02:03");
+    AssertFormatting(formatter, -1, "1969-12-31 23:59:59");
+  }
+  {
+    StringFormatter<TimestampType> formatter(timestamp(TimeUnit::MILLI, "UTC"));
+
+    AssertFormatting(formatter, 0, "1970-01-01 00:00:00.000");
+    AssertFormatting(formatter, 951782403123LL, "2000-02-29 00:00:03.123");
+    AssertFormatting(formatter, -1, "1969-12-31 23:59:59.999");
+  }
+  {
+    StringFormatter<TimestampType> formatter(timestamp(TimeUnit::MICRO));
+
+    AssertFormatting(formatter, 1000001, "1970-01-01 00:00:01.000001");
+  }
+  {
+    StringFormatter<TimestampType> formatter(timestamp(TimeUnit::NANO));
+
+    AssertFormatting(formatter, 1000000001, "1970-01-01 00:00:01.000000001");
+    AssertFormatting(formatter, -1, "1969-12-31 23:59:59.999999999");
+  }
+}
+
 }  // namespace arrow
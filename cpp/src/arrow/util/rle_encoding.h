@@ -410,15 +410,9 @@ inline int RleDecoder::GetBatchWithDict(const T* dictionary, T* values, int batc
     } else if (literal_count_ > 0) {
       int literal_batch =
           std::min(batch_size - values_read, static_cast<int>(literal_count_));
-
-      const int buffer_size = 1024;
-      int indices[buffer_size];
-      literal_batch = std::min(literal_batch, buffer_size);
-      int actual_read = bit_reader_.GetBatch(bit_width_, &indices[0], literal_batch);
+      int actual_read = bit_reader_.GetBatchWithDict(bit_width_, dictionary,
+                                                     values + values_read, literal_batch);
       DCHECK_EQ(actual_read, literal_batch);
-      for (int i = 0; i < literal_batch; ++i) {
-        values[values_read + i] = dictionary[indices[i]];
-      }
       literal_count_ -= literal_batch;
       values_read += literal_batch;
     } else {
@@ -599,7 +593,7 @@ inline void RleEncoder::FlushRepeatedRun() {
   DCHECK_GT(repeat_count_, 0);
   bool result = true;
   // The lsb of 0 indicates this is a repeated run
-  int32_t indicator_value = repeat_count_ << 1 | 0;
+  uint32_t indicator_value = static_cast<uint32_t>(repeat_count_) << 1 | 0;
   result &= bit_writer_.PutVlqInt(indicator_value);
   result &= bit_writer_.PutAligned(current_value_,
                                    static_cast<int>(BitUtil::CeilDiv(bit_width_, 8)));
@@ -17,9 +17,11 @@
 
 // From Apache Impala (incubating) as of 2016-01-29
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
 #include <random>
+#include <utility>
 #include <vector>
 
 #include <gtest/gtest.h>
@@ -533,5 +535,55 @@ TEST(RleDecoder, GetBatchSpaced) {
   }
 }
 
+template <typename T>
+void CheckGetBatchWithDict(const std::vector<T>& dictionary, int bit_width) {
+  // Runs of repeated indices between literal runs
+  std::vector<int> indices;
+  for (int i = 0; i < 10000; ++i) {
+    const int index = (i * 7919) % static_cast<int>(dictionary.size());
+    const int repeats = i % 50 == 0 ? 20 : 1;
+    indices.insert(indices.end(), repeats, index);
+  }
+  const int num_values = static_cast<int>(indices.size());
+  const int buffer_size = RleEncoder::MaxBufferSize(bit_width, num_values);
+  std::vector<uint8_t> buffer(buffer_size);
+  RleEncoder encoder(buffer.data(), buffer_size, bit_width);
+  for (int index : indices) {
+    ASSERT_TRUE(encoder.Put(index));
+  }
+  const int encoded_size = encoder.Flush();
+
+  RleDecoder decoder(buffer.data(), encoded_size, bit_width);
+  std::vector<T> values(num_values);
+  int values_read = 0;
+  while (values_read < num_values) {
+    const int batch_size = std::min(777, num_values - values_read);
+    ASSERT_EQ(batch_size, decoder.GetBatchWithDict(dictionary.data(),
+                                                   values.data() + values_read,
+                                                   batch_size));
+    values_read += batch_size;
+  }
+  for (int i = 0; i < num_values; ++i) {
+    ASSERT_EQ(dictionary[indices[i]], values[i]) << i;
+  }
+}
+
+TEST(RleDecoder, GetBatchWithDict) {
+  for (int bit_width : {1, 5, 10}) {
+    const int dictionary_size = std::min(1 << bit_width, 1000);
+    std::vector<int32_t> int32s;
+    std::vector<double> doubles;
+    std::vector<std::pair<int64_t, int64_t>> pairs;
+    for (int i = 0; i < dictionary_size; ++i) {
+      int32s.push_back(i * 3 - 100);
+      doubles.push_back(i * 0.25);
+      pairs.emplace_back(i, -i);
+    }
+    CheckGetBatchWithDict(int32s, bit_width);
+    CheckGetBatchWithDict(doubles, bit_width);
+    CheckGetBatchWithDict(pairs, bit_width);
+  }
+}
+
 }  // namespace util
 }  // namespace arrow
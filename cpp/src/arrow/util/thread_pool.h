@@ -78,6 +78,10 @@ class ARROW_EXPORT ThreadPool {
   // Construct a thread pool with the given number of worker threads
   static Result<std::shared_ptr<ThreadPool>> Make(int threads);
 
+  // Like Make(), but for a pool which lives until the end of the process,
+  // e.g. a process-global singleton
+  static Result<std::shared_ptr<ThreadPool>> MakeEternal(int threads);
+
   // Destroy thread pool; the pool will first be shut down
   ~ThreadPool();
 
@@ -26,6 +26,7 @@
 #include <arrow/compute/api.h>
 #include <cstdint>
 #include <functional>
+#include <numeric>
 #include <sstream>
 #include <vector>
 
@@ -47,6 +48,7 @@
 #include "parquet/arrow/schema.h"
 #include "parquet/arrow/test_util.h"
 #include "parquet/arrow/writer.h"
+#include "parquet/bloom_filter.h"
 #include "parquet/column_writer.h"
 #include "parquet/file_writer.h"
 #include "parquet/test_util.h"
@@ -1973,6 +1975,513 @@ TEST(TestArrowReadWrite, GetRecordBatchReader) {
   ASSERT_EQ(nullptr, actual_batch);
 }
 
+TEST(TestArrowReadWrite, GetRecordBatchReaderUseThreads) {
+  const int num_columns = 20;
+  const int num_rows = 1000;
+  // Batches straddle the row group boundary
+  const int batch_size = 150;
+
+  std::shared_ptr<Table> table;
+  ASSERT_NO_FATAL_FAILURE(MakeDoubleTable(num_columns, num_rows, 1, &table));
+
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_NO_FATAL_FAILURE(WriteTableToBuffer(table, num_rows / 2,
+                                             default_arrow_writer_properties(), &buffer));
+
+  ArrowReaderProperties properties = default_arrow_reader_properties();
+  properties.set_batch_size(batch_size);
+  properties.set_use_threads(true);
+
+  std::unique_ptr<FileReader> reader;
+  FileReaderBuilder builder;
+  ASSERT_OK(builder.Open(std::make_shared<BufferReader>(buffer)));
+  ASSERT_OK(builder.properties(properties)->Build(&reader));
+
+  std::shared_ptr<::arrow::RecordBatchReader> rb_reader;
+  ASSERT_OK_NO_THROW(reader->GetRecordBatchReader({0, 1}, &rb_reader));
+  std::shared_ptr<Table> batches_table;
+  ASSERT_OK(rb_reader->ReadAll(&batches_table));
+  ASSERT_NO_FATAL_FAILURE(::arrow::AssertTablesEqual(*table, *batches_table, false));
+
+  std::shared_ptr<::arrow::RecordBatch> batch;
+  ASSERT_OK(rb_reader->ReadNext(&batch));
+  ASSERT_EQ(nullptr, batch);
+
+  // Drop the reader while the next batch is being read ahead
+  ASSERT_OK_NO_THROW(reader->GetRecordBatchReader({0, 1}, {1, 4, 5}, &rb_reader));
+  ASSERT_OK(rb_reader->ReadNext(&batch));
+  ASSERT_EQ(batch->num_rows(), batch_size);
+  ASSERT_EQ(batch->num_columns(), 3);
+  ASSERT_TRUE(batch->column(0)->Equals(table->column(1)->chunk(0)->Slice(0, batch_size)));
+  rb_reader.reset();
+}
+
+TEST(TestArrowReadWrite, ReadWithPreBuffer) {
+  const int num_columns = 20;
+  const int num_rows = 1000;
+  const int batch_size = 100;
+
+  std::shared_ptr<Table> table;
+  ASSERT_NO_FATAL_FAILURE(MakeDoubleTable(num_columns, num_rows, 1, &table));
+
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_NO_FATAL_FAILURE(WriteTableToBuffer(table, num_rows / 2,
+                                             default_arrow_writer_properties(), &buffer));
+
+  for (bool use_threads : {false, true}) {
+    ArrowReaderProperties properties = default_arrow_reader_properties();
+    properties.set_use_threads(use_threads);
+    properties.set_batch_size(batch_size);
+    properties.set_pre_buffer(true);
+    // Small limits so that the column chunks are coalesced into several ranges
+    ::arrow::io::CacheOptions cache_options = ::arrow::io::CacheOptions::Defaults();
+    cache_options.hole_size_limit = 16;
+    cache_options.range_size_limit = 2048;
+    properties.set_cache_options(cache_options);
+
+    std::unique_ptr<FileReader> reader;
+    FileReaderBuilder builder;
+    ASSERT_OK(builder.Open(std::make_shared<BufferReader>(buffer)));
+    ASSERT_OK(builder.properties(properties)->Build(&reader));
+
+    std::shared_ptr<Table> result;
+    ASSERT_OK_NO_THROW(reader->ReadTable(&result));
+    ASSERT_NO_FATAL_FAILURE(::arrow::AssertTablesEqual(*table, *result, false));
+
+    // Only the second row group and some of the columns
+    ASSERT_OK_NO_THROW(reader->ReadRowGroups({1}, {2, 3, 7}, &result));
+    ASSERT_EQ(result->num_rows(), num_rows / 2);
+    ASSERT_EQ(result->num_columns(), 3);
+    ASSERT_TRUE(result->column(0)->Equals(table->column(2)->Slice(num_rows / 2)));
+
+    std::shared_ptr<::arrow::RecordBatchReader> rb_reader;
+    ASSERT_OK_NO_THROW(reader->GetRecordBatchReader({0, 1}, &rb_reader));
+    std::shared_ptr<Table> batches_table;
+    ASSERT_OK(rb_reader->ReadAll(&batches_table));
+    ASSERT_NO_FATAL_FAILURE(::arrow::AssertTablesEqual(*table, *batches_table, false));
+  }
+}
+
+TEST(TestArrowReadWrite, GetRecordBatchReaderWithPreBuffer) {
+  const int num_columns = 5;
+  const int num_rows = 1000;
+  // Batches straddle the row group boundaries
+  const int batch_size = 150;
+
+  std::shared_ptr<Table> table;
+  ASSERT_NO_FATAL_FAILURE(MakeDoubleTable(num_columns, num_rows, 1, &table));
+
+  // Row groups are pre-buffered one ahead of the one being decoded
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_NO_FATAL_FAILURE(WriteTableToBuffer(table, num_rows / 10,
+                                             default_arrow_writer_properties(), &buffer));
+
+  for (bool use_threads : {false, true}) {
+    ArrowReaderProperties properties = default_arrow_reader_properties();
+    properties.set_use_threads(use_threads);
+    properties.set_batch_size(batch_size);
+    properties.set_pre_buffer(true);
+
+    std::unique_ptr<FileReader> reader;
+    FileReaderBuilder builder;
+    ASSERT_OK(builder.Open(std::make_shared<BufferReader>(buffer)));
+    ASSERT_OK(builder.properties(properties)->Build(&reader));
+
+    std::shared_ptr<::arrow::RecordBatchReader> rb_reader;
+    ASSERT_OK_NO_THROW(reader->GetRecordBatchReader(::arrow::internal::Iota(10),
+                                                    &rb_reader));
+    std::shared_ptr<Table> batches_table;
+    ASSERT_OK(rb_reader->ReadAll(&batches_table));
+    ASSERT_NO_FATAL_FAILURE(::arrow::AssertTablesEqual(*table, *batches_table, false));
+
+    // Some row groups, out of order, and some of the columns
+    ASSERT_OK_NO_THROW(reader->GetRecordBatchReader({7, 2, 3}, {1, 4}, &rb_reader));
+    ASSERT_OK(rb_reader->ReadAll(&batches_table));
+    ASSERT_EQ(batches_table->num_rows(), 300);
+    std::shared_ptr<Table> expected;
+    ASSERT_OK_AND_ASSIGN(expected, ::arrow::ConcatenateTables(
+                                       {table->Slice(700, 100), table->Slice(200, 200)}));
+    ASSERT_TRUE(batches_table->column(1)->Equals(expected->column(4)));
+
+    // Drop the reader before all row groups were read
+    ASSERT_OK_NO_THROW(reader->GetRecordBatchReader({0, 1, 2}, &rb_reader));
+    std::shared_ptr<::arrow::RecordBatch> batch;
+    ASSERT_OK(rb_reader->ReadNext(&batch));
+    rb_reader.reset();
+    ASSERT_OK_NO_THROW(reader->ReadRowGroups({0, 1, 2}, &batches_table));
+    ASSERT_NO_FATAL_FAILURE(
+        ::arrow::AssertTablesEqual(*table->Slice(0, 300), *batches_table, false));
+  }
+}
+
+TEST(TestArrowReadWrite, ReadWithPreBufferTruncatedFile) {
+  const int num_columns = 5;
+  const int num_rows = 1000;
+
+  std::shared_ptr<Table> table;
+  ASSERT_NO_FATAL_FAILURE(MakeDoubleTable(num_columns, num_rows, 1, &table));
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_NO_FATAL_FAILURE(WriteTableToBuffer(table, num_rows / 2,
+                                             default_arrow_writer_properties(), &buffer));
+  auto metadata = ReadMetaData(std::make_shared<BufferReader>(buffer));
+
+  for (bool use_threads : {false, true}) {
+    ArrowReaderProperties properties = default_arrow_reader_properties();
+    properties.set_use_threads(use_threads);
+    properties.set_pre_buffer(true);
+
+    // The column chunks are past the end of the file: the errors are returned,
+    // not thrown
+    auto truncated = std::make_shared<BufferReader>(SliceBuffer(buffer, 0, 4));
+    std::unique_ptr<FileReader> reader;
+    ASSERT_OK(FileReader::Make(default_memory_pool(),
+                               ParquetFileReader::Open(truncated,
+                                                       default_reader_properties(),
+                                                       metadata),
+                               properties, &reader));
+
+    std::shared_ptr<Table> result;
+    ASSERT_RAISES(IOError, reader->ReadTable(&result));
+    ASSERT_RAISES(IOError, reader->ReadRowGroups({1}, {2, 3}, &result));
+    ASSERT_RAISES(Invalid, reader->ReadRowGroups({2}, &result));
+
+    std::unique_ptr<::arrow::RecordBatchReader> rb_reader;
+    Status status = reader->GetRecordBatchReader({0, 1}, &rb_reader);
+    if (status.ok()) {
+      status = rb_reader->ReadAll(&result);
+    }
+    ASSERT_RAISES(IOError, status);
+  }
+}
+
+TEST(TestArrowReadWrite, GetRecordBatchReaderSelectedRows) {
+  const int num_columns = 3;
+  const int num_rows = 1000;
+
+  std::shared_ptr<Table> table;
+  ASSERT_NO_FATAL_FAILURE(MakeDoubleTable(num_columns, num_rows, 1, &table));
+
+  // Pages of 100 rows
+  auto sink = CreateOutputStream();
+  auto write_props = WriterProperties::Builder()
+                         .write_batch_size(100)
+                         ->data_pagesize(1)
+                         ->disable_dictionary()
+                         ->enable_write_page_index()
+                         ->build();
+  ASSERT_OK_NO_THROW(WriteTable(*table, ::arrow::default_memory_pool(), sink,
+                                num_rows / 2, write_props));
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+  // Only the pages holding the selected rows are read
+  std::shared_ptr<Table> expected;
+  ASSERT_OK_AND_ASSIGN(expected,
+                       ::arrow::ConcatenateTables({table->Slice(100, 100),
+                                                   table->Slice(500, 100),
+                                                   table->Slice(900, 100)}));
+
+  for (bool pre_buffer : {false, true}) {
+    ArrowReaderProperties properties = default_arrow_reader_properties();
+    properties.set_pre_buffer(pre_buffer);
+    std::unique_ptr<FileReader> reader;
+    FileReaderBuilder builder;
+    ASSERT_OK(builder.Open(std::make_shared<BufferReader>(buffer)));
+    ASSERT_OK(builder.properties(properties)->Build(&reader));
+
+    std::unique_ptr<::arrow::RecordBatchReader> rb_reader;
+    ASSERT_OK_NO_THROW(reader->GetRecordBatchReader(
+        {0, 1}, {0, 1, 2}, {{{150, 151}}, {{0, 1}, {420, 430}}},
+        /*page_index=*/nullptr, &rb_reader));
+    std::shared_ptr<Table> result;
+    ASSERT_OK(rb_reader->ReadAll(&result));
+    ASSERT_NO_FATAL_FAILURE(::arrow::AssertTablesEqual(*expected, *result, false));
+
+    // No rows selected in the first row group
+    ASSERT_OK_NO_THROW(reader->GetRecordBatchReader({0, 1}, {2}, {{}, {{0, 1}}},
+                                                    /*page_index=*/nullptr, &rb_reader));
+    ASSERT_OK(rb_reader->ReadAll(&result));
+    ASSERT_EQ(result->num_rows(), 100);
+    ASSERT_TRUE(result->column(0)->Equals(table->column(2)->Slice(500, 100)));
+
+    ASSERT_RAISES(Invalid, reader->GetRecordBatchReader({0, 1}, {0}, {{}},
+                                                        /*page_index=*/nullptr,
+                                                        &rb_reader));
+  }
+}
+
+TEST(TestArrowReadWrite, GetFilteredRecordBatchReader) {
+  const int64_t num_rows = 10000;
+  std::vector<int64_t> x(num_rows);
+  std::iota(x.begin(), x.end(), 0);
+  std::shared_ptr<Array> x_array;
+  ::arrow::ArrayFromVector<::arrow::Int64Type>(x, &x_array);
+  ::arrow::random::RandomArrayGenerator rag(42);
+  auto table = Table::Make(
+      ::arrow::schema({::arrow::field("x", ::arrow::int64(), /*nullable=*/false),
+                       ::arrow::field("str", ::arrow::utf8()),
+                       ::arrow::field("f64", ::arrow::float64())}),
+      {x_array, rag.String(num_rows, 0, 10, 0.1), rag.Float64(num_rows, 0, 1, 0.1)});
+
+  // Rows selected in runs, alone, and separated by short gaps, within and
+  // across pages of 100 rows and row groups of 5000 rows
+  auto selected = [](int64_t x) {
+    return (x >= 1000 && x < 1003) || x % 997 == 5 || (x >= 4990 && x < 5010) ||
+           (x >= 7000 && x < 7100 && x % 10 == 0);
+  };
+  std::vector<std::shared_ptr<Table>> slices;
+  for (int64_t i = 0; i < num_rows; ++i) {
+    if (selected(i)) {
+      slices.push_back(table->Slice(i, 1));
+    }
+  }
+  ASSERT_OK_AND_ASSIGN(auto expected, ::arrow::ConcatenateTables(slices));
+
+  auto sink = CreateOutputStream();
+  auto write_props = WriterProperties::Builder()
+                         .write_batch_size(100)
+                         ->data_pagesize(1)
+                         ->enable_write_page_index()
+                         ->build();
+  ASSERT_OK_NO_THROW(WriteTable(*table, ::arrow::default_memory_pool(), sink,
+                                num_rows / 2, write_props));
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+  RowFilter filter = [&](const std::shared_ptr<::arrow::RecordBatch>& batch,
+                         std::shared_ptr<Array>* selection) {
+    const auto& values = static_cast<const ::arrow::Int64Array&>(*batch->column(0));
+    ::arrow::BooleanBuilder builder;
+    for (int64_t i = 0; i < values.length(); ++i) {
+      RETURN_NOT_OK(builder.Append(selected(values.Value(i))));
+    }
+    return builder.Finish(selection);
+  };
+
+  for (bool use_threads : {false, true}) {
+    ArrowReaderProperties properties = default_arrow_reader_properties();
+    properties.set_use_threads(use_threads);
+    properties.set_batch_size(1000);
+    std::unique_ptr<FileReader> reader;
+    FileReaderBuilder builder;
+    ASSERT_OK(builder.Open(std::make_shared<BufferReader>(buffer)));
+    ASSERT_OK(builder.properties(properties)->Build(&reader));
+
+    std::unique_ptr<::arrow::RecordBatchReader> rb_reader;
+    std::shared_ptr<Table> result;
+    ASSERT_OK_NO_THROW(reader->GetFilteredRecordBatchReader(
+        {0, 1}, {0, 1, 2}, {0}, filter, {}, /*page_index=*/nullptr, &rb_reader));
+    ASSERT_OK(rb_reader->ReadAll(&result));
+    ASSERT_NO_FATAL_FAILURE(::arrow::AssertTablesEqual(*expected, *result, false));
+
+    // Without the filter column, within the pages of some rows
+    ASSERT_OK_NO_THROW(reader->GetFilteredRecordBatchReader(
+        {0, 1}, {2, 1}, {0}, filter, {{{0, 2000}}, {{2000, 2100}}},
+        /*page_index=*/nullptr, &rb_reader));
+    ASSERT_OK(rb_reader->ReadAll(&result));
+    std::vector<std::shared_ptr<Table>> row_slices;
+    for (int64_t i = 0; i < num_rows; ++i) {
+      if (selected(i) && (i < 2000 || (i >= 7000 && i < 7100))) {
+        row_slices.push_back(table->Slice(i, 1));
+      }
+    }
+    ASSERT_OK_AND_ASSIGN(auto expected_rows, ::arrow::ConcatenateTables(row_slices));
+    ASSERT_EQ(result->num_columns(), 2);
+    ASSERT_TRUE(result->column(0)->Equals(expected_rows->column(2)));
+    ASSERT_TRUE(result->column(1)->Equals(expected_rows->column(1)));
+
+    ASSERT_RAISES(Invalid, reader->GetFilteredRecordBatchReader(
+                               {0, 1}, {0, 1}, {}, filter, {}, nullptr, &rb_reader));
+    RowFilter bad_filter = [](const std::shared_ptr<::arrow::RecordBatch>& batch,
+                              std::shared_ptr<Array>* selection) {
+      *selection = batch->column(0);
+      return Status::OK();
+    };
+    ASSERT_OK_NO_THROW(reader->GetFilteredRecordBatchReader(
+        {0}, {1}, {0}, bad_filter, {}, nullptr, &rb_reader));
+    ASSERT_RAISES(Invalid, rb_reader->ReadAll(&result));
+  }
+}
+
+TEST(TestArrowReadWrite, WriteBloomFilters) {
+  auto schema = ::arrow::schema(
+      {::arrow::field("i32", ::arrow::int32()), ::arrow::field("str", ::arrow::utf8()),
+       ::arrow::field("dict", ::arrow::dictionary(::arrow::int32(), ::arrow::utf8())),
+       ::arrow::field("no_filter", ::arrow::int64())});
+  auto dictionary = ::arrow::ArrayFromJSON(::arrow::utf8(), R"(["x", "y", "z"])");
+  std::shared_ptr<Array> dict_column;
+  ASSERT_OK(::arrow::DictionaryArray::FromArrays(
+      schema->field(2)->type(),
+      ::arrow::ArrayFromJSON(::arrow::int32(), "[0, 2, null, 0]"), dictionary,
+      &dict_column));
+  auto table = Table::Make(
+      schema, {::arrow::ArrayFromJSON(::arrow::int32(), "[1, 2, null, 4]"),
+               ::arrow::ArrayFromJSON(::arrow::utf8(), R"(["a", null, "b", "c"])"),
+               dict_column, ::arrow::ArrayFromJSON(::arrow::int64(), "[1, 2, 3, 4]")});
+
+  auto write_props = WriterProperties::Builder()
+                         .enable_bloom_filter("i32")
+                         ->enable_bloom_filter("str")
+                         ->enable_bloom_filter("dict")
+                         ->build();
+  auto sink = CreateOutputStream();
+  ASSERT_OK_NO_THROW(
+      WriteTable(*table, ::arrow::default_memory_pool(), sink, 2, write_props,
+                 ArrowWriterProperties::Builder().store_schema()->build()));
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+  auto reader = ParquetFileReader::Open(std::make_shared<BufferReader>(buffer));
+  ASSERT_EQ(2, reader->metadata()->num_row_groups());
+
+  auto find_int = [](const BloomFilter& filter, int32_t value) {
+    return filter.FindHash(filter.Hash(value));
+  };
+  auto find_string = [](const BloomFilter& filter, const std::string& value) {
+    ByteArray byte_array(value);
+    return filter.FindHash(filter.Hash(&byte_array));
+  };
+
+  // Only the non-null values of each row group are inserted
+  auto row_group = reader->RowGroup(0);
+  auto filter = row_group->GetColumnBloomFilter(0);
+  ASSERT_NE(nullptr, filter);
+  ASSERT_TRUE(find_int(*filter, 1));
+  ASSERT_TRUE(find_int(*filter, 2));
+  ASSERT_FALSE(find_int(*filter, 4));
+  filter = row_group->GetColumnBloomFilter(1);
+  ASSERT_NE(nullptr, filter);
+  ASSERT_TRUE(find_string(*filter, "a"));
+  ASSERT_FALSE(find_string(*filter, "b"));
+  // The values of dictionary arrays are those of the dictionary
+  filter = row_group->GetColumnBloomFilter(2);
+  ASSERT_NE(nullptr, filter);
+  ASSERT_TRUE(find_string(*filter, "x"));
+  ASSERT_TRUE(find_string(*filter, "z"));
+  ASSERT_FALSE(find_string(*filter, "w"));
+  ASSERT_FALSE(row_group->metadata()->ColumnChunk(3)->has_bloom_filter());
+  ASSERT_EQ(nullptr, row_group->GetColumnBloomFilter(3));
+
+  row_group = reader->RowGroup(1);
+  filter = row_group->GetColumnBloomFilter(0);
+  ASSERT_NE(nullptr, filter);
+  ASSERT_TRUE(find_int(*filter, 4));
+  ASSERT_FALSE(find_int(*filter, 1));
+  filter = row_group->GetColumnBloomFilter(1);
+  ASSERT_NE(nullptr, filter);
+  ASSERT_TRUE(find_string(*filter, "b"));
+  ASSERT_TRUE(find_string(*filter, "c"));
+  ASSERT_FALSE(find_string(*filter, "a"));
+
+  // The Bloom filters don't change the data read
+  std::unique_ptr<FileReader> arrow_reader;
+  ASSERT_OK_NO_THROW(OpenFile(std::make_shared<BufferReader>(buffer),
+                              ::arrow::default_memory_pool(), &arrow_reader));
+  std::shared_ptr<Table> result;
+  ASSERT_OK_NO_THROW(arrow_reader->ReadTable(&result));
+  ASSERT_NO_FATAL_FAILURE(::arrow::AssertTablesEqual(*table, *result, false));
+}
+
+TEST(TestArrowReadWrite, WriteTableUseThreads) {
+  const int64_t num_rows = 1000;
+  ::arrow::random::RandomArrayGenerator rag(42);
+  auto table = Table::Make(
+      ::arrow::schema({::arrow::field("i32", ::arrow::int32()),
+                       ::arrow::field("f64", ::arrow::float64()),
+                       ::arrow::field("str", ::arrow::utf8()),
+                       ::arrow::field("i64", ::arrow::int64(), /*nullable=*/false)}),
+      {rag.Int32(num_rows, 0, 100, 0.1), rag.Float64(num_rows, 0, 1, 0.1),
+       rag.String(num_rows, 0, 10, 0.1), rag.Int64(num_rows, 0, 1LL << 40)});
+
+  auto arrow_props = ArrowWriterProperties::Builder().set_use_threads(true)->build();
+  ASSERT_TRUE(arrow_props->use_threads());
+  ASSERT_FALSE(default_arrow_writer_properties()->use_threads());
+
+  // Dictionary and plain encoded column chunks, in several row groups
+  for (bool use_dictionary : {true, false}) {
+    WriterProperties::Builder builder;
+    builder.data_pagesize(1024);
+    if (!use_dictionary) {
+      builder.disable_dictionary();
+    }
+    auto sink = CreateOutputStream();
+    ASSERT_OK_NO_THROW(WriteTable(*table, ::arrow::default_memory_pool(), sink,
+                                  num_rows / 3, builder.build(), arrow_props));
+    ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+    std::unique_ptr<FileReader> reader;
+    ASSERT_OK_NO_THROW(OpenFile(std::make_shared<BufferReader>(buffer),
+                                ::arrow::default_memory_pool(), &reader));
+    ASSERT_EQ(4, reader->num_row_groups());
+    std::shared_ptr<Table> result;
+    ASSERT_OK_NO_THROW(reader->ReadTable(&result));
+    ASSERT_NO_FATAL_FAILURE(::arrow::AssertTablesEqual(*table, *result, false));
+  }
+}
+
+TEST(TestArrowReadWrite, WriteRecordBatch) {
+  const int num_batches = 100;
+  const int64_t batch_size = 1000;
+  const int64_t target_row_group_bytes = 64 * 1024;
+  ::arrow::random::RandomArrayGenerator rag(42);
+  auto schema = ::arrow::schema({::arrow::field("i64", ::arrow::int64(), false),
+                                 ::arrow::field("str", ::arrow::utf8())});
+  std::vector<std::shared_ptr<::arrow::RecordBatch>> batches;
+  for (int i = 0; i < num_batches; i++) {
+    batches.push_back(::arrow::RecordBatch::Make(
+        schema, batch_size,
+        {rag.Int64(batch_size, 0, 1LL << 40), rag.String(batch_size, 0, 10, 0.1)}));
+  }
+  std::shared_ptr<Table> table;
+  ASSERT_OK(Table::FromRecordBatches(batches, &table));
+
+  auto props = WriterProperties::Builder().disable_dictionary()->build();
+  for (bool use_threads : {false, true}) {
+    // Memory bounded by the target, or bounding the row groups
+    for (int64_t max_buffered_bytes : {4 * target_row_group_bytes,
+                                       target_row_group_bytes / 2}) {
+      auto arrow_props = ArrowWriterProperties::Builder()
+                             .set_use_threads(use_threads)
+                             ->set_target_row_group_bytes(target_row_group_bytes)
+                             ->set_max_buffered_bytes(max_buffered_bytes)
+                             ->build();
+      auto sink = CreateOutputStream();
+      std::unique_ptr<FileWriter> writer;
+      ASSERT_OK_NO_THROW(FileWriter::Open(*schema, ::arrow::default_memory_pool(), sink,
+                                          props, arrow_props, &writer));
+      for (const auto& batch : batches) {
+        ASSERT_OK_NO_THROW(writer->WriteRecordBatch(*batch));
+      }
+      ASSERT_OK_NO_THROW(writer->Close());
+      ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+      std::unique_ptr<FileReader> reader;
+      ASSERT_OK_NO_THROW(OpenFile(std::make_shared<BufferReader>(buffer),
+                                  ::arrow::default_memory_pool(), &reader));
+      auto metadata = reader->parquet_reader()->metadata();
+      const int64_t row_group_bytes =
+          std::min(target_row_group_bytes, max_buffered_bytes);
+      ASSERT_GT(metadata->num_row_groups(), 2);
+      // Batches are split across row groups of about the target size
+      for (int i = 0; i < metadata->num_row_groups() - 1; i++) {
+        const int64_t total_byte_size = metadata->RowGroup(i)->total_byte_size();
+        ASSERT_GE(total_byte_size, row_group_bytes / 2);
+        ASSERT_LE(total_byte_size, 2 * row_group_bytes);
+      }
+      std::shared_ptr<Table> result;
+      ASSERT_OK_NO_THROW(reader->ReadTable(&result));
+      ASSERT_NO_FATAL_FAILURE(::arrow::AssertTablesEqual(*table, *result, false));
+    }
+  }
+
+  auto sink = CreateOutputStream();
+  std::unique_ptr<FileWriter> writer;
+  ASSERT_OK_NO_THROW(FileWriter::Open(*schema, ::arrow::default_memory_pool(), sink,
+                                      props, default_arrow_writer_properties(),
+                                      &writer));
+  auto other_schema = ::arrow::schema({::arrow::field("i64", ::arrow::int64())});
+  auto other = ::arrow::RecordBatch::Make(other_schema, batch_size,
+                                          {rag.Int64(batch_size, 0, 100)});
+  ASSERT_RAISES(Invalid, writer->WriteRecordBatch(*other));
+}
+
 TEST(TestArrowReadWrite, ScanContents) {
   const int num_columns = 20;
   const int num_rows = 1000;
@@ -2941,6 +3450,79 @@ TEST_P(TestArrowReadDictionary, StreamReadWholeFileDict) {
   CheckStreamReadWholeFile(*expected_dense_);
 }
 
+TEST_P(TestArrowReadDictionary, StreamReadChunkedDict) {
+  properties_.set_read_dictionary(0, true);
+
+  auto num_row_groups = options.num_row_groups;
+  auto chunk_size = options.num_rows / num_row_groups;
+
+  std::vector<std::shared_ptr<Array>> chunks(num_row_groups);
+  for (int i = 0; i < num_row_groups; ++i) {
+    AsDictionary32Encoded(*dense_values_->Slice(chunk_size * i, chunk_size), &chunks[i]);
+  }
+  auto ex_table = MakeSimpleTable(std::make_shared<ChunkedArray>(chunks),
+                                  /*nullable=*/true);
+
+  // Each batch spans two row groups, hence two dictionaries
+  properties_.set_batch_size(chunk_size * 3 / 2);
+  for (bool use_threads : {false, true}) {
+    properties_.set_use_threads(use_threads);
+    CheckStreamReadWholeFile(*ex_table);
+  }
+}
+
+TEST_P(TestArrowReadDictionary, ReadWholeFileUnifiedDict) {
+  properties_.set_read_dictionary(0, true);
+  properties_.set_unify_dictionaries(true);
+
+  // A single chunk whose dictionary holds the values of all the row groups
+  std::shared_ptr<Array> unified;
+  AsDictionary32Encoded(*dense_values_, &unified);
+  auto ex_table = MakeSimpleTable(
+      std::make_shared<ChunkedArray>(::arrow::ArrayVector{unified}), /*nullable=*/true);
+  ASSERT_OK_AND_ASSIGN(auto reader, GetReader());
+  std::shared_ptr<Table> actual;
+  ASSERT_OK_NO_THROW(reader->ReadTable(&actual));
+  ASSERT_EQ(actual->column(0)->num_chunks(), 1);
+  ::arrow::AssertTablesEqual(*ex_table, *actual);
+}
+
+TEST_P(TestArrowReadDictionary, StreamReadUnifiedDict) {
+  properties_.set_read_dictionary(0, true);
+  properties_.set_unify_dictionaries(true);
+
+  std::shared_ptr<Array> unified;
+  AsDictionary32Encoded(*dense_values_, &unified);
+  const auto& unified_dict = static_cast<const ::arrow::DictionaryArray&>(*unified);
+
+  // Each batch spans two row groups, and its dictionary is a prefix of the
+  // dictionary of the whole column
+  auto chunk_size = options.num_rows / options.num_row_groups;
+  properties_.set_batch_size(chunk_size * 3 / 2);
+  ASSERT_OK_AND_ASSIGN(auto reader, GetReader());
+  std::unique_ptr<::arrow::RecordBatchReader> rb;
+  ASSERT_OK(reader->GetRecordBatchReader(
+      ::arrow::internal::Iota(options.num_row_groups), &rb));
+
+  int64_t offset = 0;
+  int64_t dictionary_length = 0;
+  std::shared_ptr<::arrow::RecordBatch> batch;
+  while (true) {
+    ASSERT_OK(rb->ReadNext(&batch));
+    if (batch == nullptr) break;
+    const auto& column =
+        static_cast<const ::arrow::DictionaryArray&>(*batch->column(0));
+    ASSERT_GE(column.dictionary()->length(), dictionary_length);
+    dictionary_length = column.dictionary()->length();
+    ::arrow::AssertArraysEqual(*unified_dict.dictionary()->Slice(0, dictionary_length),
+                               *column.dictionary());
+    ::arrow::AssertArraysEqual(*unified_dict.indices()->Slice(offset, column.length()),
+                               *column.indices());
+    offset += column.length();
+  }
+  ASSERT_EQ(offset, options.num_rows);
+}
+
 TEST_P(TestArrowReadDictionary, ReadWholeFileDense) {
   properties_.set_read_dictionary(0, false);
   CheckReadWholeFile(*expected_dense_);
@@ -2950,6 +3532,35 @@ INSTANTIATE_TEST_CASE_P(
     ReadDictionary, TestArrowReadDictionary,
     ::testing::ValuesIn(TestArrowReadDictionary::null_probabilities()));
 
+TEST(TestArrowReadDictionary, UnifyRepeatedDictionaries) {
+  // Row groups with the same values in the same order have identical
+  // dictionary pages, whose indices are read as they are
+  auto values = ArrayFromJSON(::arrow::utf8(), R"(["b", "a", null, "c", "a", "b"])");
+  std::shared_ptr<Array> repeated;
+  ASSERT_OK(::arrow::Concatenate({values, values, values, values},
+                                 default_memory_pool(), &repeated));
+  auto table = MakeSimpleTable(repeated, /*nullable=*/true);
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_NO_FATAL_FAILURE(WriteTableToBuffer(table, values->length(),
+                                             default_arrow_writer_properties(), &buffer));
+
+  ArrowReaderProperties properties = default_arrow_reader_properties();
+  properties.set_read_dictionary(0, true);
+  properties.set_unify_dictionaries(true);
+  std::unique_ptr<FileReader> reader;
+  FileReaderBuilder builder;
+  ASSERT_OK(builder.Open(std::make_shared<BufferReader>(buffer)));
+  ASSERT_OK(builder.properties(properties)->Build(&reader));
+  ASSERT_EQ(reader->num_row_groups(), 4);
+
+  std::shared_ptr<Table> actual;
+  ASSERT_OK_NO_THROW(reader->ReadTable(&actual));
+  std::shared_ptr<Array> expected;
+  AsDictionary32Encoded(*repeated, &expected);
+  ASSERT_EQ(actual->column(0)->num_chunks(), 1);
+  ::arrow::AssertArraysEqual(*expected, *actual->column(0)->chunk(0));
+}
+
 TEST(TestArrowWriteDictionaries, ChangingDictionaries) {
   constexpr int num_unique = 50;
   constexpr int repeat = 10000;
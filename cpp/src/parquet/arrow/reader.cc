@@ -25,11 +25,13 @@
 #include <vector>
 
 #include "arrow/array.h"
+#include "arrow/array/concatenate.h"
 #include "arrow/buffer.h"
 #include "arrow/io/memory.h"
 #include "arrow/record_batch.h"
 #include "arrow/table.h"
 #include "arrow/type.h"
+#include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/range.h"
 #include "arrow/util/thread_pool.h"
@@ -42,6 +44,7 @@
 #include "parquet/schema.h"
 
 using arrow::Array;
+using arrow::ArrayVector;
 using arrow::BooleanArray;
 using arrow::ChunkedArray;
 using arrow::DataType;
@@ -87,6 +90,16 @@ class ColumnReaderImpl : public ColumnReader {
   virtual const ColumnDescriptor* descr() const = 0;
 
   virtual ReaderType type() const = 0;
+
+  // Skip the next num_records records. By default they are decoded and
+  // discarded.
+  virtual Status SkipRecords(int64_t num_records) {
+    if (num_records == 0) {
+      return Status::OK();
+    }
+    std::shared_ptr<ChunkedArray> discarded;
+    return NextBatch(num_records, &discarded);
+  }
 };
 
 std::shared_ptr<std::unordered_set<int>> VectorToSharedSet(
@@ -111,9 +124,12 @@ class FileReaderImpl : public FileReader {
                                 reader_properties_, &manifest_);
   }
 
-  FileColumnIteratorFactory SomeRowGroupsFactory(std::vector<int> row_groups) {
-    return [row_groups](int i, ParquetFileReader* reader) {
-      return new FileColumnIterator(i, reader, row_groups);
+  FileColumnIteratorFactory SomeRowGroupsFactory(
+      std::vector<int> row_groups,
+      std::shared_ptr<const RowGroupPageSelections> page_selections = NULLPTR,
+      std::shared_ptr<RowGroupPrefetcher> prefetcher = NULLPTR) {
+    return [row_groups, page_selections, prefetcher](int i, ParquetFileReader* reader) {
+      return new FileColumnIterator(i, reader, row_groups, page_selections, prefetcher);
     };
   }
 
@@ -160,16 +176,19 @@ class FileReaderImpl : public FileReader {
     return ReadRowGroups(Iota(reader_->metadata()->num_row_groups()), indices, out);
   }
 
-  Status GetFieldReader(int i,
-                        const std::shared_ptr<std::unordered_set<int>>& included_leaves,
-                        const std::vector<int>& row_groups,
-                        std::unique_ptr<ColumnReaderImpl>* out) {
+  Status GetFieldReader(
+      int i, const std::shared_ptr<std::unordered_set<int>>& included_leaves,
+      const std::vector<int>& row_groups, std::unique_ptr<ColumnReaderImpl>* out,
+      std::shared_ptr<const RowGroupPageSelections> page_selections = NULLPTR,
+      std::shared_ptr<RowGroupPrefetcher> prefetcher = NULLPTR) {
     auto ctx = std::make_shared<ReaderContext>();
     ctx->reader = reader_.get();
     ctx->pool = pool_;
-    ctx->iterator_factory = SomeRowGroupsFactory(row_groups);
+    ctx->iterator_factory = SomeRowGroupsFactory(row_groups, std::move(page_selections),
+                                                 std::move(prefetcher));
     ctx->filter_leaves = true;
     ctx->included_leaves = included_leaves;
+    ctx->unify_dictionaries = reader_properties_.unify_dictionaries();
     return GetReader(manifest_.schema_fields[i], ctx, out);
   }
 
@@ -246,6 +265,12 @@ class FileReaderImpl : public FileReader {
                        const std::vector<int>& indices,
                        std::shared_ptr<Table>* table) override;
 
+  // Decode the given leaf columns, whose schema fields are field_indices
+  Status DecodeRowGroups(const std::vector<int>& row_groups,
+                         const std::vector<int>& indices,
+                         const std::vector<int>& field_indices,
+                         std::shared_ptr<Table>* table);
+
   Status ReadRowGroups(const std::vector<int>& row_groups,
                        std::shared_ptr<Table>* table) override {
     return ReadRowGroups(row_groups, Iota(reader_->metadata()->num_columns()), table);
@@ -270,6 +295,50 @@ class FileReaderImpl : public FileReader {
                                 Iota(reader_->metadata()->num_columns()), out);
   }
 
+  Status GetRecordBatchReader(const std::vector<int>& row_group_indices,
+                              const std::vector<int>& column_indices,
+                              const std::vector<RowRanges>& row_selections,
+                              std::shared_ptr<PageIndex> page_index,
+                              std::unique_ptr<RecordBatchReader>* out) override;
+
+  Status GetFilteredRecordBatchReader(const std::vector<int>& row_group_indices,
+                                      const std::vector<int>& column_indices,
+                                      const std::vector<int>& filter_column_indices,
+                                      RowFilter filter,
+                                      const std::vector<RowRanges>& row_selections,
+                                      std::shared_ptr<PageIndex> page_index,
+                                      std::unique_ptr<RecordBatchReader>* out) override;
+
+  // Select the data pages of column_indices holding row_selections, see
+  // PageSelection
+  Status SelectPages(const std::vector<int>& row_group_indices,
+                     const std::vector<int>& column_indices,
+                     const std::vector<RowRanges>& row_selections,
+                     std::shared_ptr<PageIndex> page_index,
+                     std::shared_ptr<const RowGroupPageSelections>* out);
+
+  // Pre-buffer the column chunks read by the readers of included_leaves with
+  // pre_buffer, or return null
+  std::shared_ptr<RowGroupPrefetcher> MakePrefetcher(
+      const std::vector<int>& row_groups,
+      const std::shared_ptr<const RowGroupPageSelections>& page_selections,
+      const std::unordered_set<int>& included_leaves) {
+    if (!reader_properties_.pre_buffer()) {
+      return nullptr;
+    }
+    // The selected pages are read with one request per column chunk, only
+    // the row groups read whole are pre-buffered
+    std::vector<bool> prebuffer;
+    for (int row_group : row_groups) {
+      prebuffer.push_back(page_selections == nullptr ||
+                          page_selections->selections.count(row_group) == 0);
+    }
+    return std::make_shared<RowGroupPrefetcher>(
+        reader_.get(), row_groups, std::move(prebuffer),
+        std::vector<int>(included_leaves.begin(), included_leaves.end()),
+        static_cast<int>(included_leaves.size()), reader_properties_.cache_options());
+  }
+
   int num_columns() const { return reader_->metadata()->num_columns(); }
 
   ParquetFileReader* parquet_reader() const override { return reader_.get(); }
@@ -295,21 +364,33 @@ class FileReaderImpl : public FileReader {
   SchemaManifest manifest_;
 };
 
+// Reads batch_size records of every column at a time.  With use_threads, the
+// columns of a batch are decoded in parallel on the CPU thread pool, and the
+// next batch is decoded ahead while the caller consumes the current one.
 class RowGroupRecordBatchReader : public ::arrow::RecordBatchReader {
  public:
   RowGroupRecordBatchReader(std::vector<std::unique_ptr<ColumnReaderImpl>> field_readers,
-                            std::shared_ptr<::arrow::Schema> schema, int64_t batch_size)
+                            std::shared_ptr<::arrow::Schema> schema, int64_t batch_size,
+                            bool use_threads)
       : field_readers_(std::move(field_readers)),
         schema_(std::move(schema)),
-        batch_size_(batch_size) {}
-
-  ~RowGroupRecordBatchReader() override {}
+        batch_size_(batch_size),
+        use_threads_(use_threads),
+        next_columns_(field_readers_.size()) {}
+
+  ~RowGroupRecordBatchReader() override {
+    // The pending tasks reference the field readers
+    for (auto& fut : next_futures_) {
+      fut.wait();
+    }
+  }
 
   std::shared_ptr<::arrow::Schema> schema() const override { return schema_; }
 
   static Status Make(const std::vector<int>& row_groups,
                      const std::vector<int>& column_indices, FileReaderImpl* reader,
                      int64_t batch_size,
+                     std::shared_ptr<const RowGroupPageSelections> page_selections,
                      std::unique_ptr<::arrow::RecordBatchReader>* out) {
     std::vector<int> field_indices;
     if (!reader->manifest_.GetFieldIndices(column_indices, &field_indices)) {
@@ -319,39 +400,388 @@ class RowGroupRecordBatchReader : public ::arrow::RecordBatchReader {
     std::vector<std::shared_ptr<Field>> fields;
 
     auto included_leaves = VectorToSharedSet(column_indices);
+    auto prefetcher =
+        reader->MakePrefetcher(row_groups, page_selections, *included_leaves);
+
     for (size_t i = 0; i < field_indices.size(); ++i) {
       RETURN_NOT_OK(reader->GetFieldReader(field_indices[i], included_leaves, row_groups,
-                                           &field_readers[i]));
+                                           &field_readers[i], page_selections,
+                                           prefetcher));
       fields.push_back(field_readers[i]->field());
     }
-    out->reset(new RowGroupRecordBatchReader(std::move(field_readers),
-                                             ::arrow::schema(fields), batch_size));
+    out->reset(new RowGroupRecordBatchReader(
+        std::move(field_readers), ::arrow::schema(fields), batch_size,
+        reader->reader_properties_.use_threads()));
     return Status::OK();
   }
 
   Status ReadNext(std::shared_ptr<::arrow::RecordBatch>* out) override {
-    // TODO (hatemhelal): Consider refactoring this to share logic with ReadTable as this
-    // does not currently honor the use_threads option.
+    if (table_batch_reader_) {
+      RETURN_NOT_OK(table_batch_reader_->ReadNext(out));
+      if (*out != nullptr) {
+        return Status::OK();
+      }
+      table_batch_reader_.reset();
+    }
+
+    if (next_futures_.empty()) {
+      RETURN_NOT_OK(StartNextBatch());
+    }
+    RETURN_NOT_OK(FinishNextBatch());
     std::vector<std::shared_ptr<ChunkedArray>> columns(field_readers_.size());
-    for (size_t i = 0; i < field_readers_.size(); ++i) {
-      RETURN_NOT_OK(field_readers_[i]->NextBatch(batch_size_, &columns[i]));
-      if (columns[i]->num_chunks() > 1) {
-        return Status::NotImplemented("This class cannot yet iterate chunked arrays");
+    columns.swap(next_columns_);
+    table_ = Table::Make(schema_, std::move(columns));
+    RETURN_NOT_OK(table_->Validate());
+    if (table_->num_rows() == 0) {
+      // All row groups were consumed
+      *out = nullptr;
+      return Status::OK();
+    }
+    if (use_threads_) {
+      // Read ahead the next batch while the caller processes this one
+      RETURN_NOT_OK(StartNextBatch());
+    }
+
+    // A column may be read as several chunks, e.g. when a dictionary-encoded
+    // column spans several row groups; TableBatchReader yields one batch per
+    // contiguous slice of all columns.
+    table_batch_reader_.reset(new ::arrow::TableBatchReader(*table_));
+    return table_batch_reader_->ReadNext(out);
+  }
+
+ private:
+  Status ReadColumn(int i) {
+    BEGIN_PARQUET_CATCH_EXCEPTIONS
+    return field_readers_[i]->NextBatch(batch_size_, &next_columns_[i]);
+    END_PARQUET_CATCH_EXCEPTIONS
+  }
+
+  // Start decoding the next batch of every column on the CPU thread pool.
+  // Without use_threads, the columns are decoded in FinishNextBatch().
+  Status StartNextBatch() {
+    if (!use_threads_) {
+      return Status::OK();
+    }
+    auto pool = ::arrow::internal::GetCpuThreadPool();
+    const int num_fields = static_cast<int>(field_readers_.size());
+    for (int i = 0; i < num_fields; ++i) {
+      auto maybe_future = pool->Submit([this, i]() { return ReadColumn(i); });
+      if (!maybe_future.ok()) {
+        // Let the columns already submitted complete before bailing out
+        RETURN_NOT_OK(FinishNextBatch());
+        return maybe_future.status();
+      }
+      next_futures_.push_back(maybe_future.MoveValueUnsafe());
+    }
+    return Status::OK();
+  }
+
+  Status FinishNextBatch() {
+    if (!use_threads_) {
+      for (size_t i = 0; i < field_readers_.size(); ++i) {
+        RETURN_NOT_OK(ReadColumn(static_cast<int>(i)));
+      }
+      return Status::OK();
+    }
+    Status final_status = Status::OK();
+    for (auto& fut : next_futures_) {
+      Status st = fut.get();
+      if (!st.ok()) {
+        final_status = std::move(st);
+      }
+    }
+    next_futures_.clear();
+    return final_status;
+  }
+
+  std::vector<std::unique_ptr<ColumnReaderImpl>> field_readers_;
+  std::shared_ptr<::arrow::Schema> schema_;
+  int64_t batch_size_;
+  bool use_threads_;
+
+  // The batch currently being iterated over
+  std::shared_ptr<Table> table_;
+  std::unique_ptr<::arrow::TableBatchReader> table_batch_reader_;
+
+  // The next batch, possibly being decoded in the background
+  std::vector<std::shared_ptr<ChunkedArray>> next_columns_;
+  std::vector<std::future<Status>> next_futures_;
+};
+
+// Decodes the fields read by a RowFilter batch_size rows at a time, then only
+// the rows it selects of the other fields.  With use_threads, the fields are
+// decoded in parallel on the CPU thread pool.
+class FilteredRecordBatchReader : public ::arrow::RecordBatchReader {
+ public:
+  // Gaps between selected rows shorter than this are decoded and sliced away
+  // rather than skipped, to keep the decoded chunks large enough
+  static constexpr int64_t kMinRowsToSkip = 64;
+
+  FilteredRecordBatchReader(
+      std::vector<std::unique_ptr<ColumnReaderImpl>> filter_readers,
+      std::shared_ptr<::arrow::Schema> filter_schema,
+      std::vector<std::unique_ptr<ColumnReaderImpl>> field_readers,
+      std::vector<int> filter_positions, std::shared_ptr<::arrow::Schema> schema,
+      RowFilter filter, int64_t batch_size, bool use_threads, MemoryPool* pool)
+      : filter_readers_(std::move(filter_readers)),
+        filter_schema_(std::move(filter_schema)),
+        field_readers_(std::move(field_readers)),
+        filter_positions_(std::move(filter_positions)),
+        schema_(std::move(schema)),
+        filter_(std::move(filter)),
+        batch_size_(batch_size),
+        use_threads_(use_threads),
+        pool_(pool),
+        done_(false) {}
+
+  std::shared_ptr<::arrow::Schema> schema() const override { return schema_; }
+
+  static Status Make(const std::vector<int>& row_groups,
+                     const std::vector<int>& column_indices,
+                     const std::vector<int>& filter_column_indices, RowFilter filter,
+                     FileReaderImpl* reader,
+                     std::shared_ptr<const RowGroupPageSelections> page_selections,
+                     std::unique_ptr<::arrow::RecordBatchReader>* out) {
+    std::vector<int> field_indices;
+    std::vector<int> filter_field_indices;
+    if (!reader->manifest_.GetFieldIndices(column_indices, &field_indices) ||
+        !reader->manifest_.GetFieldIndices(filter_column_indices,
+                                           &filter_field_indices)) {
+      return Status::Invalid("Invalid column index");
+    }
+
+    // A field holding both filter and other leaves is decoded once, with all
+    // of them
+    std::vector<int> leaves(column_indices);
+    leaves.insert(leaves.end(), filter_column_indices.begin(),
+                  filter_column_indices.end());
+    auto included_leaves = VectorToSharedSet(leaves);
+    auto prefetcher =
+        reader->MakePrefetcher(row_groups, page_selections, *included_leaves);
+
+    std::vector<std::unique_ptr<ColumnReaderImpl>> filter_readers(
+        filter_field_indices.size());
+    std::vector<std::shared_ptr<Field>> filter_fields;
+    for (size_t i = 0; i < filter_field_indices.size(); ++i) {
+      RETURN_NOT_OK(reader->GetFieldReader(filter_field_indices[i], included_leaves,
+                                           row_groups, &filter_readers[i],
+                                           page_selections, prefetcher));
+      filter_fields.push_back(filter_readers[i]->field());
+    }
+
+    std::vector<std::unique_ptr<ColumnReaderImpl>> field_readers(field_indices.size());
+    std::vector<int> filter_positions;
+    std::vector<std::shared_ptr<Field>> fields;
+    for (size_t i = 0; i < field_indices.size(); ++i) {
+      auto it = std::find(filter_field_indices.begin(), filter_field_indices.end(),
+                          field_indices[i]);
+      if (it != filter_field_indices.end()) {
+        // Taken from the decoded filter field
+        filter_positions.push_back(static_cast<int>(it - filter_field_indices.begin()));
+        fields.push_back(filter_fields[filter_positions.back()]);
+        continue;
       }
+      filter_positions.push_back(-1);
+      RETURN_NOT_OK(reader->GetFieldReader(field_indices[i], included_leaves, row_groups,
+                                           &field_readers[i], page_selections,
+                                           prefetcher));
+      fields.push_back(field_readers[i]->field());
     }
 
-    // Create an intermediate table and use TableBatchReader as an adaptor to a
-    // RecordBatch
-    std::shared_ptr<Table> table = Table::Make(schema_, columns);
-    RETURN_NOT_OK(table->Validate());
-    ::arrow::TableBatchReader table_batch_reader(*table);
-    return table_batch_reader.ReadNext(out);
+    out->reset(new FilteredRecordBatchReader(
+        std::move(filter_readers), ::arrow::schema(filter_fields),
+        std::move(field_readers), std::move(filter_positions), ::arrow::schema(fields),
+        std::move(filter), reader->reader_properties_.batch_size(),
+        reader->reader_properties_.use_threads(), reader->pool_));
+    return Status::OK();
+  }
+
+  Status ReadNext(std::shared_ptr<::arrow::RecordBatch>* out) override {
+    while (true) {
+      if (table_batch_reader_) {
+        RETURN_NOT_OK(table_batch_reader_->ReadNext(out));
+        if (*out != nullptr) {
+          return Status::OK();
+        }
+        table_batch_reader_.reset();
+      }
+      if (done_) {
+        // All row groups were consumed
+        *out = nullptr;
+        return Status::OK();
+      }
+      RETURN_NOT_OK(ReadNextTable());
+    }
   }
 
  private:
+  // Decode the next batch_size rows of the filter fields, then the rows they
+  // select of the other fields
+  Status ReadNextTable() {
+    std::vector<std::shared_ptr<ChunkedArray>> filter_columns(filter_readers_.size());
+    RETURN_NOT_OK(ForEachField(static_cast<int>(filter_readers_.size()), [&](int i) {
+      return filter_readers_[i]->NextBatch(batch_size_, &filter_columns[i]);
+    }));
+    auto filter_table = Table::Make(filter_schema_, std::move(filter_columns));
+    RETURN_NOT_OK(filter_table->Validate());
+    const int64_t num_rows = filter_table->num_rows();
+    if (num_rows == 0) {
+      done_ = true;
+      return Status::OK();
+    }
+
+    RowRanges selected;
+    RETURN_NOT_OK(SelectRows(*filter_table, &selected));
+    int64_t num_selected = 0;
+    for (const RowRange& range : selected) {
+      num_selected += range.last - range.first;
+    }
+
+    std::vector<std::shared_ptr<ChunkedArray>> columns(field_readers_.size());
+    RETURN_NOT_OK(ForEachField(static_cast<int>(field_readers_.size()), [&](int i) {
+      if (filter_positions_[i] >= 0) {
+        return TakeRows(*filter_table->column(filter_positions_[i]), selected,
+                        &columns[i]);
+      }
+      return ReadRows(field_readers_[i].get(), selected, num_rows, &columns[i]);
+    }));
+    table_ = Table::Make(schema_, std::move(columns), num_selected);
+    RETURN_NOT_OK(table_->Validate());
+    table_batch_reader_.reset(new ::arrow::TableBatchReader(*table_));
+    return Status::OK();
+  }
+
+  // Pass the filter fields to filter_ one contiguous batch at a time, and
+  // collect the selected rows
+  Status SelectRows(const Table& filter_table, RowRanges* selected) {
+    ::arrow::TableBatchReader batches(filter_table);
+    int64_t offset = 0;
+    while (true) {
+      std::shared_ptr<::arrow::RecordBatch> batch;
+      RETURN_NOT_OK(batches.ReadNext(&batch));
+      if (batch == nullptr) {
+        return Status::OK();
+      }
+      std::shared_ptr<Array> selection;
+      RETURN_NOT_OK(filter_(batch, &selection));
+      if (selection == nullptr || selection->type_id() != ::arrow::Type::BOOL ||
+          selection->length() != batch->num_rows()) {
+        return Status::Invalid(
+            "Row filter must return a boolean array of the length of the batch");
+      }
+      const auto& values =
+          ::arrow::internal::checked_cast<const BooleanArray&>(*selection);
+      for (int64_t i = 0; i < values.length(); ++i) {
+        if (!values.IsValid(i) || !values.Value(i)) {
+          continue;
+        }
+        const int64_t row = offset + i;
+        if (!selected->empty() && selected->back().last == row) {
+          ++selected->back().last;
+        } else {
+          selected->push_back({row, row + 1});
+        }
+      }
+      offset += batch->num_rows();
+    }
+  }
+
+  // The selected rows of a decoded filter field
+  Status TakeRows(const ChunkedArray& column, const RowRanges& selected,
+                  std::shared_ptr<ChunkedArray>* out) {
+    ArrayVector chunks;
+    for (const RowRange& range : selected) {
+      auto slice = column.Slice(range.first, range.last - range.first);
+      chunks.insert(chunks.end(), slice->chunks().begin(), slice->chunks().end());
+    }
+    return Compact(std::move(chunks), column.type(), out);
+  }
+
+  // Decode the selected rows out of the next num_rows rows of a field, and
+  // skip the others
+  Status ReadRows(ColumnReaderImpl* reader, const RowRanges& selected, int64_t num_rows,
+                  std::shared_ptr<ChunkedArray>* out) {
+    BEGIN_PARQUET_CATCH_EXCEPTIONS
+    ArrayVector chunks;
+    int64_t position = 0;
+    size_t i = 0;
+    while (i < selected.size()) {
+      // Decode the ranges separated by short gaps at once
+      size_t end = i + 1;
+      while (end < selected.size() &&
+             selected[end].first - selected[end - 1].last < kMinRowsToSkip) {
+        ++end;
+      }
+      const int64_t first = selected[i].first;
+      const int64_t last = selected[end - 1].last;
+      RETURN_NOT_OK(reader->SkipRecords(first - position));
+      std::shared_ptr<ChunkedArray> values;
+      RETURN_NOT_OK(reader->NextBatch(last - first, &values));
+      for (; i < end; ++i) {
+        const int64_t slice_offset = selected[i].first - first;
+        const int64_t slice_length = selected[i].last - selected[i].first;
+        auto slice = values->Slice(slice_offset, slice_length);
+        chunks.insert(chunks.end(), slice->chunks().begin(), slice->chunks().end());
+      }
+      position = last;
+    }
+    RETURN_NOT_OK(reader->SkipRecords(num_rows - position));
+    return Compact(std::move(chunks), reader->field()->type(), out);
+    END_PARQUET_CATCH_EXCEPTIONS
+  }
+
+  // Concatenate the slices of the selected rows, which may be many and small.
+  // Dictionary arrays are left chunked as their dictionaries may differ.
+  Status Compact(ArrayVector chunks, const std::shared_ptr<DataType>& type,
+                 std::shared_ptr<ChunkedArray>* out) {
+    if (chunks.size() > 1 && type->id() != ::arrow::Type::DICTIONARY) {
+      std::shared_ptr<Array> array;
+      RETURN_NOT_OK(::arrow::Concatenate(chunks, pool_, &array));
+      chunks = {std::move(array)};
+    }
+    *out = std::make_shared<ChunkedArray>(std::move(chunks), type);
+    return Status::OK();
+  }
+
+  template <typename Function>
+  Status ForEachField(int num_fields, Function&& func) {
+    if (!use_threads_) {
+      for (int i = 0; i < num_fields; ++i) {
+        RETURN_NOT_OK(func(i));
+      }
+      return Status::OK();
+    }
+    std::vector<std::future<Status>> futures(num_fields);
+    auto pool = ::arrow::internal::GetCpuThreadPool();
+    for (int i = 0; i < num_fields; ++i) {
+      ARROW_ASSIGN_OR_RAISE(futures[i], pool->Submit(func, i));
+    }
+    Status final_status = Status::OK();
+    for (auto& fut : futures) {
+      Status st = fut.get();
+      if (!st.ok()) {
+        final_status = std::move(st);
+      }
+    }
+    return final_status;
+  }
+
+  std::vector<std::unique_ptr<ColumnReaderImpl>> filter_readers_;
+  std::shared_ptr<::arrow::Schema> filter_schema_;
+  // Null for the fields taken from the filter fields
   std::vector<std::unique_ptr<ColumnReaderImpl>> field_readers_;
+  // The position of each field among the filter fields, or -1
+  std::vector<int> filter_positions_;
   std::shared_ptr<::arrow::Schema> schema_;
+  RowFilter filter_;
   int64_t batch_size_;
+  bool use_threads_;
+  MemoryPool* pool_;
+  bool done_;
+
+  // The batch currently being iterated over
+  std::shared_ptr<Table> table_;
+  std::unique_ptr<::arrow::TableBatchReader> table_batch_reader_;
 };
 
 class ColumnChunkReaderImpl : public ColumnChunkReader {
@@ -403,7 +833,8 @@ class LeafReader : public ColumnReaderImpl {
         input_(std::move(input)),
         descr_(input_->descr()) {
     record_reader_ = RecordReader::Make(
-        descr_, ctx_->pool, field_->type()->id() == ::arrow::Type::DICTIONARY);
+        descr_, ctx_->pool, field_->type()->id() == ::arrow::Type::DICTIONARY,
+        ctx_->unify_dictionaries);
     NextRowGroup();
   }
 
@@ -442,6 +873,22 @@ class LeafReader : public ColumnReaderImpl {
     END_PARQUET_CATCH_EXCEPTIONS
   }
 
+  Status SkipRecords(int64_t num_records) override {
+    if (descr_->max_repetition_level() > 0) {
+      return ColumnReaderImpl::SkipRecords(num_records);
+    }
+    BEGIN_PARQUET_CATCH_EXCEPTIONS
+    while (num_records > 0 && record_reader_->HasMoreData()) {
+      const int64_t records_skipped = record_reader_->SkipRecords(num_records);
+      num_records -= records_skipped;
+      if (records_skipped == 0) {
+        NextRowGroup();
+      }
+    }
+    return Status::OK();
+    END_PARQUET_CATCH_EXCEPTIONS
+  }
+
   const std::shared_ptr<Field> field() override { return field_; }
   const ColumnDescriptor* descr() const override { return descr_; }
 
@@ -535,6 +982,12 @@ class PARQUET_NO_EXPORT StructReader : public ColumnReaderImpl {
   Status NextBatch(int64_t records_to_read, std::shared_ptr<ChunkedArray>* out) override;
   Status GetDefLevels(const int16_t** data, int64_t* length) override;
   Status GetRepLevels(const int16_t** data, int64_t* length) override;
+  Status SkipRecords(int64_t num_records) override {
+    for (auto& child : children_) {
+      RETURN_NOT_OK(child->SkipRecords(num_records));
+    }
+    return Status::OK();
+  }
   const std::shared_ptr<Field> field() override { return filtered_field_; }
   const ColumnDescriptor* descr() const override { return nullptr; }
   ReaderType type() const override { return STRUCT; }
@@ -770,7 +1223,88 @@ Status FileReaderImpl::GetRecordBatchReader(const std::vector<int>& row_group_in
     RETURN_NOT_OK(BoundsCheckRowGroup(row_group_index));
   }
   return RowGroupRecordBatchReader::Make(row_group_indices, column_indices, this,
-                                         reader_properties_.batch_size(), out);
+                                         reader_properties_.batch_size(),
+                                         /*page_selections=*/nullptr, out);
+}
+
+Status FileReaderImpl::GetRecordBatchReader(const std::vector<int>& row_group_indices,
+                                            const std::vector<int>& column_indices,
+                                            const std::vector<RowRanges>& row_selections,
+                                            std::shared_ptr<PageIndex> page_index,
+                                            std::unique_ptr<RecordBatchReader>* out) {
+  std::shared_ptr<const RowGroupPageSelections> page_selections;
+  RETURN_NOT_OK(SelectPages(row_group_indices, column_indices, row_selections,
+                            std::move(page_index), &page_selections));
+  return RowGroupRecordBatchReader::Make(row_group_indices, column_indices, this,
+                                         reader_properties_.batch_size(),
+                                         std::move(page_selections), out);
+}
+
+Status FileReaderImpl::GetFilteredRecordBatchReader(
+    const std::vector<int>& row_group_indices, const std::vector<int>& column_indices,
+    const std::vector<int>& filter_column_indices, RowFilter filter,
+    const std::vector<RowRanges>& row_selections, std::shared_ptr<PageIndex> page_index,
+    std::unique_ptr<RecordBatchReader>* out) {
+  if (filter_column_indices.empty()) {
+    return Status::Invalid("A row filter needs some columns to read");
+  }
+  for (auto row_group_index : row_group_indices) {
+    RETURN_NOT_OK(BoundsCheckRowGroup(row_group_index));
+  }
+  std::shared_ptr<const RowGroupPageSelections> page_selections;
+  if (!row_selections.empty()) {
+    // The filter and the other fields must be read from the same rows
+    auto leaves = VectorToSharedSet(column_indices);
+    leaves->insert(filter_column_indices.begin(), filter_column_indices.end());
+    RETURN_NOT_OK(SelectPages(row_group_indices,
+                              std::vector<int>(leaves->begin(), leaves->end()),
+                              row_selections, std::move(page_index), &page_selections));
+  }
+  return FilteredRecordBatchReader::Make(row_group_indices, column_indices,
+                                         filter_column_indices, std::move(filter), this,
+                                         std::move(page_selections), out);
+}
+
+Status FileReaderImpl::SelectPages(const std::vector<int>& row_group_indices,
+                                   const std::vector<int>& column_indices,
+                                   const std::vector<RowRanges>& row_selections,
+                                   std::shared_ptr<PageIndex> page_index,
+                                   std::shared_ptr<const RowGroupPageSelections>* out) {
+  if (row_selections.size() != row_group_indices.size()) {
+    return Status::Invalid("Got ", row_selections.size(), " row selections for ",
+                           row_group_indices.size(), " row groups");
+  }
+  for (auto row_group_index : row_group_indices) {
+    RETURN_NOT_OK(BoundsCheckRowGroup(row_group_index));
+  }
+
+  auto page_selections = std::make_shared<RowGroupPageSelections>();
+  BEGIN_PARQUET_CATCH_EXCEPTIONS
+  if (page_index == nullptr) {
+    page_index = reader_->ReadPageIndex(row_group_indices, column_indices);
+  }
+  for (size_t i = 0; i < row_group_indices.size(); ++i) {
+    const int row_group = row_group_indices[i];
+    std::unordered_map<int, const OffsetIndex*> offset_indexes;
+    for (int column : column_indices) {
+      const OffsetIndex* offset_index = page_index->GetOffsetIndex(row_group, column);
+      if (offset_index == nullptr) {
+        break;
+      }
+      offset_indexes[column] = offset_index;
+    }
+    if (offset_indexes.size() < column_indices.size()) {
+      // Read whole, for lack of an OffsetIndex
+      continue;
+    }
+    page_selections->selections[row_group] = PageSelection::Make(
+        row_selections[i], offset_indexes,
+        reader_->metadata()->RowGroup(row_group)->num_rows());
+  }
+  END_PARQUET_CATCH_EXCEPTIONS
+  page_selections->page_index = std::move(page_index);
+  *out = std::move(page_selections);
+  return Status::OK();
 }
 
 Status FileReaderImpl::GetColumn(int i, FileColumnIteratorFactory iterator_factory,
@@ -781,6 +1315,7 @@ Status FileReaderImpl::GetColumn(int i, FileColumnIteratorFactory iterator_facto
   ctx->pool = pool_;
   ctx->iterator_factory = AllRowGroupsFactory();
   ctx->filter_leaves = false;
+  ctx->unify_dictionaries = reader_properties_.unify_dictionaries();
   std::unique_ptr<ColumnReaderImpl> result;
   RETURN_NOT_OK(GetReader(manifest_.schema_fields[i], ctx, &result));
   out->reset(result.release());
@@ -790,7 +1325,9 @@ Status FileReaderImpl::GetColumn(int i, FileColumnIteratorFactory iterator_facto
 Status FileReaderImpl::ReadRowGroups(const std::vector<int>& row_groups,
                                      const std::vector<int>& indices,
                                      std::shared_ptr<Table>* out) {
-  BEGIN_PARQUET_CATCH_EXCEPTIONS
+  for (auto row_group : row_groups) {
+    RETURN_NOT_OK(BoundsCheckRowGroup(row_group));
+  }
 
   // We only need to read schema fields which have columns indicated
   // in the indices vector
@@ -799,6 +1336,26 @@ Status FileReaderImpl::ReadRowGroups(const std::vector<int>& row_groups,
     return Status::Invalid("Invalid column index");
   }
 
+  if (!reader_properties_.pre_buffer()) {
+    return DecodeRowGroups(row_groups, indices, field_indices, out);
+  }
+
+  // Coalesce the reads of all the column chunks before decoding them, as
+  // all of them are decoded at once
+  BEGIN_PARQUET_CATCH_EXCEPTIONS
+  reader_->PreBuffer(row_groups, indices, reader_properties_.cache_options());
+  END_PARQUET_CATCH_EXCEPTIONS
+  Status status = DecodeRowGroups(row_groups, indices, field_indices, out);
+  reader_->ReleasePreBuffered(row_groups);
+  return status;
+}
+
+Status FileReaderImpl::DecodeRowGroups(const std::vector<int>& row_groups,
+                                       const std::vector<int>& indices,
+                                       const std::vector<int>& field_indices,
+                                       std::shared_ptr<Table>* out) {
+  BEGIN_PARQUET_CATCH_EXCEPTIONS
+
   int num_fields = static_cast<int>(field_indices.size());
   std::vector<std::shared_ptr<Field>> fields(num_fields);
   std::vector<std::shared_ptr<ChunkedArray>> columns(num_fields);
@@ -19,6 +19,7 @@
 #define PARQUET_ARROW_READER_H
 
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <vector>
 
@@ -28,6 +29,7 @@
 
 namespace arrow {
 
+class Array;
 class ChunkedArray;
 class KeyValueMetadata;
 class RecordBatchReader;
@@ -49,6 +51,14 @@ class ColumnChunkReader;
 class ColumnReader;
 class RowGroupReader;
 
+/// \brief Select rows of a batch, see FileReader::GetFilteredRecordBatchReader
+///
+/// Set selection to a boolean array of the length of the batch, true for the
+/// rows to select. Null slots are not selected.
+using RowFilter =
+    std::function<::arrow::Status(const std::shared_ptr<::arrow::RecordBatch>& batch,
+                                  std::shared_ptr<::arrow::Array>* selection)>;
+
 /// \brief Arrow read adapter class for deserializing Parquet files as Arrow row batches.
 ///
 /// This interfaces caters for different use cases and thus provides different
@@ -173,6 +183,54 @@ class PARQUET_EXPORT FileReader {
                                        const std::vector<int>& column_indices,
                                        std::shared_ptr<::arrow::RecordBatchReader>* out);
 
+  /// \brief Return a RecordBatchReader of some rows of the row groups selected
+  ///     from row_group_indices, whose columns are selected by column_indices.
+  ///
+  /// Only the data pages holding the selected rows are read, as located by
+  /// the OffsetIndex of each column chunk. Pages being the unit of reading,
+  /// the rows of whole pages are returned: some rows may be returned that
+  /// were not selected, but they are the same for every column (see
+  /// parquet::PageSelection). Row groups for which some of the columns have
+  /// no OffsetIndex are read whole.
+  ///
+  /// \param[in] row_group_indices the row groups to read
+  /// \param[in] column_indices the leaf columns to read
+  /// \param[in] row_selections the rows to read of each row group of
+  ///     row_group_indices
+  /// \param[in] page_index the page index of these row groups and columns, as
+  ///     returned by ParquetFileReader::ReadPageIndex, or null to read it
+  /// \param[out] out the RecordBatchReader
+  virtual ::arrow::Status GetRecordBatchReader(
+      const std::vector<int>& row_group_indices, const std::vector<int>& column_indices,
+      const std::vector<RowRanges>& row_selections, std::shared_ptr<PageIndex> page_index,
+      std::unique_ptr<::arrow::RecordBatchReader>* out) = 0;
+
+  /// \brief Return a RecordBatchReader of the rows of the row groups selected
+  ///     from row_group_indices which satisfy a filter, whose columns are
+  ///     selected by column_indices.
+  ///
+  /// The fields holding filter_column_indices are decoded first, a batch at a
+  /// time, and passed to filter. The other fields are only decoded for the
+  /// rows it selects: the records in between are skipped, and so are the data
+  /// pages of non-repeated columns holding none of the selected rows, without
+  /// decompressing them. This pays off when the filter selects few rows out
+  /// of many columns.
+  ///
+  /// \param[in] row_group_indices the row groups to read
+  /// \param[in] column_indices the leaf columns to read
+  /// \param[in] filter_column_indices the leaf columns passed to filter, they
+  ///     are only returned if they are also in column_indices
+  /// \param[in] filter selects the rows to return
+  /// \param[in] row_selections the rows to consider of each row group, as in
+  ///     the overload above, or empty to consider all the rows
+  /// \param[in] page_index the page index for row_selections, or null to read it
+  /// \param[out] out the RecordBatchReader
+  virtual ::arrow::Status GetFilteredRecordBatchReader(
+      const std::vector<int>& row_group_indices, const std::vector<int>& column_indices,
+      const std::vector<int>& filter_column_indices, RowFilter filter,
+      const std::vector<RowRanges>& row_selections, std::shared_ptr<PageIndex> page_index,
+      std::unique_ptr<::arrow::RecordBatchReader>* out) = 0;
+
   /// Read all columns into a Table
   virtual ::arrow::Status ReadTable(std::shared_ptr<::arrow::Table>* out) = 0;
 
@@ -22,15 +22,21 @@
 #include <deque>
 #include <functional>
 #include <memory>
+#include <mutex>
+#include <sstream>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
 
+#include "arrow/io/caching.h"
+
 #include "parquet/arrow/schema.h"
 #include "parquet/column_reader.h"
+#include "parquet/exception.h"
 #include "parquet/file_reader.h"
 #include "parquet/metadata.h"
+#include "parquet/page_index.h"
 #include "parquet/platform.h"
 #include "parquet/schema.h"
 
@@ -58,27 +64,145 @@ class ColumnReaderImpl;
 // ----------------------------------------------------------------------
 // Iteration utilities
 
+// The data pages to read of some row groups, by row group index, and the
+// page index locating them
+struct RowGroupPageSelections {
+  std::shared_ptr<PageIndex> page_index;
+  std::unordered_map<int, PageSelection> selections;
+};
+
+// Pre-buffers the column chunks of the row groups read by some column
+// iterators one row group ahead of them, and releases each row group once
+// all of them are past it, to bound the memory held by pre-buffering.
+class RowGroupPrefetcher {
+ public:
+  // row_groups are the row groups read by each column iterator, in order.
+  // Those for which prebuffer is false are not pre-buffered.
+  RowGroupPrefetcher(ParquetFileReader* reader, std::vector<int> row_groups,
+                     std::vector<bool> prebuffer, std::vector<int> column_indices,
+                     int num_columns, ::arrow::io::CacheOptions options)
+      : reader_(reader),
+        row_groups_(std::move(row_groups)),
+        prebuffer_(std::move(prebuffer)),
+        column_indices_(std::move(column_indices)),
+        num_columns_(num_columns),
+        options_(options),
+        num_arrived_(row_groups_.size() + 1, 0),
+        prebuffered_until_(0),
+        released_until_(0) {}
+
+  ~RowGroupPrefetcher() {
+    std::vector<int> row_groups;
+    for (int i = released_until_; i < prebuffered_until_; ++i) {
+      if (prebuffer_[i]) {
+        row_groups.push_back(row_groups_[i]);
+      }
+    }
+    reader_->ReleasePreBuffered(row_groups);
+  }
+
+  // Called when a column iterator moves to row_groups[position], or past the
+  // last row group with position == row_groups.size()
+  void OnRowGroup(int position) {
+    const int num_row_groups = static_cast<int>(row_groups_.size());
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<int> row_groups;
+    for (; prebuffered_until_ < std::min(position + 2, num_row_groups);
+         ++prebuffered_until_) {
+      if (prebuffer_[prebuffered_until_]) {
+        row_groups.push_back(row_groups_[prebuffered_until_]);
+      }
+    }
+    if (!row_groups.empty()) {
+      reader_->PreBuffer(row_groups, column_indices_, options_);
+    }
+
+    ++num_arrived_[position];
+    row_groups.clear();
+    for (; released_until_ < num_row_groups &&
+           num_arrived_[released_until_ + 1] == num_columns_;
+         ++released_until_) {
+      if (prebuffer_[released_until_]) {
+        row_groups.push_back(row_groups_[released_until_]);
+      }
+    }
+    if (!row_groups.empty()) {
+      reader_->ReleasePreBuffered(row_groups);
+    }
+  }
+
+ private:
+  ParquetFileReader* reader_;
+  const std::vector<int> row_groups_;
+  const std::vector<bool> prebuffer_;
+  const std::vector<int> column_indices_;
+  const int num_columns_;
+  const ::arrow::io::CacheOptions options_;
+
+  std::mutex mutex_;
+  // The number of column iterators which moved to each position
+  std::vector<int> num_arrived_;
+  // The positions before these were pre-buffered, resp. released
+  int prebuffered_until_;
+  int released_until_;
+};
+
 // Abstraction to decouple row group iteration details from the ColumnReader,
 // so we can read only a single row group if we want
 class FileColumnIterator {
  public:
-  explicit FileColumnIterator(int column_index, ParquetFileReader* reader,
-                              std::vector<int> row_groups)
+  explicit FileColumnIterator(
+      int column_index, ParquetFileReader* reader, std::vector<int> row_groups,
+      std::shared_ptr<const RowGroupPageSelections> page_selections = NULLPTR,
+      std::shared_ptr<RowGroupPrefetcher> prefetcher = NULLPTR)
       : column_index_(column_index),
         reader_(reader),
         schema_(reader->metadata()->schema()),
-        row_groups_(row_groups.begin(), row_groups.end()) {}
+        row_groups_(row_groups.begin(), row_groups.end()),
+        page_selections_(std::move(page_selections)),
+        prefetcher_(std::move(prefetcher)),
+        position_(0) {}
 
   virtual ~FileColumnIterator() {}
 
   std::unique_ptr<::parquet::PageReader> NextChunk() {
-    if (row_groups_.empty()) {
-      return nullptr;
+    while (!row_groups_.empty()) {
+      const int row_group = row_groups_.front();
+      row_groups_.pop_front();
+      if (prefetcher_ != nullptr) {
+        prefetcher_->OnRowGroup(position_);
+      }
+      ++position_;
+      auto row_group_reader = reader_->RowGroup(row_group);
+      if (page_selections_ == nullptr) {
+        return row_group_reader->GetColumnPageReader(column_index_);
+      }
+      auto it = page_selections_->selections.find(row_group);
+      if (it == page_selections_->selections.end()) {
+        return row_group_reader->GetColumnPageReader(column_index_);
+      }
+      if (it->second.rows.empty()) {
+        // No rows selected
+        continue;
+      }
+      auto pages = it->second.data_pages.find(column_index_);
+      const OffsetIndex* offset_index =
+          page_selections_->page_index->GetOffsetIndex(row_group, column_index_);
+      if (pages == it->second.data_pages.end() || offset_index == nullptr) {
+        std::stringstream ss;
+        ss << "No data pages selected for column " << column_index_ << " of row group "
+           << row_group;
+        throw ParquetException(ss.str());
+      }
+      return row_group_reader->GetColumnPageReader(column_index_, *offset_index,
+                                                   pages->second);
     }
-
-    auto row_group_reader = reader_->RowGroup(row_groups_.front());
-    row_groups_.pop_front();
-    return row_group_reader->GetColumnPageReader(column_index_);
+    if (prefetcher_ != nullptr) {
+      // Past the last row group
+      prefetcher_->OnRowGroup(position_);
+      prefetcher_.reset();
+    }
+    return nullptr;
   }
 
   const SchemaDescriptor* schema() const { return schema_; }
@@ -94,6 +218,10 @@ class FileColumnIterator {
   ParquetFileReader* reader_;
   const SchemaDescriptor* schema_;
   std::deque<int> row_groups_;
+  std::shared_ptr<const RowGroupPageSelections> page_selections_;
+  std::shared_ptr<RowGroupPrefetcher> prefetcher_;
+  // The position in the row groups to read of the next row group
+  int position_;
 };
 
 using FileColumnIteratorFactory =
@@ -117,6 +245,8 @@ struct ReaderContext {
   FileColumnIteratorFactory iterator_factory;
   bool filter_leaves;
   std::shared_ptr<std::unordered_set<int>> included_leaves;
+  // Whether the leaves read as dictionaries share a single dictionary
+  bool unify_dictionaries = false;
 
   bool IncludesLeaf(int leaf_index) const {
     if (this->filter_leaves) {
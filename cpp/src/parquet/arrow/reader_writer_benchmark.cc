@@ -18,6 +18,8 @@
 #include "benchmark/benchmark.h"
 
 #include <iostream>
+#include <random>
+#include <string>
 
 #include "parquet/arrow/reader.h"
 #include "parquet/arrow/writer.h"
@@ -164,6 +166,40 @@ BENCHMARK_TEMPLATE2(BM_WriteColumn, true, DoubleType);
 BENCHMARK_TEMPLATE2(BM_WriteColumn, false, BooleanType);
 BENCHMARK_TEMPLATE2(BM_WriteColumn, true, BooleanType);
 
+// A wide table of random values, whose column chunks are encoded in parallel
+// with use_threads (state.range(0))
+static void BM_WriteTableColumns(::benchmark::State& state) {
+  const int num_columns = 32;
+  const int64_t num_rows = BENCHMARK_SIZE / num_columns;
+  std::vector<std::shared_ptr<::arrow::Field>> fields;
+  std::vector<std::shared_ptr<::arrow::Array>> columns;
+  std::default_random_engine rng(42);
+  std::uniform_int_distribution<int64_t> dist(0, 1 << 20);
+  for (int i = 0; i < num_columns; ++i) {
+    ::arrow::Int64Builder builder;
+    EXIT_NOT_OK(builder.Reserve(num_rows));
+    for (int64_t j = 0; j < num_rows; ++j) {
+      builder.UnsafeAppend(dist(rng));
+    }
+    std::shared_ptr<::arrow::Array> column;
+    EXIT_NOT_OK(builder.Finish(&column));
+    fields.push_back(::arrow::field("c" + std::to_string(i), ::arrow::int64()));
+    columns.push_back(column);
+  }
+  auto table = ::arrow::Table::Make(::arrow::schema(fields), columns);
+  auto arrow_properties =
+      ArrowWriterProperties::Builder().set_use_threads(state.range(0) != 0)->build();
+
+  while (state.KeepRunning()) {
+    auto output = CreateOutputStream();
+    EXIT_NOT_OK(WriteTable(*table, ::arrow::default_memory_pool(), output, num_rows,
+                           default_writer_properties(), arrow_properties));
+  }
+  state.SetBytesProcessed(state.iterations() * BENCHMARK_SIZE * sizeof(int64_t));
+}
+
+BENCHMARK(BM_WriteTableColumns)->Arg(0)->Arg(1)->UseRealTime();
+
 template <bool nullable, typename ParquetType>
 static void BM_ReadColumn(::benchmark::State& state) {
   using T = typename ParquetType::c_type;
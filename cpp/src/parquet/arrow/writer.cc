@@ -18,7 +18,9 @@
 #include "parquet/arrow/writer.h"
 
 #include <algorithm>
+#include <cmath>
 #include <deque>
+#include <future>
 #include <string>
 #include <type_traits>
 #include <utility>
@@ -28,9 +30,11 @@
 #include "arrow/buffer_builder.h"
 #include "arrow/extension_type.h"
 #include "arrow/ipc/writer.h"
+#include "arrow/record_batch.h"
 #include "arrow/table.h"
 #include "arrow/type.h"
 #include "arrow/util/base64.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/visitor_inline.h"
 #include "parquet/arrow/reader_internal.h"
 #include "parquet/arrow/schema.h"
@@ -54,6 +58,7 @@ using arrow::ListArray;
 using arrow::MemoryPool;
 using arrow::NumericArray;
 using arrow::PrimitiveArray;
+using arrow::RecordBatch;
 using arrow::ResizableBuffer;
 using arrow::Status;
 using arrow::Table;
@@ -424,7 +429,9 @@ class FileWriterImpl : public FileWriter {
         row_group_writer_(nullptr),
         column_write_context_(pool, arrow_properties.get()),
         arrow_properties_(std::move(arrow_properties)),
-        closed_(false) {}
+        closed_(false),
+        buffered_row_group_(false),
+        buffered_rows_(0) {}
 
   Status Init() {
     return SchemaManifest::Make(writer_->schema(), /*schema_metadata=*/nullptr,
@@ -436,6 +443,7 @@ class FileWriterImpl : public FileWriter {
       PARQUET_CATCH_NOT_OK(row_group_writer_->Close());
     }
     PARQUET_CATCH_NOT_OK(row_group_writer_ = writer_->AppendRowGroup());
+    buffered_row_group_ = false;
     return Status::OK();
   }
 
@@ -443,7 +451,9 @@ class FileWriterImpl : public FileWriter {
     if (!closed_) {
       // Make idempotent
       closed_ = true;
-      if (row_group_writer_ != nullptr) {
+      if (buffered_row_group_) {
+        RETURN_NOT_OK(CloseBufferedRowGroup());
+      } else if (row_group_writer_ != nullptr) {
         PARQUET_CATCH_NOT_OK(row_group_writer_->Close());
       }
       PARQUET_CATCH_NOT_OK(writer_->Close());
@@ -492,6 +502,11 @@ class FileWriterImpl : public FileWriter {
     }
 
     auto WriteRowGroup = [&](int64_t offset, int64_t size) {
+      if (UseThreads()) {
+        RETURN_NOT_OK(NewBufferedRowGroup());
+        RETURN_NOT_OK(WriteBufferedColumns(table.columns(), offset, size));
+        return CloseBufferedRowGroup();
+      }
       RETURN_NOT_OK(NewRowGroup(size));
       for (int i = 0; i < table.num_columns(); i++) {
         RETURN_NOT_OK(WriteColumnChunk(table.column(i), offset, size));
@@ -514,6 +529,40 @@ class FileWriterImpl : public FileWriter {
     return Status::OK();
   }
 
+  Status WriteRecordBatch(const RecordBatch& batch) override {
+    if (!batch.schema()->Equals(*schema_, false)) {
+      return Status::Invalid("record batch schema does not match this writer's. batch:'",
+                             batch.schema()->ToString(), "' this:'", schema_->ToString(),
+                             "'");
+    }
+    std::vector<std::shared_ptr<ChunkedArray>> columns;
+    for (int i = 0; i < batch.num_columns(); i++) {
+      columns.push_back(std::make_shared<ChunkedArray>(batch.column(i)));
+    }
+
+    int64_t offset = 0;
+    while (offset < batch.num_rows()) {
+      if (!buffered_row_group_) {
+        RETURN_NOT_OK(NewBufferedRowGroup());
+      }
+      const int64_t size = std::min(batch.num_rows() - offset, NextSliceRows());
+      if (size == 0) {
+        // The RowGroup can't take more rows within max_buffered_bytes
+        RETURN_NOT_OK(CloseBufferedRowGroup());
+        continue;
+      }
+      RETURN_NOT_OK(WriteBufferedColumns(columns, offset, size));
+      offset += size;
+      buffered_rows_ += size;
+      if (buffered_rows_ >= properties().max_row_group_length() ||
+          BufferedRowGroupBytes(/*with_dictionaries=*/false) >=
+              arrow_properties_->target_row_group_bytes()) {
+        RETURN_NOT_OK(CloseBufferedRowGroup());
+      }
+    }
+    return Status::OK();
+  }
+
   const WriterProperties& properties() const { return *writer_->properties(); }
 
   ::arrow::MemoryPool* memory_pool() const override {
@@ -527,6 +576,134 @@ class FileWriterImpl : public FileWriter {
  private:
   friend class FileWriter;
 
+  // The encryptors of the columns are not thread-safe
+  bool UseThreads() const {
+    return arrow_properties_->use_threads() &&
+           properties().file_encryption_properties() == nullptr;
+  }
+
+  // A buffered RowGroup holds the encoded pages of its column chunks in memory
+  // until it is closed, when they are written to the sink in schema order.
+  Status NewBufferedRowGroup() {
+    if (row_group_writer_ != nullptr) {
+      PARQUET_CATCH_NOT_OK(row_group_writer_->Close());
+    }
+    PARQUET_CATCH_NOT_OK(row_group_writer_ = writer_->AppendBufferedRowGroup());
+    buffered_row_group_ = true;
+    buffered_rows_ = 0;
+    return Status::OK();
+  }
+
+  Status CloseBufferedRowGroup() {
+    // Encode the last pages and the dictionaries in parallel, the column
+    // chunks are then only copied to the sink
+    if (UseThreads()) {
+      RETURN_NOT_OK(ForEachColumn(row_group_writer_->num_columns(), [this](int i) {
+        PARQUET_CATCH_NOT_OK(row_group_writer_->column(i)->FlushPages());
+        return Status::OK();
+      }));
+    }
+    PARQUET_CATCH_NOT_OK(row_group_writer_->Close());
+    buffered_row_group_ = false;
+    buffered_rows_ = 0;
+    return Status::OK();
+  }
+
+  // Write the slice [offset, offset + size) of the columns to the buffered
+  // RowGroup
+  Status WriteBufferedColumns(const std::vector<std::shared_ptr<ChunkedArray>>& columns,
+                              int64_t offset, int64_t size) {
+    return ForEachColumn(static_cast<int>(columns.size()), [&](int i) {
+      const SchemaField* schema_field = nullptr;
+      RETURN_NOT_OK(schema_manifest_.GetColumnField(i, &schema_field));
+      ColumnWriter* column_writer;
+      PARQUET_CATCH_NOT_OK(column_writer = row_group_writer_->column(i));
+      // The scratch buffers of a write context can't be shared between threads
+      ArrowWriteContext write_context(column_write_context_.memory_pool,
+                                      arrow_properties_.get());
+      ArrowColumnWriter arrow_writer(&write_context, column_writer, schema_field,
+                                     &schema_manifest_);
+      Status st;
+      PARQUET_CATCH_NOT_OK(st = arrow_writer.Write(*columns[i], offset, size));
+      return st;
+    });
+  }
+
+  // Call func(i) for the columns 0 to num_columns - 1, in parallel on the CPU
+  // thread pool with use_threads. Exceptions must not escape func.
+  template <typename Function>
+  Status ForEachColumn(int num_columns, Function&& func) {
+    if (!UseThreads()) {
+      for (int i = 0; i < num_columns; i++) {
+        RETURN_NOT_OK(func(i));
+      }
+      return Status::OK();
+    }
+    std::vector<std::future<Status>> futures;
+    futures.reserve(num_columns);
+    auto pool = ::arrow::internal::GetCpuThreadPool();
+    Status final_status = Status::OK();
+    for (int i = 0; i < num_columns; i++) {
+      auto maybe_future = pool->Submit(func, i);
+      if (!maybe_future.ok()) {
+        final_status = maybe_future.status();
+        break;
+      }
+      futures.push_back(std::move(maybe_future).ValueOrDie());
+    }
+    // Even if a submission failed, the submitted tasks must finish before
+    // returning, as they hold references to func and its captures
+    for (auto& fut : futures) {
+      Status st = fut.get();
+      if (!st.ok() && final_status.ok()) {
+        final_status = std::move(st);
+      }
+    }
+    return final_status;
+  }
+
+  // The estimated encoded size of the buffered RowGroup, as estimated by
+  // StreamWriter, and optionally the size of the dictionaries held in memory
+  int64_t BufferedRowGroupBytes(bool with_dictionaries) const {
+    int64_t bytes = 0;
+    for (int i = 0; i < row_group_writer_->num_columns(); i++) {
+      const ColumnWriter* column_writer = row_group_writer_->column(i);
+      bytes += column_writer->total_bytes_written() +
+               column_writer->total_compressed_bytes() +
+               column_writer->EstimatedBufferedValueBytes();
+      if (with_dictionaries) {
+        bytes += column_writer->EstimatedBufferedDictionaryBytes();
+      }
+    }
+    return bytes;
+  }
+
+  // The number of rows of the next slice of a batch written to the buffered
+  // RowGroup, from the average encoded size of its rows: enough to reach
+  // target_row_group_bytes, but not to exceed max_buffered_bytes. Return 0 if
+  // the RowGroup can't take more rows.
+  int64_t NextSliceRows() const {
+    const int64_t max_rows = properties().max_row_group_length() - buffered_rows_;
+    const int64_t min_rows = properties().write_batch_size();
+    if (buffered_rows_ == 0) {
+      // No rows to estimate the size of a row from yet
+      return std::min(max_rows, min_rows);
+    }
+    const double row_bytes = std::max(
+        1.0, static_cast<double>(BufferedRowGroupBytes(/*with_dictionaries=*/false)) /
+                 static_cast<double>(buffered_rows_));
+    const int64_t target_rows = static_cast<int64_t>(std::ceil(
+        (arrow_properties_->target_row_group_bytes() -
+         BufferedRowGroupBytes(/*with_dictionaries=*/false)) /
+        row_bytes));
+    const int64_t memory_rows = static_cast<int64_t>(
+        (arrow_properties_->max_buffered_bytes() -
+         BufferedRowGroupBytes(/*with_dictionaries=*/true)) /
+        row_bytes);
+    return std::max<int64_t>(
+        0, std::min({max_rows, memory_rows, std::max(target_rows, min_rows)}));
+  }
+
   std::shared_ptr<::arrow::Schema> schema_;
 
   SchemaManifest schema_manifest_;
@@ -536,6 +713,10 @@ class FileWriterImpl : public FileWriter {
   ArrowWriteContext column_write_context_;
   std::shared_ptr<ArrowWriterProperties> arrow_properties_;
   bool closed_;
+  // Whether row_group_writer_ is a buffered RowGroup written by
+  // WriteRecordBatch, and the number of rows written to it
+  bool buffered_row_group_;
+  int64_t buffered_rows_;
 };
 
 FileWriter::~FileWriter() {}
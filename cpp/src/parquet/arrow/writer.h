@@ -28,6 +28,7 @@ namespace arrow {
 
 class Array;
 class ChunkedArray;
+class RecordBatch;
 class Schema;
 class Table;
 
@@ -67,6 +68,14 @@ class PARQUET_EXPORT FileWriter {
   /// \brief Write a Table to Parquet.
   virtual ::arrow::Status WriteTable(const ::arrow::Table& table, int64_t chunk_size) = 0;
 
+  /// \brief Append a RecordBatch to the current RowGroup.
+  ///
+  /// The encoded pages of the RowGroup are held in memory, and it is closed
+  /// once it reaches ArrowWriterProperties::target_row_group_bytes or
+  /// WriterProperties::max_row_group_length rows, so consecutive small batches
+  /// are written to the same RowGroup. The last RowGroup is closed by Close.
+  virtual ::arrow::Status WriteRecordBatch(const ::arrow::RecordBatch& batch) = 0;
+
   virtual ::arrow::Status NewRowGroup(int64_t chunk_size) = 0;
   virtual ::arrow::Status WriteColumnChunk(const ::arrow::Array& data) = 0;
 
@@ -17,13 +17,21 @@
 
 #include <cstdint>
 #include <cstring>
+#include <utility>
+#include <vector>
 
+#include "arrow/util/dispatch.h"
 #include "arrow/util/logging.h"
 #include "parquet/bloom_filter.h"
+#include "parquet/bloom_filter_internal.h"
 #include "parquet/exception.h"
 #include "parquet/murmur3.h"
 
 namespace parquet {
+
+using ::arrow::internal::DispatchLevel;
+using ::arrow::internal::DynamicDispatch;
+
 constexpr uint32_t BlockSplitBloomFilter::SALT[kBitsSetPerBlock];
 
 BlockSplitBloomFilter::BlockSplitBloomFilter()
@@ -111,51 +119,92 @@ void BlockSplitBloomFilter::WriteTo(ArrowOutputStream* sink) const {
   PARQUET_THROW_NOT_OK(sink->Write(data_->mutable_data(), num_bytes_));
 }
 
-void BlockSplitBloomFilter::SetMask(uint32_t key, BlockMask& block_mask) const {
-  for (int i = 0; i < kBitsSetPerBlock; ++i) {
-    block_mask.item[i] = key * SALT[i];
+namespace internal {
+
+void FindHashesDefault(const uint32_t* salt, const uint32_t* bitset32,
+                       uint32_t num_blocks, const uint64_t* hashes, int num_values,
+                       bool* found) {
+  for (int i = 0; i < num_values; ++i) {
+    const uint32_t bucket_index =
+        static_cast<uint32_t>(hashes[i] >> 32) & (num_blocks - 1);
+    const uint32_t key = static_cast<uint32_t>(hashes[i]);
+    const uint32_t* block = bitset32 + 8 * bucket_index;
+    bool all_set = true;
+    for (int j = 0; j < 8; ++j) {
+      all_set &= (block[j] & (UINT32_C(0x1) << ((key * salt[j]) >> 27))) != 0;
+    }
+    found[i] = all_set;
   }
+}
 
-  for (int i = 0; i < kBitsSetPerBlock; ++i) {
-    block_mask.item[i] = block_mask.item[i] >> 27;
+void InsertHashesDefault(const uint32_t* salt, uint32_t* bitset32, uint32_t num_blocks,
+                         const uint64_t* hashes, int num_values) {
+  for (int i = 0; i < num_values; ++i) {
+    const uint32_t bucket_index =
+        static_cast<uint32_t>(hashes[i] >> 32) & (num_blocks - 1);
+    const uint32_t key = static_cast<uint32_t>(hashes[i]);
+    uint32_t* block = bitset32 + 8 * bucket_index;
+    for (int j = 0; j < 8; ++j) {
+      block[j] |= UINT32_C(0x1) << ((key * salt[j]) >> 27);
+    }
   }
+}
+
+}  // namespace internal
+
+namespace {
+
+struct FindHashesDynamic {
+  using FunctionType = decltype(&internal::FindHashesDefault);
 
-  for (int i = 0; i < kBitsSetPerBlock; ++i) {
-    block_mask.item[i] = UINT32_C(0x1) << block_mask.item[i];
+  static std::vector<std::pair<DispatchLevel, FunctionType>> implementations() {
+    return {
+      {DispatchLevel::NONE, internal::FindHashesDefault}
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+      , {DispatchLevel::AVX2, internal::FindHashesAvx2}
+#endif
+    };
   }
-}
+};
+
+struct InsertHashesDynamic {
+  using FunctionType = decltype(&internal::InsertHashesDefault);
+
+  static std::vector<std::pair<DispatchLevel, FunctionType>> implementations() {
+    return {
+      {DispatchLevel::NONE, internal::InsertHashesDefault}
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+      , {DispatchLevel::AVX2, internal::InsertHashesAvx2}
+#endif
+    };
+  }
+};
+
+}  // namespace
 
 bool BlockSplitBloomFilter::FindHash(uint64_t hash) const {
-  const uint32_t bucket_index =
-      static_cast<uint32_t>((hash >> 32) & (num_bytes_ / kBytesPerFilterBlock - 1));
-  uint32_t key = static_cast<uint32_t>(hash);
-  uint32_t* bitset32 = reinterpret_cast<uint32_t*>(data_->mutable_data());
-
-  // Calculate mask for bucket.
-  BlockMask block_mask;
-  SetMask(key, block_mask);
-
-  for (int i = 0; i < kBitsSetPerBlock; ++i) {
-    if (0 == (bitset32[kBitsSetPerBlock * bucket_index + i] & block_mask.item[i])) {
-      return false;
-    }
-  }
-  return true;
+  bool found;
+  internal::FindHashesDefault(SALT, reinterpret_cast<const uint32_t*>(data_->data()),
+                              num_bytes_ / kBytesPerFilterBlock, &hash, 1, &found);
+  return found;
 }
 
 void BlockSplitBloomFilter::InsertHash(uint64_t hash) {
-  const uint32_t bucket_index =
-      static_cast<uint32_t>(hash >> 32) & (num_bytes_ / kBytesPerFilterBlock - 1);
-  uint32_t key = static_cast<uint32_t>(hash);
-  uint32_t* bitset32 = reinterpret_cast<uint32_t*>(data_->mutable_data());
+  internal::InsertHashesDefault(SALT, reinterpret_cast<uint32_t*>(data_->mutable_data()),
+                                num_bytes_ / kBytesPerFilterBlock, &hash, 1);
+}
 
-  // Calculate mask for bucket.
-  BlockMask block_mask;
-  SetMask(key, block_mask);
+void BlockSplitBloomFilter::FindHashes(const uint64_t* hashes, int num_values,
+                                       bool* found) const {
+  static DynamicDispatch<FindHashesDynamic> dispatch;
+  dispatch.func(SALT, reinterpret_cast<const uint32_t*>(data_->data()),
+                num_bytes_ / kBytesPerFilterBlock, hashes, num_values, found);
+}
 
-  for (int i = 0; i < kBitsSetPerBlock; i++) {
-    bitset32[bucket_index * kBitsSetPerBlock + i] |= block_mask.item[i];
-  }
+void BlockSplitBloomFilter::InsertHashes(const uint64_t* hashes, int num_values) {
+  static DynamicDispatch<InsertHashesDynamic> dispatch;
+  dispatch.func(SALT, reinterpret_cast<uint32_t*>(data_->mutable_data()),
+                num_bytes_ / kBytesPerFilterBlock, hashes, num_values);
 }
 
 }  // namespace parquet
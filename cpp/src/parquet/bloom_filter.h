@@ -49,6 +49,19 @@ class PARQUET_EXPORT BloomFilter {
   /// @param hash the hash of value to insert into Bloom filter.
   virtual void InsertHash(uint64_t hash) = 0;
 
+  /// Determine whether each element of a batch exists in set or not.
+  ///
+  /// @param hashes the hashes of the elements to look up.
+  /// @param num_values the number of hashes.
+  /// @param found set to false for each value definitely not in set, and to true
+  /// for each value PROBABLY in set.
+  virtual void FindHashes(const uint64_t* hashes, int num_values, bool* found) const = 0;
+
+  /// Insert a batch of elements to set represented by Bloom filter bitset.
+  /// @param hashes the hashes of values to insert into Bloom filter.
+  /// @param num_values the number of hashes.
+  virtual void InsertHashes(const uint64_t* hashes, int num_values) = 0;
+
   /// Write this Bloom filter to an output stream. A Bloom filter structure should
   /// include bitset length, hash strategy, algorithm, and bitset.
   ///
@@ -101,6 +114,65 @@ class PARQUET_EXPORT BloomFilter {
   /// @return hash result.
   virtual uint64_t Hash(const FLBA* value, uint32_t len) const = 0;
 
+  /// Compute hashes for a batch of 32 bits values by using their plain encoding
+  /// results.
+  ///
+  /// @param values the values to hash.
+  /// @param num_values the number of values.
+  /// @param hashes the num_values hash results.
+  virtual void Hashes(const int32_t* values, int num_values, uint64_t* hashes) const = 0;
+
+  /// Compute hashes for a batch of 64 bits values by using their plain encoding
+  /// results.
+  ///
+  /// @param values the values to hash.
+  /// @param num_values the number of values.
+  /// @param hashes the num_values hash results.
+  virtual void Hashes(const int64_t* values, int num_values, uint64_t* hashes) const = 0;
+
+  /// Compute hashes for a batch of float values by using their plain encoding
+  /// results.
+  ///
+  /// @param values the values to hash.
+  /// @param num_values the number of values.
+  /// @param hashes the num_values hash results.
+  virtual void Hashes(const float* values, int num_values, uint64_t* hashes) const = 0;
+
+  /// Compute hashes for a batch of double values by using their plain encoding
+  /// results.
+  ///
+  /// @param values the values to hash.
+  /// @param num_values the number of values.
+  /// @param hashes the num_values hash results.
+  virtual void Hashes(const double* values, int num_values, uint64_t* hashes) const = 0;
+
+  /// Compute hashes for a batch of Int96 values by using their plain encoding
+  /// results.
+  ///
+  /// @param values the values to hash.
+  /// @param num_values the number of values.
+  /// @param hashes the num_values hash results.
+  virtual void Hashes(const Int96* values, int num_values, uint64_t* hashes) const = 0;
+
+  /// Compute hashes for a batch of ByteArray values by using their plain encoding
+  /// results.
+  ///
+  /// @param values the values to hash.
+  /// @param num_values the number of values.
+  /// @param hashes the num_values hash results.
+  virtual void Hashes(const ByteArray* values, int num_values,
+                      uint64_t* hashes) const = 0;
+
+  /// Compute hashes for a batch of fixed byte array values by using their plain
+  /// encoding results.
+  ///
+  /// @param values the values to hash.
+  /// @param type_len the length of the values.
+  /// @param num_values the number of values.
+  /// @param hashes the num_values hash results.
+  virtual void Hashes(const FLBA* values, uint32_t type_len, int num_values,
+                      uint64_t* hashes) const = 0;
+
   virtual ~BloomFilter() {}
 
  protected:
@@ -182,6 +254,11 @@ class PARQUET_EXPORT BlockSplitBloomFilter : public BloomFilter {
 
   bool FindHash(uint64_t hash) const override;
   void InsertHash(uint64_t hash) override;
+
+  /// The lookups and insertions of a batch use SIMD instructions when the CPU
+  /// supports them.
+  void FindHashes(const uint64_t* hashes, int num_values, bool* found) const override;
+  void InsertHashes(const uint64_t* hashes, int num_values) override;
   void WriteTo(ArrowOutputStream* sink) const override;
   uint32_t GetBitsetSize() const override { return num_bytes_; }
 
@@ -195,6 +272,29 @@ class PARQUET_EXPORT BlockSplitBloomFilter : public BloomFilter {
     return hasher_->Hash(value, len);
   }
 
+  void Hashes(const int32_t* values, int num_values, uint64_t* hashes) const override {
+    hasher_->Hashes(values, num_values, hashes);
+  }
+  void Hashes(const int64_t* values, int num_values, uint64_t* hashes) const override {
+    hasher_->Hashes(values, num_values, hashes);
+  }
+  void Hashes(const float* values, int num_values, uint64_t* hashes) const override {
+    hasher_->Hashes(values, num_values, hashes);
+  }
+  void Hashes(const double* values, int num_values, uint64_t* hashes) const override {
+    hasher_->Hashes(values, num_values, hashes);
+  }
+  void Hashes(const Int96* values, int num_values, uint64_t* hashes) const override {
+    hasher_->Hashes(values, num_values, hashes);
+  }
+  void Hashes(const ByteArray* values, int num_values, uint64_t* hashes) const override {
+    hasher_->Hashes(values, num_values, hashes);
+  }
+  void Hashes(const FLBA* values, uint32_t type_len, int num_values,
+              uint64_t* hashes) const override {
+    hasher_->Hashes(values, type_len, num_values, hashes);
+  }
+
   /// Deserialize the Bloom filter from an input stream. It is used when reconstructing
   /// a Bloom filter from a parquet filter.
   ///
@@ -209,22 +309,12 @@ class PARQUET_EXPORT BlockSplitBloomFilter : public BloomFilter {
   // The number of bits to be set in each tiny Bloom filter
   static constexpr int kBitsSetPerBlock = 8;
 
-  // A mask structure used to set bits in each tiny Bloom filter.
-  struct BlockMask {
-    uint32_t item[kBitsSetPerBlock];
-  };
-
   // The block-based algorithm needs eight odd SALT values to calculate eight indexes
   // of bit to set, one bit in each 32-bit word.
   static constexpr uint32_t SALT[kBitsSetPerBlock] = {
       0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU,
       0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U};
 
-  /// Set bits in mask array according to input key.
-  /// @param key the value to calculate mask values.
-  /// @param mask the mask array is used to set inside a block
-  void SetMask(uint32_t key, BlockMask& mask) const;
-
   // Memory pool to allocate aligned buffer for bitset
   ::arrow::MemoryPool* pool_;
 
@@ -0,0 +1,69 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Bloom filter batch operations compiled with AVX2 code generation, see
+// bloom_filter_internal.h
+
+#include <immintrin.h>
+
+#include <cstdint>
+
+#include "parquet/bloom_filter_internal.h"
+
+namespace parquet {
+namespace internal {
+
+namespace {
+
+// The bit to set or test in each of the eight words of a block
+inline __m256i BlockMask(__m256i salt, uint64_t hash) {
+  const __m256i key = _mm256_set1_epi32(static_cast<int>(static_cast<uint32_t>(hash)));
+  const __m256i bit_index = _mm256_srli_epi32(_mm256_mullo_epi32(key, salt), 27);
+  return _mm256_sllv_epi32(_mm256_set1_epi32(1), bit_index);
+}
+
+inline uint32_t BlockIndex(uint64_t hash, uint32_t num_blocks) {
+  return static_cast<uint32_t>(hash >> 32) & (num_blocks - 1);
+}
+
+}  // namespace
+
+void FindHashesAvx2(const uint32_t* salt, const uint32_t* bitset32, uint32_t num_blocks,
+                    const uint64_t* hashes, int num_values, bool* found) {
+  const __m256i salt_vector = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(salt));
+  for (int i = 0; i < num_values; ++i) {
+    const uint32_t* block_words = bitset32 + 8 * BlockIndex(hashes[i], num_blocks);
+    const __m256i block =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block_words));
+    // Whether all the bits of the mask are set in the block
+    found[i] = _mm256_testc_si256(block, BlockMask(salt_vector, hashes[i])) != 0;
+  }
+}
+
+void InsertHashesAvx2(const uint32_t* salt, uint32_t* bitset32, uint32_t num_blocks,
+                      const uint64_t* hashes, int num_values) {
+  const __m256i salt_vector = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(salt));
+  for (int i = 0; i < num_values; ++i) {
+    auto* block =
+        reinterpret_cast<__m256i*>(bitset32 + 8 * BlockIndex(hashes[i], num_blocks));
+    _mm256_storeu_si256(block, _mm256_or_si256(_mm256_loadu_si256(block),
+                                               BlockMask(salt_vector, hashes[i])));
+  }
+}
+
+}  // namespace internal
+}  // namespace parquet
@@ -0,0 +1,106 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "benchmark/benchmark.h"
+
+#include "parquet/bloom_filter.h"
+
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace parquet {
+
+namespace {
+
+// The number of hashes inserted or looked up in each iteration
+constexpr int kNumHashes = 4096;
+
+std::vector<uint64_t> RandomHashes() {
+  std::vector<uint64_t> hashes(kNumHashes);
+  std::mt19937_64 gen(42);
+  for (auto& hash : hashes) {
+    hash = gen();
+  }
+  return hashes;
+}
+
+// A filter sized for state.range(0) distinct values with a 1% false positive
+// probability, holding half of the hashes
+std::unique_ptr<BlockSplitBloomFilter> MakeFilter(const benchmark::State& state,
+                                                  const std::vector<uint64_t>& hashes) {
+  std::unique_ptr<BlockSplitBloomFilter> filter(new BlockSplitBloomFilter());
+  filter->Init(BlockSplitBloomFilter::OptimalNumOfBits(
+                   static_cast<uint32_t>(state.range(0)), 0.01) /
+               8);
+  filter->InsertHashes(hashes.data(), kNumHashes / 2);
+  return filter;
+}
+
+}  // namespace
+
+static void BM_InsertHash(benchmark::State& state) {
+  const auto hashes = RandomHashes();
+  auto filter = MakeFilter(state, hashes);
+  for (auto _ : state) {
+    for (uint64_t hash : hashes) {
+      filter->InsertHash(hash);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kNumHashes);
+}
+
+static void BM_InsertHashes(benchmark::State& state) {
+  const auto hashes = RandomHashes();
+  auto filter = MakeFilter(state, hashes);
+  for (auto _ : state) {
+    filter->InsertHashes(hashes.data(), kNumHashes);
+  }
+  state.SetItemsProcessed(state.iterations() * kNumHashes);
+}
+
+static void BM_FindHash(benchmark::State& state) {
+  const auto hashes = RandomHashes();
+  auto filter = MakeFilter(state, hashes);
+  std::unique_ptr<bool[]> found(new bool[kNumHashes]);
+  for (auto _ : state) {
+    for (int i = 0; i < kNumHashes; ++i) {
+      found[i] = filter->FindHash(hashes[i]);
+    }
+    benchmark::DoNotOptimize(found.get());
+  }
+  state.SetItemsProcessed(state.iterations() * kNumHashes);
+}
+
+static void BM_FindHashes(benchmark::State& state) {
+  const auto hashes = RandomHashes();
+  auto filter = MakeFilter(state, hashes);
+  std::unique_ptr<bool[]> found(new bool[kNumHashes]);
+  for (auto _ : state) {
+    filter->FindHashes(hashes.data(), kNumHashes, found.get());
+    benchmark::DoNotOptimize(found.get());
+  }
+  state.SetItemsProcessed(state.iterations() * kNumHashes);
+}
+
+BENCHMARK(BM_InsertHash)->Arg(1 << 10)->Arg(1 << 20);
+BENCHMARK(BM_InsertHashes)->Arg(1 << 10)->Arg(1 << 20);
+BENCHMARK(BM_FindHash)->Arg(1 << 10)->Arg(1 << 20);
+BENCHMARK(BM_FindHashes)->Arg(1 << 10)->Arg(1 << 20);
+
+}  // namespace parquet
@@ -0,0 +1,51 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef PARQUET_BLOOM_FILTER_INTERNAL_H
+#define PARQUET_BLOOM_FILTER_INTERNAL_H
+
+#include <cstdint>
+
+namespace parquet {
+namespace internal {
+
+// Lookups and insertions of batches of hashes in the bitset of a
+// BlockSplitBloomFilter, with an implementation for each
+// arrow::internal::DispatchLevel (see arrow/util/dispatch.h).
+//
+// The bitset holds num_blocks blocks of eight 32-bit words, num_blocks being
+// a power of 2.  The upper 32 bits of a hash select the block and the lower 32
+// bits, multiplied by each of the eight salt values, select one bit in each
+// word of the block.
+
+void FindHashesDefault(const uint32_t* salt, const uint32_t* bitset32,
+                       uint32_t num_blocks, const uint64_t* hashes, int num_values,
+                       bool* found);
+void InsertHashesDefault(const uint32_t* salt, uint32_t* bitset32, uint32_t num_blocks,
+                         const uint64_t* hashes, int num_values);
+
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+void FindHashesAvx2(const uint32_t* salt, const uint32_t* bitset32, uint32_t num_blocks,
+                    const uint64_t* hashes, int num_values, bool* found);
+void InsertHashesAvx2(const uint32_t* salt, uint32_t* bitset32, uint32_t num_blocks,
+                      const uint64_t* hashes, int num_values);
+#endif
+
+}  // namespace internal
+}  // namespace parquet
+
+#endif  // PARQUET_BLOOM_FILTER_INTERNAL_H
@@ -90,6 +90,102 @@ TEST(BasicTest, TestBloomFilter) {
   }
 }
 
+// The BatchTest checks that hashing, inserting and looking up batches of values gives
+// the same results as doing so one value at a time.
+TEST(BatchTest, TestBloomFilter) {
+  const int num_values = 1000;
+  std::vector<int64_t> values(num_values);
+  std::default_random_engine gen(42);
+  std::uniform_int_distribution<int64_t> dist;
+  for (auto& value : values) {
+    value = dist(gen);
+  }
+
+  BlockSplitBloomFilter batch_filter;
+  batch_filter.Init(1024);
+  BlockSplitBloomFilter single_filter;
+  single_filter.Init(1024);
+
+  std::vector<uint64_t> hashes(num_values);
+  batch_filter.Hashes(values.data(), num_values / 2, hashes.data());
+  batch_filter.InsertHashes(hashes.data(), num_values / 2);
+  for (int i = 0; i < num_values / 2; i++) {
+    ASSERT_EQ(hashes[i], single_filter.Hash(values[i]));
+    single_filter.InsertHash(single_filter.Hash(values[i]));
+  }
+
+  auto serialize = [](const BloomFilter& bloom_filter) {
+    auto sink = CreateOutputStream();
+    bloom_filter.WriteTo(sink.get());
+    return sink->Finish().ValueOrDie();
+  };
+  ASSERT_TRUE(serialize(batch_filter)->Equals(*serialize(single_filter)));
+
+  // Half of the values were inserted, some of the others are false positives
+  batch_filter.Hashes(values.data(), num_values, hashes.data());
+  std::unique_ptr<bool[]> found(new bool[num_values]);
+  batch_filter.FindHashes(hashes.data(), num_values, found.get());
+  int num_found = 0;
+  for (int i = 0; i < num_values; i++) {
+    ASSERT_EQ(found[i], single_filter.FindHash(hashes[i])) << i;
+    num_found += found[i];
+  }
+  EXPECT_LT(num_found, num_values);
+  for (int i = 0; i < num_values / 2; i++) {
+    ASSERT_TRUE(found[i]) << i;
+  }
+}
+
+TEST(BatchTest, TestHashes) {
+  BlockSplitBloomFilter bloom_filter;
+  bloom_filter.Init(1024);
+  uint64_t hashes[3];
+
+  const int32_t int32_values[3] = {1, -2, 3};
+  bloom_filter.Hashes(int32_values, 3, hashes);
+  for (int i = 0; i < 3; i++) {
+    EXPECT_EQ(hashes[i], bloom_filter.Hash(int32_values[i]));
+  }
+
+  const float float_values[3] = {1.5f, -0.0f, 3.25f};
+  bloom_filter.Hashes(float_values, 3, hashes);
+  for (int i = 0; i < 3; i++) {
+    EXPECT_EQ(hashes[i], bloom_filter.Hash(float_values[i]));
+  }
+
+  const double double_values[3] = {1.5, -2.5, 1e100};
+  bloom_filter.Hashes(double_values, 3, hashes);
+  for (int i = 0; i < 3; i++) {
+    EXPECT_EQ(hashes[i], bloom_filter.Hash(double_values[i]));
+  }
+
+  const Int96 int96_values[3] = {{{1, 2, 3}}, {{4, 5, 6}}, {{7, 8, 9}}};
+  bloom_filter.Hashes(int96_values, 3, hashes);
+  for (int i = 0; i < 3; i++) {
+    EXPECT_EQ(hashes[i], bloom_filter.Hash(&int96_values[i]));
+  }
+
+  const std::string strings[3] = {"", "parquet", "bloom filter"};
+  ByteArray byte_arrays[3];
+  for (int i = 0; i < 3; i++) {
+    byte_arrays[i] = ByteArray(static_cast<uint32_t>(strings[i].size()),
+                               reinterpret_cast<const uint8_t*>(strings[i].data()));
+  }
+  bloom_filter.Hashes(byte_arrays, 3, hashes);
+  for (int i = 0; i < 3; i++) {
+    EXPECT_EQ(hashes[i], bloom_filter.Hash(&byte_arrays[i]));
+  }
+
+  const std::string fixed = "abcdefghi";
+  const FLBA flbas[3] = {FLBA(reinterpret_cast<const uint8_t*>(fixed.data())),
+                         FLBA(reinterpret_cast<const uint8_t*>(fixed.data()) + 3),
+                         FLBA(reinterpret_cast<const uint8_t*>(fixed.data()) + 6)};
+  bloom_filter.Hashes(flbas, 3, 3, hashes);
+  for (int i = 0; i < 3; i++) {
+    EXPECT_EQ(hashes[i], bloom_filter.Hash(&flbas[i], 3));
+  }
+}
+
 // Helper function to generate random string.
 std::string GetRandomString(uint32_t length) {
   // Character set used to generate random string
@@ -137,6 +137,10 @@ class SerializedPageReader : public PageReader {
 
   void set_max_page_header_size(uint32_t size) override { max_page_header_size_ = size; }
 
+  void set_data_page_filter(std::function<bool(int64_t num_values)> filter) override {
+    data_page_filter_ = std::move(filter);
+  }
+
  private:
   void UpdateDecryption(const std::shared_ptr<Decryptor>& decryptor, int8_t module_type,
                         const std::string& page_aad);
@@ -167,6 +171,9 @@ class SerializedPageReader : public PageReader {
   // Maximum allowed page size
   uint32_t max_page_header_size_;
 
+  // Decides from their number of values which data pages to skip
+  std::function<bool(int64_t num_values)> data_page_filter_;
+
   // Number of rows read in data pages so far
   int64_t seen_num_rows_;
 
@@ -257,6 +264,22 @@ std::shared_ptr<Page> SerializedPageReader::NextPage() {
 
     int compressed_len = current_page_header_.compressed_page_size;
     int uncompressed_len = current_page_header_.uncompressed_page_size;
+
+    if (data_page_filter_ &&
+        (current_page_header_.type == format::PageType::DATA_PAGE ||
+         current_page_header_.type == format::PageType::DATA_PAGE_V2)) {
+      const int64_t num_values =
+          current_page_header_.type == format::PageType::DATA_PAGE
+              ? current_page_header_.data_page_header.num_values
+              : current_page_header_.data_page_header_v2.num_values;
+      if (data_page_filter_(num_values)) {
+        // Skip the page, keeping the page ordinal of the decryption AAD in step
+        PARQUET_THROW_NOT_OK(stream_->Advance(compressed_len));
+        ++page_ordinal_;
+        seen_num_rows_ += num_values;
+        continue;
+      }
+    }
     if (crypto_ctx_.data_decryptor != nullptr) {
       UpdateDecryption(crypto_ctx_.data_decryptor, encryption::kDictionaryPage,
                        data_page_aad_);
@@ -586,8 +609,12 @@ class ColumnReaderImplBase {
 
         case Encoding::DELTA_BINARY_PACKED:
         case Encoding::DELTA_LENGTH_BYTE_ARRAY:
-        case Encoding::DELTA_BYTE_ARRAY:
-          ParquetException::NYI("Unsupported encoding");
+        case Encoding::DELTA_BYTE_ARRAY: {
+          auto decoder = MakeTypedDecoder<DType>(encoding, descr_);
+          current_decoder_ = decoder.get();
+          decoders_[static_cast<int>(encoding)] = std::move(decoder);
+          break;
+        }
 
         default:
           throw ParquetException("Unknown encoding type.");
@@ -975,6 +1002,38 @@ class TypedRecordReader : public ColumnReaderImplBase<DType>,
     return records_read;
   }
 
+  int64_t SkipRecords(int64_t num_records) override {
+    if (this->max_rep_level_ > 0) {
+      throw ParquetException("Skipping records of repeated columns is not supported");
+    }
+    // Each level is a record, as is each value of required columns
+    int64_t records_skipped = SkipBufferedLevels(num_records);
+    while (records_skipped < num_records) {
+      if (available_values_current_page() == 0) {
+        // The pager skips the data pages made only of records to skip
+        records_to_skip_ = num_records - records_skipped;
+        const bool has_next = this->HasNextInternal();
+        records_skipped = num_records - records_to_skip_;
+        records_to_skip_ = 0;
+        if (!has_next) {
+          break;
+        }
+        continue;
+      }
+      const int64_t records_in_page =
+          std::min(num_records - records_skipped, available_values_current_page());
+      if (records_in_page == available_values_current_page()) {
+        // Decoders are reset by the next page
+        this->ConsumeBufferedValues(records_in_page);
+      } else {
+        SkipValues(CountValues(records_in_page));
+        this->ConsumeBufferedValues(records_in_page);
+      }
+      records_skipped += records_in_page;
+    }
+    return records_skipped;
+  }
+
   // We may outwardly have the appearance of having exhausted a column chunk
   // when in fact we are in the middle of processing the last batch
   bool has_values_to_process() const { return levels_position_ < levels_written_; }
@@ -1129,6 +1188,16 @@ class TypedRecordReader : public ColumnReaderImplBase<DType>,
   void SetPageReader(std::unique_ptr<PageReader> reader) override {
     at_record_start_ = true;
     this->pager_ = std::move(reader);
+    if (this->pager_ != nullptr && this->max_rep_level_ == 0) {
+      // Data pages hold whole records, see SkipRecords
+      this->pager_->set_data_page_filter([this](int64_t num_values) {
+        if (num_values > records_to_skip_) {
+          return false;
+        }
+        records_to_skip_ -= num_values;
+        return true;
+      });
+    }
     ResetDecoders();
   }
 
@@ -1247,6 +1316,74 @@ class TypedRecordReader : public ColumnReaderImplBase<DType>,
   T* ValuesHead() {
     return reinterpret_cast<T*>(values_->mutable_data()) + values_written_;
   }
+
+  // Skip the records whose levels were decoded ahead by ReadRecords, but not
+  // their values. Return the number of records skipped.
+  int64_t SkipBufferedLevels(int64_t num_records) {
+    const int64_t levels_skipped =
+        std::min(num_records, levels_written_ - levels_position_);
+    if (levels_skipped == 0) {
+      return 0;
+    }
+    int16_t* def_data = def_levels();
+    SkipValues(std::count(def_data + levels_position_,
+                          def_data + levels_position_ + levels_skipped,
+                          this->max_def_level_));
+    this->ConsumeBufferedValues(levels_skipped);
+    std::copy(def_data + levels_position_ + levels_skipped, def_data + levels_written_,
+              def_data + levels_position_);
+    levels_written_ -= levels_skipped;
+    return levels_skipped;
+  }
+
+  // The number of non-null values of the next num_records records of the
+  // current page, decoding their definition levels
+  int64_t CountValues(int64_t num_records) {
+    if (this->max_def_level_ == 0) {
+      return num_records;
+    }
+    int64_t num_values = 0;
+    int16_t* levels = ScratchSpace<int16_t>(std::min(num_records, kMinLevelBatchSize));
+    while (num_records > 0) {
+      const int64_t levels_read =
+          this->ReadDefinitionLevels(std::min(num_records, kMinLevelBatchSize), levels);
+      if (levels_read == 0) {
+        throw ParquetException("Data page has fewer definition levels than values");
+      }
+      num_values += std::count(levels, levels + levels_read, this->max_def_level_);
+      num_records -= levels_read;
+    }
+    return num_values;
+  }
+
+  // Decode and discard the next num_values values of the current page
+  void SkipValues(int64_t num_values) {
+    T* values = ScratchSpace<T>(std::min(num_values, kMinLevelBatchSize));
+    while (num_values > 0) {
+      const int64_t values_read =
+          this->ReadValues(std::min(num_values, kMinLevelBatchSize), values);
+      if (values_read == 0) {
+        throw ParquetException("Data page has fewer values than expected");
+      }
+      num_values -= values_read;
+    }
+  }
+
+  template <typename U>
+  U* ScratchSpace(int64_t length) {
+    if (skip_scratch_ == nullptr) {
+      skip_scratch_ = AllocateBuffer(this->pool_);
+    }
+    const int64_t size = length * static_cast<int64_t>(sizeof(U));
+    if (skip_scratch_->size() < size) {
+      PARQUET_THROW_NOT_OK(skip_scratch_->Resize(size, false));
+    }
+    return reinterpret_cast<U*>(skip_scratch_->mutable_data());
+  }
+
+  // The records of the data pages the pager may skip, see SkipRecords
+  int64_t records_to_skip_ = 0;
+  std::shared_ptr<ResizableBuffer> skip_scratch_;
 };
 
 class FLBARecordReader : public TypedRecordReader<FLBAType>,
@@ -1346,8 +1483,10 @@ class ByteArrayDictionaryRecordReader : public TypedRecordReader<ByteArrayType>,
                                         virtual public DictionaryRecordReader {
  public:
   ByteArrayDictionaryRecordReader(const ColumnDescriptor* descr,
-                                  ::arrow::MemoryPool* pool)
-      : TypedRecordReader<ByteArrayType>(descr, pool), builder_(pool) {
+                                  ::arrow::MemoryPool* pool, bool unify_dictionaries)
+      : TypedRecordReader<ByteArrayType>(descr, pool),
+        builder_(pool),
+        unify_dictionaries_(unify_dictionaries) {
     this->read_dictionary_ = true;
   }
 
@@ -1364,22 +1503,49 @@ class ByteArrayDictionaryRecordReader : public TypedRecordReader<ByteArrayType>,
       PARQUET_THROW_NOT_OK(builder_.Finish(&chunk));
       result_chunks_.emplace_back(std::move(chunk));
 
-      // Also clears the dictionary memo table
-      builder_.ResetFull();
+      if (!unify_dictionaries_) {
+        // Also clears the dictionary memo table
+        builder_.ResetFull();
+      }
     }
   }
 
   void MaybeWriteNewDictionary() {
     if (this->new_dictionary_) {
-      /// If there is a new dictionary, we may need to flush the builder, then
-      /// insert the new dictionary values
-      FlushBuilder();
       auto decoder = dynamic_cast<BinaryDictDecoder*>(this->current_decoder_);
-      decoder->InsertDictionary(&builder_);
+      if (unify_dictionaries_) {
+        UnifyDictionary(decoder);
+      } else {
+        /// If there is a new dictionary, we may need to flush the builder, then
+        /// insert the new dictionary values
+        FlushBuilder();
+        decoder->InsertDictionary(&builder_);
+      }
       this->new_dictionary_ = false;
     }
   }
 
+  // Insert the values of the decoder's dictionary into the memo of the builder,
+  // which keeps the values of all the previous dictionaries, and have the
+  // decoder remap its indices to the memo's
+  void UnifyDictionary(DictDecoder<ByteArrayType>* decoder) {
+    auto dictionary = decoder->GetDictionary();
+    // Column chunks written from the same data often repeat the dictionary page
+    // of the previous one, whose mapping is then still valid
+    if (previous_dictionary_ == nullptr || !dictionary->Equals(*previous_dictionary_)) {
+      transpose_map_.resize(static_cast<size_t>(dictionary->length()));
+      PARQUET_THROW_NOT_OK(
+          builder_.InsertMemoValues(*dictionary, transpose_map_.data()));
+      identity_transpose_ = true;
+      for (size_t i = 0; i < transpose_map_.size(); ++i) {
+        identity_transpose_ &= transpose_map_[i] == static_cast<int32_t>(i);
+      }
+      previous_dictionary_ = std::move(dictionary);
+    }
+    decoder->SetIndicesTransposeMap(identity_transpose_ ? nullptr
+                                                        : transpose_map_.data());
+  }
+
   void ReadValuesDense(int64_t values_to_read) override {
     int64_t num_decoded = 0;
     if (current_encoding_ == Encoding::RLE_DICTIONARY) {
@@ -1420,6 +1586,14 @@ class ByteArrayDictionaryRecordReader : public TypedRecordReader<ByteArrayType>,
 
   ::arrow::BinaryDictionary32Builder builder_;
   std::vector<std::shared_ptr<::arrow::Array>> result_chunks_;
+
+  // Whether the builder keeps the values of all the dictionaries read, see
+  // ArrowReaderProperties::set_unify_dictionaries
+  const bool unify_dictionaries_;
+  // The last dictionary inserted and the memo index of each of its values
+  std::shared_ptr<::arrow::Array> previous_dictionary_;
+  std::vector<int32_t> transpose_map_;
+  bool identity_transpose_ = true;
 };
 
 // TODO(wesm): Implement these to some satisfaction
@@ -1434,9 +1608,11 @@ void TypedRecordReader<FLBAType>::DebugPrintState() {}
 
 std::shared_ptr<RecordReader> MakeByteArrayRecordReader(const ColumnDescriptor* descr,
                                                         ::arrow::MemoryPool* pool,
-                                                        bool read_dictionary) {
+                                                        bool read_dictionary,
+                                                        bool unify_dictionaries) {
   if (read_dictionary) {
-    return std::make_shared<ByteArrayDictionaryRecordReader>(descr, pool);
+    return std::make_shared<ByteArrayDictionaryRecordReader>(descr, pool,
+                                                             unify_dictionaries);
   } else {
     return std::make_shared<ByteArrayChunkedRecordReader>(descr, pool);
   }
@@ -1444,7 +1620,8 @@ std::shared_ptr<RecordReader> MakeByteArrayRecordReader(const ColumnDescriptor*
 
 std::shared_ptr<RecordReader> RecordReader::Make(const ColumnDescriptor* descr,
                                                  MemoryPool* pool,
-                                                 const bool read_dictionary) {
+                                                 const bool read_dictionary,
+                                                 const bool unify_dictionaries) {
   switch (descr->physical_type()) {
     case Type::BOOLEAN:
       return std::make_shared<TypedRecordReader<BooleanType>>(descr, pool);
@@ -1459,7 +1636,7 @@ std::shared_ptr<RecordReader> RecordReader::Make(const ColumnDescriptor* descr,
     case Type::DOUBLE:
       return std::make_shared<TypedRecordReader<DoubleType>>(descr, pool);
     case Type::BYTE_ARRAY:
-      return MakeByteArrayRecordReader(descr, pool, read_dictionary);
+      return MakeByteArrayRecordReader(descr, pool, read_dictionary, unify_dictionaries);
     case Type::FIXED_LEN_BYTE_ARRAY:
       return std::make_shared<FLBARecordReader>(descr, pool);
     default: {
@@ -18,6 +18,7 @@
 #pragma once
 
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -107,6 +108,12 @@ class PARQUET_EXPORT PageReader {
   virtual std::shared_ptr<Page> NextPage() = 0;
 
   virtual void set_max_page_header_size(uint32_t size) = 0;
+
+  /// \brief Skip the data pages for which filter returns true, given their
+  /// number of values, without reading or decompressing them
+  ///
+  /// Readers not supporting this return every page, without calling filter.
+  virtual void set_data_page_filter(std::function<bool(int64_t num_values)> filter) {}
 };
 
 class PARQUET_EXPORT ColumnReader {
@@ -207,7 +214,7 @@ class RecordReader {
   static std::shared_ptr<RecordReader> Make(
       const ColumnDescriptor* descr,
       ::arrow::MemoryPool* pool = ::arrow::default_memory_pool(),
-      const bool read_dictionary = false);
+      const bool read_dictionary = false, const bool unify_dictionaries = false);
 
   virtual ~RecordReader() = default;
 
@@ -215,6 +222,12 @@ class RecordReader {
   /// \return number of records read
   virtual int64_t ReadRecords(int64_t num_records) = 0;
 
+  /// \brief Skip the indicated number of records, without decoding the data
+  /// pages made only of skipped records. Only supported for non-repeated
+  /// columns.
+  /// \return number of records skipped
+  virtual int64_t SkipRecords(int64_t num_records) = 0;
+
   /// \brief Pre-allocate space for data. Results in better flat read performance
   virtual void Reserve(int64_t num_values) = 0;
 
@@ -36,11 +36,13 @@
 #include "arrow/util/compression.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/rle_encoding.h"
+#include "parquet/bloom_filter.h"
 #include "parquet/column_page.h"
 #include "parquet/encoding.h"
 #include "parquet/encryption_internal.h"
 #include "parquet/internal_file_encryptor.h"
 #include "parquet/metadata.h"
+#include "parquet/page_index.h"
 #include "parquet/platform.h"
 #include "parquet/properties.h"
 #include "parquet/schema.h"
@@ -153,7 +155,8 @@ class SerializedPageWriter : public PageWriter {
                        int16_t row_group_ordinal, int16_t column_chunk_ordinal,
                        MemoryPool* pool = ::arrow::default_memory_pool(),
                        std::shared_ptr<Encryptor> meta_encryptor = nullptr,
-                       std::shared_ptr<Encryptor> data_encryptor = nullptr)
+                       std::shared_ptr<Encryptor> data_encryptor = nullptr,
+                       ColumnPageIndexBuilder* page_index_builder = nullptr)
       : sink_(std::move(sink)),
         metadata_(metadata),
         pool_(pool),
@@ -167,7 +170,8 @@ class SerializedPageWriter : public PageWriter {
         column_ordinal_(column_chunk_ordinal),
         meta_encryptor_(std::move(meta_encryptor)),
         data_encryptor_(std::move(data_encryptor)),
-        encryption_buffer_(AllocateBuffer(pool, 0)) {
+        encryption_buffer_(AllocateBuffer(pool, 0)),
+        page_index_builder_(page_index_builder) {
     if (data_encryptor_ != nullptr || meta_encryptor_ != nullptr) {
       InitEncryption();
     }
@@ -307,6 +311,11 @@ class SerializedPageWriter : public PageWriter {
         thrift_serializer_->Serialize(&page_header, sink_.get(), meta_encryptor_);
     PARQUET_THROW_NOT_OK(sink_->Write(output_data_buffer, output_data_len));
 
+    if (page_index_builder_ != nullptr) {
+      page_index_builder_->AddPage(page.statistics(), page.num_values(), start_pos,
+                                   static_cast<int32_t>(header_size + output_data_len));
+    }
+
     total_uncompressed_size_ += uncompressed_size + header_size;
     total_compressed_size_ += output_data_len + header_size;
     num_values_ += page.num_values();
@@ -405,6 +414,9 @@ class SerializedPageWriter : public PageWriter {
   std::shared_ptr<Encryptor> data_encryptor_;
 
   std::shared_ptr<ResizableBuffer> encryption_buffer_;
+
+  // Records the location and statistics of the data pages, if not null
+  ColumnPageIndexBuilder* page_index_builder_;
 };
 
 // This implementation of the PageWriter writes to the final sink on Close .
@@ -415,13 +427,17 @@ class BufferedPageWriter : public PageWriter {
                      int16_t row_group_ordinal, int16_t current_column_ordinal,
                      MemoryPool* pool = ::arrow::default_memory_pool(),
                      std::shared_ptr<Encryptor> meta_encryptor = nullptr,
-                     std::shared_ptr<Encryptor> data_encryptor = nullptr)
-      : final_sink_(std::move(sink)), metadata_(metadata), has_dictionary_pages_(false) {
+                     std::shared_ptr<Encryptor> data_encryptor = nullptr,
+                     ColumnPageIndexBuilder* page_index_builder = nullptr)
+      : final_sink_(std::move(sink)),
+        metadata_(metadata),
+        has_dictionary_pages_(false),
+        page_index_builder_(page_index_builder) {
     in_memory_sink_ = CreateOutputStream(pool);
-    pager_ = std::unique_ptr<SerializedPageWriter>(
-        new SerializedPageWriter(in_memory_sink_, codec, compression_level, metadata,
-                                 row_group_ordinal, current_column_ordinal, pool,
-                                 std::move(meta_encryptor), std::move(data_encryptor)));
+    pager_ = std::unique_ptr<SerializedPageWriter>(new SerializedPageWriter(
+        in_memory_sink_, codec, compression_level, metadata, row_group_ordinal,
+        current_column_ordinal, pool, std::move(meta_encryptor),
+        std::move(data_encryptor), page_index_builder));
   }
 
   int64_t WriteDictionaryPage(const DictionaryPage& page) override {
@@ -449,6 +465,11 @@ class BufferedPageWriter : public PageWriter {
     // flush everything to the serialized sink
     PARQUET_ASSIGN_OR_THROW(auto buffer, in_memory_sink_->Finish());
     PARQUET_THROW_NOT_OK(final_sink_->Write(buffer));
+
+    // The pages were located relative to the in-memory sink
+    if (page_index_builder_ != nullptr) {
+      page_index_builder_->ShiftOffsets(final_position);
+    }
   }
 
   int64_t WriteDataPage(const CompressedDataPage& page) override {
@@ -467,6 +488,7 @@ class BufferedPageWriter : public PageWriter {
   std::shared_ptr<::arrow::io::BufferOutputStream> in_memory_sink_;
   std::unique_ptr<SerializedPageWriter> pager_;
   bool has_dictionary_pages_;
+  ColumnPageIndexBuilder* page_index_builder_;
 };
 
 std::unique_ptr<PageWriter> PageWriter::Open(
@@ -474,17 +496,18 @@ std::unique_ptr<PageWriter> PageWriter::Open(
     int compression_level, ColumnChunkMetaDataBuilder* metadata,
     int16_t row_group_ordinal, int16_t column_chunk_ordinal, MemoryPool* pool,
     bool buffered_row_group, std::shared_ptr<Encryptor> meta_encryptor,
-    std::shared_ptr<Encryptor> data_encryptor) {
+    std::shared_ptr<Encryptor> data_encryptor,
+    ColumnPageIndexBuilder* page_index_builder) {
   if (buffered_row_group) {
-    return std::unique_ptr<PageWriter>(
-        new BufferedPageWriter(std::move(sink), codec, compression_level, metadata,
-                               row_group_ordinal, column_chunk_ordinal, pool,
-                               std::move(meta_encryptor), std::move(data_encryptor)));
+    return std::unique_ptr<PageWriter>(new BufferedPageWriter(
+        std::move(sink), codec, compression_level, metadata, row_group_ordinal,
+        column_chunk_ordinal, pool, std::move(meta_encryptor), std::move(data_encryptor),
+        page_index_builder));
   } else {
-    return std::unique_ptr<PageWriter>(
-        new SerializedPageWriter(std::move(sink), codec, compression_level, metadata,
-                                 row_group_ordinal, column_chunk_ordinal, pool,
-                                 std::move(meta_encryptor), std::move(data_encryptor)));
+    return std::unique_ptr<PageWriter>(new SerializedPageWriter(
+        std::move(sink), codec, compression_level, metadata, row_group_ordinal,
+        column_chunk_ordinal, pool, std::move(meta_encryptor), std::move(data_encryptor),
+        page_index_builder));
   }
 }
 
@@ -515,6 +538,7 @@ class ColumnWriterImpl {
         total_bytes_written_(0),
         total_compressed_bytes_(0),
         closed_(false),
+        pages_flushed_(false),
         fallback_(false),
         definition_levels_sink_(allocator_),
         repetition_levels_sink_(allocator_) {
@@ -532,6 +556,8 @@ class ColumnWriterImpl {
 
   virtual ~ColumnWriterImpl() = default;
 
+  void FlushPages();
+
   int64_t Close();
 
  protected:
@@ -560,14 +586,14 @@ class ColumnWriterImpl {
 
   // Write multiple definition levels
   void WriteDefinitionLevels(int64_t num_levels, const int16_t* levels) {
-    DCHECK(!closed_);
+    DCHECK(!pages_flushed_);
     PARQUET_THROW_NOT_OK(
         definition_levels_sink_.Append(levels, sizeof(int16_t) * num_levels));
   }
 
   // Write multiple repetition levels
   void WriteRepetitionLevels(int64_t num_levels, const int16_t* levels) {
-    DCHECK(!closed_);
+    DCHECK(!pages_flushed_);
     PARQUET_THROW_NOT_OK(
         repetition_levels_sink_.Append(levels, sizeof(int16_t) * num_levels));
   }
@@ -616,6 +642,9 @@ class ColumnWriterImpl {
   // Flag to check if the Writer has been closed
   bool closed_;
 
+  // Flag to check if the pages have been flushed to the PageWriter
+  bool pages_flushed_;
+
   // Flag to infer if dictionary encoding has fallen back to PLAIN
   bool fallback_;
 
@@ -731,14 +760,21 @@ void ColumnWriterImpl::AddDataPage() {
   num_buffered_encoded_values_ = 0;
 }
 
-int64_t ColumnWriterImpl::Close() {
-  if (!closed_) {
-    closed_ = true;
+void ColumnWriterImpl::FlushPages() {
+  if (!pages_flushed_) {
+    pages_flushed_ = true;
     if (has_dictionary_ && !fallback_) {
       WriteDictionaryPage();
     }
 
     FlushBufferedDataPages();
+  }
+}
+
+int64_t ColumnWriterImpl::Close() {
+  if (!closed_) {
+    closed_ = true;
+    FlushPages();
 
     EncodedStatistics chunk_statistics = GetChunkStatistics();
     chunk_statistics.ApplyStatSizeLimits(
@@ -814,6 +850,24 @@ static inline bool IsDictionaryEncoding(Encoding::type encoding) {
   return encoding == Encoding::PLAIN_DICTIONARY;
 }
 
+// Hash values for a Bloom filter, BOOLEAN columns have none
+template <typename T>
+static void HashValues(const BloomFilter& bloom_filter, const ColumnDescriptor& descr,
+                       const T* values, int num_values, uint64_t* hashes) {
+  bloom_filter.Hashes(values, num_values, hashes);
+}
+
+static void HashValues(const BloomFilter& bloom_filter, const ColumnDescriptor& descr,
+                       const FLBA* values, int num_values, uint64_t* hashes) {
+  bloom_filter.Hashes(values, static_cast<uint32_t>(descr.type_length()), num_values,
+                      hashes);
+}
+
+static void HashValues(const BloomFilter& bloom_filter, const ColumnDescriptor& descr,
+                       const bool* values, int num_values, uint64_t* hashes) {
+  ParquetException::NYI("Bloom filter of a BOOLEAN column");
+}
+
 template <typename DType>
 class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<DType> {
  public:
@@ -821,9 +875,11 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
 
   TypedColumnWriterImpl(ColumnChunkMetaDataBuilder* metadata,
                         std::unique_ptr<PageWriter> pager, const bool use_dictionary,
-                        Encoding::type encoding, const WriterProperties* properties)
+                        Encoding::type encoding, const WriterProperties* properties,
+                        BloomFilter* bloom_filter)
       : ColumnWriterImpl(metadata, std::move(pager), use_dictionary, encoding,
-                         properties) {
+                         properties),
+        bloom_filter_(bloom_filter) {
     current_encoder_ = MakeEncoder(DType::type_num, encoding, use_dictionary, descr_,
                                    properties->memory_pool());
 
@@ -834,6 +890,8 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
     }
   }
 
+  void FlushPages() override { ColumnWriterImpl::FlushPages(); }
+
   int64_t Close() override { return ColumnWriterImpl::Close(); }
 
   void WriteBatch(int64_t num_values, const int16_t* def_levels,
@@ -899,6 +957,14 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
     return current_encoder_->EstimatedDataEncodedSize();
   }
 
+  int64_t EstimatedBufferedDictionaryBytes() const override {
+    if (!has_dictionary_ || fallback_ || pages_flushed_) {
+      return 0;
+    }
+    auto dict_encoder = dynamic_cast<DictEncoder<DType>*>(current_encoder_.get());
+    return dict_encoder->dict_encoded_size();
+  }
+
  protected:
   std::shared_ptr<Buffer> GetValuesBuffer() override {
     return current_encoder_->FlushValues();
@@ -973,6 +1039,11 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
   // which case we call back to the dense write path)
   std::shared_ptr<::arrow::Array> preserved_dictionary_;
 
+  // The Bloom filter of the column chunk, if one is written, and scratch space
+  // for the hashes of the values added to it
+  BloomFilter* bloom_filter_;
+  std::vector<uint64_t> hashes_;
+
   int64_t WriteLevels(int64_t num_values, const int16_t* def_levels,
                       const int16_t* rep_levels) {
     int64_t values_to_write = 0;
@@ -1105,6 +1176,7 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
     if (page_statistics_ != nullptr) {
       page_statistics_->Update(values, num_values, num_nulls);
     }
+    UpdateBloomFilter(values, num_values);
   }
 
   void WriteValuesSpaced(const T* values, int64_t num_values, int64_t num_spaced_values,
@@ -1122,9 +1194,72 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
       page_statistics_->UpdateSpaced(values, valid_bits, valid_bits_offset, num_values,
                                      num_nulls);
     }
+    if (descr_->schema_node()->is_optional()) {
+      UpdateBloomFilterSpaced(values, num_spaced_values, valid_bits, valid_bits_offset);
+    } else {
+      UpdateBloomFilter(values, num_values);
+    }
+  }
+
+  void UpdateBloomFilter(const T* values, int64_t num_values) {
+    if (bloom_filter_ == nullptr || num_values == 0) {
+      return;
+    }
+    hashes_.resize(num_values);
+    HashValues(*bloom_filter_, *descr_, values, static_cast<int>(num_values),
+               hashes_.data());
+    bloom_filter_->InsertHashes(hashes_.data(), static_cast<int>(num_values));
+  }
+
+  // Add the runs of non-null values to the Bloom filter, the values of null
+  // slots are undefined
+  void UpdateBloomFilterSpaced(const T* values, int64_t num_spaced_values,
+                               const uint8_t* valid_bits, int64_t valid_bits_offset) {
+    if (bloom_filter_ == nullptr) {
+      return;
+    }
+    ::arrow::internal::BitmapReader valid_bits_reader(valid_bits, valid_bits_offset,
+                                                      num_spaced_values);
+    int64_t run_start = 0;
+    for (int64_t i = 0; i < num_spaced_values; ++i) {
+      if (!valid_bits_reader.IsSet()) {
+        UpdateBloomFilter(values + run_start, i - run_start);
+        run_start = i + 1;
+      }
+      valid_bits_reader.Next();
+    }
+    UpdateBloomFilter(values + run_start, num_spaced_values - run_start);
   }
+
+  // Add the values of an Arrow array encoded without going through WriteValues,
+  // which only the BYTE_ARRAY writer does, to the Bloom filter
+  void UpdateBloomFilterArray(const ::arrow::Array& values);
 };
 
+template <typename DType>
+void TypedColumnWriterImpl<DType>::UpdateBloomFilterArray(const ::arrow::Array& values) {
+  if (bloom_filter_ != nullptr) {
+    ParquetException::NYI("Adding Arrow arrays to the Bloom filter of this type");
+  }
+}
+
+template <>
+void TypedColumnWriterImpl<ByteArrayType>::UpdateBloomFilterArray(
+    const ::arrow::Array& values) {
+  if (bloom_filter_ == nullptr) {
+    return;
+  }
+  const auto& binary_values = checked_cast<const ::arrow::BinaryArray&>(values);
+  std::vector<ByteArray> non_null_values;
+  non_null_values.reserve(binary_values.length() - binary_values.null_count());
+  for (int64_t i = 0; i < binary_values.length(); ++i) {
+    if (binary_values.IsValid(i)) {
+      non_null_values.emplace_back(binary_values.GetView(i));
+    }
+  }
+  UpdateBloomFilter(non_null_values.data(), non_null_values.size());
+}
+
 template <typename DType>
 Status TypedColumnWriterImpl<DType>::WriteArrowDictionary(const int16_t* def_levels,
                                                           const int16_t* rep_levels,
@@ -1153,8 +1288,12 @@ Status TypedColumnWriterImpl<DType>::WriteArrowDictionary(const int16_t* def_lev
     return WriteArrowDense(def_levels, rep_levels, num_levels, *dense_array, ctx);
   };
 
+  // The Bloom filter is updated with the Arrow arrays themselves only for
+  // BYTE_ARRAY columns, other columns add the dense values
+  const bool bloom_filter_supported =
+      bloom_filter_ == nullptr || DType::type_num == Type::BYTE_ARRAY;
   if (!IsDictionaryEncoding(current_encoder_->encoding()) ||
-      !DictionaryDirectWriteSupported(array)) {
+      !DictionaryDirectWriteSupported(array) || !bloom_filter_supported) {
     // No longer dictionary-encoding for whatever reason, maybe we never were
     // or we decided to stop. Note that WriteArrow can be invoked multiple
     // times with both dense and dictionary-encoded versions of the same data
@@ -1191,6 +1330,8 @@ Status TypedColumnWriterImpl<DType>::WriteArrowDictionary(const int16_t* def_lev
     if (page_statistics_ != nullptr) {
       PARQUET_CATCH_NOT_OK(page_statistics_->Update(*dictionary));
     }
+    // Likewise the Bloom filter may hold values which are not written
+    PARQUET_CATCH_NOT_OK(UpdateBloomFilterArray(*dictionary));
     preserved_dictionary_ = dictionary;
   } else if (!dictionary->Equals(*preserved_dictionary_)) {
     // Dictionary has changed
@@ -1605,6 +1746,7 @@ Status TypedColumnWriterImpl<ByteArrayType>::WriteArrowDense(const int16_t* def_
     if (page_statistics_ != nullptr) {
       page_statistics_->Update(*data_slice);
     }
+    UpdateBloomFilterArray(*data_slice);
     CommitWriteAndCheckPageLimit(batch_size, batch_num_values);
     CheckDictionarySizeLimit();
     value_offset += batch_num_spaced_values;
@@ -1718,7 +1860,8 @@ Status TypedColumnWriterImpl<FLBAType>::WriteArrowDense(const int16_t* def_level
 
 std::shared_ptr<ColumnWriter> ColumnWriter::Make(ColumnChunkMetaDataBuilder* metadata,
                                                  std::unique_ptr<PageWriter> pager,
-                                                 const WriterProperties* properties) {
+                                                 const WriterProperties* properties,
+                                                 BloomFilter* bloom_filter) {
   const ColumnDescriptor* descr = metadata->descr();
   const bool use_dictionary = properties->dictionary_enabled(descr->path()) &&
                               descr->physical_type() != Type::BOOLEAN;
@@ -1729,28 +1872,36 @@ std::shared_ptr<ColumnWriter> ColumnWriter::Make(ColumnChunkMetaDataBuilder* met
   switch (descr->physical_type()) {
     case Type::BOOLEAN:
       return std::make_shared<TypedColumnWriterImpl<BooleanType>>(
-          metadata, std::move(pager), use_dictionary, encoding, properties);
+          metadata, std::move(pager), use_dictionary, encoding, properties,
+          bloom_filter);
     case Type::INT32:
       return std::make_shared<TypedColumnWriterImpl<Int32Type>>(
-          metadata, std::move(pager), use_dictionary, encoding, properties);
+          metadata, std::move(pager), use_dictionary, encoding, properties,
+          bloom_filter);
     case Type::INT64:
       return std::make_shared<TypedColumnWriterImpl<Int64Type>>(
-          metadata, std::move(pager), use_dictionary, encoding, properties);
+          metadata, std::move(pager), use_dictionary, encoding, properties,
+          bloom_filter);
     case Type::INT96:
       return std::make_shared<TypedColumnWriterImpl<Int96Type>>(
-          metadata, std::move(pager), use_dictionary, encoding, properties);
+          metadata, std::move(pager), use_dictionary, encoding, properties,
+          bloom_filter);
     case Type::FLOAT:
       return std::make_shared<TypedColumnWriterImpl<FloatType>>(
-          metadata, std::move(pager), use_dictionary, encoding, properties);
+          metadata, std::move(pager), use_dictionary, encoding, properties,
+          bloom_filter);
     case Type::DOUBLE:
       return std::make_shared<TypedColumnWriterImpl<DoubleType>>(
-          metadata, std::move(pager), use_dictionary, encoding, properties);
+          metadata, std::move(pager), use_dictionary, encoding, properties,
+          bloom_filter);
     case Type::BYTE_ARRAY:
       return std::make_shared<TypedColumnWriterImpl<ByteArrayType>>(
-          metadata, std::move(pager), use_dictionary, encoding, properties);
+          metadata, std::move(pager), use_dictionary, encoding, properties,
+          bloom_filter);
     case Type::FIXED_LEN_BYTE_ARRAY:
       return std::make_shared<TypedColumnWriterImpl<FLBAType>>(
-          metadata, std::move(pager), use_dictionary, encoding, properties);
+          metadata, std::move(pager), use_dictionary, encoding, properties,
+          bloom_filter);
     default:
       ParquetException::NYI("type reader not implemented");
   }
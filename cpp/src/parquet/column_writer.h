@@ -42,7 +42,9 @@ class RleEncoder;
 namespace parquet {
 
 struct ArrowWriteContext;
+class BloomFilter;
 class ColumnDescriptor;
+class ColumnPageIndexBuilder;
 class CompressedDataPage;
 class DictionaryPage;
 class ColumnChunkMetaDataBuilder;
@@ -90,7 +92,8 @@ class PARQUET_EXPORT PageWriter {
       ::arrow::MemoryPool* pool = ::arrow::default_memory_pool(),
       bool buffered_row_group = false,
       std::shared_ptr<Encryptor> header_encryptor = NULLPTR,
-      std::shared_ptr<Encryptor> data_encryptor = NULLPTR);
+      std::shared_ptr<Encryptor> data_encryptor = NULLPTR,
+      ColumnPageIndexBuilder* page_index_builder = NULLPTR);
 
   // The Column Writer decides if dictionary encoding is used if set and
   // if the dictionary encoding has fallen back to default encoding on reaching dictionary
@@ -111,9 +114,22 @@ class PARQUET_EXPORT ColumnWriter {
  public:
   virtual ~ColumnWriter() = default;
 
+  /// \brief Make a ColumnWriter, which adds the values written to bloom_filter
+  /// if not null
   static std::shared_ptr<ColumnWriter> Make(ColumnChunkMetaDataBuilder*,
                                             std::unique_ptr<PageWriter>,
-                                            const WriterProperties* properties);
+                                            const WriterProperties* properties,
+                                            BloomFilter* bloom_filter = NULLPTR);
+
+  /// \brief Commits any buffered values to pages and passes all pages to the
+  /// PageWriter, without closing the ColumnWriter. No values may be written
+  /// afterwards.
+  ///
+  /// The PageWriter of a buffered RowGroup (see
+  /// ParquetFileWriter::AppendBufferedRowGroup) only writes the pages to the
+  /// sink when the ColumnWriter is closed, so the pages of the columns of such
+  /// a RowGroup can be encoded and compressed concurrently.
+  virtual void FlushPages() = 0;
 
   /// \brief Closes the ColumnWriter, commits any buffered values to pages.
   /// \return Total size of the column in bytes
@@ -139,6 +155,13 @@ class PARQUET_EXPORT ColumnWriter {
   /// \brief The file-level writer properties
   virtual const WriterProperties* properties() = 0;
 
+  // Estimated size of the values that are not written to a page yet
+  virtual int64_t EstimatedBufferedValueBytes() const = 0;
+
+  // Size of the dictionary that is not written to a page yet, or 0 if the
+  // column is not dictionary encoded
+  virtual int64_t EstimatedBufferedDictionaryBytes() const = 0;
+
   /// \brief Write Apache Arrow columnar data directly to ColumnWriter. Returns
   /// error status if the array data type is not compatible with the concrete
   /// writer type
@@ -187,9 +210,6 @@ class TypedColumnWriter : public ColumnWriter {
   virtual void WriteBatchSpaced(int64_t num_values, const int16_t* def_levels,
                                 const int16_t* rep_levels, const uint8_t* valid_bits,
                                 int64_t valid_bits_offset, const T* values) = 0;
-
-  // Estimated size of the values that are not written to a page yet
-  virtual int64_t EstimatedBufferedValueBytes() const = 0;
 };
 
 using BoolWriter = TypedColumnWriter<BooleanType>;
@@ -681,6 +681,40 @@ TEST_F(TestByteArrayValuesWriter, CheckDefaultStats) {
   ASSERT_TRUE(this->metadata_is_stats_set());
 }
 
+// The DELTA encodings only support some physical types
+TEST_F(TestNullValuesWriter, RequiredDeltaBinaryPacked) {
+  this->TestRequiredWithEncoding(Encoding::DELTA_BINARY_PACKED);
+}
+
+using TestInt64ValuesWriter = TestPrimitiveWriter<Int64Type>;
+TEST_F(TestInt64ValuesWriter, RequiredDeltaBinaryPacked) {
+  this->TestRequiredWithEncoding(Encoding::DELTA_BINARY_PACKED);
+}
+
+TEST_F(TestInt64ValuesWriter, DeltaBinaryPackedEncodingInMetadata) {
+  this->SetUpSchema(Repetition::REQUIRED);
+  this->GenerateData(SMALL_SIZE);
+  ColumnProperties column_properties(Encoding::DELTA_BINARY_PACKED);
+  auto writer = this->BuildWriter(SMALL_SIZE, column_properties);
+  writer->WriteBatch(SMALL_SIZE, nullptr, nullptr, this->values_ptr_);
+  writer->Close();
+
+  this->ReadColumn();
+  ASSERT_EQ(SMALL_SIZE, this->values_read_);
+  ASSERT_EQ(this->values_, this->values_out_);
+
+  std::vector<Encoding::type> expected({Encoding::DELTA_BINARY_PACKED, Encoding::RLE});
+  ASSERT_EQ(expected, this->metadata_encodings());
+}
+
+TEST_F(TestByteArrayValuesWriter, RequiredDeltaLengthByteArray) {
+  this->TestRequiredWithEncoding(Encoding::DELTA_LENGTH_BYTE_ARRAY);
+}
+
+TEST_F(TestByteArrayValuesWriter, RequiredDeltaByteArray) {
+  this->TestRequiredWithEncoding(Encoding::DELTA_BYTE_ARRAY);
+}
+
 TEST(TestColumnWriter, RepeatedListsUpdateSpacedBug) {
   // In ARROW-3930 we discovered a bug when writing from Arrow when we had data
   // that looks like this:
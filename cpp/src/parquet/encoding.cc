@@ -18,16 +18,21 @@
 #include "parquet/encoding.h"
 
 #include <algorithm>
+#include <array>
 #include <cstdint>
 #include <cstdlib>
+#include <cstring>
+#include <limits>
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
 #include "arrow/array.h"
 #include "arrow/builder.h"
 #include "arrow/stl.h"
+#include "arrow/type_traits.h"
 #include "arrow/util/bit_stream_utils.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/hashing.h"
@@ -914,6 +919,342 @@ void ByteStreamSplitEncoder<DType>::PutSpaced(const T* src, int num_values,
   Put(data, num_valid_values);
 }
 
+// ----------------------------------------------------------------------
+// DeltaBitPackEncoder
+
+// Copy two buffers into a new one
+static std::shared_ptr<Buffer> ConcatenateEncodedBuffers(const Buffer& first,
+                                                         const Buffer& second,
+                                                         MemoryPool* pool) {
+  std::shared_ptr<ResizableBuffer> out =
+      AllocateBuffer(pool, first.size() + second.size());
+  uint8_t* out_data = out->mutable_data();
+  if (first.size() > 0) {
+    std::memcpy(out_data, first.data(), first.size());
+  }
+  if (second.size() > 0) {
+    std::memcpy(out_data + first.size(), second.data(), second.size());
+  }
+  return out;
+}
+
+/// DELTA_BINARY_PACKED, as described in the Parquet format specification. A
+/// page starts with the header
+///
+///   <block size> <number of mini blocks> <total value count> <first value>
+///
+/// followed by blocks of the deltas between consecutive values, each written
+/// as
+///
+///   <min delta> <bit widths of the mini blocks> <mini blocks>
+///
+/// Each mini block holds its deltas less the block's min delta, bit packed at
+/// the mini block's width. The last mini block with values is padded to full
+/// size and the ones after it are omitted.
+template <typename DType>
+class DeltaBitPackEncoder : public EncoderImpl, virtual public TypedEncoder<DType> {
+ public:
+  using T = typename DType::c_type;
+  using UT = typename std::make_unsigned<T>::type;
+  using TypedEncoder<DType>::Put;
+
+  static constexpr int kValuesPerBlock = 128;
+  static constexpr int kMiniBlocksPerBlock = 4;
+  static constexpr int kValuesPerMiniBlock = kValuesPerBlock / kMiniBlocksPerBlock;
+
+  explicit DeltaBitPackEncoder(const ColumnDescriptor* descr, MemoryPool* pool)
+      : EncoderImpl(descr, Encoding::DELTA_BINARY_PACKED, pool), sink_(pool) {}
+
+  int64_t EstimatedDataEncodedSize() override {
+    return kMaxHeaderLength + sink_.length() + kMaxBlockLength;
+  }
+
+  std::shared_ptr<Buffer> FlushValues() override;
+
+  void Put(const T* src, int num_values) override {
+    for (int i = 0; i < num_values; ++i) {
+      PutValue(src[i]);
+    }
+  }
+
+  void Put(const arrow::Array& values) override;
+
+  void PutSpaced(const T* src, int num_values, const uint8_t* valid_bits,
+                 int64_t valid_bits_offset) override {
+    arrow::internal::BitmapReader valid_bits_reader(valid_bits, valid_bits_offset,
+                                                    num_values);
+    for (int i = 0; i < num_values; ++i) {
+      if (valid_bits_reader.IsSet()) {
+        PutValue(src[i]);
+      }
+      valid_bits_reader.Next();
+    }
+  }
+
+  void PutValue(T value) {
+    if (total_value_count_ == 0) {
+      first_value_ = value;
+    } else {
+      // Deltas wrap around, as they do when decoding
+      deltas_[num_block_values_++] =
+          static_cast<T>(static_cast<UT>(value) - static_cast<UT>(current_value_));
+      if (num_block_values_ == kValuesPerBlock) {
+        FlushBlock();
+      }
+    }
+    current_value_ = value;
+    ++total_value_count_;
+  }
+
+ private:
+  // Three int32 and one T as VLQ integers
+  static constexpr int kMaxHeaderLength =
+      3 * arrow::BitUtil::BitReader::MAX_VLQ_BYTE_LEN +
+      arrow::BitUtil::BitReader::MAX_VLQ_BYTE_LEN_64;
+  // The min delta, the bit widths and the mini blocks at full width
+  static constexpr int kMaxBlockLength =
+      arrow::BitUtil::BitReader::MAX_VLQ_BYTE_LEN_64 + kMiniBlocksPerBlock +
+      kValuesPerBlock * static_cast<int>(sizeof(T));
+
+  void FlushBlock();
+
+  int total_value_count_ = 0;
+  T first_value_ = 0;
+  T current_value_ = 0;
+  // The deltas of the block being filled
+  std::array<T, kValuesPerBlock> deltas_;
+  int num_block_values_ = 0;
+  arrow::BufferBuilder sink_;
+};
+
+template <typename DType>
+void DeltaBitPackEncoder<DType>::FlushBlock() {
+  if (num_block_values_ == 0) {
+    return;
+  }
+  const T min_delta =
+      *std::min_element(deltas_.begin(), deltas_.begin() + num_block_values_);
+  // Relative to min_delta, the deltas are non-negative
+  for (int i = 0; i < num_block_values_; ++i) {
+    deltas_[i] = static_cast<T>(static_cast<UT>(deltas_[i]) - static_cast<UT>(min_delta));
+  }
+
+  std::array<uint8_t, kMiniBlocksPerBlock> bit_widths;
+  for (int j = 0; j < kMiniBlocksPerBlock; ++j) {
+    const int start = j * kValuesPerMiniBlock;
+    const int end = std::min(start + kValuesPerMiniBlock, num_block_values_);
+    UT max_value = 0;
+    for (int i = start; i < end; ++i) {
+      max_value = std::max(max_value, static_cast<UT>(deltas_[i]));
+    }
+    bit_widths[j] = static_cast<uint8_t>(arrow::BitUtil::NumRequiredBits(max_value));
+  }
+
+  PARQUET_THROW_NOT_OK(sink_.Reserve(kMaxBlockLength));
+  arrow::BitUtil::BitWriter writer(sink_.mutable_data() + sink_.length(),
+                                   kMaxBlockLength);
+  writer.PutZigZagVlqInt(min_delta);
+  for (uint8_t bit_width : bit_widths) {
+    writer.PutAligned<uint8_t>(bit_width, 1);
+  }
+  for (int j = 0; j * kValuesPerMiniBlock < num_block_values_; ++j) {
+    const int start = j * kValuesPerMiniBlock;
+    for (int i = start; i < start + kValuesPerMiniBlock; ++i) {
+      const UT value = i < num_block_values_ ? static_cast<UT>(deltas_[i]) : 0;
+      writer.PutValue(value, bit_widths[j]);
+    }
+  }
+  writer.Flush();
+  sink_.UnsafeAdvance(writer.bytes_written());
+  num_block_values_ = 0;
+}
+
+template <typename DType>
+std::shared_ptr<Buffer> DeltaBitPackEncoder<DType>::FlushValues() {
+  FlushBlock();
+
+  uint8_t header[kMaxHeaderLength];
+  arrow::BitUtil::BitWriter header_writer(header, kMaxHeaderLength);
+  header_writer.PutVlqInt(static_cast<uint32_t>(kValuesPerBlock));
+  header_writer.PutVlqInt(static_cast<uint32_t>(kMiniBlocksPerBlock));
+  header_writer.PutVlqInt(static_cast<uint32_t>(total_value_count_));
+  header_writer.PutZigZagVlqInt(first_value_);
+  header_writer.Flush();
+
+  std::shared_ptr<Buffer> blocks;
+  PARQUET_THROW_NOT_OK(sink_.Finish(&blocks));
+  total_value_count_ = 0;
+  first_value_ = current_value_ = 0;
+  return ConcatenateEncodedBuffers(Buffer(header, header_writer.bytes_written()),
+                                   *blocks, this->memory_pool());
+}
+
+template <typename DType>
+void DeltaBitPackEncoder<DType>::Put(const arrow::Array& values) {
+  using ArrowType = typename EncodingTraits<DType>::ArrowType;
+  using ArrayType = typename arrow::TypeTraits<ArrowType>::ArrayType;
+  if (values.type_id() != ArrowType::type_id) {
+    throw ParquetException(std::string("direct put to ") + ArrowType::type_name() +
+                           " from " + values.type()->ToString() + " not supported");
+  }
+  const auto& data = checked_cast<const ArrayType&>(values);
+  if (data.null_count() == 0) {
+    Put(data.raw_values(), static_cast<int>(data.length()));
+  } else {
+    PutSpaced(data.raw_values(), static_cast<int>(data.length()),
+              data.null_bitmap_data(), data.offset());
+  }
+}
+
+// ----------------------------------------------------------------------
+// DeltaLengthByteArrayEncoder
+
+/// DELTA_LENGTH_BYTE_ARRAY: the lengths of the values, DELTA_BINARY_PACKED,
+/// followed by the concatenated values
+class DeltaLengthByteArrayEncoder : public EncoderImpl,
+                                    virtual public TypedEncoder<ByteArrayType> {
+ public:
+  using TypedEncoder<ByteArrayType>::Put;
+
+  explicit DeltaLengthByteArrayEncoder(const ColumnDescriptor* descr, MemoryPool* pool)
+      : EncoderImpl(descr, Encoding::DELTA_LENGTH_BYTE_ARRAY, pool),
+        length_encoder_(nullptr, pool),
+        sink_(pool) {}
+
+  int64_t EstimatedDataEncodedSize() override {
+    return length_encoder_.EstimatedDataEncodedSize() + sink_.length();
+  }
+
+  std::shared_ptr<Buffer> FlushValues() override {
+    std::shared_ptr<Buffer> lengths = length_encoder_.FlushValues();
+    std::shared_ptr<Buffer> data;
+    PARQUET_THROW_NOT_OK(sink_.Finish(&data));
+    return ConcatenateEncodedBuffers(*lengths, *data, this->memory_pool());
+  }
+
+  void Put(const ByteArray* src, int num_values) override {
+    for (int i = 0; i < num_values; ++i) {
+      PutValue(src[i].ptr, src[i].len);
+    }
+  }
+
+  void Put(const arrow::Array& values) override {
+    AssertBinary(values);
+    const auto& data = checked_cast<const arrow::BinaryArray&>(values);
+    PARQUET_THROW_NOT_OK(
+        sink_.Reserve(data.value_offset(data.length()) - data.value_offset(0)));
+    for (int64_t i = 0; i < data.length(); i++) {
+      if (data.IsValid(i)) {
+        auto view = data.GetView(i);
+        PutValue(reinterpret_cast<const uint8_t*>(view.data()),
+                 static_cast<uint32_t>(view.size()));
+      }
+    }
+  }
+
+  void PutSpaced(const ByteArray* src, int num_values, const uint8_t* valid_bits,
+                 int64_t valid_bits_offset) override {
+    arrow::internal::BitmapReader valid_bits_reader(valid_bits, valid_bits_offset,
+                                                    num_values);
+    for (int i = 0; i < num_values; ++i) {
+      if (valid_bits_reader.IsSet()) {
+        PutValue(src[i].ptr, src[i].len);
+      }
+      valid_bits_reader.Next();
+    }
+  }
+
+  void PutValue(const uint8_t* data, uint32_t length) {
+    if (ARROW_PREDICT_FALSE(length > static_cast<uint32_t>(
+                                         std::numeric_limits<int32_t>::max()))) {
+      throw ParquetException("BYTE_ARRAY value too large for DELTA_LENGTH_BYTE_ARRAY");
+    }
+    length_encoder_.PutValue(static_cast<int32_t>(length));
+    PARQUET_THROW_NOT_OK(sink_.Append(data, length));
+  }
+
+ private:
+  DeltaBitPackEncoder<Int32Type> length_encoder_;
+  arrow::BufferBuilder sink_;
+};
+
+// ----------------------------------------------------------------------
+// DeltaByteArrayEncoder
+
+/// DELTA_BYTE_ARRAY: the lengths of the prefixes shared with the previous
+/// values, DELTA_BINARY_PACKED, followed by the remaining suffixes,
+/// DELTA_LENGTH_BYTE_ARRAY
+class DeltaByteArrayEncoder : public EncoderImpl,
+                              virtual public TypedEncoder<ByteArrayType> {
+ public:
+  using TypedEncoder<ByteArrayType>::Put;
+
+  explicit DeltaByteArrayEncoder(const ColumnDescriptor* descr, MemoryPool* pool)
+      : EncoderImpl(descr, Encoding::DELTA_BYTE_ARRAY, pool),
+        prefix_length_encoder_(nullptr, pool),
+        suffix_encoder_(nullptr, pool) {}
+
+  int64_t EstimatedDataEncodedSize() override {
+    return prefix_length_encoder_.EstimatedDataEncodedSize() +
+           suffix_encoder_.EstimatedDataEncodedSize();
+  }
+
+  std::shared_ptr<Buffer> FlushValues() override {
+    std::shared_ptr<Buffer> prefix_lengths = prefix_length_encoder_.FlushValues();
+    std::shared_ptr<Buffer> suffixes = suffix_encoder_.FlushValues();
+    last_value_.clear();
+    return ConcatenateEncodedBuffers(*prefix_lengths, *suffixes, this->memory_pool());
+  }
+
+  void Put(const ByteArray* src, int num_values) override {
+    for (int i = 0; i < num_values; ++i) {
+      PutValue(src[i].ptr, src[i].len);
+    }
+  }
+
+  void Put(const arrow::Array& values) override {
+    AssertBinary(values);
+    const auto& data = checked_cast<const arrow::BinaryArray&>(values);
+    for (int64_t i = 0; i < data.length(); i++) {
+      if (data.IsValid(i)) {
+        auto view = data.GetView(i);
+        PutValue(reinterpret_cast<const uint8_t*>(view.data()),
+                 static_cast<uint32_t>(view.size()));
+      }
+    }
+  }
+
+  void PutSpaced(const ByteArray* src, int num_values, const uint8_t* valid_bits,
+                 int64_t valid_bits_offset) override {
+    arrow::internal::BitmapReader valid_bits_reader(valid_bits, valid_bits_offset,
+                                                    num_values);
+    for (int i = 0; i < num_values; ++i) {
+      if (valid_bits_reader.IsSet()) {
+        PutValue(src[i].ptr, src[i].len);
+      }
+      valid_bits_reader.Next();
+    }
+  }
+
+ private:
+  void PutValue(const uint8_t* data, uint32_t length) {
+    const uint32_t max_prefix_length =
+        std::min(length, static_cast<uint32_t>(last_value_.size()));
+    uint32_t prefix_length = 0;
+    while (prefix_length < max_prefix_length &&
+           data[prefix_length] == static_cast<uint8_t>(last_value_[prefix_length])) {
+      ++prefix_length;
+    }
+    prefix_length_encoder_.PutValue(static_cast<int32_t>(prefix_length));
+    suffix_encoder_.PutValue(data + prefix_length, length - prefix_length);
+    last_value_.assign(reinterpret_cast<const char*>(data), length);
+  }
+
+  DeltaBitPackEncoder<Int32Type> prefix_length_encoder_;
+  DeltaLengthByteArrayEncoder suffix_encoder_;
+  std::string last_value_;
+};
+
 // ----------------------------------------------------------------------
 // Encoder and decoder factory functions
 
@@ -974,6 +1315,26 @@ std::unique_ptr<Encoder> MakeEncoder(Type::type type_num, Encoding::type encodin
         throw ParquetException("BYTE_STREAM_SPLIT only supports FLOAT and DOUBLE");
         break;
     }
+  } else if (encoding == Encoding::DELTA_BINARY_PACKED) {
+    switch (type_num) {
+      case Type::INT32:
+        return std::unique_ptr<Encoder>(new DeltaBitPackEncoder<Int32Type>(descr, pool));
+      case Type::INT64:
+        return std::unique_ptr<Encoder>(new DeltaBitPackEncoder<Int64Type>(descr, pool));
+      default:
+        throw ParquetException("DELTA_BINARY_PACKED only supports INT32 and INT64");
+        break;
+    }
+  } else if (encoding == Encoding::DELTA_LENGTH_BYTE_ARRAY) {
+    if (type_num == Type::BYTE_ARRAY) {
+      return std::unique_ptr<Encoder>(new DeltaLengthByteArrayEncoder(descr, pool));
+    }
+    throw ParquetException("DELTA_LENGTH_BYTE_ARRAY only supports BYTE_ARRAY");
+  } else if (encoding == Encoding::DELTA_BYTE_ARRAY) {
+    if (type_num == Type::BYTE_ARRAY) {
+      return std::unique_ptr<Encoder>(new DeltaByteArrayEncoder(descr, pool));
+    }
+    throw ParquetException("DELTA_BYTE_ARRAY only supports BYTE_ARRAY");
   } else {
     ParquetException::NYI("Selected encoding is not supported");
   }
@@ -1600,6 +1961,12 @@ class DictDecoderImpl : public DecoderImpl, virtual public DictDecoder<Type> {
 
   void InsertDictionary(arrow::ArrayBuilder* builder) override;
 
+  std::shared_ptr<arrow::Array> GetDictionary() override;
+
+  void SetIndicesTransposeMap(const int32_t* transpose_map) override {
+    transpose_map_ = transpose_map;
+  }
+
   int DecodeIndicesSpaced(int num_values, int null_count, const uint8_t* valid_bits,
                           int64_t valid_bits_offset,
                           arrow::ArrayBuilder* builder) override {
@@ -1623,6 +1990,10 @@ class DictDecoderImpl : public DecoderImpl, virtual public DictDecoder<Type> {
     arrow::internal::BitmapReader bit_reader(valid_bits, valid_bits_offset, num_values);
     for (int64_t i = 0; i < num_values; ++i) {
       valid_bytes[i] = static_cast<uint8_t>(bit_reader.IsSet());
+      // The indices of null slots are left undefined by GetBatchSpaced
+      if (transpose_map_ != nullptr && valid_bytes[i]) {
+        indices_buffer[i] = TransposeIndex(indices_buffer[i]);
+      }
       bit_reader.Next();
     }
 
@@ -1648,6 +2019,11 @@ class DictDecoderImpl : public DecoderImpl, virtual public DictDecoder<Type> {
     if (num_values != idx_decoder_.GetBatch(indices_buffer, num_values)) {
       ParquetException::EofException();
     }
+    if (transpose_map_ != nullptr) {
+      for (int i = 0; i < num_values; ++i) {
+        indices_buffer[i] = TransposeIndex(indices_buffer[i]);
+      }
+    }
     auto binary_builder = checked_cast<arrow::BinaryDictionary32Builder*>(builder);
     PARQUET_THROW_NOT_OK(binary_builder->AppendIndices(indices_buffer, num_values));
     num_values_ -= num_values;
@@ -1655,6 +2031,13 @@ class DictDecoderImpl : public DecoderImpl, virtual public DictDecoder<Type> {
   }
 
  protected:
+  int32_t TransposeIndex(int32_t index) const {
+    if (ARROW_PREDICT_FALSE(index < 0 || index >= dictionary_length_)) {
+      throw ParquetException("Index not in dictionary bounds");
+    }
+    return transpose_map_[index];
+  }
+
   inline void DecodeDict(TypedDecoder<Type>* dictionary) {
     dictionary_length_ = static_cast<int32_t>(dictionary->values_left());
     PARQUET_THROW_NOT_OK(dictionary_->Resize(dictionary_length_ * sizeof(T),
@@ -1683,6 +2066,10 @@ class DictDecoderImpl : public DecoderImpl, virtual public DictDecoder<Type> {
   // BinaryDictionary32Builder
   std::shared_ptr<ResizableBuffer> indices_scratch_space_;
 
+  // The map of the indices appended by DecodeIndices and DecodeIndicesSpaced,
+  // or null
+  const int32_t* transpose_map_ = nullptr;
+
   arrow::util::RleDecoder idx_decoder_;
 };
 
@@ -1901,6 +2288,18 @@ int DictDecoderImpl<Type>::DecodeArrow(
   return num_values - null_count;
 }
 
+template <typename Type>
+std::shared_ptr<arrow::Array> DictDecoderImpl<Type>::GetDictionary() {
+  ParquetException::NYI("GetDictionary only implemented for BYTE_ARRAY types");
+}
+
+template <>
+std::shared_ptr<arrow::Array> DictDecoderImpl<ByteArrayType>::GetDictionary() {
+  // Make a BinaryArray referencing the internal dictionary data
+  return std::make_shared<arrow::BinaryArray>(dictionary_length_, byte_array_offsets_,
+                                              byte_array_data_);
+}
+
 template <typename Type>
 void DictDecoderImpl<Type>::InsertDictionary(arrow::ArrayBuilder* builder) {
   ParquetException::NYI("InsertDictionary only implemented for BYTE_ARRAY types");
@@ -1909,11 +2308,7 @@ void DictDecoderImpl<Type>::InsertDictionary(arrow::ArrayBuilder* builder) {
 template <>
 void DictDecoderImpl<ByteArrayType>::InsertDictionary(arrow::ArrayBuilder* builder) {
   auto binary_builder = checked_cast<arrow::BinaryDictionary32Builder*>(builder);
-
-  // Make a BinaryArray referencing the internal dictionary data
-  auto arr = std::make_shared<arrow::BinaryArray>(dictionary_length_, byte_array_offsets_,
-                                                  byte_array_data_);
-  PARQUET_THROW_NOT_OK(binary_builder->InsertMemoValues(*arr));
+  PARQUET_THROW_NOT_OK(binary_builder->InsertMemoValues(*GetDictionary()));
 }
 
 class DictByteArrayDecoderImpl : public DictDecoderImpl<ByteArrayType>,
@@ -2124,6 +2519,7 @@ template <typename DType>
 class DeltaBitPackDecoder : public DecoderImpl, virtual public TypedDecoder<DType> {
  public:
   typedef typename DType::c_type T;
+  using UT = typename std::make_unsigned<T>::type;
 
   explicit DeltaBitPackDecoder(const ColumnDescriptor* descr,
                                MemoryPool* pool = arrow::default_memory_pool())
@@ -2135,111 +2531,218 @@ class DeltaBitPackDecoder : public DecoderImpl, virtual public TypedDecoder<DTyp
 
   void SetData(int num_values, const uint8_t* data, int len) override {
     this->num_values_ = num_values;
+    this->len_ = len;
     decoder_ = arrow::BitUtil::BitReader(data, len);
-    values_current_block_ = 0;
-    values_current_mini_block_ = 0;
+    InitHeader();
   }
 
+  /// The number of values in the page, which excludes nulls
+  int ValidValuesCount() const { return total_value_count_; }
+
+  /// The number of bytes of the page read so far. Once all values are
+  /// decoded, this is the size of the encoded values.
+  int BytesConsumed() { return len_ - decoder_.bytes_left(); }
+
   int Decode(T* buffer, int max_values) override {
-    return GetInternal(buffer, max_values);
+    max_values = std::min(max_values, values_remaining_);
+    int i = 0;
+    if (max_values > 0 && first_value_pending_) {
+      buffer[i++] = last_value_;
+      first_value_pending_ = false;
+    }
+    while (i < max_values) {
+      if (mini_block_position_ == mini_block_length_) {
+        LoadMiniBlock();
+      }
+      const int num_copied =
+          std::min(max_values - i, mini_block_length_ - mini_block_position_);
+      std::copy_n(mini_block_values_.data() + mini_block_position_, num_copied,
+                  buffer + i);
+      mini_block_position_ += num_copied;
+      i += num_copied;
+    }
+    values_remaining_ -= max_values;
+    this->num_values_ -= max_values;
+    return max_values;
   }
 
   int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
                   int64_t valid_bits_offset,
                   typename EncodingTraits<DType>::Accumulator* out) override {
-    if (null_count != 0) {
-      ParquetException::NYI("Delta bit pack DecodeArrow with null slots");
+    std::vector<T> values(num_values - null_count);
+    DecodeExactly(values.data(), num_values - null_count);
+    if (null_count == 0) {
+      PARQUET_THROW_NOT_OK(out->AppendValues(values));
+      return num_values;
     }
-    std::vector<T> values(num_values);
-    GetInternal(values.data(), num_values);
-    PARQUET_THROW_NOT_OK(out->AppendValues(values));
-    return num_values;
+    PARQUET_THROW_NOT_OK(out->Reserve(num_values));
+    arrow::internal::BitmapReader bit_reader(valid_bits, valid_bits_offset, num_values);
+    auto value = values.begin();
+    for (int i = 0; i < num_values; ++i) {
+      if (bit_reader.IsSet()) {
+        out->UnsafeAppend(*value++);
+      } else {
+        out->UnsafeAppendNull();
+      }
+      bit_reader.Next();
+    }
+    return num_values - null_count;
   }
 
   int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
                   int64_t valid_bits_offset,
                   typename EncodingTraits<DType>::DictAccumulator* out) override {
-    if (null_count != 0) {
-      ParquetException::NYI("Delta bit pack DecodeArrow with null slots");
-    }
-    std::vector<T> values(num_values);
-    GetInternal(values.data(), num_values);
+    std::vector<T> values(num_values - null_count);
+    DecodeExactly(values.data(), num_values - null_count);
     PARQUET_THROW_NOT_OK(out->Reserve(num_values));
-    for (T value : values) {
-      PARQUET_THROW_NOT_OK(out->Append(value));
+    auto value = values.begin();
+    for (int i = 0; i < num_values; ++i) {
+      if (null_count == 0 || BitUtil::GetBit(valid_bits, valid_bits_offset + i)) {
+        PARQUET_THROW_NOT_OK(out->Append(*value++));
+      } else {
+        PARQUET_THROW_NOT_OK(out->AppendNull());
+      }
     }
-    return num_values;
+    return num_values - null_count;
   }
 
  private:
-  void InitBlock() {
-    int32_t block_size;
-    if (!decoder_.GetVlqInt(&block_size)) ParquetException::EofException();
-    if (!decoder_.GetVlqInt(&num_mini_blocks_)) ParquetException::EofException();
-    if (!decoder_.GetVlqInt(&values_current_block_)) {
+  void DecodeExactly(T* buffer, int num_values) {
+    if (Decode(buffer, num_values) != num_values) {
       ParquetException::EofException();
     }
-    if (!decoder_.GetZigZagVlqInt(&last_value_)) ParquetException::EofException();
+  }
 
-    delta_bit_widths_ = AllocateBuffer(pool_, num_mini_blocks_);
-    uint8_t* bit_width_data = delta_bit_widths_->mutable_data();
+  void InitHeader() {
+    if (!decoder_.GetVlqInt(&values_per_block_) ||
+        !decoder_.GetVlqInt(&mini_blocks_per_block_) ||
+        !decoder_.GetVlqInt(&total_value_count_) ||
+        !decoder_.GetZigZagVlqInt(&last_value_)) {
+      ParquetException::EofException();
+    }
+    if (values_per_block_ <= 0 || mini_blocks_per_block_ <= 0 ||
+        values_per_block_ % mini_blocks_per_block_ != 0 ||
+        values_per_block_ / mini_blocks_per_block_ % 32 != 0 || total_value_count_ < 0) {
+      throw ParquetException("Invalid DELTA_BINARY_PACKED header");
+    }
+    values_per_mini_block_ = values_per_block_ / mini_blocks_per_block_;
+    mini_block_deltas_.resize(values_per_mini_block_);
+    mini_block_values_.resize(values_per_mini_block_);
+    bit_widths_.resize(mini_blocks_per_block_);
 
+    values_remaining_ = total_value_count_;
+    deltas_remaining_ = std::max(total_value_count_ - 1, 0);
+    first_value_pending_ = true;
+    // Start with an exhausted block, so that the first delta loads the next one
+    mini_block_index_ = mini_blocks_per_block_;
+    mini_block_position_ = mini_block_length_ = 0;
+  }
+
+  void InitBlock() {
     if (!decoder_.GetZigZagVlqInt(&min_delta_)) ParquetException::EofException();
-    for (int i = 0; i < num_mini_blocks_; ++i) {
-      if (!decoder_.GetAligned<uint8_t>(1, bit_width_data + i)) {
+    for (int i = 0; i < mini_blocks_per_block_; ++i) {
+      if (!decoder_.GetAligned<uint8_t>(1, &bit_widths_[i])) {
         ParquetException::EofException();
       }
     }
-    values_per_mini_block_ = block_size / num_mini_blocks_;
-    mini_block_idx_ = 0;
-    delta_bit_width_ = bit_width_data[0];
-    values_current_mini_block_ = values_per_mini_block_;
+    mini_block_index_ = 0;
   }
 
-  template <typename T>
-  int GetInternal(T* buffer, int max_values) {
-    max_values = std::min(max_values, this->num_values_);
-    const uint8_t* bit_width_data = delta_bit_widths_->data();
-    for (int i = 0; i < max_values; ++i) {
-      if (ARROW_PREDICT_FALSE(values_current_mini_block_ == 0)) {
-        ++mini_block_idx_;
-        if (mini_block_idx_ < static_cast<size_t>(delta_bit_widths_->size())) {
-          delta_bit_width_ = bit_width_data[mini_block_idx_];
-          values_current_mini_block_ = values_per_mini_block_;
-        } else {
-          InitBlock();
-          buffer[i] = last_value_;
-          continue;
-        }
-      }
+  // Unpack the next mini block, padding included, and compute its values
+  void LoadMiniBlock() {
+    if (mini_block_index_ == mini_blocks_per_block_) {
+      InitBlock();
+    }
+    const int bit_width = bit_widths_[mini_block_index_++];
+    if (bit_width > static_cast<int>(sizeof(T) * 8)) {
+      throw ParquetException("Invalid DELTA_BINARY_PACKED bit width");
+    }
+    const int num_deltas = std::min(values_per_mini_block_, deltas_remaining_);
+    if (bit_width == 0) {
+      std::fill(mini_block_deltas_.begin(), mini_block_deltas_.end(), 0);
+    } else if (decoder_.GetBatch(bit_width, mini_block_deltas_.data(),
+                                 values_per_mini_block_) < num_deltas) {
+      ParquetException::EofException();
+    }
 
-      // TODO: the key to this algorithm is to decode the entire miniblock at once.
-      int64_t delta;
-      if (!decoder_.GetValue(delta_bit_width_, &delta)) ParquetException::EofException();
-      delta += min_delta_;
-      last_value_ += static_cast<int32_t>(delta);
-      buffer[i] = last_value_;
-      --values_current_mini_block_;
+    // Deltas wrap around, as they do when encoding
+    UT value = static_cast<UT>(last_value_);
+    const UT min_delta = static_cast<UT>(min_delta_);
+    for (int i = 0; i < num_deltas; ++i) {
+      value += min_delta + mini_block_deltas_[i];
+      mini_block_values_[i] = static_cast<T>(value);
     }
-    this->num_values_ -= max_values;
-    return max_values;
+    last_value_ = static_cast<T>(value);
+    deltas_remaining_ -= num_deltas;
+    mini_block_length_ = num_deltas;
+    mini_block_position_ = 0;
   }
 
   MemoryPool* pool_;
   arrow::BitUtil::BitReader decoder_;
-  int32_t values_current_block_;
-  int32_t num_mini_blocks_;
-  uint64_t values_per_mini_block_;
-  uint64_t values_current_mini_block_;
 
-  int32_t min_delta_;
-  size_t mini_block_idx_;
-  std::shared_ptr<ResizableBuffer> delta_bit_widths_;
-  int delta_bit_width_;
+  // From the page header
+  int32_t values_per_block_;
+  int32_t mini_blocks_per_block_;
+  int32_t values_per_mini_block_;
+  int32_t total_value_count_ = 0;
 
-  int32_t last_value_;
+  int values_remaining_ = 0;
+  int deltas_remaining_ = 0;
+  bool first_value_pending_ = false;
+
+  T min_delta_;
+  std::vector<uint8_t> bit_widths_;
+  int mini_block_index_;
+
+  // The values of the current mini block not yet returned
+  std::vector<UT> mini_block_deltas_;
+  std::vector<T> mini_block_values_;
+  int mini_block_position_ = 0;
+  int mini_block_length_ = 0;
+
+  T last_value_;
 };
 
+// Append decoded BYTE_ARRAY values to an Arrow accumulator, with nulls where
+// valid_bits is not set
+static int AppendByteArrays(const ByteArray* values, int num_values, int null_count,
+                            const uint8_t* valid_bits, int64_t valid_bits_offset,
+                            EncodingTraits<ByteArrayType>::Accumulator* out) {
+  ArrowBinaryHelper helper(out);
+  PARQUET_THROW_NOT_OK(helper.builder->Reserve(num_values));
+  const ByteArray* value = values;
+  for (int i = 0; i < num_values; ++i) {
+    if (null_count == 0 || BitUtil::GetBit(valid_bits, valid_bits_offset + i)) {
+      if (ARROW_PREDICT_FALSE(!helper.CanFit(value->len))) {
+        PARQUET_THROW_NOT_OK(helper.PushChunk());
+        PARQUET_THROW_NOT_OK(helper.builder->Reserve(num_values - i));
+      }
+      PARQUET_THROW_NOT_OK(helper.Append(value->ptr, static_cast<int32_t>(value->len)));
+      ++value;
+    } else {
+      helper.UnsafeAppendNull();
+    }
+  }
+  return num_values - null_count;
+}
+
+static int AppendByteArrays(const ByteArray* values, int num_values, int null_count,
+                            const uint8_t* valid_bits, int64_t valid_bits_offset,
+                            EncodingTraits<ByteArrayType>::DictAccumulator* out) {
+  PARQUET_THROW_NOT_OK(out->Reserve(num_values));
+  const ByteArray* value = values;
+  for (int i = 0; i < num_values; ++i) {
+    if (null_count == 0 || BitUtil::GetBit(valid_bits, valid_bits_offset + i)) {
+      PARQUET_THROW_NOT_OK(out->Append(value->ptr, static_cast<int32_t>(value->len)));
+      ++value;
+    } else {
+      PARQUET_THROW_NOT_OK(out->AppendNull());
+    }
+  }
+  return num_values - null_count;
+}
+
 // ----------------------------------------------------------------------
 // DELTA_LENGTH_BYTE_ARRAY
 
@@ -2254,24 +2757,33 @@ class DeltaLengthByteArrayDecoder : public DecoderImpl,
 
   void SetData(int num_values, const uint8_t* data, int len) override {
     num_values_ = num_values;
-    if (len == 0) return;
-    int total_lengths_len = arrow::util::SafeLoadAs<int32_t>(data);
-    data += 4;
-    this->len_decoder_.SetData(num_values, data, total_lengths_len);
-    data_ = data + total_lengths_len;
-    this->len_ = len - 4 - total_lengths_len;
+    // The lengths come first, so they are all decoded to find the values
+    len_decoder_.SetData(num_values, data, len);
+    num_valid_values_ = len_decoder_.ValidValuesCount();
+    lengths_.resize(num_valid_values_);
+    if (len_decoder_.Decode(lengths_.data(), num_valid_values_) != num_valid_values_) {
+      ParquetException::EofException();
+    }
+    const int lengths_size = len_decoder_.BytesConsumed();
+    data_ = data + lengths_size;
+    len_ = len - lengths_size;
+    length_index_ = 0;
   }
 
+  /// The number of values in the page, which excludes nulls
+  int ValidValuesCount() const { return num_valid_values_; }
+
   int Decode(ByteArray* buffer, int max_values) override {
-    using VectorT = ArrowPoolVector<int>;
-    max_values = std::min(max_values, num_values_);
-    VectorT lengths(max_values, 0, ::arrow::stl::allocator<int>(pool_));
-    len_decoder_.Decode(lengths.data(), max_values);
+    max_values = std::min(max_values, num_valid_values_ - length_index_);
     for (int i = 0; i < max_values; ++i) {
-      buffer[i].len = lengths[i];
+      const int32_t length = lengths_[length_index_++];
+      if (ARROW_PREDICT_FALSE(length < 0 || length > len_)) {
+        ParquetException::EofException();
+      }
+      buffer[i].len = static_cast<uint32_t>(length);
       buffer[i].ptr = data_;
-      this->data_ += lengths[i];
-      this->len_ -= lengths[i];
+      this->data_ += length;
+      this->len_ -= length;
     }
     this->num_values_ -= max_values;
     return max_values;
@@ -2280,18 +2792,33 @@ class DeltaLengthByteArrayDecoder : public DecoderImpl,
   int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
                   int64_t valid_bits_offset,
                   typename EncodingTraits<ByteArrayType>::Accumulator* out) override {
-    ParquetException::NYI("DecodeArrow for DeltaLengthByteArrayDecoder");
+    return DecodeArrowImpl(num_values, null_count, valid_bits, valid_bits_offset, out);
   }
 
   int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
                   int64_t valid_bits_offset,
                   typename EncodingTraits<ByteArrayType>::DictAccumulator* out) override {
-    ParquetException::NYI("DecodeArrow for DeltaLengthByteArrayDecoder");
+    return DecodeArrowImpl(num_values, null_count, valid_bits, valid_bits_offset, out);
   }
 
  private:
+  template <typename Accumulator>
+  int DecodeArrowImpl(int num_values, int null_count, const uint8_t* valid_bits,
+                      int64_t valid_bits_offset, Accumulator* out) {
+    const int values_to_decode = num_values - null_count;
+    std::vector<ByteArray> values(values_to_decode);
+    if (Decode(values.data(), values_to_decode) != values_to_decode) {
+      ParquetException::EofException();
+    }
+    return AppendByteArrays(values.data(), num_values, null_count, valid_bits,
+                            valid_bits_offset, out);
+  }
+
   DeltaBitPackDecoder<Int32Type> len_decoder_;
   ::arrow::MemoryPool* pool_;
+  ArrowPoolVector<int32_t> lengths_{::arrow::stl::allocator<int32_t>(pool_)};
+  int num_valid_values_ = 0;
+  int length_index_ = 0;
 };
 
 // ----------------------------------------------------------------------
@@ -2305,46 +2832,101 @@ class DeltaByteArrayDecoder : public DecoderImpl,
       : DecoderImpl(descr, Encoding::DELTA_BYTE_ARRAY),
         prefix_len_decoder_(nullptr, pool),
         suffix_decoder_(nullptr, pool),
+        pool_(pool),
         last_value_(0, nullptr) {}
 
-  virtual void SetData(int num_values, const uint8_t* data, int len) {
+  void SetData(int num_values, const uint8_t* data, int len) override {
     num_values_ = num_values;
-    if (len == 0) return;
-    int prefix_len_length = arrow::util::SafeLoadAs<int32_t>(data);
-    data += 4;
-    len -= 4;
-    prefix_len_decoder_.SetData(num_values, data, prefix_len_length);
-    data += prefix_len_length;
-    len -= prefix_len_length;
-    suffix_decoder_.SetData(num_values, data, len);
-  }
-
-  // TODO: this doesn't work and requires memory management. We need to allocate
-  // new strings to store the results.
-  virtual int Decode(ByteArray* buffer, int max_values) {
-    max_values = std::min(max_values, this->num_values_);
-    for (int i = 0; i < max_values; ++i) {
-      int prefix_len = 0;
-      prefix_len_decoder_.Decode(&prefix_len, 1);
-      ByteArray suffix = {0, nullptr};
-      suffix_decoder_.Decode(&suffix, 1);
-      buffer[i].len = prefix_len + suffix.len;
+    // The prefix lengths come first, so they are all decoded to find the suffixes
+    prefix_len_decoder_.SetData(num_values, data, len);
+    num_valid_values_ = prefix_len_decoder_.ValidValuesCount();
+    prefix_lengths_.resize(num_valid_values_);
+    if (prefix_len_decoder_.Decode(prefix_lengths_.data(), num_valid_values_) !=
+        num_valid_values_) {
+      ParquetException::EofException();
+    }
+    const int prefix_lengths_size = prefix_len_decoder_.BytesConsumed();
+    suffix_decoder_.SetData(num_values, data + prefix_lengths_size,
+                            len - prefix_lengths_size);
+    if (suffix_decoder_.ValidValuesCount() != num_valid_values_) {
+      throw ParquetException("Wrong number of suffixes in DELTA_BYTE_ARRAY page");
+    }
+    prefix_length_index_ = 0;
+    last_value_ = ByteArray(0, nullptr);
+    value_buffers_.clear();
+  }
 
-      uint8_t* result = reinterpret_cast<uint8_t*>(malloc(buffer[i].len));
-      memcpy(result, last_value_.ptr, prefix_len);
-      memcpy(result + prefix_len, suffix.ptr, suffix.len);
+  /// The values point into memory owned by the decoder until the next call to
+  /// SetData()
+  int Decode(ByteArray* buffer, int max_values) override {
+    max_values = std::min(max_values, num_valid_values_ - prefix_length_index_);
+    if (suffix_decoder_.Decode(buffer, max_values) != max_values) {
+      ParquetException::EofException();
+    }
 
-      buffer[i].ptr = result;
+    int64_t data_size = 0;
+    for (int i = 0; i < max_values; ++i) {
+      data_size += prefix_lengths_[prefix_length_index_ + i] + buffer[i].len;
+    }
+    value_buffers_.push_back(AllocateBuffer(pool_, data_size));
+    uint8_t* out_data = value_buffers_.back()->mutable_data();
+
+    for (int i = 0; i < max_values; ++i) {
+      const int32_t prefix_length = prefix_lengths_[prefix_length_index_++];
+      if (ARROW_PREDICT_FALSE(prefix_length < 0 ||
+                              static_cast<uint32_t>(prefix_length) > last_value_.len)) {
+        throw ParquetException("Invalid prefix length in DELTA_BYTE_ARRAY page");
+      }
+      const ByteArray suffix = buffer[i];
+      if (prefix_length > 0) {
+        std::memcpy(out_data, last_value_.ptr, prefix_length);
+      }
+      if (suffix.len > 0) {
+        std::memcpy(out_data + prefix_length, suffix.ptr, suffix.len);
+      }
+      buffer[i].ptr = out_data;
+      buffer[i].len = prefix_length + suffix.len;
+      out_data += buffer[i].len;
       last_value_ = buffer[i];
     }
     this->num_values_ -= max_values;
     return max_values;
   }
 
+  int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
+                  int64_t valid_bits_offset,
+                  typename EncodingTraits<ByteArrayType>::Accumulator* out) override {
+    return DecodeArrowImpl(num_values, null_count, valid_bits, valid_bits_offset, out);
+  }
+
+  int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
+                  int64_t valid_bits_offset,
+                  typename EncodingTraits<ByteArrayType>::DictAccumulator* out) override {
+    return DecodeArrowImpl(num_values, null_count, valid_bits, valid_bits_offset, out);
+  }
+
  private:
+  template <typename Accumulator>
+  int DecodeArrowImpl(int num_values, int null_count, const uint8_t* valid_bits,
+                      int64_t valid_bits_offset, Accumulator* out) {
+    const int values_to_decode = num_values - null_count;
+    std::vector<ByteArray> values(values_to_decode);
+    if (Decode(values.data(), values_to_decode) != values_to_decode) {
+      ParquetException::EofException();
+    }
+    return AppendByteArrays(values.data(), num_values, null_count, valid_bits,
+                            valid_bits_offset, out);
+  }
+
   DeltaBitPackDecoder<Int32Type> prefix_len_decoder_;
   DeltaLengthByteArrayDecoder suffix_decoder_;
+  ::arrow::MemoryPool* pool_;
+  ArrowPoolVector<int32_t> prefix_lengths_{::arrow::stl::allocator<int32_t>(pool_)};
+  int num_valid_values_ = 0;
+  int prefix_length_index_ = 0;
   ByteArray last_value_;
+  // The decoded values of the current page
+  std::vector<std::shared_ptr<ResizableBuffer>> value_buffers_;
 };
 
 // ----------------------------------------------------------------------
@@ -2450,6 +3032,26 @@ std::unique_ptr<Decoder> MakeDecoder(Type::type type_num, Encoding::type encodin
         throw ParquetException("BYTE_STREAM_SPLIT only supports FLOAT and DOUBLE");
         break;
     }
+  } else if (encoding == Encoding::DELTA_BINARY_PACKED) {
+    switch (type_num) {
+      case Type::INT32:
+        return std::unique_ptr<Decoder>(new DeltaBitPackDecoder<Int32Type>(descr));
+      case Type::INT64:
+        return std::unique_ptr<Decoder>(new DeltaBitPackDecoder<Int64Type>(descr));
+      default:
+        throw ParquetException("DELTA_BINARY_PACKED only supports INT32 and INT64");
+        break;
+    }
+  } else if (encoding == Encoding::DELTA_LENGTH_BYTE_ARRAY) {
+    if (type_num == Type::BYTE_ARRAY) {
+      return std::unique_ptr<Decoder>(new DeltaLengthByteArrayDecoder(descr));
+    }
+    throw ParquetException("DELTA_LENGTH_BYTE_ARRAY only supports BYTE_ARRAY");
+  } else if (encoding == Encoding::DELTA_BYTE_ARRAY) {
+    if (type_num == Type::BYTE_ARRAY) {
+      return std::unique_ptr<Decoder>(new DeltaByteArrayDecoder(descr));
+    }
+    throw ParquetException("DELTA_BYTE_ARRAY only supports BYTE_ARRAY");
   } else {
     ParquetException::NYI("Selected encoding is not supported");
   }
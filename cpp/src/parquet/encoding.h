@@ -352,6 +352,17 @@ class DictDecoder : virtual public TypedDecoder<DType> {
   /// but do not append any indices
   virtual void InsertDictionary(::arrow::ArrayBuilder* builder) = 0;
 
+  /// \brief The dictionary values, as an Arrow array sharing the decoder's
+  /// memory
+  virtual std::shared_ptr<::arrow::Array> GetDictionary() = 0;
+
+  /// \brief Map the indices appended by DecodeIndices and DecodeIndicesSpaced,
+  /// index i to transpose_map[i], e.g. to the indices of the dictionary values
+  /// in a builder holding the values of several dictionaries. The map has an
+  /// entry per dictionary value and must outlive its use by the decoder. A
+  /// null map appends the indices unchanged.
+  virtual void SetIndicesTransposeMap(const int32_t* transpose_map) = 0;
+
   /// \brief Decode only dictionary indices and append to dictionary
   /// builder. The builder must have had the dictionary from this decoder
   /// inserted already.
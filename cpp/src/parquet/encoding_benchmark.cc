@@ -29,8 +29,11 @@
 #include "parquet/platform.h"
 #include "parquet/schema.h"
 
+#include <algorithm>
 #include <cmath>
 #include <random>
+#include <string>
+#include <vector>
 
 using arrow::default_memory_pool;
 using arrow::MemoryPool;
@@ -263,6 +266,93 @@ static void BM_DictDecodingInt64_literals(benchmark::State& state) {
 
 BENCHMARK(BM_DictDecodingInt64_literals)->Range(MIN_RANGE, MAX_RANGE);
 
+// ----------------------------------------------------------------------
+// Sorted integers, like timestamps or ids, with PLAIN, dictionary and
+// DELTA_BINARY_PACKED encoding
+
+static std::vector<int64_t> SortedInt64Values(int64_t num_values) {
+  std::default_random_engine gen(42);
+  std::uniform_int_distribution<int64_t> gap(0, 1000);
+  std::vector<int64_t> values(num_values);
+  // Microseconds since the epoch, from 2020-01-01
+  int64_t value = 1577836800000000LL;
+  for (auto& v : values) {
+    value += gap(gen);
+    v = value;
+  }
+  return values;
+}
+
+static void EncodeSortedInt64(benchmark::State& state, Encoding::type encoding,
+                              bool use_dictionary) {
+  std::vector<int64_t> values = SortedInt64Values(state.range(0));
+  auto encoder = MakeTypedEncoder<Int64Type>(encoding, use_dictionary);
+  int64_t encoded_size = 0;
+  for (auto _ : state) {
+    encoder->Put(values.data(), static_cast<int>(values.size()));
+    encoded_size = encoder->FlushValues()->size();
+  }
+  if (use_dictionary) {
+    encoded_size +=
+        dynamic_cast<DictEncoder<Int64Type>*>(encoder.get())->dict_encoded_size();
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(int64_t));
+  state.counters["encoded_bytes_per_value"] =
+      static_cast<double>(encoded_size) / static_cast<double>(state.range(0));
+}
+
+static void DecodeSortedInt64(benchmark::State& state, Encoding::type encoding) {
+  std::vector<int64_t> values = SortedInt64Values(state.range(0));
+  auto encoder = MakeTypedEncoder<Int64Type>(encoding);
+  encoder->Put(values.data(), static_cast<int>(values.size()));
+  std::shared_ptr<Buffer> buf = encoder->FlushValues();
+
+  for (auto _ : state) {
+    auto decoder = MakeTypedDecoder<Int64Type>(encoding);
+    decoder->SetData(static_cast<int>(values.size()), buf->data(),
+                     static_cast<int>(buf->size()));
+    decoder->Decode(values.data(), static_cast<int>(values.size()));
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(int64_t));
+}
+
+static void BM_PlainEncodingInt64_sorted(benchmark::State& state) {
+  EncodeSortedInt64(state, Encoding::PLAIN, /*use_dictionary=*/false);
+}
+
+BENCHMARK(BM_PlainEncodingInt64_sorted)->Range(MIN_RANGE, MAX_RANGE);
+
+static void BM_DictEncodingInt64_sorted(benchmark::State& state) {
+  EncodeSortedInt64(state, Encoding::PLAIN, /*use_dictionary=*/true);
+}
+
+BENCHMARK(BM_DictEncodingInt64_sorted)->Range(MIN_RANGE, MAX_RANGE);
+
+static void BM_DeltaBitPackingEncodingInt64_sorted(benchmark::State& state) {
+  EncodeSortedInt64(state, Encoding::DELTA_BINARY_PACKED, /*use_dictionary=*/false);
+}
+
+BENCHMARK(BM_DeltaBitPackingEncodingInt64_sorted)->Range(MIN_RANGE, MAX_RANGE);
+
+static void BM_PlainDecodingInt64_sorted(benchmark::State& state) {
+  DecodeSortedInt64(state, Encoding::PLAIN);
+}
+
+BENCHMARK(BM_PlainDecodingInt64_sorted)->Range(MIN_RANGE, MAX_RANGE);
+
+static void BM_DictDecodingInt64_sorted(benchmark::State& state) {
+  std::vector<int64_t> values = SortedInt64Values(state.range(0));
+  DecodeDict<Int64Type>(values, state);
+}
+
+BENCHMARK(BM_DictDecodingInt64_sorted)->Range(MIN_RANGE, MAX_RANGE);
+
+static void BM_DeltaBitPackingDecodingInt64_sorted(benchmark::State& state) {
+  DecodeSortedInt64(state, Encoding::DELTA_BINARY_PACKED);
+}
+
+BENCHMARK(BM_DeltaBitPackingDecodingInt64_sorted)->Range(MIN_RANGE, MAX_RANGE);
+
 // ----------------------------------------------------------------------
 // Shared benchmarks for decoding using arrow builders
 
@@ -420,6 +510,131 @@ BENCHMARK_DEFINE_F(BM_ArrowBinaryPlain, DecodeArrowNonNull_Dict)
 BENCHMARK_REGISTER_F(BM_ArrowBinaryPlain, DecodeArrowNonNull_Dict)
     ->Range(MIN_RANGE, MAX_RANGE);
 
+// ----------------------------------------------------------------------
+// Benchmark Decoding from DELTA_LENGTH_BYTE_ARRAY and DELTA_BYTE_ARRAY Encoding
+template <Encoding::type kEncoding>
+class BenchmarkDecodeArrowDelta : public BenchmarkDecodeArrow {
+ public:
+  void DoEncodeArrow() override {
+    auto encoder = MakeTypedEncoder<ByteArrayType>(kEncoding);
+    encoder->Put(*input_array_);
+    buffer_ = encoder->FlushValues();
+  }
+
+  void DoEncodeLowLevel() override {
+    auto encoder = MakeTypedEncoder<ByteArrayType>(kEncoding);
+    encoder->Put(values_.data(), num_values_);
+    buffer_ = encoder->FlushValues();
+  }
+
+  std::unique_ptr<ByteArrayDecoder> InitializeDecoder() override {
+    auto decoder = MakeTypedDecoder<ByteArrayType>(kEncoding);
+    decoder->SetData(num_values_, buffer_->data(), static_cast<int>(buffer_->size()));
+    return decoder;
+  }
+};
+
+using BM_ArrowBinaryDeltaLength =
+    BenchmarkDecodeArrowDelta<Encoding::DELTA_LENGTH_BYTE_ARRAY>;
+
+BENCHMARK_DEFINE_F(BM_ArrowBinaryDeltaLength, EncodeArrow)
+(benchmark::State& state) { EncodeArrowBenchmark(state); }
+BENCHMARK_REGISTER_F(BM_ArrowBinaryDeltaLength, EncodeArrow)->Range(1 << 18, 1 << 20);
+
+BENCHMARK_DEFINE_F(BM_ArrowBinaryDeltaLength, EncodeLowLevel)
+(benchmark::State& state) { EncodeLowLevelBenchmark(state); }
+BENCHMARK_REGISTER_F(BM_ArrowBinaryDeltaLength, EncodeLowLevel)->Range(1 << 18, 1 << 20);
+
+BENCHMARK_DEFINE_F(BM_ArrowBinaryDeltaLength, DecodeArrow_Dense)
+(benchmark::State& state) { DecodeArrowDenseBenchmark(state); }
+BENCHMARK_REGISTER_F(BM_ArrowBinaryDeltaLength, DecodeArrow_Dense)
+    ->Range(MIN_RANGE, MAX_RANGE);
+
+BENCHMARK_DEFINE_F(BM_ArrowBinaryDeltaLength, DecodeArrow_Dict)
+(benchmark::State& state) { DecodeArrowDictBenchmark(state); }
+BENCHMARK_REGISTER_F(BM_ArrowBinaryDeltaLength, DecodeArrow_Dict)
+    ->Range(MIN_RANGE, MAX_RANGE);
+
+using BM_ArrowBinaryDelta = BenchmarkDecodeArrowDelta<Encoding::DELTA_BYTE_ARRAY>;
+
+BENCHMARK_DEFINE_F(BM_ArrowBinaryDelta, EncodeArrow)
+(benchmark::State& state) { EncodeArrowBenchmark(state); }
+BENCHMARK_REGISTER_F(BM_ArrowBinaryDelta, EncodeArrow)->Range(1 << 18, 1 << 20);
+
+BENCHMARK_DEFINE_F(BM_ArrowBinaryDelta, EncodeLowLevel)
+(benchmark::State& state) { EncodeLowLevelBenchmark(state); }
+BENCHMARK_REGISTER_F(BM_ArrowBinaryDelta, EncodeLowLevel)->Range(1 << 18, 1 << 20);
+
+BENCHMARK_DEFINE_F(BM_ArrowBinaryDelta, DecodeArrow_Dense)
+(benchmark::State& state) { DecodeArrowDenseBenchmark(state); }
+BENCHMARK_REGISTER_F(BM_ArrowBinaryDelta, DecodeArrow_Dense)->Range(MIN_RANGE, MAX_RANGE);
+
+BENCHMARK_DEFINE_F(BM_ArrowBinaryDelta, DecodeArrow_Dict)
+(benchmark::State& state) { DecodeArrowDictBenchmark(state); }
+BENCHMARK_REGISTER_F(BM_ArrowBinaryDelta, DecodeArrow_Dict)->Range(MIN_RANGE, MAX_RANGE);
+
+// ----------------------------------------------------------------------
+// Strings sharing long prefixes, like URLs, with PLAIN and DELTA encodings
+
+static std::vector<std::string> UrlStrings(int64_t num_values) {
+  std::default_random_engine gen(42);
+  std::uniform_int_distribution<int> category(0, 15);
+  std::uniform_int_distribution<int> gap(1, 100);
+  std::vector<std::string> strings(num_values);
+  int item = 0;
+  for (auto& str : strings) {
+    item += gap(gen);
+    str = "https://www.example.com/catalog/category-" + std::to_string(category(gen)) +
+          "/item/" + std::to_string(item);
+  }
+  std::sort(strings.begin(), strings.end());
+  return strings;
+}
+
+static void DecodeUrls(benchmark::State& state, Encoding::type encoding) {
+  std::vector<std::string> strings = UrlStrings(state.range(0));
+  std::vector<ByteArray> values;
+  int64_t total_size = 0;
+  for (const auto& str : strings) {
+    values.emplace_back(static_cast<uint32_t>(str.size()),
+                        reinterpret_cast<const uint8_t*>(str.data()));
+    total_size += static_cast<int64_t>(str.size());
+  }
+  const int num_values = static_cast<int>(values.size());
+  auto encoder = MakeTypedEncoder<ByteArrayType>(encoding);
+  encoder->Put(values.data(), num_values);
+  std::shared_ptr<Buffer> buf = encoder->FlushValues();
+
+  for (auto _ : state) {
+    auto decoder = MakeTypedDecoder<ByteArrayType>(encoding);
+    decoder->SetData(num_values, buf->data(), static_cast<int>(buf->size()));
+    typename EncodingTraits<ByteArrayType>::Accumulator acc;
+    acc.builder.reset(new BinaryBuilder);
+    decoder->DecodeArrowNonNull(num_values, &acc);
+  }
+  state.SetBytesProcessed(state.iterations() * total_size);
+  state.counters["encoded_bytes_per_value"] =
+      static_cast<double>(buf->size()) / static_cast<double>(num_values);
+}
+
+static void BM_PlainDecodingUrls(benchmark::State& state) {
+  DecodeUrls(state, Encoding::PLAIN);
+}
+
+BENCHMARK(BM_PlainDecodingUrls)->Range(MIN_RANGE, MAX_RANGE);
+
+static void BM_DeltaLengthDecodingUrls(benchmark::State& state) {
+  DecodeUrls(state, Encoding::DELTA_LENGTH_BYTE_ARRAY);
+}
+
+BENCHMARK(BM_DeltaLengthDecodingUrls)->Range(MIN_RANGE, MAX_RANGE);
+
+static void BM_DeltaDecodingUrls(benchmark::State& state) {
+  DecodeUrls(state, Encoding::DELTA_BYTE_ARRAY);
+}
+
+BENCHMARK(BM_DeltaDecodingUrls)->Range(MIN_RANGE, MAX_RANGE);
+
 // ----------------------------------------------------------------------
 // Benchmark Decoding from Dictionary Encoding
 class BM_ArrowBinaryDict : public BenchmarkDecodeArrow {
@@ -20,6 +20,7 @@
 #include <cstdlib>
 #include <cstring>
 #include <limits>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -1049,5 +1050,276 @@ TEST(ByteStreamSplitEncodeDecode, InvalidDataTypes) {
   ASSERT_THROW(MakeTypedDecoder<FLBAType>(Encoding::BYTE_STREAM_SPLIT), ParquetException);
 }
 
+// ----------------------------------------------------------------------
+// DELTA_BINARY_PACKED encode/decode tests
+
+template <typename Type>
+class TestDeltaBitPackEncoding : public TestEncodingBase<Type> {
+ public:
+  typedef typename Type::c_type T;
+  static constexpr int TYPE = Type::type_num;
+
+  void CheckRoundtrip() override {
+    auto encoder =
+        MakeTypedEncoder<Type>(Encoding::DELTA_BINARY_PACKED, false, descr_.get());
+    auto decoder = MakeTypedDecoder<Type>(Encoding::DELTA_BINARY_PACKED, descr_.get());
+    encoder->Put(draws_, num_values_);
+    encode_buffer_ = encoder->FlushValues();
+
+    decoder->SetData(num_values_, encode_buffer_->data(),
+                     static_cast<int>(encode_buffer_->size()));
+    // Decode in steps that do not line up with the mini blocks
+    int values_decoded = 0;
+    while (values_decoded < num_values_) {
+      const int num_decoded = decoder->Decode(decode_buf_ + values_decoded, 77);
+      ASSERT_GT(num_decoded, 0);
+      values_decoded += num_decoded;
+    }
+    ASSERT_EQ(num_values_, values_decoded);
+    ASSERT_EQ(0, decoder->values_left());
+    ASSERT_NO_FATAL_FAILURE(VerifyResults<T>(decode_buf_, draws_, num_values_));
+  }
+
+  // Values with a constant difference, like sorted ids or timestamps
+  void ExecuteSequence(int nvalues, T start, T stride) {
+    num_values_ = nvalues;
+    this->input_bytes_.resize(num_values_ * sizeof(T));
+    this->output_bytes_.resize(num_values_ * sizeof(T));
+    draws_ = reinterpret_cast<T*>(this->input_bytes_.data());
+    decode_buf_ = reinterpret_cast<T*>(this->output_bytes_.data());
+    for (int i = 0; i < num_values_; ++i) {
+      draws_[i] = static_cast<T>(start + stride * i);
+    }
+    CheckRoundtrip();
+  }
+
+ protected:
+  USING_BASE_MEMBERS();
+};
+
+typedef ::testing::Types<Int32Type, Int64Type> DeltaBitPackTypes;
+
+TYPED_TEST_CASE(TestDeltaBitPackEncoding, DeltaBitPackTypes);
+
+TYPED_TEST(TestDeltaBitPackEncoding, BasicRoundTrip) {
+  // Random values over the whole range, so that deltas overflow
+  ASSERT_NO_FATAL_FAILURE(this->Execute(10000, 1));
+  ASSERT_NO_FATAL_FAILURE(this->Execute(1000, 10));
+}
+
+TYPED_TEST(TestDeltaBitPackEncoding, BlockBoundaries) {
+  for (int nvalues : {0, 1, 2, 31, 32, 33, 127, 128, 129, 130, 1000}) {
+    ASSERT_NO_FATAL_FAILURE(this->Execute(nvalues, 1));
+  }
+}
+
+TYPED_TEST(TestDeltaBitPackEncoding, Sequences) {
+  using T = typename TypeParam::c_type;
+  ASSERT_NO_FATAL_FAILURE(this->ExecuteSequence(10000, 1000, 3));
+  ASSERT_NO_FATAL_FAILURE(this->ExecuteSequence(10000, 1000, -17));
+  ASSERT_NO_FATAL_FAILURE(this->ExecuteSequence(10000, 42, 0));
+  ASSERT_NO_FATAL_FAILURE(
+      this->ExecuteSequence(1000, std::numeric_limits<T>::min(), 1 << 20));
+}
+
+TYPED_TEST(TestDeltaBitPackEncoding, Extremes) {
+  using T = typename TypeParam::c_type;
+  std::vector<T> values;
+  for (int i = 0; i < 1000; ++i) {
+    values.push_back(i % 2 ? std::numeric_limits<T>::max()
+                           : std::numeric_limits<T>::min());
+  }
+  auto encoder = MakeTypedEncoder<TypeParam>(Encoding::DELTA_BINARY_PACKED);
+  encoder->Put(values.data(), static_cast<int>(values.size()));
+  auto buffer = encoder->FlushValues();
+
+  auto decoder = MakeTypedDecoder<TypeParam>(Encoding::DELTA_BINARY_PACKED);
+  decoder->SetData(static_cast<int>(values.size()), buffer->data(),
+                   static_cast<int>(buffer->size()));
+  std::vector<T> decoded(values.size());
+  ASSERT_EQ(static_cast<int>(values.size()),
+            decoder->Decode(decoded.data(), static_cast<int>(values.size())));
+  ASSERT_EQ(values, decoded);
+}
+
+TEST(DeltaBitPackEncodeDecode, SpecificationExample) {
+  // Example 1 of the Parquet specification: the deltas of 1, 2, 3, 4, 5 are
+  // all 1, so the mini blocks have a bit width of 0 and take no space
+  const std::vector<int32_t> values = {1, 2, 3, 4, 5};
+  const std::vector<uint8_t> expected = {
+      0x80, 0x01,  // block size: 128
+      0x04,        // mini blocks per block: 4
+      0x05,        // total value count: 5
+      0x02,        // first value: 1, zigzag encoded
+      0x02,        // min delta: 1, zigzag encoded
+      0x00, 0x00, 0x00, 0x00};  // bit widths of the mini blocks
+
+  auto encoder = MakeTypedEncoder<Int32Type>(Encoding::DELTA_BINARY_PACKED);
+  encoder->Put(values);
+  auto buffer = encoder->FlushValues();
+  ASSERT_EQ(expected,
+            std::vector<uint8_t>(buffer->data(), buffer->data() + buffer->size()));
+
+  auto decoder = MakeTypedDecoder<Int32Type>(Encoding::DELTA_BINARY_PACKED);
+  decoder->SetData(5, expected.data(), static_cast<int>(expected.size()));
+  std::vector<int32_t> decoded(5);
+  ASSERT_EQ(5, decoder->Decode(decoded.data(), 10));
+  ASSERT_EQ(values, decoded);
+}
+
+TEST(DeltaBitPackEncodeDecode, PutArrowWithNulls) {
+  arrow::random::RandomArrayGenerator rag{42};
+  auto values = rag.Int64(1000, -1000, 1000, /*null_probability=*/0.2);
+  auto encoder = MakeTypedEncoder<Int64Type>(Encoding::DELTA_BINARY_PACKED);
+  encoder->Put(*values);
+  auto buffer = encoder->FlushValues();
+
+  auto decoder = MakeTypedDecoder<Int64Type>(Encoding::DELTA_BINARY_PACKED);
+  const int num_values = static_cast<int>(values->length());
+  const int null_count = static_cast<int>(values->null_count());
+  decoder->SetData(num_values, buffer->data(), static_cast<int>(buffer->size()));
+  typename EncodingTraits<Int64Type>::Accumulator builder;
+  ASSERT_EQ(num_values - null_count,
+            decoder->DecodeArrow(num_values, null_count, values->null_bitmap_data(),
+                                 values->offset(), &builder));
+  std::shared_ptr<arrow::Array> decoded;
+  ASSERT_OK(builder.Finish(&decoded));
+  ASSERT_ARRAYS_EQUAL(*values, *decoded);
+}
+
+TEST(DeltaBitPackEncodeDecode, TruncatedInput) {
+  std::vector<int64_t> values(1000);
+  random_numbers(1000, 0, std::numeric_limits<int64_t>::min(),
+                 std::numeric_limits<int64_t>::max(), values.data());
+  auto encoder = MakeTypedEncoder<Int64Type>(Encoding::DELTA_BINARY_PACKED);
+  encoder->Put(values);
+  auto buffer = encoder->FlushValues();
+
+  auto decoder = MakeTypedDecoder<Int64Type>(Encoding::DELTA_BINARY_PACKED);
+  decoder->SetData(1000, buffer->data(), static_cast<int>(buffer->size() / 2));
+  ASSERT_THROW(decoder->Decode(values.data(), 1000), ParquetException);
+}
+
+TEST(DeltaEncodeDecode, InvalidDataTypes) {
+  ASSERT_THROW(MakeTypedEncoder<FloatType>(Encoding::DELTA_BINARY_PACKED),
+               ParquetException);
+  ASSERT_THROW(MakeTypedEncoder<ByteArrayType>(Encoding::DELTA_BINARY_PACKED),
+               ParquetException);
+  ASSERT_THROW(MakeTypedEncoder<Int32Type>(Encoding::DELTA_LENGTH_BYTE_ARRAY),
+               ParquetException);
+  ASSERT_THROW(MakeTypedEncoder<FLBAType>(Encoding::DELTA_BYTE_ARRAY), ParquetException);
+
+  ASSERT_THROW(MakeTypedDecoder<DoubleType>(Encoding::DELTA_BINARY_PACKED),
+               ParquetException);
+  ASSERT_THROW(MakeTypedDecoder<ByteArrayType>(Encoding::DELTA_BINARY_PACKED),
+               ParquetException);
+  ASSERT_THROW(MakeTypedDecoder<Int64Type>(Encoding::DELTA_LENGTH_BYTE_ARRAY),
+               ParquetException);
+  ASSERT_THROW(MakeTypedDecoder<FLBAType>(Encoding::DELTA_BYTE_ARRAY), ParquetException);
+}
+
+// ----------------------------------------------------------------------
+// DELTA_LENGTH_BYTE_ARRAY and DELTA_BYTE_ARRAY encode/decode tests
+
+class DeltaLengthByteArrayEncoding : public TestArrowBuilderDecoding {
+ public:
+  void SetupEncoderDecoder() override {
+    encoder_ = MakeTypedEncoder<ByteArrayType>(Encoding::DELTA_LENGTH_BYTE_ARRAY);
+    plain_decoder_ = MakeTypedDecoder<ByteArrayType>(Encoding::DELTA_LENGTH_BYTE_ARRAY);
+    decoder_ = plain_decoder_.get();
+    ASSERT_NO_THROW(encoder_->PutSpaced(input_data_.data(), num_values_, valid_bits_, 0));
+    buffer_ = encoder_->FlushValues();
+    decoder_->SetData(num_values_, buffer_->data(), static_cast<int>(buffer_->size()));
+  }
+};
+
+TEST_F(DeltaLengthByteArrayEncoding, CheckDecodeArrowUsingDenseBuilder) {
+  this->CheckDecodeArrowUsingDenseBuilder();
+}
+
+TEST_F(DeltaLengthByteArrayEncoding, CheckDecodeArrowUsingDictBuilder) {
+  this->CheckDecodeArrowUsingDictBuilder();
+}
+
+TEST_F(DeltaLengthByteArrayEncoding, CheckDecodeArrowNonNullDenseBuilder) {
+  this->CheckDecodeArrowNonNullUsingDenseBuilder();
+}
+
+TEST_F(DeltaLengthByteArrayEncoding, CheckDecodeArrowNonNullDictBuilder) {
+  this->CheckDecodeArrowNonNullUsingDictBuilder();
+}
+
+class DeltaByteArrayEncoding : public TestArrowBuilderDecoding {
+ public:
+  void SetupEncoderDecoder() override {
+    encoder_ = MakeTypedEncoder<ByteArrayType>(Encoding::DELTA_BYTE_ARRAY);
+    plain_decoder_ = MakeTypedDecoder<ByteArrayType>(Encoding::DELTA_BYTE_ARRAY);
+    decoder_ = plain_decoder_.get();
+    ASSERT_NO_THROW(encoder_->PutSpaced(input_data_.data(), num_values_, valid_bits_, 0));
+    buffer_ = encoder_->FlushValues();
+    decoder_->SetData(num_values_, buffer_->data(), static_cast<int>(buffer_->size()));
+  }
+};
+
+TEST_F(DeltaByteArrayEncoding, CheckDecodeArrowUsingDenseBuilder) {
+  this->CheckDecodeArrowUsingDenseBuilder();
+}
+
+TEST_F(DeltaByteArrayEncoding, CheckDecodeArrowUsingDictBuilder) {
+  this->CheckDecodeArrowUsingDictBuilder();
+}
+
+TEST_F(DeltaByteArrayEncoding, CheckDecodeArrowNonNullDenseBuilder) {
+  this->CheckDecodeArrowNonNullUsingDenseBuilder();
+}
+
+TEST_F(DeltaByteArrayEncoding, CheckDecodeArrowNonNullDictBuilder) {
+  this->CheckDecodeArrowNonNullUsingDictBuilder();
+}
+
+TEST(DeltaByteArrayEncodeDecode, SharedPrefixes) {
+  std::vector<std::string> strings = {"", "a", "", "abc", "ab"};
+  for (int i = 0; i < 1000; ++i) {
+    strings.push_back("https://example.com/items/" + std::to_string(i * 7));
+  }
+  arrow::BinaryBuilder builder;
+  std::vector<ByteArray> values;
+  for (const auto& str : strings) {
+    ASSERT_OK(builder.Append(str));
+    values.emplace_back(static_cast<uint32_t>(str.size()),
+                        reinterpret_cast<const uint8_t*>(str.data()));
+  }
+  std::shared_ptr<arrow::Array> array;
+  ASSERT_OK(builder.Finish(&array));
+  const int num_values = static_cast<int>(values.size());
+
+  for (auto encoding : {Encoding::DELTA_LENGTH_BYTE_ARRAY, Encoding::DELTA_BYTE_ARRAY}) {
+    auto encoder = MakeTypedEncoder<ByteArrayType>(encoding);
+    encoder->Put(values.data(), num_values);
+    auto buffer = encoder->FlushValues();
+
+    // Putting an Arrow array gives the same result
+    encoder->Put(*array);
+    AssertBufferEqual(*buffer, *encoder->FlushValues());
+
+    // Decode in several steps, each prefix referring to the previous step
+    auto decoder = MakeTypedDecoder<ByteArrayType>(encoding);
+    decoder->SetData(num_values, buffer->data(), static_cast<int>(buffer->size()));
+    std::vector<ByteArray> decoded(num_values);
+    int values_decoded = 0;
+    while (values_decoded < num_values) {
+      const int num_decoded = decoder->Decode(decoded.data() + values_decoded, 7);
+      ASSERT_GT(num_decoded, 0);
+      values_decoded += num_decoded;
+    }
+    ASSERT_EQ(0, decoder->values_left());
+    for (int i = 0; i < num_values; ++i) {
+      ASSERT_EQ(strings[i], std::string(reinterpret_cast<const char*>(decoded[i].ptr),
+                                        decoded[i].len))
+          << i;
+    }
+  }
+}
+
 }  // namespace test
 }  // namespace parquet
@@ -20,14 +20,23 @@
 #include <algorithm>
 #include <cstdint>
 #include <cstring>
+#include <limits>
 #include <memory>
+#include <mutex>
 #include <ostream>
+#include <sstream>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
 #include <utility>
+#include <vector>
 
+#include "arrow/io/caching.h"
 #include "arrow/io/file.h"
+#include "arrow/io/memory.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/ubsan.h"
+#include "parquet/bloom_filter.h"
 #include "parquet/column_reader.h"
 #include "parquet/column_scanner.h"
 #include "parquet/deprecated_io.h"
@@ -36,6 +45,7 @@
 #include "parquet/file_writer.h"
 #include "parquet/internal_file_decryptor.h"
 #include "parquet/metadata.h"
+#include "parquet/page_index.h"
 #include "parquet/platform.h"
 #include "parquet/properties.h"
 #include "parquet/schema.h"
@@ -43,6 +53,8 @@
 
 namespace parquet {
 
+using ::arrow::io::internal::ReadRangeCache;
+
 // PARQUET-978: Minimize footer reads by reading 64 KB from the end of the file
 static constexpr int64_t kDefaultFooterReadSize = 64 * 1024;
 static constexpr uint32_t kFooterSize = 8;
@@ -75,20 +87,148 @@ std::unique_ptr<PageReader> RowGroupReader::GetColumnPageReader(int i) {
   return contents_->GetColumnPageReader(i);
 }
 
+std::shared_ptr<ColumnReader> RowGroupReader::Column(int i,
+                                                     const std::vector<int>& data_pages) {
+  DCHECK(i < metadata()->num_columns())
+      << "The RowGroup only has " << metadata()->num_columns()
+      << "columns, requested column: " << i;
+  const ColumnDescriptor* descr = metadata()->schema()->Column(i);
+
+  std::unique_ptr<PageReader> page_reader = GetColumnPageReader(i, data_pages);
+  return ColumnReader::Make(
+      descr, std::move(page_reader),
+      const_cast<ReaderProperties*>(contents_->properties())->memory_pool());
+}
+
+std::unique_ptr<PageReader> RowGroupReader::GetColumnPageReader(
+    int i, const std::vector<int>& data_pages) {
+  DCHECK(i < metadata()->num_columns())
+      << "The RowGroup only has " << metadata()->num_columns()
+      << "columns, requested column: " << i;
+  std::unique_ptr<OffsetIndex> offset_index = contents_->GetOffsetIndex(i);
+  if (offset_index == nullptr) {
+    throw ParquetException("Cannot select data pages: the column chunk has no "
+                           "OffsetIndex");
+  }
+  return contents_->GetSelectedPagesReader(i, *offset_index, data_pages);
+}
+
+std::unique_ptr<PageReader> RowGroupReader::GetColumnPageReader(
+    int i, const OffsetIndex& offset_index, const std::vector<int>& data_pages) {
+  DCHECK(i < metadata()->num_columns())
+      << "The RowGroup only has " << metadata()->num_columns()
+      << "columns, requested column: " << i;
+  return contents_->GetSelectedPagesReader(i, offset_index, data_pages);
+}
+
+std::unique_ptr<ColumnIndex> RowGroupReader::GetColumnIndex(int i) {
+  DCHECK(i < metadata()->num_columns())
+      << "The RowGroup only has " << metadata()->num_columns()
+      << "columns, requested column: " << i;
+  return contents_->GetColumnIndex(i);
+}
+
+std::unique_ptr<OffsetIndex> RowGroupReader::GetOffsetIndex(int i) {
+  DCHECK(i < metadata()->num_columns())
+      << "The RowGroup only has " << metadata()->num_columns()
+      << "columns, requested column: " << i;
+  return contents_->GetOffsetIndex(i);
+}
+
+std::unique_ptr<BloomFilter> RowGroupReader::GetColumnBloomFilter(int i) {
+  DCHECK(i < metadata()->num_columns())
+      << "The RowGroup only has " << metadata()->num_columns()
+      << "columns, requested column: " << i;
+  return contents_->GetColumnBloomFilter(i);
+}
+
 // Returns the rowgroup metadata
 const RowGroupMetaData* RowGroupReader::metadata() const { return contents_->metadata(); }
 
+std::unique_ptr<PageReader> RowGroupReader::Contents::GetSelectedPagesReader(
+    int i, const OffsetIndex& offset_index, const std::vector<int>& data_pages) {
+  throw ParquetException("Reading selected data pages is not supported");
+}
+
+std::unique_ptr<ColumnIndex> RowGroupReader::Contents::GetColumnIndex(int i) {
+  return nullptr;
+}
+
+std::unique_ptr<OffsetIndex> RowGroupReader::Contents::GetOffsetIndex(int i) {
+  return nullptr;
+}
+
+std::unique_ptr<BloomFilter> RowGroupReader::Contents::GetColumnBloomFilter(int i) {
+  return nullptr;
+}
+
+void ParquetFileReader::Contents::PreBuffer(const std::vector<int>& row_groups,
+                                            const std::vector<int>& column_indices,
+                                            const ::arrow::io::CacheOptions& options) {}
+
+void ParquetFileReader::Contents::ReleasePreBuffered(
+    const std::vector<int>& row_groups) {}
+
+std::shared_ptr<PageIndex> ParquetFileReader::Contents::ReadPageIndex(
+    const std::vector<int>& row_groups, const std::vector<int>& column_indices) {
+  auto page_index = std::make_shared<PageIndex>();
+  for (int row_group : row_groups) {
+    std::shared_ptr<RowGroupReader> row_group_reader = GetRowGroup(row_group);
+    for (int column : column_indices) {
+      page_index->SetColumnIndex(row_group, column,
+                                 row_group_reader->GetColumnIndex(column));
+      page_index->SetOffsetIndex(row_group, column,
+                                 row_group_reader->GetOffsetIndex(column));
+    }
+  }
+  return page_index;
+}
+
+// The byte range of a column chunk in the file
+static ::arrow::io::ReadRange ComputeColumnChunkRange(FileMetaData* file_metadata,
+                                                      ArrowInputFile* source,
+                                                      const RowGroupMetaData& row_group,
+                                                      int column) {
+  auto col = row_group.ColumnChunk(column);
+
+  int64_t col_start = col->data_page_offset();
+  if (col->has_dictionary_page() && col->dictionary_page_offset() > 0 &&
+      col_start > col->dictionary_page_offset()) {
+    col_start = col->dictionary_page_offset();
+  }
+
+  int64_t col_length = col->total_compressed_size();
+
+  // PARQUET-816 workaround for old files created by older parquet-mr
+  const ApplicationVersion& version = file_metadata->writer_version();
+  if (version.VersionLt(ApplicationVersion::PARQUET_816_FIXED_VERSION())) {
+    // The Parquet MR writer had a bug in 1.2.8 and below where it didn't include the
+    // dictionary page header size in total_compressed_size and total_uncompressed_size
+    // (see IMPALA-694). We add padding to compensate.
+    PARQUET_ASSIGN_OR_THROW(int64_t size, source->GetSize());
+    int64_t bytes_remaining = size - (col_start + col_length);
+    int64_t padding = std::min<int64_t>(kMaxDictHeaderSize, bytes_remaining);
+    col_length += padding;
+  }
+
+  return {col_start, col_length};
+}
+
 // RowGroupReader::Contents implementation for the Parquet file specification
 class SerializedRowGroup : public RowGroupReader::Contents {
  public:
   SerializedRowGroup(std::shared_ptr<ArrowInputFile> source, FileMetaData* file_metadata,
                      int row_group_number, const ReaderProperties& props,
-                     std::shared_ptr<InternalFileDecryptor> file_decryptor = nullptr)
+                     std::shared_ptr<InternalFileDecryptor> file_decryptor = nullptr,
+                     std::shared_ptr<ReadRangeCache> cached_source = nullptr,
+                     std::unordered_set<int> prebuffered_columns = {})
       : source_(std::move(source)),
         file_metadata_(file_metadata),
         properties_(props),
         row_group_ordinal_(row_group_number),
-        file_decryptor_(file_decryptor) {
+        file_decryptor_(file_decryptor),
+        cached_source_(std::move(cached_source)),
+        prebuffered_columns_(std::move(prebuffered_columns)) {
     row_group_metadata_ = file_metadata->RowGroup(row_group_number);
   }
 
@@ -99,30 +239,18 @@ class SerializedRowGroup : public RowGroupReader::Contents {
   std::unique_ptr<PageReader> GetColumnPageReader(int i) override {
     // Read column chunk from the file
     auto col = row_group_metadata_->ColumnChunk(i);
-
-    int64_t col_start = col->data_page_offset();
-    if (col->has_dictionary_page() && col->dictionary_page_offset() > 0 &&
-        col_start > col->dictionary_page_offset()) {
-      col_start = col->dictionary_page_offset();
-    }
-
-    int64_t col_length = col->total_compressed_size();
-
-    // PARQUET-816 workaround for old files created by older parquet-mr
-    const ApplicationVersion& version = file_metadata_->writer_version();
-    if (version.VersionLt(ApplicationVersion::PARQUET_816_FIXED_VERSION())) {
-      // The Parquet MR writer had a bug in 1.2.8 and below where it didn't include the
-      // dictionary page header size in total_compressed_size and total_uncompressed_size
-      // (see IMPALA-694). We add padding to compensate.
-      PARQUET_ASSIGN_OR_THROW(int64_t size, source_->GetSize());
-      int64_t bytes_remaining = size - (col_start + col_length);
-      int64_t padding = std::min<int64_t>(kMaxDictHeaderSize, bytes_remaining);
-      col_length += padding;
+    ::arrow::io::ReadRange col_range =
+        ComputeColumnChunkRange(file_metadata_, source_.get(), *row_group_metadata_, i);
+
+    std::shared_ptr<ArrowInputStream> stream;
+    if (cached_source_ != nullptr && prebuffered_columns_.count(i) > 0) {
+      // The column chunk was pre-buffered, serve it from memory
+      PARQUET_ASSIGN_OR_THROW(auto buffer, cached_source_->Read(col_range));
+      stream = std::make_shared<::arrow::io::BufferReader>(std::move(buffer));
+    } else {
+      stream = properties_.GetStream(source_, col_range.offset, col_range.length);
     }
 
-    std::shared_ptr<ArrowInputStream> stream =
-        properties_.GetStream(source_, col_start, col_length);
-
     std::unique_ptr<ColumnCryptoMetaData> crypto_metadata = col->crypto_metadata();
 
     // Column is encrypted only if crypto_metadata exists.
@@ -159,13 +287,156 @@ class SerializedRowGroup : public RowGroupReader::Contents {
                             properties_.memory_pool(), &ctx);
   }
 
+  std::unique_ptr<PageReader> GetSelectedPagesReader(
+      int i, const OffsetIndex& offset_index,
+      const std::vector<int>& data_pages) override {
+    auto col = row_group_metadata_->ColumnChunk(i);
+    // The AAD of encrypted pages depends on their ordinal in the column chunk
+    if (col->crypto_metadata()) {
+      throw ParquetException("Reading selected data pages of an encrypted column is "
+                             "not supported");
+    }
+    const std::vector<PageLocation>& locations = offset_index.page_locations();
+
+    // The byte ranges to read as (offset, length), starting with the dictionary
+    // page and coalescing adjacent data pages
+    std::vector<std::pair<int64_t, int64_t>> ranges;
+    if (!locations.empty() && col->has_dictionary_page() &&
+        col->dictionary_page_offset() > 0 &&
+        col->dictionary_page_offset() < locations[0].offset) {
+      ranges.emplace_back(col->dictionary_page_offset(),
+                          locations[0].offset - col->dictionary_page_offset());
+    }
+    int previous_page = -1;
+    for (int page : data_pages) {
+      if (page <= previous_page || page >= static_cast<int>(locations.size())) {
+        std::stringstream ss;
+        ss << "Invalid data page selection: page " << page << " after page "
+           << previous_page << " in a column chunk of " << locations.size()
+           << " pages";
+        throw ParquetException(ss.str());
+      }
+      previous_page = page;
+      const PageLocation& location = locations[page];
+      if (!ranges.empty() &&
+          ranges.back().first + ranges.back().second == location.offset) {
+        ranges.back().second += location.compressed_page_size;
+      } else {
+        ranges.emplace_back(location.offset, location.compressed_page_size);
+      }
+    }
+
+    // Serve the pages from memory if the column chunk was pre-buffered
+    const bool prebuffered =
+        cached_source_ != nullptr && prebuffered_columns_.count(i) > 0;
+    auto read_range = [&](int64_t offset, int64_t length) {
+      if (prebuffered) {
+        PARQUET_ASSIGN_OR_THROW(auto buffer, cached_source_->Read({offset, length}));
+        return buffer;
+      }
+      return ReadRange(offset, length);
+    };
+
+    std::shared_ptr<Buffer> pages;
+    if (ranges.size() == 1) {
+      pages = read_range(ranges[0].first, ranges[0].second);
+    } else {
+      int64_t total_size = 0;
+      for (const auto& range : ranges) {
+        total_size += range.second;
+      }
+      std::shared_ptr<ResizableBuffer> buffer =
+          AllocateBuffer(properties_.memory_pool(), total_size);
+      uint8_t* out = buffer->mutable_data();
+      for (const auto& range : ranges) {
+        std::shared_ptr<Buffer> range_buffer = read_range(range.first, range.second);
+        std::memcpy(out, range_buffer->data(), range_buffer->size());
+        out += range_buffer->size();
+      }
+      pages = std::move(buffer);
+    }
+
+    auto stream = std::make_shared<::arrow::io::BufferReader>(std::move(pages));
+    return PageReader::Open(std::move(stream), col->num_values(), col->compression(),
+                            properties_.memory_pool());
+  }
+
+  std::unique_ptr<ColumnIndex> GetColumnIndex(int i) override {
+    auto col = row_group_metadata_->ColumnChunk(i);
+    if (!col->has_column_index()) {
+      return nullptr;
+    }
+    CheckPageIndexNotEncrypted(*col);
+    std::shared_ptr<Buffer> buffer =
+        ReadRange(col->column_index_offset(), col->column_index_length());
+    return ColumnIndex::Make(row_group_metadata_->schema()->Column(i), buffer->data(),
+                             static_cast<uint32_t>(buffer->size()));
+  }
+
+  std::unique_ptr<OffsetIndex> GetOffsetIndex(int i) override {
+    auto col = row_group_metadata_->ColumnChunk(i);
+    if (!col->has_offset_index()) {
+      return nullptr;
+    }
+    CheckPageIndexNotEncrypted(*col);
+    std::shared_ptr<Buffer> buffer =
+        ReadRange(col->offset_index_offset(), col->offset_index_length());
+    return OffsetIndex::Make(buffer->data(), static_cast<uint32_t>(buffer->size()));
+  }
+
+  std::unique_ptr<BloomFilter> GetColumnBloomFilter(int i) override {
+    auto col = row_group_metadata_->ColumnChunk(i);
+    if (!col->has_bloom_filter()) {
+      return nullptr;
+    }
+    if (col->crypto_metadata()) {
+      throw ParquetException("Reading the Bloom filter of an encrypted column is not "
+                             "supported");
+    }
+    // The header holds the size of the bitset, the hash strategy and the
+    // algorithm, as 4-byte integers
+    constexpr int64_t kHeaderSize = 3 * sizeof(uint32_t);
+    const int64_t offset = col->bloom_filter_offset();
+    std::shared_ptr<Buffer> header = ReadRange(offset, kHeaderSize);
+    uint32_t num_bytes;
+    std::memcpy(&num_bytes, header->data(), sizeof(uint32_t));
+    if (num_bytes < BlockSplitBloomFilter::kMinimumBloomFilterBytes ||
+        num_bytes > BloomFilter::kMaximumBloomFilterBytes) {
+      throw ParquetException("Invalid Bloom filter size: " + std::to_string(num_bytes));
+    }
+    ::arrow::io::BufferReader stream(ReadRange(offset, kHeaderSize + num_bytes));
+    return std::unique_ptr<BloomFilter>(
+        new BlockSplitBloomFilter(BlockSplitBloomFilter::Deserialize(&stream)));
+  }
+
  private:
+  std::shared_ptr<Buffer> ReadRange(int64_t offset, int64_t length) {
+    PARQUET_ASSIGN_OR_THROW(auto buffer, source_->ReadAt(offset, length));
+    if (buffer->size() != length) {
+      std::stringstream ss;
+      ss << "Could only read " << buffer->size() << " of the " << length
+         << " bytes at offset " << offset;
+      ParquetException::EofException(ss.str());
+    }
+    return buffer;
+  }
+
+  // The page index modules of encrypted columns are encrypted as well
+  static void CheckPageIndexNotEncrypted(const ColumnChunkMetaData& col) {
+    if (col.crypto_metadata()) {
+      throw ParquetException("Reading the page index of an encrypted column is not "
+                             "supported");
+    }
+  }
+
   std::shared_ptr<ArrowInputFile> source_;
   FileMetaData* file_metadata_;
   std::unique_ptr<RowGroupMetaData> row_group_metadata_;
   ReaderProperties properties_;
   int16_t row_group_ordinal_;
   std::shared_ptr<InternalFileDecryptor> file_decryptor_;
+  std::shared_ptr<ReadRangeCache> cached_source_;
+  std::unordered_set<int> prebuffered_columns_;
 };
 
 // ----------------------------------------------------------------------
@@ -192,12 +463,119 @@ class SerializedFile : public ParquetFileReader::Contents {
   }
 
   std::shared_ptr<RowGroupReader> GetRowGroup(int i) override {
-    std::unique_ptr<SerializedRowGroup> contents(
-        new SerializedRowGroup(source_, file_metadata_.get(), static_cast<int16_t>(i),
-                               properties_, file_decryptor_));
+    std::shared_ptr<ReadRangeCache> cached_source;
+    std::unordered_set<int> prebuffered_columns;
+    {
+      std::lock_guard<std::mutex> lock(prebuffer_mutex_);
+      auto it = prebuffered_row_groups_.find(i);
+      if (it != prebuffered_row_groups_.end()) {
+        cached_source = it->second.cached_source;
+        prebuffered_columns = it->second.columns;
+      }
+    }
+    std::unique_ptr<SerializedRowGroup> contents(new SerializedRowGroup(
+        source_, file_metadata_.get(), static_cast<int16_t>(i), properties_,
+        file_decryptor_, std::move(cached_source), std::move(prebuffered_columns)));
     return std::make_shared<RowGroupReader>(std::move(contents));
   }
 
+  void PreBuffer(const std::vector<int>& row_groups,
+                 const std::vector<int>& column_indices,
+                 const ::arrow::io::CacheOptions& options) override {
+    auto cached_source = std::make_shared<ReadRangeCache>(source_, options);
+    std::vector<::arrow::io::ReadRange> ranges;
+    for (int row_group : row_groups) {
+      std::unique_ptr<RowGroupMetaData> row_group_metadata =
+          file_metadata_->RowGroup(row_group);
+      for (int column : column_indices) {
+        ranges.push_back(ComputeColumnChunkRange(file_metadata_.get(), source_.get(),
+                                                 *row_group_metadata, column));
+      }
+    }
+    PARQUET_THROW_NOT_OK(cached_source->Cache(std::move(ranges)));
+
+    std::lock_guard<std::mutex> lock(prebuffer_mutex_);
+    for (int row_group : row_groups) {
+      PreBufferedRowGroup& prebuffered = prebuffered_row_groups_[row_group];
+      prebuffered.cached_source = cached_source;
+      prebuffered.columns =
+          std::unordered_set<int>(column_indices.begin(), column_indices.end());
+    }
+  }
+
+  void ReleasePreBuffered(const std::vector<int>& row_groups) override {
+    std::lock_guard<std::mutex> lock(prebuffer_mutex_);
+    for (int row_group : row_groups) {
+      prebuffered_row_groups_.erase(row_group);
+    }
+  }
+
+  std::shared_ptr<PageIndex> ReadPageIndex(
+      const std::vector<int>& row_groups,
+      const std::vector<int>& column_indices) override {
+    // The locations of the page index structures to read, as (row group,
+    // column, is offset index, offset, length)
+    struct Location {
+      int row_group;
+      int column;
+      bool offset_index;
+      int64_t offset;
+      int64_t length;
+    };
+    std::vector<Location> locations;
+    int64_t begin = std::numeric_limits<int64_t>::max();
+    int64_t end = 0;
+    for (int row_group : row_groups) {
+      std::unique_ptr<RowGroupMetaData> row_group_metadata =
+          file_metadata_->RowGroup(row_group);
+      for (int column : column_indices) {
+        auto col = row_group_metadata->ColumnChunk(column);
+        // The page index modules of encrypted columns are encrypted as well
+        if (col->crypto_metadata()) {
+          continue;
+        }
+        if (col->has_column_index()) {
+          locations.push_back({row_group, column, false, col->column_index_offset(),
+                               col->column_index_length()});
+        }
+        if (col->has_offset_index()) {
+          locations.push_back({row_group, column, true, col->offset_index_offset(),
+                               col->offset_index_length()});
+        }
+      }
+    }
+    for (const auto& location : locations) {
+      begin = std::min(begin, location.offset);
+      end = std::max(end, location.offset + location.length);
+    }
+
+    auto page_index = std::make_shared<PageIndex>();
+    if (locations.empty()) {
+      return page_index;
+    }
+    PARQUET_ASSIGN_OR_THROW(auto buffer, source_->ReadAt(begin, end - begin));
+    if (buffer->size() != end - begin) {
+      std::stringstream ss;
+      ss << "Could only read " << buffer->size() << " of the " << end - begin
+         << " bytes of the page index at offset " << begin;
+      ParquetException::EofException(ss.str());
+    }
+    const SchemaDescriptor* schema = file_metadata_->schema();
+    for (const auto& location : locations) {
+      const uint8_t* data = buffer->data() + (location.offset - begin);
+      const auto length = static_cast<uint32_t>(location.length);
+      if (location.offset_index) {
+        page_index->SetOffsetIndex(location.row_group, location.column,
+                                   OffsetIndex::Make(data, length));
+      } else {
+        page_index->SetColumnIndex(
+            location.row_group, location.column,
+            ColumnIndex::Make(schema->Column(location.column), data, length));
+      }
+    }
+    return page_index;
+  }
+
   std::shared_ptr<FileMetaData> metadata() const override { return file_metadata_; }
 
   void set_metadata(std::shared_ptr<FileMetaData> metadata) {
@@ -263,6 +641,16 @@ class SerializedFile : public ParquetFileReader::Contents {
 
   std::shared_ptr<InternalFileDecryptor> file_decryptor_;
 
+  // The pre-buffered column chunks of a row group. A cache is shared by the
+  // row groups pre-buffered together, and freed once they are all released
+  // and their readers destroyed.
+  struct PreBufferedRowGroup {
+    std::shared_ptr<ReadRangeCache> cached_source;
+    std::unordered_set<int> columns;
+  };
+  std::mutex prebuffer_mutex_;
+  std::unordered_map<int, PreBufferedRowGroup> prebuffered_row_groups_;
+
   void ParseUnencryptedFileMetadata(const std::shared_ptr<Buffer>& footer_buffer,
                                     int64_t footer_read_size, int64_t file_size,
                                     std::shared_ptr<Buffer>* metadata_buffer,
@@ -524,6 +912,21 @@ std::shared_ptr<FileMetaData> ParquetFileReader::metadata() const {
   return contents_->metadata();
 }
 
+void ParquetFileReader::PreBuffer(const std::vector<int>& row_groups,
+                                  const std::vector<int>& column_indices,
+                                  const ::arrow::io::CacheOptions& options) {
+  contents_->PreBuffer(row_groups, column_indices, options);
+}
+
+void ParquetFileReader::ReleasePreBuffered(const std::vector<int>& row_groups) {
+  contents_->ReleasePreBuffered(row_groups);
+}
+
+std::shared_ptr<PageIndex> ParquetFileReader::ReadPageIndex(
+    const std::vector<int>& row_groups, const std::vector<int>& column_indices) {
+  return contents_->ReadPageIndex(row_groups, column_indices);
+}
+
 std::shared_ptr<RowGroupReader> ParquetFileReader::RowGroup(int i) {
   DCHECK(i < metadata()->num_row_groups())
       << "The file only has " << metadata()->num_row_groups()
@@ -23,12 +23,16 @@
 #include <string>
 #include <vector>
 
-#include "parquet/metadata.h"  // IWYU pragma: keep
+#include "arrow/io/caching.h"
+
+#include "parquet/metadata.h"    // IWYU pragma: keep
+#include "parquet/page_index.h"  // IWYU pragma: keep
 #include "parquet/platform.h"
 #include "parquet/properties.h"
 
 namespace parquet {
 
+class BloomFilter;
 class ColumnReader;
 class FileMetaData;
 class PageReader;
@@ -45,6 +49,15 @@ class PARQUET_EXPORT RowGroupReader {
     virtual std::unique_ptr<PageReader> GetColumnPageReader(int i) = 0;
     virtual const RowGroupMetaData* metadata() const = 0;
     virtual const ReaderProperties* properties() const = 0;
+
+    // The page index is optional, the default implementations report it as
+    // missing
+    virtual std::unique_ptr<PageReader> GetSelectedPagesReader(
+        int i, const OffsetIndex& offset_index, const std::vector<int>& data_pages);
+    virtual std::unique_ptr<ColumnIndex> GetColumnIndex(int i);
+    virtual std::unique_ptr<OffsetIndex> GetOffsetIndex(int i);
+    // Bloom filters are optional as well
+    virtual std::unique_ptr<BloomFilter> GetColumnBloomFilter(int i);
   };
 
   explicit RowGroupReader(std::unique_ptr<Contents> contents);
@@ -58,6 +71,43 @@ class PARQUET_EXPORT RowGroupReader {
 
   std::unique_ptr<PageReader> GetColumnPageReader(int i);
 
+  /// \brief Construct a ColumnReader reading only some of the data pages of
+  /// the indicated column, see GetColumnPageReader(int, const std::vector<int>&)
+  std::shared_ptr<ColumnReader> Column(int i, const std::vector<int>& data_pages);
+
+  /// \brief Construct a PageReader reading only some of the data pages of the
+  /// indicated column, in addition to its dictionary page if any
+  ///
+  /// Only the bytes of the selected pages are read from the file. The pages
+  /// are located with the OffsetIndex of the column chunk, which must exist.
+  ///
+  /// \param[in] i the row group-relative column index
+  /// \param[in] data_pages the ordinals of the data pages to read, in
+  /// increasing order, as indices into OffsetIndex::page_locations()
+  std::unique_ptr<PageReader> GetColumnPageReader(int i,
+                                                  const std::vector<int>& data_pages);
+
+  /// \brief Same as GetColumnPageReader(int, const std::vector<int>&), with
+  /// the OffsetIndex of the column chunk already read, e.g. by
+  /// ParquetFileReader::ReadPageIndex
+  std::unique_ptr<PageReader> GetColumnPageReader(int i, const OffsetIndex& offset_index,
+                                                  const std::vector<int>& data_pages);
+
+  /// \brief Read the ColumnIndex of the indicated column, or return null if
+  /// it was not written
+  std::unique_ptr<ColumnIndex> GetColumnIndex(int i);
+
+  /// \brief Read the OffsetIndex of the indicated column, or return null if
+  /// it was not written
+  std::unique_ptr<OffsetIndex> GetOffsetIndex(int i);
+
+  /// \brief Read the Bloom filter of the indicated column, or return null if
+  /// it was not written
+  ///
+  /// A Bloom filter is written for the columns enabled with
+  /// WriterProperties::Builder::enable_bloom_filter.
+  std::unique_ptr<BloomFilter> GetColumnBloomFilter(int i);
+
  private:
   // Holds a pointer to an instance of Contents implementation
   std::unique_ptr<Contents> contents_;
@@ -79,6 +129,16 @@ class PARQUET_EXPORT ParquetFileReader {
     virtual void Close() = 0;
     virtual std::shared_ptr<RowGroupReader> GetRowGroup(int i) = 0;
     virtual std::shared_ptr<FileMetaData> metadata() const = 0;
+    // Start fetching the given column chunks in the background. The default
+    // implementation does nothing: column chunks are read when requested.
+    virtual void PreBuffer(const std::vector<int>& row_groups,
+                           const std::vector<int>& column_indices,
+                           const ::arrow::io::CacheOptions& options);
+    virtual void ReleasePreBuffered(const std::vector<int>& row_groups);
+    // Read the page index of the given column chunks. The default
+    // implementation reads it one column chunk at a time.
+    virtual std::shared_ptr<PageIndex> ReadPageIndex(
+        const std::vector<int>& row_groups, const std::vector<int>& column_indices);
   };
 
   ParquetFileReader();
@@ -118,6 +178,44 @@ class PARQUET_EXPORT ParquetFileReader {
   // Returns the file metadata. Only one instance is ever created
   std::shared_ptr<FileMetaData> metadata() const;
 
+  /// \brief Pre-buffer the given column chunks of the given row groups
+  ///
+  /// All column chunk byte ranges are computed up front, coalesced according
+  /// to the CacheOptions and fetched concurrently on the I/O thread pool.
+  /// Column readers of the pre-buffered row groups and columns are then
+  /// served from the fetched buffers, which hides the latency of
+  /// high-latency filesystems such as S3.
+  ///
+  /// The pre-buffered column chunks are held in memory until their row
+  /// groups are released with ReleasePreBuffered() and the readers created
+  /// from them are destroyed. Pre-buffering a row group again replaces its
+  /// pre-buffered column chunks. This may be called concurrently with reads
+  /// from this file.
+  ///
+  /// \param[in] row_groups the row groups to pre-buffer
+  /// \param[in] column_indices the leaf column indices to pre-buffer
+  /// \param[in] options how to coalesce the byte ranges
+  void PreBuffer(const std::vector<int>& row_groups,
+                 const std::vector<int>& column_indices,
+                 const ::arrow::io::CacheOptions& options);
+
+  /// \brief Release the pre-buffered column chunks of the given row groups
+  ///
+  /// Readers created from these row groups afterwards read from the file.
+  void ReleasePreBuffered(const std::vector<int>& row_groups);
+
+  /// \brief Read the ColumnIndex and OffsetIndex of the given column chunks
+  ///
+  /// The page index of a file is stored contiguously before its footer, so
+  /// the page index of all the requested column chunks is fetched with a
+  /// single read spanning them. Column chunks without a page index, or with
+  /// an encrypted one, are left out of the result.
+  ///
+  /// \param[in] row_groups the row groups whose page index to read
+  /// \param[in] column_indices the leaf column indices whose page index to read
+  std::shared_ptr<PageIndex> ReadPageIndex(const std::vector<int>& row_groups,
+                                           const std::vector<int>& column_indices);
+
  private:
   // Holds a pointer to an instance of Contents implementation
   std::unique_ptr<Contents> contents_;
@@ -23,11 +23,13 @@
 #include <utility>
 #include <vector>
 
+#include "parquet/bloom_filter.h"
 #include "parquet/column_writer.h"
 #include "parquet/deprecated_io.h"
 #include "parquet/encryption_internal.h"
 #include "parquet/exception.h"
 #include "parquet/internal_file_encryptor.h"
+#include "parquet/page_index.h"
 #include "parquet/platform.h"
 #include "parquet/schema.h"
 #include "parquet/types.h"
@@ -74,6 +76,62 @@ inline void ThrowRowsMisMatchError(int col, int64_t prev, int64_t curr) {
   throw ParquetException(ss.str());
 }
 
+// ----------------------------------------------------------------------
+// BloomFilterBuilder
+
+// Collects the Bloom filters of the column chunks of a row group while it is
+// written, and serializes them once the row group is closed so that at most one
+// row group's filters are held in memory
+class BloomFilterBuilder {
+ public:
+  BloomFilterBuilder(const SchemaDescriptor* schema, const WriterProperties* properties)
+      : schema_(schema), properties_(properties), row_group_ordinal_(-1) {}
+
+  void AppendRowGroup() {
+    ++row_group_ordinal_;
+    filters_.clear();
+    filters_.resize(schema_->num_columns());
+  }
+
+  // The Bloom filter of column i of the current row group, or nullptr if none
+  // is written for the column
+  BloomFilter* GetColumnBloomFilter(int i) {
+    const ColumnDescriptor* descr = schema_->Column(i);
+    if (descr->physical_type() == Type::BOOLEAN ||
+        !properties_->bloom_filter_enabled(descr->path())) {
+      return nullptr;
+    }
+    if (filters_[i] == nullptr) {
+      const BloomFilterOptions& options =
+          properties_->bloom_filter_options(descr->path());
+      const uint32_t num_bits = BlockSplitBloomFilter::OptimalNumOfBits(
+          static_cast<uint32_t>(options.ndv), options.fpp);
+      std::unique_ptr<BlockSplitBloomFilter> filter(new BlockSplitBloomFilter());
+      filter->Init(num_bits / 8);
+      filters_[i] = std::move(filter);
+    }
+    return filters_[i].get();
+  }
+
+  // Write the filters of the current row group to the sink and record their
+  // offsets in the metadata
+  void WriteTo(ArrowOutputStream* sink, FileMetaDataBuilder* metadata) {
+    for (int i = 0; i < static_cast<int>(filters_.size()); ++i) {
+      if (filters_[i] == nullptr) continue;
+      PARQUET_ASSIGN_OR_THROW(int64_t offset, sink->Tell());
+      filters_[i]->WriteTo(sink);
+      metadata->SetBloomFilterOffset(row_group_ordinal_, i, offset);
+    }
+    filters_.clear();
+  }
+
+ private:
+  const SchemaDescriptor* schema_;
+  const WriterProperties* properties_;
+  int row_group_ordinal_;
+  std::vector<std::unique_ptr<BloomFilter>> filters_;
+};
+
 // ----------------------------------------------------------------------
 // RowGroupSerializer
 
@@ -83,7 +141,9 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
   RowGroupSerializer(std::shared_ptr<ArrowOutputStream> sink,
                      RowGroupMetaDataBuilder* metadata, int16_t row_group_ordinal,
                      const WriterProperties* properties, bool buffered_row_group = false,
-                     InternalFileEncryptor* file_encryptor = nullptr)
+                     InternalFileEncryptor* file_encryptor = nullptr,
+                     PageIndexBuilder* page_index_builder = nullptr,
+                     BloomFilterBuilder* bloom_filter_builder = nullptr)
       : sink_(std::move(sink)),
         metadata_(metadata),
         properties_(properties),
@@ -93,7 +153,9 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
         next_column_index_(0),
         num_rows_(0),
         buffered_row_group_(buffered_row_group),
-        file_encryptor_(file_encryptor) {
+        file_encryptor_(file_encryptor),
+        page_index_builder_(page_index_builder),
+        bloom_filter_builder_(bloom_filter_builder) {
     if (buffered_row_group) {
       InitColumns();
     } else {
@@ -138,8 +200,11 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
     std::unique_ptr<PageWriter> pager = PageWriter::Open(
         sink_, properties_->compression(path), properties_->compression_level(path),
         col_meta, row_group_ordinal_, static_cast<int16_t>(next_column_index_ - 1),
-        properties_->memory_pool(), false, meta_encryptor, data_encryptor);
-    column_writers_[0] = ColumnWriter::Make(col_meta, std::move(pager), properties_);
+        properties_->memory_pool(), false, meta_encryptor, data_encryptor,
+        GetColumnPageIndexBuilder(next_column_index_ - 1));
+    column_writers_[0] =
+        ColumnWriter::Make(col_meta, std::move(pager), properties_,
+                           GetColumnBloomFilter(next_column_index_ - 1));
     return column_writers_[0].get();
   }
 
@@ -208,6 +273,17 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
   mutable int64_t num_rows_;
   bool buffered_row_group_;
   InternalFileEncryptor* file_encryptor_;
+  PageIndexBuilder* page_index_builder_;
+  BloomFilterBuilder* bloom_filter_builder_;
+
+  ColumnPageIndexBuilder* GetColumnPageIndexBuilder(int i) {
+    return page_index_builder_ ? page_index_builder_->GetColumnBuilder(i) : nullptr;
+  }
+
+  BloomFilter* GetColumnBloomFilter(int i) {
+    return bloom_filter_builder_ ? bloom_filter_builder_->GetColumnBloomFilter(i)
+                                 : nullptr;
+  }
 
   void CheckRowsWritten() const {
     // verify when only one column is written at a time
@@ -244,10 +320,13 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
       std::unique_ptr<PageWriter> pager = PageWriter::Open(
           sink_, properties_->compression(path), properties_->compression_level(path),
           col_meta, static_cast<int16_t>(row_group_ordinal_),
-          static_cast<int16_t>(next_column_index_++), properties_->memory_pool(),
-          buffered_row_group_, meta_encryptor, data_encryptor);
+          static_cast<int16_t>(next_column_index_), properties_->memory_pool(),
+          buffered_row_group_, meta_encryptor, data_encryptor,
+          GetColumnPageIndexBuilder(next_column_index_));
       column_writers_.push_back(
-          ColumnWriter::Make(col_meta, std::move(pager), properties_));
+          ColumnWriter::Make(col_meta, std::move(pager), properties_,
+                             GetColumnBloomFilter(next_column_index_)));
+      ++next_column_index_;
     }
   }
 
@@ -281,6 +360,7 @@ class FileSerializer : public ParquetFileWriter::Contents {
       if (row_group_writer_) {
         num_rows_ += row_group_writer_->num_rows();
         row_group_writer_->Close();
+        WriteBloomFilters();
       }
       row_group_writer_.reset();
 
@@ -288,6 +368,9 @@ class FileSerializer : public ParquetFileWriter::Contents {
       auto file_encryption_properties = properties_->file_encryption_properties();
 
       if (file_encryption_properties == nullptr) {  // Non encrypted file.
+        if (page_index_builder_) {
+          page_index_builder_->WriteTo(sink_.get(), metadata_.get());
+        }
         file_metadata_ = metadata_->Finish();
         WriteFileMetaData(*file_metadata_, sink_.get());
       } else {  // Encrypted file
@@ -309,12 +392,20 @@ class FileSerializer : public ParquetFileWriter::Contents {
   RowGroupWriter* AppendRowGroup(bool buffered_row_group) {
     if (row_group_writer_) {
       row_group_writer_->Close();
+      WriteBloomFilters();
     }
     num_row_groups_++;
     auto rg_metadata = metadata_->AppendRowGroup();
+    if (page_index_builder_) {
+      page_index_builder_->AppendRowGroup();
+    }
+    if (bloom_filter_builder_) {
+      bloom_filter_builder_->AppendRowGroup();
+    }
     std::unique_ptr<RowGroupWriter::Contents> contents(new RowGroupSerializer(
         sink_, rg_metadata, static_cast<int16_t>(num_row_groups_ - 1), properties_.get(),
-        buffered_row_group, file_encryptor_.get()));
+        buffered_row_group, file_encryptor_.get(), page_index_builder_.get(),
+        bloom_filter_builder_.get()));
     row_group_writer_.reset(new RowGroupWriter(std::move(contents)));
     return row_group_writer_.get();
   }
@@ -347,6 +438,22 @@ class FileSerializer : public ParquetFileWriter::Contents {
     } else {
       throw ParquetException("Appending to file not implemented.");
     }
+    // The page index of encrypted files would have to be encrypted as well
+    if (properties_->write_page_index() &&
+        properties_->file_encryption_properties() == nullptr) {
+      page_index_builder_ = PageIndexBuilder::Make(&schema_);
+    }
+    // Bloom filters of encrypted files would have to be encrypted as well
+    if (properties_->bloom_filter_enabled() &&
+        properties_->file_encryption_properties() == nullptr) {
+      bloom_filter_builder_.reset(new BloomFilterBuilder(&schema_, properties_.get()));
+    }
+  }
+
+  void WriteBloomFilters() {
+    if (bloom_filter_builder_) {
+      bloom_filter_builder_->WriteTo(sink_.get(), metadata_.get());
+    }
   }
 
   void CloseEncryptedFile(FileEncryptionProperties* file_encryption_properties) {
@@ -388,6 +495,8 @@ class FileSerializer : public ParquetFileWriter::Contents {
   std::unique_ptr<RowGroupWriter> row_group_writer_;
 
   std::unique_ptr<InternalFileEncryptor> file_encryptor_;
+  std::unique_ptr<PageIndexBuilder> page_index_builder_;
+  std::unique_ptr<BloomFilterBuilder> bloom_filter_builder_;
 
   void StartFile() {
     auto file_encryption_properties = properties_->file_encryption_properties();
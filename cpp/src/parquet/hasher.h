@@ -67,6 +67,65 @@ class Hasher {
   /// @param len the value length.
   virtual uint64_t Hash(const FLBA* value, uint32_t len) const = 0;
 
+  /// Compute hashes for a batch of 32 bits values by using their plain encoding
+  /// results.
+  ///
+  /// @param values the values to hash.
+  /// @param num_values the number of values.
+  /// @param hashes the num_values hash results.
+  virtual void Hashes(const int32_t* values, int num_values, uint64_t* hashes) const = 0;
+
+  /// Compute hashes for a batch of 64 bits values by using their plain encoding
+  /// results.
+  ///
+  /// @param values the values to hash.
+  /// @param num_values the number of values.
+  /// @param hashes the num_values hash results.
+  virtual void Hashes(const int64_t* values, int num_values, uint64_t* hashes) const = 0;
+
+  /// Compute hashes for a batch of float values by using their plain encoding
+  /// results.
+  ///
+  /// @param values the values to hash.
+  /// @param num_values the number of values.
+  /// @param hashes the num_values hash results.
+  virtual void Hashes(const float* values, int num_values, uint64_t* hashes) const = 0;
+
+  /// Compute hashes for a batch of double values by using their plain encoding
+  /// results.
+  ///
+  /// @param values the values to hash.
+  /// @param num_values the number of values.
+  /// @param hashes the num_values hash results.
+  virtual void Hashes(const double* values, int num_values, uint64_t* hashes) const = 0;
+
+  /// Compute hashes for a batch of Int96 values by using their plain encoding
+  /// results.
+  ///
+  /// @param values the values to hash.
+  /// @param num_values the number of values.
+  /// @param hashes the num_values hash results.
+  virtual void Hashes(const Int96* values, int num_values, uint64_t* hashes) const = 0;
+
+  /// Compute hashes for a batch of ByteArray values by using their plain encoding
+  /// results.
+  ///
+  /// @param values the values to hash.
+  /// @param num_values the number of values.
+  /// @param hashes the num_values hash results.
+  virtual void Hashes(const ByteArray* values, int num_values,
+                      uint64_t* hashes) const = 0;
+
+  /// Compute hashes for a batch of fixed byte array values by using their plain
+  /// encoding results.
+  ///
+  /// @param values the values to hash.
+  /// @param type_len the length of the values.
+  /// @param num_values the number of values.
+  /// @param hashes the num_values hash results.
+  virtual void Hashes(const FLBA* values, uint32_t type_len, int num_values,
+                      uint64_t* hashes) const = 0;
+
   virtual ~Hasher() = default;
 };
 
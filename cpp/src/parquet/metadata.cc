@@ -281,6 +281,26 @@ class ColumnChunkMetaData::ColumnChunkMetaDataImpl {
     return column_metadata_->total_uncompressed_size;
   }
 
+  inline bool has_column_index() const { return column_->__isset.column_index_offset; }
+
+  inline int64_t column_index_offset() const { return column_->column_index_offset; }
+
+  inline int32_t column_index_length() const { return column_->column_index_length; }
+
+  inline bool has_offset_index() const { return column_->__isset.offset_index_offset; }
+
+  inline int64_t offset_index_offset() const { return column_->offset_index_offset; }
+
+  inline int32_t offset_index_length() const { return column_->offset_index_length; }
+
+  inline bool has_bloom_filter() const {
+    return column_metadata_->__isset.bloom_filter_offset;
+  }
+
+  inline int64_t bloom_filter_offset() const {
+    return column_metadata_->bloom_filter_offset;
+  }
+
   inline std::unique_ptr<ColumnCryptoMetaData> crypto_metadata() const {
     if (column_->__isset.crypto_metadata) {
       return ColumnCryptoMetaData::Make(
@@ -379,6 +399,32 @@ std::unique_ptr<ColumnCryptoMetaData> ColumnChunkMetaData::crypto_metadata() con
   return impl_->crypto_metadata();
 }
 
+bool ColumnChunkMetaData::has_column_index() const { return impl_->has_column_index(); }
+
+int64_t ColumnChunkMetaData::column_index_offset() const {
+  return impl_->column_index_offset();
+}
+
+int32_t ColumnChunkMetaData::column_index_length() const {
+  return impl_->column_index_length();
+}
+
+bool ColumnChunkMetaData::has_offset_index() const { return impl_->has_offset_index(); }
+
+int64_t ColumnChunkMetaData::offset_index_offset() const {
+  return impl_->offset_index_offset();
+}
+
+int32_t ColumnChunkMetaData::offset_index_length() const {
+  return impl_->offset_index_length();
+}
+
+bool ColumnChunkMetaData::has_bloom_filter() const { return impl_->has_bloom_filter(); }
+
+int64_t ColumnChunkMetaData::bloom_filter_offset() const {
+  return impl_->bloom_filter_offset();
+}
+
 // row-group metadata
 class RowGroupMetaData::RowGroupMetaDataImpl {
  public:
@@ -1276,6 +1322,24 @@ class FileMetaDataBuilder::FileMetaDataBuilderImpl {
     return current_row_group_builder_.get();
   }
 
+  void SetColumnIndexLocation(int row_group, int column, int64_t offset,
+                              int32_t length) {
+    format::ColumnChunk& column_chunk = GetColumnChunk(row_group, column);
+    column_chunk.__set_column_index_offset(offset);
+    column_chunk.__set_column_index_length(length);
+  }
+
+  void SetOffsetIndexLocation(int row_group, int column, int64_t offset,
+                              int32_t length) {
+    format::ColumnChunk& column_chunk = GetColumnChunk(row_group, column);
+    column_chunk.__set_offset_index_offset(offset);
+    column_chunk.__set_offset_index_length(length);
+  }
+
+  void SetBloomFilterOffset(int row_group, int column, int64_t offset) {
+    GetColumnChunk(row_group, column).meta_data.__set_bloom_filter_offset(offset);
+  }
+
   std::unique_ptr<FileMetaData> Finish() {
     int64_t total_rows = 0;
     for (auto row_group : row_groups_) {
@@ -1378,6 +1442,17 @@ class FileMetaDataBuilder::FileMetaDataBuilderImpl {
   std::unique_ptr<format::FileCryptoMetaData> crypto_metadata_;
 
  private:
+  format::ColumnChunk& GetColumnChunk(int row_group, int column) {
+    if (row_group < 0 || row_group >= static_cast<int>(row_groups_.size()) ||
+        column < 0 ||
+        column >= static_cast<int>(row_groups_[row_group].columns.size())) {
+      std::stringstream ss;
+      ss << "Column chunk (" << row_group << ", " << column << ") does not exist";
+      throw ParquetException(ss.str());
+    }
+    return row_groups_[row_group].columns[column];
+  }
+
   const std::shared_ptr<WriterProperties> properties_;
   std::vector<format::RowGroup> row_groups_;
 
@@ -1405,6 +1480,21 @@ RowGroupMetaDataBuilder* FileMetaDataBuilder::AppendRowGroup() {
   return impl_->AppendRowGroup();
 }
 
+void FileMetaDataBuilder::SetColumnIndexLocation(int row_group, int column,
+                                                 int64_t offset, int32_t length) {
+  impl_->SetColumnIndexLocation(row_group, column, offset, length);
+}
+
+void FileMetaDataBuilder::SetOffsetIndexLocation(int row_group, int column,
+                                                 int64_t offset, int32_t length) {
+  impl_->SetOffsetIndexLocation(row_group, column, offset, length);
+}
+
+void FileMetaDataBuilder::SetBloomFilterOffset(int row_group, int column,
+                                               int64_t offset) {
+  impl_->SetBloomFilterOffset(row_group, column, offset);
+}
+
 std::unique_ptr<FileMetaData> FileMetaDataBuilder::Finish() { return impl_->Finish(); }
 
 std::unique_ptr<FileCryptoMetaData> FileMetaDataBuilder::GetCryptoMetaData() {
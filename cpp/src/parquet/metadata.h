@@ -160,6 +160,18 @@ class PARQUET_EXPORT ColumnChunkMetaData {
   int64_t total_uncompressed_size() const;
   std::unique_ptr<ColumnCryptoMetaData> crypto_metadata() const;
 
+  // page index, see parquet/page_index.h
+  bool has_column_index() const;
+  int64_t column_index_offset() const;
+  int32_t column_index_length() const;
+  bool has_offset_index() const;
+  int64_t offset_index_offset() const;
+  int32_t offset_index_length() const;
+
+  // Bloom filter, see parquet/bloom_filter.h
+  bool has_bloom_filter() const;
+  int64_t bloom_filter_offset() const;
+
  private:
   explicit ColumnChunkMetaData(
       const void* metadata, const ColumnDescriptor* descr, int16_t row_group_ordinal,
@@ -378,6 +390,15 @@ class PARQUET_EXPORT FileMetaDataBuilder {
   // The prior RowGroupMetaDataBuilder (if any) is destroyed
   RowGroupMetaDataBuilder* AppendRowGroup();
 
+  // Record where the page index of a column chunk was written, must be called
+  // before Finish()
+  void SetColumnIndexLocation(int row_group, int column, int64_t offset, int32_t length);
+  void SetOffsetIndexLocation(int row_group, int column, int64_t offset, int32_t length);
+
+  // Record where the Bloom filter of a column chunk was written, must be called
+  // before Finish()
+  void SetBloomFilterOffset(int row_group, int column, int64_t offset);
+
   // Complete the Thrift structure
   std::unique_ptr<FileMetaData> Finish();
 
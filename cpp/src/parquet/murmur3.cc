@@ -219,4 +219,56 @@ uint64_t MurmurHash3::Hash(const ByteArray* value) const {
   return out[0];
 }
 
+void MurmurHash3::Hashes(const int32_t* values, int num_values, uint64_t* hashes) const {
+  for (int i = 0; i < num_values; ++i) {
+    hashes[i] = HashHelper(values[i], seed_);
+  }
+}
+
+void MurmurHash3::Hashes(const int64_t* values, int num_values, uint64_t* hashes) const {
+  for (int i = 0; i < num_values; ++i) {
+    hashes[i] = HashHelper(values[i], seed_);
+  }
+}
+
+void MurmurHash3::Hashes(const float* values, int num_values, uint64_t* hashes) const {
+  for (int i = 0; i < num_values; ++i) {
+    hashes[i] = HashHelper(values[i], seed_);
+  }
+}
+
+void MurmurHash3::Hashes(const double* values, int num_values, uint64_t* hashes) const {
+  for (int i = 0; i < num_values; ++i) {
+    hashes[i] = HashHelper(values[i], seed_);
+  }
+}
+
+void MurmurHash3::Hashes(const Int96* values, int num_values, uint64_t* hashes) const {
+  for (int i = 0; i < num_values; ++i) {
+    uint64_t out[2];
+    Hash_x64_128(reinterpret_cast<const void*>(values[i].value), sizeof(values[i].value),
+                 seed_, out);
+    hashes[i] = out[0];
+  }
+}
+
+void MurmurHash3::Hashes(const ByteArray* values, int num_values,
+                         uint64_t* hashes) const {
+  for (int i = 0; i < num_values; ++i) {
+    uint64_t out[2];
+    Hash_x64_128(reinterpret_cast<const void*>(values[i].ptr), values[i].len, seed_,
+                 out);
+    hashes[i] = out[0];
+  }
+}
+
+void MurmurHash3::Hashes(const FLBA* values, uint32_t type_len, int num_values,
+                         uint64_t* hashes) const {
+  for (int i = 0; i < num_values; ++i) {
+    uint64_t out[2];
+    Hash_x64_128(reinterpret_cast<const void*>(values[i].ptr), type_len, seed_, out);
+    hashes[i] = out[0];
+  }
+}
+
 }  // namespace parquet
@@ -0,0 +1,411 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "parquet/page_index.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "parquet/exception.h"
+#include "parquet/metadata.h"
+#include "parquet/schema.h"
+#include "parquet/statistics.h"
+#include "parquet/thrift_internal.h"
+
+namespace parquet {
+
+// ----------------------------------------------------------------------
+// OffsetIndex / ColumnIndex
+
+namespace {
+
+class SerializedOffsetIndex : public OffsetIndex {
+ public:
+  SerializedOffsetIndex(const void* serialized_index, uint32_t index_len) {
+    format::OffsetIndex offset_index;
+    DeserializeThriftMsg(reinterpret_cast<const uint8_t*>(serialized_index), &index_len,
+                         &offset_index);
+    page_locations_.reserve(offset_index.page_locations.size());
+    for (const auto& location : offset_index.page_locations) {
+      page_locations_.push_back(
+          {location.offset, location.compressed_page_size, location.first_row_index});
+    }
+  }
+
+  const std::vector<PageLocation>& page_locations() const override {
+    return page_locations_;
+  }
+
+ private:
+  std::vector<PageLocation> page_locations_;
+};
+
+class SerializedColumnIndex : public ColumnIndex {
+ public:
+  SerializedColumnIndex(const ColumnDescriptor* descr, const void* serialized_index,
+                        uint32_t index_len)
+      : descr_(descr) {
+    DeserializeThriftMsg(reinterpret_cast<const uint8_t*>(serialized_index), &index_len,
+                         &column_index_);
+    const size_t num_pages = column_index_.null_pages.size();
+    if (column_index_.min_values.size() != num_pages ||
+        column_index_.max_values.size() != num_pages ||
+        (column_index_.__isset.null_counts &&
+         column_index_.null_counts.size() != num_pages)) {
+      throw ParquetException("Invalid ColumnIndex: page lists have different lengths");
+    }
+  }
+
+  const std::vector<bool>& null_pages() const override {
+    return column_index_.null_pages;
+  }
+
+  const std::vector<std::string>& encoded_min_values() const override {
+    return column_index_.min_values;
+  }
+
+  const std::vector<std::string>& encoded_max_values() const override {
+    return column_index_.max_values;
+  }
+
+  BoundaryOrder::type boundary_order() const override {
+    return static_cast<BoundaryOrder::type>(column_index_.boundary_order);
+  }
+
+  bool has_null_counts() const override { return column_index_.__isset.null_counts; }
+
+  const std::vector<int64_t>& null_counts() const override {
+    return column_index_.null_counts;
+  }
+
+  std::shared_ptr<Statistics> page_statistics(int i, int64_t num_rows) const override {
+    const bool null_page = column_index_.null_pages[i];
+    int64_t null_count = null_page ? num_rows : 0;
+    if (has_null_counts()) {
+      null_count = column_index_.null_counts[i];
+    }
+    return Statistics::Make(descr_, column_index_.min_values[i],
+                            column_index_.max_values[i], num_rows - null_count,
+                            null_count, /*distinct_count=*/0, /*has_min_max=*/!null_page);
+  }
+
+ private:
+  const ColumnDescriptor* descr_;
+  format::ColumnIndex column_index_;
+};
+
+}  // namespace
+
+std::unique_ptr<OffsetIndex> OffsetIndex::Make(const void* serialized_index,
+                                               uint32_t index_len) {
+  return std::unique_ptr<OffsetIndex>(
+      new SerializedOffsetIndex(serialized_index, index_len));
+}
+
+std::unique_ptr<ColumnIndex> ColumnIndex::Make(const ColumnDescriptor* descr,
+                                               const void* serialized_index,
+                                               uint32_t index_len) {
+  return std::unique_ptr<ColumnIndex>(
+      new SerializedColumnIndex(descr, serialized_index, index_len));
+}
+
+// ----------------------------------------------------------------------
+// PageIndex
+
+const ColumnIndex* PageIndex::GetColumnIndex(int row_group, int column) const {
+  auto it = column_indexes_.find(std::make_pair(row_group, column));
+  return it == column_indexes_.end() ? nullptr : it->second.get();
+}
+
+const OffsetIndex* PageIndex::GetOffsetIndex(int row_group, int column) const {
+  auto it = offset_indexes_.find(std::make_pair(row_group, column));
+  return it == offset_indexes_.end() ? nullptr : it->second.get();
+}
+
+void PageIndex::SetColumnIndex(int row_group, int column,
+                               std::unique_ptr<ColumnIndex> index) {
+  column_indexes_[std::make_pair(row_group, column)] = std::move(index);
+}
+
+void PageIndex::SetOffsetIndex(int row_group, int column,
+                               std::unique_ptr<OffsetIndex> index) {
+  offset_indexes_[std::make_pair(row_group, column)] = std::move(index);
+}
+
+// ----------------------------------------------------------------------
+// PageSelection
+
+namespace {
+
+// Sort the ranges, clip them to the row group and merge the overlapping and
+// adjacent ones
+RowRanges NormalizeRowRanges(RowRanges rows, int64_t num_rows) {
+  std::sort(rows.begin(), rows.end(), [](const RowRange& left, const RowRange& right) {
+    return left.first < right.first;
+  });
+  RowRanges out;
+  for (const auto& range : rows) {
+    const int64_t first = std::max<int64_t>(range.first, 0);
+    const int64_t last = std::min(range.last, num_rows);
+    if (first >= last) {
+      continue;
+    }
+    if (!out.empty() && first <= out.back().last) {
+      out.back().last = std::max(out.back().last, last);
+    } else {
+      out.push_back({first, last});
+    }
+  }
+  return out;
+}
+
+// The ordinals of the pages holding some of the given rows, and the rows of
+// these pages
+void SelectPages(const RowRanges& rows, const std::vector<PageLocation>& locations,
+                 int64_t num_rows, std::vector<int>* pages, RowRanges* page_rows) {
+  const int num_pages = static_cast<int>(locations.size());
+  size_t range = 0;
+  for (int page = 0; page < num_pages && range < rows.size(); ++page) {
+    const int64_t first = locations[page].first_row_index;
+    const int64_t last =
+        page + 1 < num_pages ? locations[page + 1].first_row_index : num_rows;
+    while (range < rows.size() && rows[range].last <= first) {
+      ++range;
+    }
+    if (range < rows.size() && rows[range].first < last) {
+      pages->push_back(page);
+      if (!page_rows->empty() && page_rows->back().last == first) {
+        page_rows->back().last = last;
+      } else {
+        page_rows->push_back({first, last});
+      }
+    }
+  }
+}
+
+bool RowRangesEqual(const RowRanges& left, const RowRanges& right) {
+  return left.size() == right.size() &&
+         std::equal(left.begin(), left.end(), right.begin(),
+                    [](const RowRange& l, const RowRange& r) {
+                      return l.first == r.first && l.last == r.last;
+                    });
+}
+
+}  // namespace
+
+int64_t PageSelection::num_rows() const {
+  int64_t out = 0;
+  for (const auto& range : rows) {
+    out += range.last - range.first;
+  }
+  return out;
+}
+
+PageSelection PageSelection::Make(
+    RowRanges rows, const std::unordered_map<int, const OffsetIndex*>& offset_indexes,
+    int64_t num_rows) {
+  PageSelection selection;
+  selection.rows = NormalizeRowRanges(std::move(rows), num_rows);
+
+  // Widening the rows to the pages of a column can make them span more pages
+  // of another column: repeat until the rows are whole pages of every column.
+  // This terminates as the rows only grow.
+  bool widened = true;
+  while (widened) {
+    widened = false;
+    for (const auto& column : offset_indexes) {
+      std::vector<int> pages;
+      RowRanges page_rows;
+      SelectPages(selection.rows, column.second->page_locations(), num_rows, &pages,
+                  &page_rows);
+      page_rows.insert(page_rows.end(), selection.rows.begin(), selection.rows.end());
+      page_rows = NormalizeRowRanges(std::move(page_rows), num_rows);
+      if (!RowRangesEqual(page_rows, selection.rows)) {
+        selection.rows = std::move(page_rows);
+        widened = true;
+      }
+    }
+  }
+
+  for (const auto& column : offset_indexes) {
+    std::vector<int> pages;
+    RowRanges page_rows;
+    SelectPages(selection.rows, column.second->page_locations(), num_rows, &pages,
+                &page_rows);
+    selection.data_pages[column.first] = std::move(pages);
+  }
+  return selection;
+}
+
+// ----------------------------------------------------------------------
+// ColumnPageIndexBuilder
+
+class ColumnPageIndexBuilder::ColumnPageIndexBuilderImpl {
+ public:
+  ColumnPageIndexBuilderImpl() : num_rows_(0), has_column_index_(true) {
+    // The bounds are not compared across pages
+    column_index_.__set_boundary_order(format::BoundaryOrder::UNORDERED);
+    column_index_.__isset.null_counts = true;
+  }
+
+  void AddPage(const EncodedStatistics& stats, int32_t num_values, int64_t offset,
+               int32_t page_size) {
+    format::PageLocation location;
+    location.__set_offset(offset);
+    location.__set_compressed_page_size(page_size);
+    location.__set_first_row_index(num_rows_);
+    offset_index_.page_locations.push_back(location);
+    // Pages of non-repeated columns hold exactly one value per row
+    num_rows_ += num_values;
+
+    if (!has_column_index_) {
+      return;
+    }
+    const bool has_min_max = stats.has_min && stats.has_max;
+    const bool null_page =
+        !has_min_max && stats.has_null_count && stats.null_count == num_values;
+    if (!has_min_max && !null_page) {
+      // A ColumnIndex must have valid bounds for every page holding values
+      has_column_index_ = false;
+      column_index_ = format::ColumnIndex();
+      return;
+    }
+    column_index_.null_pages.push_back(null_page);
+    column_index_.min_values.push_back(null_page ? "" : stats.min());
+    column_index_.max_values.push_back(null_page ? "" : stats.max());
+    if (stats.has_null_count) {
+      column_index_.null_counts.push_back(stats.null_count);
+    } else {
+      column_index_.__isset.null_counts = false;
+    }
+  }
+
+  void ShiftOffsets(int64_t final_position) {
+    for (auto& location : offset_index_.page_locations) {
+      location.offset += final_position;
+    }
+  }
+
+  bool has_column_index() const {
+    return has_column_index_ && !column_index_.null_pages.empty();
+  }
+
+  bool has_offset_index() const { return !offset_index_.page_locations.empty(); }
+
+  int64_t WriteColumnIndex(ArrowOutputStream* sink) const {
+    ThriftSerializer serializer;
+    return serializer.Serialize(&column_index_, sink);
+  }
+
+  int64_t WriteOffsetIndex(ArrowOutputStream* sink) const {
+    ThriftSerializer serializer;
+    return serializer.Serialize(&offset_index_, sink);
+  }
+
+ private:
+  int64_t num_rows_;
+  bool has_column_index_;
+  format::ColumnIndex column_index_;
+  format::OffsetIndex offset_index_;
+};
+
+ColumnPageIndexBuilder::ColumnPageIndexBuilder()
+    : impl_(new ColumnPageIndexBuilderImpl()) {}
+
+ColumnPageIndexBuilder::~ColumnPageIndexBuilder() {}
+
+void ColumnPageIndexBuilder::AddPage(const EncodedStatistics& stats, int32_t num_values,
+                                     int64_t offset, int32_t page_size) {
+  impl_->AddPage(stats, num_values, offset, page_size);
+}
+
+void ColumnPageIndexBuilder::ShiftOffsets(int64_t final_position) {
+  impl_->ShiftOffsets(final_position);
+}
+
+bool ColumnPageIndexBuilder::has_column_index() const {
+  return impl_->has_column_index();
+}
+
+bool ColumnPageIndexBuilder::has_offset_index() const {
+  return impl_->has_offset_index();
+}
+
+int64_t ColumnPageIndexBuilder::WriteColumnIndex(ArrowOutputStream* sink) const {
+  return impl_->WriteColumnIndex(sink);
+}
+
+int64_t ColumnPageIndexBuilder::WriteOffsetIndex(ArrowOutputStream* sink) const {
+  return impl_->WriteOffsetIndex(sink);
+}
+
+// ----------------------------------------------------------------------
+// PageIndexBuilder
+
+std::unique_ptr<PageIndexBuilder> PageIndexBuilder::Make(const SchemaDescriptor* schema) {
+  return std::unique_ptr<PageIndexBuilder>(new PageIndexBuilder(schema));
+}
+
+PageIndexBuilder::PageIndexBuilder(const SchemaDescriptor* schema) : schema_(schema) {}
+
+PageIndexBuilder::~PageIndexBuilder() {}
+
+void PageIndexBuilder::AppendRowGroup() {
+  std::vector<std::unique_ptr<ColumnPageIndexBuilder>> columns(schema_->num_columns());
+  for (int i = 0; i < schema_->num_columns(); ++i) {
+    if (schema_->Column(i)->max_repetition_level() == 0) {
+      columns[i].reset(new ColumnPageIndexBuilder());
+    }
+  }
+  row_groups_.push_back(std::move(columns));
+}
+
+ColumnPageIndexBuilder* PageIndexBuilder::GetColumnBuilder(int i) {
+  if (row_groups_.empty()) {
+    throw ParquetException("No row group was appended to the PageIndexBuilder");
+  }
+  return row_groups_.back()[i].get();
+}
+
+void PageIndexBuilder::WriteTo(ArrowOutputStream* sink,
+                               FileMetaDataBuilder* metadata) const {
+  const int num_row_groups = static_cast<int>(row_groups_.size());
+  for (int rg = 0; rg < num_row_groups; ++rg) {
+    for (int i = 0; i < schema_->num_columns(); ++i) {
+      const auto& builder = row_groups_[rg][i];
+      if (builder == nullptr || !builder->has_column_index()) {
+        continue;
+      }
+      PARQUET_ASSIGN_OR_THROW(int64_t offset, sink->Tell());
+      int64_t length = builder->WriteColumnIndex(sink);
+      metadata->SetColumnIndexLocation(rg, i, offset, static_cast<int32_t>(length));
+    }
+  }
+  for (int rg = 0; rg < num_row_groups; ++rg) {
+    for (int i = 0; i < schema_->num_columns(); ++i) {
+      const auto& builder = row_groups_[rg][i];
+      if (builder == nullptr || !builder->has_offset_index()) {
+        continue;
+      }
+      PARQUET_ASSIGN_OR_THROW(int64_t offset, sink->Tell());
+      int64_t length = builder->WriteOffsetIndex(sink);
+      metadata->SetOffsetIndexLocation(rg, i, offset, static_cast<int32_t>(length));
+    }
+  }
+}
+
+}  // namespace parquet
@@ -0,0 +1,230 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef PARQUET_PAGE_INDEX_H
+#define PARQUET_PAGE_INDEX_H
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "parquet/platform.h"
+#include "parquet/types.h"
+
+namespace parquet {
+
+class ColumnDescriptor;
+class EncodedStatistics;
+class FileMetaDataBuilder;
+class SchemaDescriptor;
+class Statistics;
+
+// ----------------------------------------------------------------------
+// Page index reader API
+//
+// The page index of a column chunk is made of an OffsetIndex, locating each
+// of its data pages in the file, and an optional ColumnIndex holding the
+// statistics of each of its data pages. Both are stored apart from the
+// column chunk, after the last row group, so that they can be read without
+// touching the pages themselves.
+
+/// \brief Location of a data page, as recorded in an OffsetIndex
+struct PARQUET_EXPORT PageLocation {
+  /// Offset of the page header in the file
+  int64_t offset;
+  /// Size of the page, including its header
+  int32_t compressed_page_size;
+  /// Index within the row group of the first row of the page
+  int64_t first_row_index;
+};
+
+class PARQUET_EXPORT OffsetIndex {
+ public:
+  /// \brief Deserialize an OffsetIndex
+  static std::unique_ptr<OffsetIndex> Make(const void* serialized_index,
+                                           uint32_t index_len);
+
+  virtual ~OffsetIndex() = default;
+
+  /// \brief The location of each data page, ordered by offset
+  virtual const std::vector<PageLocation>& page_locations() const = 0;
+};
+
+class PARQUET_EXPORT ColumnIndex {
+ public:
+  /// \brief Deserialize the ColumnIndex of the given column
+  static std::unique_ptr<ColumnIndex> Make(const ColumnDescriptor* descr,
+                                           const void* serialized_index,
+                                           uint32_t index_len);
+
+  virtual ~ColumnIndex() = default;
+
+  /// \brief For each data page, whether it only holds null values, in which
+  /// case it has no min and max values
+  virtual const std::vector<bool>& null_pages() const = 0;
+
+  /// \brief The plain-encoded min value of each data page
+  virtual const std::vector<std::string>& encoded_min_values() const = 0;
+
+  /// \brief The plain-encoded max value of each data page
+  virtual const std::vector<std::string>& encoded_max_values() const = 0;
+
+  /// \brief Whether the min and max values are ordered across pages
+  virtual BoundaryOrder::type boundary_order() const = 0;
+
+  virtual bool has_null_counts() const = 0;
+
+  /// \brief The number of null values of each data page, if has_null_counts()
+  virtual const std::vector<int64_t>& null_counts() const = 0;
+
+  /// \brief The statistics of data page i of a non-repeated column
+  ///
+  /// The number of rows of a page is not part of the ColumnIndex and must be
+  /// given by the caller, as derived from the OffsetIndex.
+  virtual std::shared_ptr<Statistics> page_statistics(int i, int64_t num_rows) const = 0;
+};
+
+/// \brief The page index of some column chunks of a file
+class PARQUET_EXPORT PageIndex {
+ public:
+  /// \brief The ColumnIndex of a column chunk, or null if it was not read
+  const ColumnIndex* GetColumnIndex(int row_group, int column) const;
+
+  /// \brief The OffsetIndex of a column chunk, or null if it was not read
+  const OffsetIndex* GetOffsetIndex(int row_group, int column) const;
+
+  void SetColumnIndex(int row_group, int column, std::unique_ptr<ColumnIndex> index);
+
+  void SetOffsetIndex(int row_group, int column, std::unique_ptr<OffsetIndex> index);
+
+ private:
+  std::map<std::pair<int, int>, std::unique_ptr<ColumnIndex>> column_indexes_;
+  std::map<std::pair<int, int>, std::unique_ptr<OffsetIndex>> offset_indexes_;
+};
+
+// ----------------------------------------------------------------------
+// Page selection
+
+/// \brief The rows [first, last) of a row group
+struct PARQUET_EXPORT RowRange {
+  int64_t first;
+  int64_t last;
+};
+
+/// \brief Sorted and disjoint ranges of rows of a row group
+using RowRanges = std::vector<RowRange>;
+
+/// \brief The data pages to read from the column chunks of a row group
+struct PARQUET_EXPORT PageSelection {
+  /// \brief The rows held by the selected pages, the same for every column
+  RowRanges rows;
+  /// \brief The ordinals of the selected data pages, by column index
+  std::unordered_map<int, std::vector<int>> data_pages;
+
+  /// \brief The number of rows held by the selected pages
+  int64_t num_rows() const;
+
+  /// \brief Select the data pages of some columns holding the given rows
+  ///
+  /// Pages are the unit of reading, and the pages of different columns do not
+  /// start at the same rows. The selected rows are widened until they are
+  /// made of whole pages of every column, so that reading the selected pages
+  /// of each column yields the same rows.
+  ///
+  /// \param[in] rows the rows to select
+  /// \param[in] offset_indexes the OffsetIndex of each column, by column index
+  /// \param[in] num_rows the number of rows of the row group
+  static PageSelection Make(
+      RowRanges rows, const std::unordered_map<int, const OffsetIndex*>& offset_indexes,
+      int64_t num_rows);
+};
+
+// ----------------------------------------------------------------------
+// Page index builder API
+
+/// \brief Collects the page index of a column chunk while its pages are written
+///
+/// A page index is only built for non-repeated columns, whose pages always
+/// start at a row boundary. The ColumnIndex is dropped if a data page is
+/// missing its min/max statistics (e.g. because statistics are disabled or
+/// exceed the maximum statistics size).
+class PARQUET_EXPORT ColumnPageIndexBuilder {
+ public:
+  ColumnPageIndexBuilder();
+  ~ColumnPageIndexBuilder();
+
+  /// \brief Record a data page
+  ///
+  /// \param[in] stats the statistics written in the page header
+  /// \param[in] num_values the number of values (and rows) of the page
+  /// \param[in] offset the position of the page header in the output
+  /// \param[in] page_size the size of the page, including its header
+  void AddPage(const EncodedStatistics& stats, int32_t num_values, int64_t offset,
+               int32_t page_size);
+
+  /// \brief Shift the offsets of all recorded pages, e.g. when the pages were
+  /// first written to a buffer which was then copied to the file at final_position
+  void ShiftOffsets(int64_t final_position);
+
+  bool has_column_index() const;
+
+  bool has_offset_index() const;
+
+  /// \brief Serialize the ColumnIndex, return the number of bytes written
+  int64_t WriteColumnIndex(ArrowOutputStream* sink) const;
+
+  /// \brief Serialize the OffsetIndex, return the number of bytes written
+  int64_t WriteOffsetIndex(ArrowOutputStream* sink) const;
+
+ private:
+  class ColumnPageIndexBuilderImpl;
+  std::unique_ptr<ColumnPageIndexBuilderImpl> impl_;
+};
+
+/// \brief Collects the page index of all column chunks of a file and writes
+/// it before the file footer
+class PARQUET_EXPORT PageIndexBuilder {
+ public:
+  static std::unique_ptr<PageIndexBuilder> Make(const SchemaDescriptor* schema);
+
+  ~PageIndexBuilder();
+
+  /// \brief Start collecting the page index of a new row group
+  void AppendRowGroup();
+
+  /// \brief The builder for column i of the current row group, or null if no
+  /// page index is built for that column
+  ColumnPageIndexBuilder* GetColumnBuilder(int i);
+
+  /// \brief Write all ColumnIndex then all OffsetIndex structures to sink and
+  /// record their locations in the file metadata
+  void WriteTo(ArrowOutputStream* sink, FileMetaDataBuilder* metadata) const;
+
+ private:
+  explicit PageIndexBuilder(const SchemaDescriptor* schema);
+
+  const SchemaDescriptor* schema_;
+  std::vector<std::vector<std::unique_ptr<ColumnPageIndexBuilder>>> row_groups_;
+};
+
+}  // namespace parquet
+
+#endif  // PARQUET_PAGE_INDEX_H
@@ -0,0 +1,342 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "arrow/io/memory.h"
+
+#include "parquet/column_reader.h"
+#include "parquet/column_writer.h"
+#include "parquet/file_reader.h"
+#include "parquet/file_writer.h"
+#include "parquet/metadata.h"
+#include "parquet/page_index.h"
+#include "parquet/platform.h"
+#include "parquet/schema.h"
+#include "parquet/statistics.h"
+#include "parquet/test_util.h"
+
+namespace parquet {
+
+using schema::GroupNode;
+using schema::PrimitiveNode;
+
+namespace test {
+
+// Every tenth value is null, values of the second half of a row group are
+// all null so that its last pages are null pages.
+class TestPageIndex : public ::testing::Test {
+ public:
+  void SetUp() override {
+    num_rows_ = 1000;
+    auto field = PrimitiveNode::Make("a", Repetition::OPTIONAL, Type::INT64);
+    schema_ = std::static_pointer_cast<GroupNode>(
+        GroupNode::Make("schema", Repetition::REQUIRED, {field}));
+    for (int64_t i = 0; i < num_rows_; ++i) {
+      const bool is_null = i % 10 == 0 || i >= num_rows_ / 2;
+      def_levels_.push_back(is_null ? 0 : 1);
+      if (!is_null) {
+        values_.push_back(i);
+      }
+    }
+  }
+
+  std::shared_ptr<WriterProperties> Properties(bool write_page_index) {
+    WriterProperties::Builder builder;
+    // Small pages so that each column chunk spans many of them
+    builder.data_pagesize(64)->write_batch_size(16)->disable_dictionary();
+    if (write_page_index) {
+      builder.enable_write_page_index();
+    }
+    return builder.build();
+  }
+
+  std::shared_ptr<Buffer> WriteFile(bool write_page_index, bool buffered) {
+    auto sink = CreateOutputStream();
+    auto file_writer =
+        ParquetFileWriter::Open(sink, schema_, Properties(write_page_index));
+    for (int rg = 0; rg < 2; ++rg) {
+      RowGroupWriter* row_group_writer = buffered ? file_writer->AppendBufferedRowGroup()
+                                                  : file_writer->AppendRowGroup();
+      auto column_writer = static_cast<Int64Writer*>(
+          buffered ? row_group_writer->column(0) : row_group_writer->NextColumn());
+      column_writer->WriteBatch(num_rows_, def_levels_.data(), nullptr, values_.data());
+      row_group_writer->Close();
+    }
+    file_writer->Close();
+    PARQUET_ASSIGN_OR_THROW(auto buffer, sink->Finish());
+    return buffer;
+  }
+
+  std::unique_ptr<ParquetFileReader> OpenFile(const std::shared_ptr<Buffer>& buffer) {
+    return ParquetFileReader::Open(std::make_shared<::arrow::io::BufferReader>(buffer));
+  }
+
+  // Read all values of a column reader, with nulls as -1
+  std::vector<int64_t> ReadAll(ColumnReader* reader) {
+    auto int64_reader = static_cast<Int64Reader*>(reader);
+    std::vector<int64_t> out;
+    std::vector<int16_t> def_levels(num_rows_);
+    std::vector<int64_t> values(num_rows_);
+    while (int64_reader->HasNext()) {
+      int64_t values_read = 0;
+      int64_t levels_read =
+          int64_reader->ReadBatch(num_rows_, def_levels.data(), nullptr, values.data(),
+                                  &values_read);
+      int64_t value = 0;
+      for (int64_t i = 0; i < levels_read; ++i) {
+        out.push_back(def_levels[i] == 1 ? values[value++] : -1);
+      }
+    }
+    return out;
+  }
+
+  void CheckPageIndex(const std::shared_ptr<Buffer>& buffer) {
+    auto file_reader = OpenFile(buffer);
+    auto metadata = file_reader->metadata();
+    for (int rg = 0; rg < metadata->num_row_groups(); ++rg) {
+      auto column_chunk = metadata->RowGroup(rg)->ColumnChunk(0);
+      ASSERT_TRUE(column_chunk->has_column_index());
+      ASSERT_TRUE(column_chunk->has_offset_index());
+
+      auto row_group_reader = file_reader->RowGroup(rg);
+      auto offset_index = row_group_reader->GetOffsetIndex(0);
+      auto column_index = row_group_reader->GetColumnIndex(0);
+      ASSERT_NE(offset_index, nullptr);
+      ASSERT_NE(column_index, nullptr);
+
+      const auto& locations = offset_index->page_locations();
+      const size_t num_pages = locations.size();
+      ASSERT_GT(num_pages, 2);
+      ASSERT_EQ(column_index->null_pages().size(), num_pages);
+      ASSERT_TRUE(column_index->has_null_counts());
+      ASSERT_EQ(locations[0].first_row_index, 0);
+      ASSERT_GE(locations[0].offset, column_chunk->data_page_offset());
+      for (size_t i = 1; i < num_pages; ++i) {
+        ASSERT_EQ(locations[i].offset,
+                  locations[i - 1].offset + locations[i - 1].compressed_page_size);
+        ASSERT_GT(locations[i].first_row_index, locations[i - 1].first_row_index);
+      }
+
+      // Check the statistics of each page against the values written
+      for (size_t i = 0; i < num_pages; ++i) {
+        const int64_t first_row = locations[i].first_row_index;
+        const int64_t end_row =
+            i + 1 < num_pages ? locations[i + 1].first_row_index : num_rows_;
+        int64_t expected_nulls = 0;
+        int64_t expected_min = std::numeric_limits<int64_t>::max();
+        int64_t expected_max = std::numeric_limits<int64_t>::min();
+        for (int64_t row = first_row; row < end_row; ++row) {
+          if (def_levels_[row] == 0) {
+            ++expected_nulls;
+          } else {
+            expected_min = std::min(expected_min, row);
+            expected_max = std::max(expected_max, row);
+          }
+        }
+        ASSERT_EQ(column_index->null_counts()[i], expected_nulls);
+        ASSERT_EQ(column_index->null_pages()[i], expected_nulls == end_row - first_row);
+
+        auto stats = std::static_pointer_cast<Int64Statistics>(
+            column_index->page_statistics(static_cast<int>(i), end_row - first_row));
+        ASSERT_EQ(stats->null_count(), expected_nulls);
+        if (!column_index->null_pages()[i]) {
+          ASSERT_TRUE(stats->HasMinMax());
+          ASSERT_EQ(stats->min(), expected_min);
+          ASSERT_EQ(stats->max(), expected_max);
+        }
+      }
+    }
+  }
+
+ protected:
+  int64_t num_rows_;
+  std::shared_ptr<GroupNode> schema_;
+  std::vector<int16_t> def_levels_;
+  std::vector<int64_t> values_;
+};
+
+TEST_F(TestPageIndex, WriteAndRead) {
+  ASSERT_NO_FATAL_FAILURE(
+      CheckPageIndex(WriteFile(/*write_page_index=*/true, /*buffered=*/false)));
+}
+
+TEST_F(TestPageIndex, WriteAndReadBufferedRowGroup) {
+  ASSERT_NO_FATAL_FAILURE(
+      CheckPageIndex(WriteFile(/*write_page_index=*/true, /*buffered=*/true)));
+}
+
+TEST_F(TestPageIndex, NotWrittenByDefault) {
+  auto file_reader = OpenFile(WriteFile(/*write_page_index=*/false, /*buffered=*/false));
+  auto column_chunk = file_reader->metadata()->RowGroup(0)->ColumnChunk(0);
+  ASSERT_FALSE(column_chunk->has_column_index());
+  ASSERT_FALSE(column_chunk->has_offset_index());
+  auto row_group_reader = file_reader->RowGroup(0);
+  ASSERT_EQ(row_group_reader->GetColumnIndex(0), nullptr);
+  ASSERT_EQ(row_group_reader->GetOffsetIndex(0), nullptr);
+  ASSERT_THROW(row_group_reader->Column(0, {0}), ParquetException);
+}
+
+TEST_F(TestPageIndex, ReadSelectedPages) {
+  auto file_reader = OpenFile(WriteFile(/*write_page_index=*/true, /*buffered=*/false));
+  auto row_group_reader = file_reader->RowGroup(1);
+  auto offset_index = row_group_reader->GetOffsetIndex(0);
+  const auto& locations = offset_index->page_locations();
+  const int num_pages = static_cast<int>(locations.size());
+
+  // The first page, two adjacent pages and the last page
+  std::vector<int> pages = {0, 2, 3, num_pages - 1};
+  std::vector<int64_t> expected;
+  for (int page : pages) {
+    const int64_t end_row =
+        page + 1 < num_pages ? locations[page + 1].first_row_index : num_rows_;
+    for (int64_t row = locations[page].first_row_index; row < end_row; ++row) {
+      expected.push_back(def_levels_[row] == 1 ? row : -1);
+    }
+  }
+  ASSERT_EQ(ReadAll(row_group_reader->Column(0, pages).get()), expected);
+
+  // All pages
+  std::vector<int> all_pages;
+  for (int page = 0; page < num_pages; ++page) {
+    all_pages.push_back(page);
+  }
+  ASSERT_EQ(ReadAll(row_group_reader->Column(0, all_pages).get()),
+            ReadAll(row_group_reader->Column(0).get()));
+}
+
+TEST_F(TestPageIndex, InvalidPageSelection) {
+  auto file_reader = OpenFile(WriteFile(/*write_page_index=*/true, /*buffered=*/false));
+  auto row_group_reader = file_reader->RowGroup(0);
+  const int num_pages =
+      static_cast<int>(row_group_reader->GetOffsetIndex(0)->page_locations().size());
+  ASSERT_THROW(row_group_reader->Column(0, {num_pages}), ParquetException);
+  ASSERT_THROW(row_group_reader->Column(0, {-1}), ParquetException);
+  ASSERT_THROW(row_group_reader->Column(0, {2, 1}), ParquetException);
+  ASSERT_THROW(row_group_reader->Column(0, {1, 1}), ParquetException);
+}
+
+TEST_F(TestPageIndex, ReadPageIndex) {
+  auto file_reader = OpenFile(WriteFile(/*write_page_index=*/true, /*buffered=*/false));
+  auto page_index = file_reader->ReadPageIndex({1}, {0});
+  ASSERT_EQ(page_index->GetColumnIndex(0, 0), nullptr);
+  ASSERT_EQ(page_index->GetOffsetIndex(0, 0), nullptr);
+  const ColumnIndex* column_index = page_index->GetColumnIndex(1, 0);
+  const OffsetIndex* offset_index = page_index->GetOffsetIndex(1, 0);
+  ASSERT_NE(column_index, nullptr);
+  ASSERT_NE(offset_index, nullptr);
+
+  auto row_group_reader = file_reader->RowGroup(1);
+  auto expected_column_index = row_group_reader->GetColumnIndex(0);
+  auto expected_offset_index = row_group_reader->GetOffsetIndex(0);
+  ASSERT_EQ(column_index->null_pages(), expected_column_index->null_pages());
+  ASSERT_EQ(column_index->encoded_min_values(),
+            expected_column_index->encoded_min_values());
+  ASSERT_EQ(column_index->encoded_max_values(),
+            expected_column_index->encoded_max_values());
+  const auto& locations = offset_index->page_locations();
+  const auto& expected_locations = expected_offset_index->page_locations();
+  ASSERT_EQ(locations.size(), expected_locations.size());
+  for (size_t i = 0; i < locations.size(); ++i) {
+    ASSERT_EQ(locations[i].offset, expected_locations[i].offset);
+    ASSERT_EQ(locations[i].first_row_index, expected_locations[i].first_row_index);
+  }
+
+  // Without a page index
+  file_reader = OpenFile(WriteFile(/*write_page_index=*/false, /*buffered=*/false));
+  page_index = file_reader->ReadPageIndex({0, 1}, {0});
+  ASSERT_EQ(page_index->GetColumnIndex(0, 0), nullptr);
+  ASSERT_EQ(page_index->GetOffsetIndex(1, 0), nullptr);
+}
+
+// An OffsetIndex of pages starting at the given rows
+class MockOffsetIndex : public OffsetIndex {
+ public:
+  explicit MockOffsetIndex(const std::vector<int64_t>& first_rows) {
+    for (int64_t first_row : first_rows) {
+      page_locations_.push_back({first_row * 100, 100, first_row});
+    }
+  }
+
+  const std::vector<PageLocation>& page_locations() const override {
+    return page_locations_;
+  }
+
+ private:
+  std::vector<PageLocation> page_locations_;
+};
+
+void AssertRowRanges(const RowRanges& actual, const RowRanges& expected) {
+  ASSERT_EQ(actual.size(), expected.size());
+  for (size_t i = 0; i < actual.size(); ++i) {
+    ASSERT_EQ(actual[i].first, expected[i].first);
+    ASSERT_EQ(actual[i].last, expected[i].last);
+  }
+}
+
+TEST(TestPageSelection, SingleColumn) {
+  MockOffsetIndex offset_index({0, 10, 20, 30});
+  std::unordered_map<int, const OffsetIndex*> offset_indexes = {{0, &offset_index}};
+
+  auto selection = PageSelection::Make({{12, 13}}, offset_indexes, 40);
+  AssertRowRanges(selection.rows, {{10, 20}});
+  ASSERT_EQ(selection.num_rows(), 10);
+  ASSERT_EQ(selection.data_pages[0], std::vector<int>({1}));
+
+  // Unsorted, overlapping and out of bounds ranges
+  selection = PageSelection::Make({{35, 50}, {5, 12}, {11, 15}}, offset_indexes, 40);
+  AssertRowRanges(selection.rows, {{0, 20}, {30, 40}});
+  ASSERT_EQ(selection.data_pages[0], std::vector<int>({0, 1, 3}));
+
+  selection = PageSelection::Make({}, offset_indexes, 40);
+  ASSERT_EQ(selection.num_rows(), 0);
+  ASSERT_EQ(selection.data_pages[0], std::vector<int>());
+}
+
+TEST(TestPageSelection, RowsAlignedAcrossColumns) {
+  // The pages of the columns start at different rows
+  MockOffsetIndex a({0, 10, 20, 30, 40});
+  MockOffsetIndex b({0, 20, 40});
+  MockOffsetIndex c({0, 10, 25, 40});
+  std::unordered_map<int, const OffsetIndex*> offset_indexes = {
+      {0, &a}, {1, &b}, {2, &c}};
+
+  // Row 12 is in a[1], b[0] and c[1], then c[1] spans a[2] and b[1], which
+  // spans a[3] and c[2]
+  auto selection = PageSelection::Make({{12, 13}}, offset_indexes, 50);
+  AssertRowRanges(selection.rows, {{0, 40}});
+  ASSERT_EQ(selection.data_pages[0], std::vector<int>({0, 1, 2, 3}));
+  ASSERT_EQ(selection.data_pages[1], std::vector<int>({0, 1}));
+  ASSERT_EQ(selection.data_pages[2], std::vector<int>({0, 1, 2}));
+
+  // The last pages of all columns start at row 40
+  selection = PageSelection::Make({{41, 42}}, offset_indexes, 50);
+  AssertRowRanges(selection.rows, {{40, 50}});
+  ASSERT_EQ(selection.data_pages[0], std::vector<int>({4}));
+  ASSERT_EQ(selection.data_pages[1], std::vector<int>({2}));
+  ASSERT_EQ(selection.data_pages[2], std::vector<int>({3}));
+}
+
+}  // namespace test
+}  // namespace parquet
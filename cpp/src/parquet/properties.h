@@ -24,6 +24,7 @@
 #include <unordered_set>
 #include <utility>
 
+#include "arrow/io/caching.h"
 #include "arrow/type.h"
 #include "arrow/util/compression.h"
 #include "parquet/encryption.h"
@@ -95,6 +96,16 @@ static constexpr ParquetVersion::type DEFAULT_WRITER_VERSION =
 static const char DEFAULT_CREATED_BY[] = CREATED_BY_VERSION;
 static constexpr Compression::type DEFAULT_COMPRESSION_TYPE = Compression::UNCOMPRESSED;
 
+/// \brief The options of the Bloom filter written for the column chunks of a
+/// column, see parquet/bloom_filter.h
+struct BloomFilterOptions {
+  /// The expected number of distinct values in a column chunk, which sizes the
+  /// filter together with fpp
+  int32_t ndv = 1 << 20;
+  /// The false positive probability for that number of distinct values
+  double fpp = 0.05;
+};
+
 class PARQUET_EXPORT ColumnProperties {
  public:
   ColumnProperties(Encoding::type encoding = DEFAULT_ENCODING,
@@ -129,6 +140,15 @@ class PARQUET_EXPORT ColumnProperties {
     compression_level_ = compression_level;
   }
 
+  void set_bloom_filter_options(const BloomFilterOptions& bloom_filter_options) {
+    bloom_filter_enabled_ = true;
+    bloom_filter_options_ = bloom_filter_options;
+  }
+
+  void set_bloom_filter_enabled(bool bloom_filter_enabled) {
+    bloom_filter_enabled_ = bloom_filter_enabled;
+  }
+
   Encoding::type encoding() const { return encoding_; }
 
   Compression::type compression() const { return codec_; }
@@ -141,6 +161,12 @@ class PARQUET_EXPORT ColumnProperties {
 
   int compression_level() const { return compression_level_; }
 
+  bool bloom_filter_enabled() const { return bloom_filter_enabled_; }
+
+  const BloomFilterOptions& bloom_filter_options() const {
+    return bloom_filter_options_;
+  }
+
  private:
   Encoding::type encoding_;
   Compression::type codec_;
@@ -148,6 +174,8 @@ class PARQUET_EXPORT ColumnProperties {
   bool statistics_enabled_;
   size_t max_stats_size_;
   int compression_level_;
+  bool bloom_filter_enabled_ = false;
+  BloomFilterOptions bloom_filter_options_;
 };
 
 class PARQUET_EXPORT WriterProperties {
@@ -161,7 +189,8 @@ class PARQUET_EXPORT WriterProperties {
           max_row_group_length_(DEFAULT_MAX_ROW_GROUP_LENGTH),
           pagesize_(kDefaultDataPageSize),
           version_(DEFAULT_WRITER_VERSION),
-          created_by_(DEFAULT_CREATED_BY) {}
+          created_by_(DEFAULT_CREATED_BY),
+          write_page_index_(false) {}
     virtual ~Builder() {}
 
     Builder* memory_pool(MemoryPool* pool) {
@@ -373,6 +402,43 @@ class PARQUET_EXPORT WriterProperties {
       return this->disable_statistics(path->ToDotString());
     }
 
+    /// Write a Bloom filter of the values of each column chunk of a column,
+    /// which lets readers skip the column chunks (and their row groups) not
+    /// holding a given value. Filters are not written for BOOLEAN columns and
+    /// encrypted files.
+    Builder* enable_bloom_filter(const std::string& path,
+                                 const BloomFilterOptions& options = {}) {
+      bloom_filter_options_[path] = options;
+      return this;
+    }
+
+    Builder* enable_bloom_filter(const std::shared_ptr<schema::ColumnPath>& path,
+                                 const BloomFilterOptions& options = {}) {
+      return this->enable_bloom_filter(path->ToDotString(), options);
+    }
+
+    Builder* disable_bloom_filter(const std::string& path) {
+      bloom_filter_options_.erase(path);
+      return this;
+    }
+
+    Builder* disable_bloom_filter(const std::shared_ptr<schema::ColumnPath>& path) {
+      return this->disable_bloom_filter(path->ToDotString());
+    }
+
+    /// Write the page index (ColumnIndex and OffsetIndex) of the column
+    /// chunks, which lets readers locate and skip individual data pages. It is
+    /// only written for non-repeated columns and unencrypted files.
+    Builder* enable_write_page_index() {
+      write_page_index_ = true;
+      return this;
+    }
+
+    Builder* disable_write_page_index() {
+      write_page_index_ = false;
+      return this;
+    }
+
     std::shared_ptr<WriterProperties> build() {
       std::unordered_map<std::string, ColumnProperties> column_properties;
       auto get = [&](const std::string& key) -> ColumnProperties& {
@@ -391,11 +457,13 @@ class PARQUET_EXPORT WriterProperties {
         get(item.first).set_dictionary_enabled(item.second);
       for (const auto& item : statistics_enabled_)
         get(item.first).set_statistics_enabled(item.second);
+      for (const auto& item : bloom_filter_options_)
+        get(item.first).set_bloom_filter_options(item.second);
 
       return std::shared_ptr<WriterProperties>(new WriterProperties(
           pool_, dictionary_pagesize_limit_, write_batch_size_, max_row_group_length_,
           pagesize_, version_, created_by_, std::move(file_encryption_properties_),
-          default_column_properties_, column_properties));
+          default_column_properties_, column_properties, write_page_index_));
     }
 
    private:
@@ -406,6 +474,7 @@ class PARQUET_EXPORT WriterProperties {
     int64_t pagesize_;
     ParquetVersion::type version_;
     std::string created_by_;
+    bool write_page_index_;
 
     std::shared_ptr<FileEncryptionProperties> file_encryption_properties_;
 
@@ -416,6 +485,7 @@ class PARQUET_EXPORT WriterProperties {
     std::unordered_map<std::string, int32_t> codecs_compression_level_;
     std::unordered_map<std::string, bool> dictionary_enabled_;
     std::unordered_map<std::string, bool> statistics_enabled_;
+    std::unordered_map<std::string, BloomFilterOptions> bloom_filter_options_;
   };
 
   inline MemoryPool* memory_pool() const { return pool_; }
@@ -432,6 +502,8 @@ class PARQUET_EXPORT WriterProperties {
 
   inline std::string created_by() const { return parquet_created_by_; }
 
+  inline bool write_page_index() const { return write_page_index_; }
+
   inline Encoding::type dictionary_index_encoding() const {
     if (parquet_version_ == ParquetVersion::PARQUET_1_0) {
       return Encoding::PLAIN_DICTIONARY;
@@ -479,6 +551,23 @@ class PARQUET_EXPORT WriterProperties {
     return column_properties(path).max_statistics_size();
   }
 
+  bool bloom_filter_enabled(const std::shared_ptr<schema::ColumnPath>& path) const {
+    return column_properties(path).bloom_filter_enabled();
+  }
+
+  const BloomFilterOptions& bloom_filter_options(
+      const std::shared_ptr<schema::ColumnPath>& path) const {
+    return column_properties(path).bloom_filter_options();
+  }
+
+  /// Whether a Bloom filter is written for any column
+  bool bloom_filter_enabled() const {
+    for (const auto& item : column_properties_) {
+      if (item.second.bloom_filter_enabled()) return true;
+    }
+    return false;
+  }
+
   inline FileEncryptionProperties* file_encryption_properties() const {
     return file_encryption_properties_.get();
   }
@@ -499,7 +588,8 @@ class PARQUET_EXPORT WriterProperties {
       const std::string& created_by,
       std::shared_ptr<FileEncryptionProperties> file_encryption_properties,
       const ColumnProperties& default_column_properties,
-      const std::unordered_map<std::string, ColumnProperties>& column_properties)
+      const std::unordered_map<std::string, ColumnProperties>& column_properties,
+      bool write_page_index)
       : pool_(pool),
         dictionary_pagesize_limit_(dictionary_pagesize_limit),
         write_batch_size_(write_batch_size),
@@ -509,7 +599,8 @@ class PARQUET_EXPORT WriterProperties {
         parquet_created_by_(created_by),
         file_encryption_properties_(file_encryption_properties),
         default_column_properties_(default_column_properties),
-        column_properties_(column_properties) {}
+        column_properties_(column_properties),
+        write_page_index_(write_page_index) {}
 
   MemoryPool* pool_;
   int64_t dictionary_pagesize_limit_;
@@ -523,6 +614,7 @@ class PARQUET_EXPORT WriterProperties {
 
   ColumnProperties default_column_properties_;
   std::unordered_map<std::string, ColumnProperties> column_properties_;
+  bool write_page_index_;
 };
 
 PARQUET_EXPORT const std::shared_ptr<WriterProperties>& default_writer_properties();
@@ -535,13 +627,20 @@ static constexpr bool kArrowDefaultUseThreads = false;
 // Default number of rows to read when using ::arrow::RecordBatchReader
 static constexpr int64_t kArrowDefaultBatchSize = 64 * 1024;
 
+// Default size limits of the RowGroups written with FileWriter::WriteRecordBatch
+static constexpr int64_t kArrowDefaultTargetRowGroupBytes = 128 * 1024 * 1024;
+static constexpr int64_t kArrowDefaultMaxBufferedBytes = 256 * 1024 * 1024;
+
 /// EXPERIMENTAL: Properties for configuring FileReader behavior.
 class PARQUET_EXPORT ArrowReaderProperties {
  public:
   explicit ArrowReaderProperties(bool use_threads = kArrowDefaultUseThreads)
       : use_threads_(use_threads),
         read_dict_indices_(),
-        batch_size_(kArrowDefaultBatchSize) {}
+        unify_dictionaries_(false),
+        batch_size_(kArrowDefaultBatchSize),
+        pre_buffer_(false),
+        cache_options_(::arrow::io::CacheOptions::Defaults()) {}
 
   void set_use_threads(bool use_threads) { use_threads_ = use_threads; }
 
@@ -562,14 +661,56 @@ class PARQUET_EXPORT ArrowReaderProperties {
     }
   }
 
+  /// Unify the dictionaries of the columns read as dictionaries.
+  ///
+  /// When enabled, the BYTE_ARRAY columns set with set_read_dictionary are
+  /// read with a single dictionary accumulating the values of the dictionary
+  /// pages of all the row groups read, the indices of each dictionary page
+  /// being remapped to it, rather than with a dictionary per row group. The
+  /// chunks read together share a dictionary, and the dictionaries of the
+  /// batches of a RecordBatchReader are each a prefix of the next one. The
+  /// indices of a dictionary page identical to the previous one are appended
+  /// with the same mapping, without unifying its values again.
+  void set_unify_dictionaries(bool unify_dictionaries) {
+    unify_dictionaries_ = unify_dictionaries;
+  }
+
+  bool unify_dictionaries() const { return unify_dictionaries_; }
+
   void set_batch_size(int64_t batch_size) { batch_size_ = batch_size; }
 
   int64_t batch_size() const { return batch_size_; }
 
+  /// Enable read coalescing.
+  ///
+  /// When enabled, the Arrow reader will pre-buffer the column chunks of the
+  /// row groups and columns it is asked to read, in a few large concurrent
+  /// requests (see ParquetFileReader::PreBuffer). This is intended for
+  /// high-latency filesystems such as S3, where issuing one request per
+  /// column chunk is latency-bound.
+  ///
+  /// The pre-buffered column chunks are held in memory, in their encoded and
+  /// compressed form, until they are decoded. FileReader::ReadTable and
+  /// ReadRowGroups pre-buffer all the row groups they read at once, while a
+  /// RecordBatchReader pre-buffers one row group ahead of the row group being
+  /// decoded, so holds the column chunks of about two row groups at a time.
+  void set_pre_buffer(bool pre_buffer) { pre_buffer_ = pre_buffer; }
+
+  bool pre_buffer() const { return pre_buffer_; }
+
+  /// Set options for read coalescing. This can be used to tune the
+  /// implementation for characteristics of different filesystems.
+  void set_cache_options(::arrow::io::CacheOptions options) { cache_options_ = options; }
+
+  const ::arrow::io::CacheOptions& cache_options() const { return cache_options_; }
+
  private:
   bool use_threads_;
   std::unordered_set<int> read_dict_indices_;
+  bool unify_dictionaries_;
   int64_t batch_size_;
+  bool pre_buffer_;
+  ::arrow::io::CacheOptions cache_options_;
 };
 
 /// EXPERIMENTAL: Constructs the default ArrowReaderProperties
@@ -587,7 +728,10 @@ class PARQUET_EXPORT ArrowWriterProperties {
           truncated_timestamps_allowed_(false),
           store_schema_(false),
           // TODO: At some point we should flip this.
-          compliant_nested_types_(false) {}
+          compliant_nested_types_(false),
+          use_threads_(kArrowDefaultUseThreads),
+          target_row_group_bytes_(kArrowDefaultTargetRowGroupBytes),
+          max_buffered_bytes_(kArrowDefaultMaxBufferedBytes) {}
     virtual ~Builder() {}
 
     Builder* disable_deprecated_int96_timestamps() {
@@ -634,10 +778,32 @@ class PARQUET_EXPORT ArrowWriterProperties {
       return this;
     }
 
+    /// \brief Set whether to encode and compress the column chunks of a
+    /// RowGroup in parallel, see ArrowWriterProperties::use_threads()
+    Builder* set_use_threads(bool use_threads) {
+      use_threads_ = use_threads;
+      return this;
+    }
+
+    /// \brief Set the encoded size at which FileWriter::WriteRecordBatch
+    /// closes a RowGroup, see ArrowWriterProperties::target_row_group_bytes()
+    Builder* set_target_row_group_bytes(int64_t target_row_group_bytes) {
+      target_row_group_bytes_ = target_row_group_bytes;
+      return this;
+    }
+
+    /// \brief Set the bound of the memory buffered by
+    /// FileWriter::WriteRecordBatch, see ArrowWriterProperties::max_buffered_bytes()
+    Builder* set_max_buffered_bytes(int64_t max_buffered_bytes) {
+      max_buffered_bytes_ = max_buffered_bytes;
+      return this;
+    }
+
     std::shared_ptr<ArrowWriterProperties> build() {
       return std::shared_ptr<ArrowWriterProperties>(new ArrowWriterProperties(
           write_timestamps_as_int96_, coerce_timestamps_enabled_, coerce_timestamps_unit_,
-          truncated_timestamps_allowed_, store_schema_, compliant_nested_types_));
+          truncated_timestamps_allowed_, store_schema_, compliant_nested_types_,
+          use_threads_, target_row_group_bytes_, max_buffered_bytes_));
     }
 
    private:
@@ -649,6 +815,9 @@ class PARQUET_EXPORT ArrowWriterProperties {
 
     bool store_schema_;
     bool compliant_nested_types_;
+    bool use_threads_;
+    int64_t target_row_group_bytes_;
+    int64_t max_buffered_bytes_;
   };
 
   bool support_deprecated_int96_timestamps() const { return write_timestamps_as_int96_; }
@@ -669,18 +838,49 @@ class PARQUET_EXPORT ArrowWriterProperties {
   /// "element".
   bool compliant_nested_types() const { return compliant_nested_types_; }
 
+  /// \brief Whether FileWriter::WriteTable encodes and compresses the column
+  /// chunks of a RowGroup in parallel on the CPU thread pool.
+  ///
+  /// The pages of each column chunk are buffered in memory until all columns
+  /// of the RowGroup are encoded, then written in schema order. Files with
+  /// encrypted columns are always written serially.
+  bool use_threads() const { return use_threads_; }
+
+  /// \brief The estimated encoded size at which FileWriter::WriteRecordBatch
+  /// closes the RowGroup being written.
+  ///
+  /// The RowGroup holds the encoded pages of the batches written since it was
+  /// started, which are written to the sink when it is closed. Batches are
+  /// written in slices sized from the average encoded size of a row so far, so
+  /// that RowGroups come out close to this size whatever the size of the batches.
+  int64_t target_row_group_bytes() const { return target_row_group_bytes_; }
+
+  /// \brief The bound of the memory held by the RowGroup being written by
+  /// FileWriter::WriteRecordBatch.
+  ///
+  /// Unlike target_row_group_bytes(), which may be overshot by the last slice
+  /// written to a RowGroup, the RowGroup is closed before writing a slice whose
+  /// estimated size would take it past this bound. The memory also counts the
+  /// dictionaries of the dictionary-encoded columns.
+  int64_t max_buffered_bytes() const { return max_buffered_bytes_; }
+
  private:
   explicit ArrowWriterProperties(bool write_nanos_as_int96,
                                  bool coerce_timestamps_enabled,
                                  ::arrow::TimeUnit::type coerce_timestamps_unit,
                                  bool truncated_timestamps_allowed, bool store_schema,
-                                 bool compliant_nested_types)
+                                 bool compliant_nested_types, bool use_threads,
+                                 int64_t target_row_group_bytes,
+                                 int64_t max_buffered_bytes)
       : write_timestamps_as_int96_(write_nanos_as_int96),
         coerce_timestamps_enabled_(coerce_timestamps_enabled),
         coerce_timestamps_unit_(coerce_timestamps_unit),
         truncated_timestamps_allowed_(truncated_timestamps_allowed),
         store_schema_(store_schema),
-        compliant_nested_types_(compliant_nested_types) {}
+        compliant_nested_types_(compliant_nested_types),
+        use_threads_(use_threads),
+        target_row_group_bytes_(target_row_group_bytes),
+        max_buffered_bytes_(max_buffered_bytes) {}
 
   const bool write_timestamps_as_int96_;
   const bool coerce_timestamps_enabled_;
@@ -688,6 +888,9 @@ class PARQUET_EXPORT ArrowWriterProperties {
   const bool truncated_timestamps_allowed_;
   const bool store_schema_;
   const bool compliant_nested_types_;
+  const bool use_threads_;
+  const int64_t target_row_group_bytes_;
+  const int64_t max_buffered_bytes_;
 };
 
 /// \brief State object used for writing Arrow data directly to a Parquet
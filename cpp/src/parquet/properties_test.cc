@@ -65,6 +65,35 @@ TEST(TestWriterProperties, AdvancedHandling) {
             props->encoding(ColumnPath::FromDotString("delta-length")));
 }
 
+TEST(TestWriterProperties, BloomFilter) {
+  WriterProperties::Builder builder;
+  BloomFilterOptions options;
+  options.ndv = 1000;
+  options.fpp = 0.01;
+  builder.enable_bloom_filter("with-options", options);
+  builder.enable_bloom_filter("default");
+  builder.enable_bloom_filter("disabled");
+  builder.disable_bloom_filter("disabled");
+  std::shared_ptr<WriterProperties> props = builder.build();
+
+  ASSERT_TRUE(props->bloom_filter_enabled());
+  ASSERT_TRUE(props->bloom_filter_enabled(ColumnPath::FromDotString("with-options")));
+  ASSERT_TRUE(props->bloom_filter_enabled(ColumnPath::FromDotString("default")));
+  ASSERT_FALSE(props->bloom_filter_enabled(ColumnPath::FromDotString("disabled")));
+  ASSERT_FALSE(props->bloom_filter_enabled(ColumnPath::FromDotString("other")));
+
+  const auto& with_options =
+      props->bloom_filter_options(ColumnPath::FromDotString("with-options"));
+  ASSERT_EQ(1000, with_options.ndv);
+  ASSERT_EQ(0.01, with_options.fpp);
+  const auto& defaults =
+      props->bloom_filter_options(ColumnPath::FromDotString("default"));
+  ASSERT_EQ(BloomFilterOptions().ndv, defaults.ndv);
+  ASSERT_EQ(BloomFilterOptions().fpp, defaults.fpp);
+
+  ASSERT_FALSE(WriterProperties::Builder().build()->bloom_filter_enabled());
+}
+
 TEST(TestReaderProperties, GetStreamInsufficientData) {
   // ARROW-6058
   std::string data = "shorter than expected";